@@ -112,6 +112,7 @@ enum ParameterId_t : uint16_t
     PID_STATUS_INFO = 0x0071,
     PID_TYPE_OBJECTV1 = 0x0072,
     PID_ENDPOINT_GUID = 0x005a,
+    PID_COHERENT_SET = 0x0056,
     //PID_RELATED_SAMPLE_IDENTITY = 0x0083
     PID_IDENTITY_TOKEN = 0x1001,
     PID_PERMISSIONS_TOKEN = 0x1002,
@@ -126,6 +127,7 @@ enum ParameterId_t : uint16_t
     PID_TYPE_INFORMATION = 0x0075,
     PID_DISABLE_POSITIVE_ACKS = 0x8005,
     PID_DATASHARING = 0x8006,
+    PID_COHERENT_SET_END = 0x8010,
 };
 
 //!Base Parameter class with parameter PID and parameter length in bytes.
@@ -1984,6 +1984,13 @@ public:
     //! @since Functionality not implemented yet. Coming soon.
     const char* flow_controller_name = fastdds::rtps::FASTDDS_FLOW_CONTROLLER_DEFAULT;
 
+    /**
+     * Priority of the DataWriter when publish mode kind is ASYNCHRONOUS_PUBLISH_MODE.
+     * Asynchronous writers sharing a sending thread are served in descending priority order.
+     * <br> By default, 0.
+     */
+    int32_t priority = 0;
+
     inline void clear() override
     {
         PublishModeQosPolicy reset = PublishModeQosPolicy();
@@ -2810,6 +2817,9 @@ public:
         , domain_ids_(b.max_domains() != 0 ?
                 b.max_domains() :
                 b.domain_ids().size())
+        , huge_pages_(b.huge_pages())
+        , numa_node_(b.numa_node())
+        , prefault_(b.prefault())
     {
         domain_ids_ = b.domain_ids();
     }
@@ -2826,6 +2836,9 @@ public:
                 max_domains_ :
                 b.domain_ids().size());
         domain_ids_ = b.domain_ids();
+        huge_pages_ = b.huge_pages();
+        numa_node_ = b.numa_node();
+        prefault_ = b.prefault();
 
         return *this;
     }
@@ -2836,6 +2849,9 @@ public:
         return kind_ == b.kind_ &&
                shm_directory_ == b.shm_directory_ &&
                domain_ids_ == b.domain_ids_ &&
+               huge_pages_ == b.huge_pages_ &&
+               numa_node_ == b.numa_node_ &&
+               prefault_ == b.prefault_ &&
                Parameter_t::operator ==(b) &&
                QosPolicy::operator ==(b);
     }
@@ -3012,6 +3028,66 @@ public:
         }
     }
 
+    /**
+     * @return whether the shared memory of the writer is backed with huge pages
+     */
+    RTPS_DllAPI bool huge_pages() const
+    {
+        return huge_pages_;
+    }
+
+    /**
+     * @brief Sets whether the shared memory of the writer is backed with transparent huge pages.
+     * Only available on Linux.
+     *
+     * @param huge_pages true to use huge pages
+     */
+    RTPS_DllAPI void huge_pages(
+            bool huge_pages)
+    {
+        huge_pages_ = huge_pages;
+    }
+
+    /**
+     * @return the NUMA node the shared memory of the writer is bound to, -1 when it is not bound
+     */
+    RTPS_DllAPI int32_t numa_node() const
+    {
+        return numa_node_;
+    }
+
+    /**
+     * @brief Sets the NUMA node the shared memory of the writer is bound to.
+     * Only available on Linux.
+     *
+     * @param numa_node NUMA node, or -1 to keep the default memory policy
+     */
+    RTPS_DllAPI void numa_node(
+            int32_t numa_node)
+    {
+        numa_node_ = numa_node;
+    }
+
+    /**
+     * @return whether the shared memory of the writer is faulted in when created
+     */
+    RTPS_DllAPI bool prefault() const
+    {
+        return prefault_;
+    }
+
+    /**
+     * @brief Sets whether the shared memory of the writer is faulted in when created,
+     * so the first samples do not pay for it.
+     *
+     * @param prefault true to fault in the memory on creation
+     */
+    RTPS_DllAPI void prefault(
+            bool prefault)
+    {
+        prefault_ = prefault;
+    }
+
 private:
 
     void setup(
@@ -3040,6 +3116,15 @@ private:
 
     //! Only endpoints with matching domain IDs are DataSharing compatible
     std::vector<uint64_t> domain_ids_;
+
+    //! Back the shared memory of the writer with huge pages
+    bool huge_pages_ = false;
+
+    //! NUMA node the shared memory of the writer is bound to
+    int32_t numa_node_ = -1;
+
+    //! Fault in the shared memory of the writer on creation
+    bool prefault_ = false;
 };
 
 
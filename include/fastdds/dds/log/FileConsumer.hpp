@@ -51,6 +51,14 @@ public:
 
     virtual ~FileConsumer();
 
+    /** \internal
+     * Called by Log to consume all the entries collected on one iteration.
+     * All of them are written before flushing the file once.
+     * @param entries Log entries to consume.
+     */
+    RTPS_DllAPI void ConsumeBatch(
+            const std::vector<Log::Entry>& entries) override;
+
 private:
 
     /** \internal
@@ -15,12 +15,19 @@
 #ifndef _FASTDDS_DDS_LOG_LOG_HPP_
 #define _FASTDDS_DDS_LOG_LOG_HPP_
 
-#include <fastrtps/utils/DBQueue.h>
 #include <fastrtps/fastrtps_dll.h>
-#include <thread>
-#include <sstream>
 #include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <queue>
 #include <regex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 /**
  * eProsima log layer. Logging categories and verbosity can be specified dynamically at runtime.
@@ -33,6 +40,10 @@
  * * define LOG_NO_INFO
  *
  * Additionally. the lowest level (Info) is disabled by default on release branches.
+ *
+ * The arguments of basic types (numbers, strings, stream manipulators) given to a log macro are not formatted
+ * on the calling thread. They are copied in binary form to a buffer owned by the calling thread, and formatted
+ * later by the logging thread. Arguments of any other type are formatted when the macro is called.
  */
 
 // Logging API:
@@ -50,6 +61,13 @@ namespace dds {
 
 class LogConsumer;
 
+namespace detail {
+
+class LogRecord;
+class LogRingBuffer;
+
+} // namespace detail
+
 /**
  * Logging utilities.
  * Logging is accessed through the three macros above, and configuration on the log output
@@ -152,19 +170,58 @@ public:
             const Log::Context&,
             Log::Kind);
 
+    //! Maximum size of the messages formatted on the calling thread. Longer ones are truncated, ending with "(...)".
+    static constexpr uint32_t max_message_size = 16u * 1024u;
+
+    /**
+     * Not recommended to call this method directly! Use the log macros.
+     * Queues the binary encoded arguments of a log entry, built by a detail::LogRecord.
+     */
+    RTPS_DllAPI static void QueueRecord(
+            const Log::Context& context,
+            Log::Kind kind,
+            const void* arguments,
+            uint32_t arguments_size);
+
+    /**
+     * Not recommended to call this method directly! Use the log macros.
+     * Queues a log entry formatted on the calling thread, built by a detail::LogRecord.
+     * Messages longer than max_message_size are truncated.
+     */
+    RTPS_DllAPI static void QueueRecord(
+            const Log::Context& context,
+            Log::Kind kind,
+            const std::string& message);
+
+    /**
+     * Not recommended to call this method directly! Use the log macros.
+     * Returns a stream, owned by the calling thread, where the arguments that cannot be binary encoded are formatted.
+     * The binary encoded arguments received before are formatted on it first, so the manipulators among them keep
+     * applying to the following arguments.
+     * @param arguments Binary encoded arguments received before, as built by a detail::LogRecord.
+     * @param arguments_size Size of the binary encoded arguments.
+     */
+    RTPS_DllAPI static std::ostringstream& GetFormatStream(
+            const void* arguments,
+            uint32_t arguments_size);
+
 private:
 
     struct Resources
     {
-        fastrtps::DBQueue<Entry> logs;
+        //! Buffers of the threads that have logged something. Protected by rings_mutex.
+        std::vector<std::shared_ptr<detail::LogRingBuffer>> rings;
+        std::mutex rings_mutex;
+        //! Copy of rings, only accessed by the logging thread.
+        std::vector<std::shared_ptr<detail::LogRingBuffer>> rings_snapshot;
         std::vector<std::unique_ptr<LogConsumer>> consumers;
         std::unique_ptr<std::thread> logging_thread;
 
         // Condition variable segment.
         std::condition_variable cv;
         std::mutex cv_mutex;
-        bool logging;
-        bool work;
+        std::atomic<bool> logging;
+        std::atomic<bool> work;
         int current_loop;
 
         // Context configuration.
@@ -192,7 +249,28 @@ private:
 
     static void run();
 
+    // Decodes the records of all the thread buffers, and gives them to the consumers in a single batch.
+    static void process_records();
+
+    static void start_thread();
+
+    static void wake_up();
+
+    // Pushes a record on the buffer of the calling thread, waiting for room if needed.
+    static void push_record(
+            const Log::Context& context,
+            Log::Kind kind,
+            const void* arguments,
+            uint32_t arguments_size,
+            bool truncated);
+
+    static detail::LogRingBuffer& thread_ring();
+
+    static void get_timestamp(
+            std::string&);
+
     static void get_timestamp(
+            int64_t nanoseconds_since_epoch,
             std::string&);
 };
 
@@ -208,6 +286,20 @@ public:
     virtual void Consume(
             const Log::Entry&) = 0;
 
+    /**
+     * Consumes all the log entries collected by the logging thread on one iteration.
+     * The default implementation calls Consume for each entry.
+     * @param entries Log entries to consume, in the order they were logged.
+     */
+    virtual void ConsumeBatch(
+            const std::vector<Log::Entry>& entries)
+    {
+        for (const Log::Entry& entry : entries)
+        {
+            Consume(entry);
+        }
+    }
+
 protected:
 
     void print_timestamp(
@@ -235,18 +327,299 @@ protected:
             bool color) const;
 };
 
+namespace detail {
+
+/**
+ * Collects the arguments of a log macro, and queues them on the log when destroyed.
+ * Arguments of basic types are stored in binary form, to be formatted by the logging thread.
+ * Once an argument of any other type is received, or the binary encoded arguments exceed max_arguments_size, the
+ * whole entry is formatted on the calling thread, so stream manipulators keep working as expected. Entries formatted
+ * on the calling thread are truncated to Log::max_message_size.
+ */
+class LogRecord
+{
+public:
+
+    //! Type of the arguments stored in binary form.
+    enum ArgumentKind : uint8_t
+    {
+        ARG_BOOL,
+        ARG_CHAR,
+        ARG_SIGNED_CHAR,
+        ARG_UNSIGNED_CHAR,
+        ARG_SHORT,
+        ARG_UNSIGNED_SHORT,
+        ARG_INT,
+        ARG_UNSIGNED_INT,
+        ARG_LONG,
+        ARG_UNSIGNED_LONG,
+        ARG_LONG_LONG,
+        ARG_UNSIGNED_LONG_LONG,
+        ARG_FLOAT,
+        ARG_DOUBLE,
+        ARG_LONG_DOUBLE,
+        ARG_POINTER,
+        ARG_STRING,
+        ARG_OSTREAM_MANIPULATOR,
+        ARG_IOS_MANIPULATOR
+    };
+
+    //! Maximum size of the binary encoded arguments of an entry. Longer entries are formatted on the calling thread.
+    static constexpr uint32_t max_arguments_size = 1024u;
+
+    using OStreamManipulator = std::ostream& (*)(std::ostream&);
+    using IosManipulator = std::ios_base& (*)(std::ios_base&);
+
+    LogRecord(
+            const Log::Context& context,
+            Log::Kind kind)
+        : context_(context)
+        , kind_(kind)
+    {
+    }
+
+    ~LogRecord()
+    {
+        if (nullptr != stream_)
+        {
+            Log::QueueRecord(context_, kind_, stream_->str());
+        }
+        else
+        {
+            Log::QueueRecord(context_, kind_, arguments_, size_);
+        }
+    }
+
+    LogRecord(
+            const LogRecord&) = delete;
+
+    LogRecord& operator =(
+            const LogRecord&) = delete;
+
+    LogRecord& operator <<(
+            bool value)
+    {
+        return put(ARG_BOOL, value);
+    }
+
+    LogRecord& operator <<(
+            char value)
+    {
+        return put(ARG_CHAR, value);
+    }
+
+    LogRecord& operator <<(
+            signed char value)
+    {
+        return put(ARG_SIGNED_CHAR, value);
+    }
+
+    LogRecord& operator <<(
+            unsigned char value)
+    {
+        return put(ARG_UNSIGNED_CHAR, value);
+    }
+
+    LogRecord& operator <<(
+            short value)
+    {
+        return put(ARG_SHORT, value);
+    }
+
+    LogRecord& operator <<(
+            unsigned short value)
+    {
+        return put(ARG_UNSIGNED_SHORT, value);
+    }
+
+    LogRecord& operator <<(
+            int value)
+    {
+        return put(ARG_INT, value);
+    }
+
+    LogRecord& operator <<(
+            unsigned int value)
+    {
+        return put(ARG_UNSIGNED_INT, value);
+    }
+
+    LogRecord& operator <<(
+            long value)
+    {
+        return put(ARG_LONG, value);
+    }
+
+    LogRecord& operator <<(
+            unsigned long value)
+    {
+        return put(ARG_UNSIGNED_LONG, value);
+    }
+
+    LogRecord& operator <<(
+            long long value)
+    {
+        return put(ARG_LONG_LONG, value);
+    }
+
+    LogRecord& operator <<(
+            unsigned long long value)
+    {
+        return put(ARG_UNSIGNED_LONG_LONG, value);
+    }
+
+    LogRecord& operator <<(
+            float value)
+    {
+        return put(ARG_FLOAT, value);
+    }
+
+    LogRecord& operator <<(
+            double value)
+    {
+        return put(ARG_DOUBLE, value);
+    }
+
+    LogRecord& operator <<(
+            long double value)
+    {
+        return put(ARG_LONG_DOUBLE, value);
+    }
+
+    LogRecord& operator <<(
+            const void* value)
+    {
+        return put(ARG_POINTER, value);
+    }
+
+    LogRecord& operator <<(
+            const char* value)
+    {
+        if (nullptr == stream_)
+        {
+            put_string(value, (nullptr != value) ? std::strlen(value) : 0u);
+        }
+        else
+        {
+            *stream_ << value;
+        }
+        return *this;
+    }
+
+    LogRecord& operator <<(
+            const std::string& value)
+    {
+        if (nullptr == stream_)
+        {
+            put_string(value.c_str(), value.size());
+        }
+        else
+        {
+            *stream_ << value;
+        }
+        return *this;
+    }
+
+    LogRecord& operator <<(
+            OStreamManipulator value)
+    {
+        return put(ARG_OSTREAM_MANIPULATOR, value);
+    }
+
+    LogRecord& operator <<(
+            IosManipulator value)
+    {
+        return put(ARG_IOS_MANIPULATOR, value);
+    }
+
+    template<typename T>
+    LogRecord& operator <<(
+            const T& value)
+    {
+        if (nullptr == stream_)
+        {
+            start_formatting();
+        }
+        *stream_ << value;
+        return *this;
+    }
+
+private:
+
+    //! Continue the entry on the format stream, starting with the arguments already binary encoded.
+    void start_formatting()
+    {
+        stream_ = &Log::GetFormatStream(arguments_, size_);
+        size_ = 0;
+    }
+
+    template<typename T>
+    LogRecord& put(
+            ArgumentKind kind,
+            const T& value)
+    {
+        if (nullptr == stream_ && size_ + 1u + sizeof(T) <= max_arguments_size)
+        {
+            arguments_[size_++] = kind;
+            std::memcpy(&arguments_[size_], &value, sizeof(T));
+            size_ += static_cast<uint32_t>(sizeof(T));
+        }
+        else
+        {
+            if (nullptr == stream_)
+            {
+                start_formatting();
+            }
+            *stream_ << value;
+        }
+        return *this;
+    }
+
+    void put_string(
+            const char* value,
+            size_t length)
+    {
+        constexpr uint32_t header_size = 1u + sizeof(uint32_t);
+        if (size_ + header_size + length > max_arguments_size)
+        {
+            start_formatting();
+            stream_->write(value, static_cast<std::streamsize>(length));
+            return;
+        }
+
+        uint32_t str_length = static_cast<uint32_t>(length);
+        arguments_[size_++] = ARG_STRING;
+        std::memcpy(&arguments_[size_], &str_length, sizeof(uint32_t));
+        size_ += static_cast<uint32_t>(sizeof(uint32_t));
+        if (0u < str_length)
+        {
+            std::memcpy(&arguments_[size_], value, str_length);
+            size_ += str_length;
+        }
+    }
+
+    const Log::Context& context_;
+    Log::Kind kind_;
+    std::ostringstream* stream_ = nullptr;
+    uint32_t size_ = 0;
+    uint8_t arguments_[max_arguments_size];
+};
+
+} // namespace detail
+
 #if defined(WIN32)
 #define __func__ __FUNCTION__
 #endif // if defined(WIN32)
 
 // Name of variables inside macros must be unique, or it could produce an error with external variables
 #if !HAVE_LOG_NO_ERROR
-#define logError_(cat, msg)                                                                                            \
-    {                                                                                                                  \
-        using namespace eprosima::fastdds::dds;                                                                        \
-        std::stringstream fastdds_log_ss_tmp__;                                                                        \
-        fastdds_log_ss_tmp__ << msg;                                                                                   \
-        Log::QueueLog(fastdds_log_ss_tmp__.str(), Log::Context{__FILE__, __LINE__, __func__, #cat}, Log::Kind::Error); \
+#define logError_(cat, msg)                                                                 \
+    {                                                                                       \
+        using namespace eprosima::fastdds::dds;                                             \
+        const Log::Context fastdds_log_ctx_tmp__{__FILE__, __LINE__, __func__, #cat};       \
+        eprosima::fastdds::dds::detail::LogRecord fastdds_log_rec_tmp__(                    \
+            fastdds_log_ctx_tmp__, Log::Kind::Error);                                       \
+        fastdds_log_rec_tmp__ << msg;                                                       \
     }
 #elif (__INTERNALDEBUG || _INTERNALDEBUG)
 #define logError_(cat, msg)                                     \
@@ -268,10 +641,10 @@ protected:
         using namespace eprosima::fastdds::dds;                                                                     \
         if (Log::GetVerbosity() >= Log::Kind::Warning)                                                              \
         {                                                                                                           \
-            std::stringstream fastdds_log_ss_tmp__;                                                                 \
-            fastdds_log_ss_tmp__ << msg;                                                                            \
-            Log::QueueLog(                                                                                          \
-                fastdds_log_ss_tmp__.str(), Log::Context{__FILE__, __LINE__, __func__, #cat}, Log::Kind::Warning);  \
+            const Log::Context fastdds_log_ctx_tmp__{__FILE__, __LINE__, __func__, #cat};                           \
+            eprosima::fastdds::dds::detail::LogRecord fastdds_log_rec_tmp__(                                        \
+                fastdds_log_ctx_tmp__, Log::Kind::Warning);                                                         \
+            fastdds_log_rec_tmp__ << msg;                                                                           \
         }                                                                                                           \
     }
 #elif (__INTERNALDEBUG || _INTERNALDEBUG)
@@ -297,10 +670,10 @@ protected:
         using namespace eprosima::fastdds::dds;                                                         \
         if (Log::GetVerbosity() >= Log::Kind::Info)                                                     \
         {                                                                                               \
-            std::stringstream fastdds_log_ss_tmp__;                                                     \
-            fastdds_log_ss_tmp__ << msg;                                                                \
-            Log::QueueLog(fastdds_log_ss_tmp__.str(), Log::Context{__FILE__, __LINE__, __func__, #cat}, \
-                    Log::Kind::Info);                                                                   \
+            const Log::Context fastdds_log_ctx_tmp__{__FILE__, __LINE__, __func__, #cat};               \
+            eprosima::fastdds::dds::detail::LogRecord fastdds_log_rec_tmp__(                            \
+                fastdds_log_ctx_tmp__, Log::Kind::Info);                                                \
+            fastdds_log_rec_tmp__ << msg;                                                               \
         }                                                                                               \
     }
 #elif (__INTERNALDEBUG || _INTERNALDEBUG)
@@ -211,13 +211,18 @@ public:
 
     /**
      * @brief Signals the beginning of a set of coherent cache changes using the Datawriters attached to the publisher
+     *
+     * Samples written by the enabled DataWriters of this Publisher until the matching call to end_coherent_changes
+     * are held, and sent together when the set ends. Matching readers will make the whole set visible at once.
+     * Calls can be nested; only the outermost pair delimits the set.
      * @return RETCODE_OK if successful, an error code otherwise
      */
     RTPS_DllAPI ReturnCode_t begin_coherent_changes();
 
     /**
      * @brief Signals the end of a set of coherent cache changes
-     * @return RETCODE_OK if successful, an error code otherwise
+     * @return RETCODE_OK if successful, RETCODE_PRECONDITION_NOT_MET if there is no matching call to
+     * begin_coherent_changes.
      */
     RTPS_DllAPI ReturnCode_t end_coherent_changes();
 
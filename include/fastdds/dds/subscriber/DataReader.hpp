@@ -942,7 +942,7 @@ public:
 
     /**
      * @brief This operation creates a ReadCondition. The returned ReadCondition will be attached and belong to the
-     * DataReader.
+     * DataReader. An empty vector of states selects samples on any of those states.
      * @param sample_states Vector of SampleStateKind
      * @param view_states Vector of ViewStateKind
      * @param instance_states Vector of InstanceStateKind
@@ -955,13 +955,13 @@ public:
 
     /**
      * @brief This operation creates a QueryCondition. The returned QueryCondition will be attached and belong to the
-     * DataReader.
+     * DataReader. An empty vector of states selects samples on any of those states.
      * @param sample_states Vector of SampleStateKind
      * @param view_states Vector of ViewStateKind
      * @param instance_states Vector of InstanceStateKind
      * @param query_expression string containing query
      * @param query_parameters Vector of strings containing parameters of query expression
-     * @return QueryCondition pointer
+     * @return QueryCondition pointer, or nullptr if the query expression or its parameters are not valid
      */
     RTPS_DllAPI QueryCondition* create_querycondition(
             const std::vector<SampleStateKind>& sample_states,
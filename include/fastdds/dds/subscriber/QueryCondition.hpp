@@ -0,0 +1,84 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file QueryCondition.hpp
+ *
+ */
+
+#ifndef _FASTDDS_DDS_SUBSCRIBER_QUERYCONDITION_HPP_
+#define _FASTDDS_DDS_SUBSCRIBER_QUERYCONDITION_HPP_
+
+#include <string>
+#include <vector>
+
+#include <fastdds/dds/subscriber/ReadCondition.hpp>
+#include <fastrtps/fastrtps_dll.h>
+#include <fastrtps/types/TypesBase.h>
+
+using eprosima::fastrtps::types::ReturnCode_t;
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+/**
+ * @brief A QueryCondition is a specialized ReadCondition that also filters the samples by their content.
+ *
+ * The query is expressed with the same SQL subset used by ContentFilteredTopic, and is evaluated on the samples
+ * already received by the DataReader. Samples without valid data (e.g. dispose notifications) always pass the query.
+ *
+ * @ingroup FASTDDS_MODULE
+ */
+class QueryCondition : public ReadCondition
+{
+    friend class DataReaderImpl;
+
+protected:
+
+    QueryCondition(
+            detail::ReadConditionImpl* impl);
+
+    virtual ~QueryCondition();
+
+public:
+
+    /**
+     * @brief Retrieves the query expression of the QueryCondition
+     * @return The query expression
+     */
+    RTPS_DllAPI const std::string& get_query_expression() const;
+
+    /**
+     * @brief Retrieves the current values of the query parameters
+     * @param[out] query_parameters Vector where the parameters will be returned
+     * @return RETCODE_OK
+     */
+    RTPS_DllAPI ReturnCode_t get_query_parameters(
+            std::vector<std::string>& query_parameters) const;
+
+    /**
+     * @brief Changes the values of the query parameters
+     * @param query_parameters New values for the parameters of the query expression
+     * @return RETCODE_OK if the parameters were updated, RETCODE_BAD_PARAMETER if they are not valid for the query
+     */
+    RTPS_DllAPI ReturnCode_t set_query_parameters(
+            const std::vector<std::string>& query_parameters);
+};
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_DDS_SUBSCRIBER_QUERYCONDITION_HPP_
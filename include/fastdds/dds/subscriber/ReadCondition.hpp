@@ -0,0 +1,103 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReadCondition.hpp
+ *
+ */
+
+#ifndef _FASTDDS_DDS_SUBSCRIBER_READCONDITION_HPP_
+#define _FASTDDS_DDS_SUBSCRIBER_READCONDITION_HPP_
+
+#include <fastdds/dds/core/condition/Condition.hpp>
+#include <fastdds/dds/subscriber/InstanceState.hpp>
+#include <fastdds/dds/subscriber/SampleState.hpp>
+#include <fastdds/dds/subscriber/ViewState.hpp>
+#include <fastrtps/fastrtps_dll.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+class DataReader;
+class DataReaderImpl;
+
+namespace detail {
+
+class ReadConditionImpl;
+
+} // namespace detail
+
+/**
+ * @brief A ReadCondition is a specialized Condition associated with a DataReader.
+ *
+ * It allows the application to select the samples it is interested in by means of their sample, view and instance
+ * states. Its trigger_value is true when the DataReader holds at least one sample matching those states.
+ * ReadCondition objects are created and deleted through the DataReader they are attached to.
+ *
+ * @ingroup FASTDDS_MODULE
+ */
+class ReadCondition : public Condition
+{
+    friend class DataReaderImpl;
+
+protected:
+
+    ReadCondition(
+            detail::ReadConditionImpl* impl);
+
+    virtual ~ReadCondition();
+
+public:
+
+    /**
+     * @brief Retrieves the trigger_value of the ReadCondition
+     * @return true if there is some sample in the DataReader matching the condition, false otherwise
+     */
+    RTPS_DllAPI bool get_trigger_value() const override;
+
+    /**
+     * @brief Retrieves the DataReader associated with the ReadCondition
+     * @return Pointer to the DataReader
+     */
+    RTPS_DllAPI DataReader* get_datareader() const;
+
+    /**
+     * @brief Retrieves the set of sample states taken into account to determine the trigger_value
+     * @return SampleStateMask of the ReadCondition
+     */
+    RTPS_DllAPI SampleStateMask get_sample_state_mask() const;
+
+    /**
+     * @brief Retrieves the set of view states taken into account to determine the trigger_value
+     * @return ViewStateMask of the ReadCondition
+     */
+    RTPS_DllAPI ViewStateMask get_view_state_mask() const;
+
+    /**
+     * @brief Retrieves the set of instance states taken into account to determine the trigger_value
+     * @return InstanceStateMask of the ReadCondition
+     */
+    RTPS_DllAPI InstanceStateMask get_instance_state_mask() const;
+
+protected:
+
+    detail::ReadConditionImpl* impl_;
+};
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_DDS_SUBSCRIBER_READCONDITION_HPP_
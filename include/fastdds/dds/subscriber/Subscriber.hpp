@@ -239,7 +239,7 @@ public:
     /**
      * @brief Indicates that the application has finished accessing the data samples in DataReader objects managed by
      * the Subscriber.
-     * @return RETCODE_OK
+     * @return RETCODE_OK, or RETCODE_PRECONDITION_NOT_MET if there is no matching call to begin_access.
      */
     RTPS_DllAPI ReturnCode_t end_access();
 
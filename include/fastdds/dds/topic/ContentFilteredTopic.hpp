@@ -0,0 +1,120 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ContentFilteredTopic.hpp
+ */
+
+#ifndef _FASTDDS_CONTENTFILTEREDTOPIC_HPP_
+#define _FASTDDS_CONTENTFILTEREDTOPIC_HPP_
+
+#include <string>
+#include <vector>
+
+#include <fastrtps/fastrtps_dll.h>
+#include <fastrtps/types/TypesBase.h>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TopicDescription.hpp>
+
+using eprosima::fastrtps::types::ReturnCode_t;
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+class DomainParticipant;
+class DomainParticipantImpl;
+class ContentFilteredTopicImpl;
+
+/**
+ * Specialization of TopicDescription that allows for content-based subscriptions.
+ *
+ * The filter expression follows the SQL subset defined in Annex B of the DDS specification.
+ * It is announced to the matched writers, which will only send the samples that pass the filter.
+ * @ingroup FASTDDS_MODULE
+ */
+class ContentFilteredTopic : public TopicDescription
+{
+    friend class DomainParticipantImpl;
+
+    /**
+     * Create a content filtered topic, assigning its pointer to the associated implementation.
+     * Don't use directly, create ContentFilteredTopic using create_contentfilteredtopic from DomainParticipant.
+     */
+    ContentFilteredTopic(
+            const std::string& name,
+            Topic* related_topic,
+            ContentFilteredTopicImpl* p);
+
+public:
+
+    /**
+     * @brief Destructor
+     */
+    RTPS_DllAPI virtual ~ContentFilteredTopic();
+
+    /**
+     * @brief Getter for the DomainParticipant
+     * @return DomainParticipant pointer
+     */
+    RTPS_DllAPI virtual DomainParticipant* get_participant() const override;
+
+    /**
+     * Get the related Topic.
+     * @return The Topic on which this ContentFilteredTopic is based.
+     */
+    RTPS_DllAPI Topic* get_related_topic() const;
+
+    /**
+     * Get the filter expression.
+     * @return The filter expression used when this ContentFilteredTopic was created.
+     */
+    RTPS_DllAPI const std::string& get_filter_expression() const;
+
+    /**
+     * Get the expression parameters.
+     * @param [out] expression_parameters The expression parameters currently associated with the
+     *                                    ContentFilteredTopic.
+     * @return RETCODE_OK
+     */
+    RTPS_DllAPI ReturnCode_t get_expression_parameters(
+            std::vector<std::string>& expression_parameters) const;
+
+    /**
+     * Set the expression parameters.
+     * The new values are announced to the matched writers of all the DataReader objects created on this
+     * ContentFilteredTopic.
+     * @param expression_parameters The expression parameters to set.
+     * @return RETCODE_OK if the expression parameters were updated.
+     * @return RETCODE_BAD_PARAMETER if the parameters are not valid for the filter expression.
+     */
+    RTPS_DllAPI ReturnCode_t set_expression_parameters(
+            const std::vector<std::string>& expression_parameters);
+
+    /**
+     * @brief Getter for the TopicDescriptionImpl
+     * @return pointer to TopicDescriptionImpl
+     */
+    TopicDescriptionImpl* get_impl() const override;
+
+protected:
+
+    ContentFilteredTopicImpl* impl_;
+};
+
+} /* namespace dds */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif /* _FASTDDS_CONTENTFILTEREDTOPIC_HPP_ */
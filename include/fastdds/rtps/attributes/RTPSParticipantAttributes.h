@@ -432,6 +432,69 @@ public:
 
 };
 
+/**
+ * Struct EventThreadAttributes defines the event threads of a RTPSParticipant.
+ * All timed events run on a general event thread, unless some threads are dedicated to their class of events.
+ * The events of a class with several threads are spread among them.
+ * These values can also be set with the properties "fastdds.event_threads.reliability",
+ * "fastdds.event_threads.discovery" and "fastdds.event_threads.user_callbacks".
+ * @ingroup RTPS_ATTRIBUTES_MODULE
+ */
+struct EventThreadAttributes
+{
+    /// Threads for the events of the reliability protocol: heartbeats, ACKNACK responses and NACK suppression
+    uint32_t reliability_threads = 0u;
+
+    /// Threads for the events of the discovery and liveliness protocols: announcements, leases, liveliness
+    /// assertions and authentication handshakes
+    uint32_t discovery_threads = 0u;
+
+    /// Threads for the events with user visible callbacks, like deadline and lifespan
+    uint32_t user_callback_threads = 0u;
+
+    bool operator ==(
+            const EventThreadAttributes& b) const
+    {
+        return (reliability_threads == b.reliability_threads) &&
+               (discovery_threads == b.discovery_threads) &&
+               (user_callback_threads == b.user_callback_threads);
+    }
+
+};
+
+/**
+ * Struct BusyPollAttributes defines the busy-poll receive mode of a RTPSParticipant.
+ * When enabled, a single thread polls all the shared memory ports and data-sharing readers of the participant,
+ * instead of having a thread blocked on each one of them.
+ * These values can also be set with the properties "fastdds.busy_poll", "fastdds.busy_poll.cpu",
+ * "fastdds.busy_poll.spin_rounds" and "fastdds.busy_poll.max_backoff_us".
+ * @ingroup RTPS_ATTRIBUTES_MODULE
+ */
+struct BusyPollAttributes
+{
+    /// Whether the busy-poll receive mode is used
+    bool enabled = false;
+
+    /// CPU the polling thread is pinned to. A negative value leaves the thread without affinity (Linux only)
+    int32_t cpu = -1;
+
+    /// Consecutive polling rounds without data after which the thread starts backing off
+    uint32_t spin_rounds = 10000u;
+
+    /// Maximum sleep between polling rounds when backing off (us). With 0 the thread only yields the CPU
+    uint32_t max_backoff_us = 0u;
+
+    bool operator ==(
+            const BusyPollAttributes& b) const
+    {
+        return (enabled == b.enabled) &&
+               (cpu == b.cpu) &&
+               (spin_rounds == b.spin_rounds) &&
+               (max_backoff_us == b.max_backoff_us);
+    }
+
+};
+
 /**
  * Class RTPSParticipantAttributes used to define different aspects of a RTPSParticipant.
  *@ingroup RTPS_ATTRIBUTES_MODULE
@@ -467,6 +530,9 @@ public:
                (this->participantID == b.participantID) &&
                (this->throughputController == b.throughputController) &&
                (this->useBuiltinTransports == b.useBuiltinTransports) &&
+               (this->event_threads == b.event_threads) &&
+               (this->busy_poll == b.busy_poll) &&
+               (this->data_sharing_dispatcher_threads == b.data_sharing_dispatcher_threads) &&
                (this->properties == b.properties &&
                (this->prefix == b.prefix));
     }
@@ -526,6 +592,19 @@ public:
     //!Holds allocation limits affecting collections managed by a participant.
     RTPSParticipantAllocationAttributes allocation;
 
+    //! Event threads of the participant.
+    EventThreadAttributes event_threads;
+
+    //! Busy-poll receive mode of the participant.
+    BusyPollAttributes busy_poll;
+
+    /**
+     * Maximum number of threads processing the data-sharing notifications of all the readers of the participant.
+     * With 0, each reader has its own listening thread.
+     * It can also be set with the property "fastdds.datasharing.dispatcher_threads".
+     */
+    uint32_t data_sharing_dispatcher_threads = 0;
+
     //! Property policies
     PropertyPolicy properties;
 
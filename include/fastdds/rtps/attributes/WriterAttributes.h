@@ -93,6 +93,7 @@ public:
         , liveliness_lease_duration(TIME_T_INFINITE_SECONDS, TIME_T_INFINITE_NANOSECONDS)
         , liveliness_announcement_period(TIME_T_INFINITE_SECONDS, TIME_T_INFINITE_NANOSECONDS)
         , mode(SYNCHRONOUS_WRITER)
+        , async_priority(0)
         , disable_heartbeat_piggyback(false)
         , disable_positive_acks(false)
         , keep_duration(TIME_T_INFINITE_SECONDS, TIME_T_INFINITE_NANOSECONDS)
@@ -124,6 +125,9 @@ public:
     //!Indicates if the Writer is synchronous or asynchronous
     RTPSWriterPublishMode mode;
 
+    //! Priority of the writer among the asynchronous writers sharing its sending thread. Higher values go first.
+    int32_t async_priority;
+
     // Throughput controller, always the last one to apply
     ThroughputControllerDescriptor throughputController;
 
@@ -29,6 +29,13 @@
 namespace eprosima {
 
 namespace fastdds {
+
+namespace rtps {
+
+struct ContentFilterProperty;
+
+} // namespace rtps
+
 namespace dds {
 namespace builtin {
 
@@ -130,12 +137,14 @@ public:
      * @param R Pointer to the RTPSReader.
      * @param topicAtt Attributes of the associated topic
      * @param rqos QoS policies dictated by the subscriber
+     * @param content_filter Optional content filtering information.
      * @return True if correct.
      */
     bool addLocalReader(
             RTPSReader* R,
             const TopicAttributes& topicAtt,
-            const fastdds::dds::ReaderQos& rqos);
+            const fastdds::dds::ReaderQos& rqos,
+            const fastdds::rtps::ContentFilterProperty* content_filter = nullptr);
     /**
      * Update a local Writer QOS
      * @param W Writer to update
@@ -152,12 +161,14 @@ public:
      * @param R Reader to update
      * @param topicAtt Attributes of the associated topic
      * @param qos New Reader QoS
+     * @param content_filter Optional content filtering information.
      * @return
      */
     bool updateLocalReader(
             RTPSReader* R,
             const TopicAttributes& topicAtt,
-            const fastdds::dds::ReaderQos& qos);
+            const fastdds::dds::ReaderQos& qos,
+            const fastdds::rtps::ContentFilterProperty* content_filter = nullptr);
     /**
      * Remove a local Writer from the builtinProtocols.
      * @param W Pointer to the writer.
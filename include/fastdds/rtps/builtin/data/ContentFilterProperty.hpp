@@ -0,0 +1,71 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ContentFilterProperty.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_BUILTIN_DATA_CONTENTFILTERPROPERTY_HPP_
+#define _FASTDDS_RTPS_BUILTIN_DATA_CONTENTFILTERPROPERTY_HPP_
+
+#include <string>
+#include <vector>
+
+#include <fastrtps/utils/fixed_size_string.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Information about the content filter being applied by a reader.
+ * It is announced on discovery (PID_CONTENT_FILTER_PROPERTY), so matching writers can evaluate
+ * the filter before sending the samples.
+ */
+struct ContentFilterProperty
+{
+    //! Name of the content filtered topic on which the reader was created
+    fastrtps::string_255 content_filtered_topic_name;
+    //! Name of the related topic being filtered
+    fastrtps::string_255 related_topic_name;
+    //! Class of the filter
+    fastrtps::string_255 filter_class_name;
+    //! Filter expression
+    std::string filter_expression;
+    //! Values for the parameters on the filter expression
+    std::vector<std::string> expression_parameters;
+
+    bool operator ==(
+            const ContentFilterProperty& other) const
+    {
+        return content_filtered_topic_name == other.content_filtered_topic_name &&
+               related_topic_name == other.related_topic_name &&
+               filter_class_name == other.filter_class_name &&
+               filter_expression == other.filter_expression &&
+               expression_parameters == other.expression_parameters;
+    }
+
+    bool operator !=(
+            const ContentFilterProperty& other) const
+    {
+        return !(*this == other);
+    }
+
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_RTPS_BUILTIN_DATA_CONTENTFILTERPROPERTY_HPP_
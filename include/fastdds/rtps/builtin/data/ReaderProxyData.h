@@ -31,6 +31,7 @@
 #include <fastdds/rtps/security/accesscontrol/EndpointSecurityAttributes.h>
 #endif // if HAVE_SECURITY
 
+#include <fastdds/rtps/builtin/data/ContentFilterProperty.hpp>
 #include <fastdds/rtps/common/RemoteLocators.hpp>
 
 namespace eprosima {
@@ -337,6 +338,34 @@ public:
         return m_type_information != nullptr;
     }
 
+    /**
+     * Set the content filter applied by the reader.
+     * @param filter Information about the content filter.
+     */
+    RTPS_DllAPI void content_filter(
+            const fastdds::rtps::ContentFilterProperty& filter)
+    {
+        content_filter_ = filter;
+    }
+
+    /**
+     * Get the content filter applied by the reader.
+     * @return Information about the content filter.
+     */
+    RTPS_DllAPI const fastdds::rtps::ContentFilterProperty& content_filter() const
+    {
+        return content_filter_;
+    }
+
+    /**
+     * Check whether the reader is applying a content filter.
+     * @return true when a content filter is being applied.
+     */
+    RTPS_DllAPI bool has_content_filter() const
+    {
+        return content_filter_.filter_class_name.size() > 0 && !content_filter_.filter_expression.empty();
+    }
+
     inline bool disable_positive_acks() const
     {
         return m_qos.m_disablePositiveACKs.enabled;
@@ -458,6 +487,8 @@ private:
     xtypes::TypeInformation* m_type_information;
     //!
     ParameterPropertyList_t m_properties;
+    //!Content filter applied by the reader
+    fastdds::rtps::ContentFilterProperty content_filter_;
 };
 
 } // namespace rtps
@@ -32,6 +32,8 @@
 #include <foonathan/memory/container.hpp>
 #include <foonathan/memory/memory_pool.hpp>
 
+#include <memory>
+
 #define MATCH_FAILURE_REASON_COUNT size_t(16)
 
 namespace eprosima {
@@ -46,6 +48,7 @@ class TopicAttributes;
 namespace rtps {
 
 class PDP;
+class PartitionMatcherCache;
 class ParticipantProxyData;
 class RTPSWriter;
 class RTPSReader;
@@ -161,12 +164,14 @@ public:
      * @param R Pointer to the RTPSReader.
      * @param att Attributes of the associated topic
      * @param qos QoS policies dictated by the subscriber
+     * @param content_filter Optional content filtering information.
      * @return True if correct.
      */
     bool newLocalReaderProxyData(
             RTPSReader* R,
             const TopicAttributes& att,
-            const ReaderQos& qos);
+            const ReaderQos& qos,
+            const fastdds::rtps::ContentFilterProperty* content_filter = nullptr);
     /**
      * Create a new ReaderPD for a local Writer.
      * @param W Pointer to the RTPSWriter.
@@ -183,12 +188,14 @@ public:
      * @param R Pointer to the reader;
      * @param att Attributes of the associated topic
      * @param qos QoS policies dictated by the subscriber
+     * @param content_filter Optional content filtering information.
      * @return True if correctly updated
      */
     bool updatedLocalReader(
             RTPSReader* R,
             const TopicAttributes& att,
-            const ReaderQos& qos);
+            const ReaderQos& qos,
+            const fastdds::rtps::ContentFilterProperty* content_filter = nullptr);
     /**
      * A previously created Writer has been updated
      * @param W Pointer to the Writer
@@ -342,7 +349,7 @@ public:
     //! Pointer to the RTPSParticipant.
     RTPSParticipantImpl* mp_RTPSParticipant;
 
-private:
+protected:
 
     /**
      * Try to pair/unpair a local Reader against all possible writerProxy Data.
@@ -367,6 +374,8 @@ private:
             const GUID_t& participant_guid,
             const WriterProxyData& wdata);
 
+private:
+
     bool checkDataRepresentationQos(
             const WriterProxyData* wdata,
             const ReaderProxyData* rdata) const;
@@ -402,6 +411,9 @@ private:
 
     foonathan::memory::map<GUID_t, fastdds::dds::SubscriptionMatchedStatus, pool_allocator_t> reader_status_;
     foonathan::memory::map<GUID_t, fastdds::dds::PublicationMatchedStatus, pool_allocator_t> writer_status_;
+
+    //! Compiled partition expressions used on valid_matching
+    std::unique_ptr<PartitionMatcherCache> partition_matchers_;
 };
 
 } /* namespace rtps */
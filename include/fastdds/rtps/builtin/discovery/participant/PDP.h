@@ -23,6 +23,9 @@
 
 #include <mutex>
 #include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <fastdds/rtps/common/Guid.h>
 #include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
@@ -221,6 +224,24 @@ public:
     bool removeWriterProxyData(
             const GUID_t& writer_guid);
 
+    /**
+     * Get the ReaderProxyData objects of the readers on a topic, from all the registered RTPSParticipants.
+     * The PDP mutex should be taken while the returned collection is in use.
+     * @param topic_name Name of the topic.
+     * @return Collection of the ReaderProxyData objects on the topic.
+     */
+    const std::vector<ReaderProxyData*>& reader_proxies_on_topic(
+            const string_255& topic_name) const;
+
+    /**
+     * Get the WriterProxyData objects of the writers on a topic, from all the registered RTPSParticipants.
+     * The PDP mutex should be taken while the returned collection is in use.
+     * @param topic_name Name of the topic.
+     * @return Collection of the WriterProxyData objects on the topic.
+     */
+    const std::vector<WriterProxyData*>& writer_proxies_on_topic(
+            const string_255& topic_name) const;
+
     /**
      * Create the SPDP Writer and Reader
      * @return True if correct.
@@ -435,6 +456,12 @@ private:
     //!Participant's initial announcements config
     InitialAnnouncementConfig initial_announcements_;
 
+    //!ReaderProxyData objects of the registered RTPSParticipants indexed by topic name
+    std::unordered_map<std::string, std::vector<ReaderProxyData*>> reader_proxies_by_topic_;
+
+    //!WriterProxyData objects of the registered RTPSParticipants indexed by topic name
+    std::unordered_map<std::string, std::vector<WriterProxyData*>> writer_proxies_by_topic_;
+
     void check_remote_participant_liveliness(
             ParticipantProxyData* remote_participant);
 
@@ -19,6 +19,9 @@
 #ifndef _FASTDDS_RTPS_INSTANCEHANDLE_H_
 #define _FASTDDS_RTPS_INSTANCEHANDLE_H_
 
+#include <cstring>
+#include <functional>
+
 #include <fastrtps/fastrtps_dll.h>
 #include <fastdds/rtps/common/Types.h>
 #include <fastdds/rtps/common/Guid.h>
@@ -291,4 +294,27 @@ inline std::istream& operator >>(
 } // namespace fastrtps
 } // namespace eprosima
 
+namespace std {
+template <>
+struct hash<eprosima::fastrtps::rtps::InstanceHandle_t>
+{
+    std::size_t operator ()(
+            const eprosima::fastrtps::rtps::InstanceHandle_t& k) const
+    {
+        // Keys may come from an MD5 or from a short zero-padded serialized key, so all bytes are mixed.
+        uint64_t lo = 0;
+        uint64_t hi = 0;
+        memcpy(&lo, k.value, sizeof(lo));
+        memcpy(&hi, k.value + sizeof(lo), sizeof(hi));
+
+        uint64_t h = lo ^ (hi * 0x9E3779B97F4A7C15ull);
+        h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ull;
+        h = (h ^ (h >> 27)) * 0x94D049BB133111EBull;
+        return static_cast<std::size_t>(h ^ (h >> 31));
+    }
+
+};
+
+} // namespace std
+
 #endif /* _FASTDDS_RTPS_INSTANCEHANDLE_H_ */
@@ -46,6 +46,8 @@ namespace eprosima
                     WriteParams(const WriteParams &wparam)
                         : sample_identity_(wparam.sample_identity_)
                         , related_sample_identity_(wparam.related_sample_identity_)
+                        , coherent_set_(wparam.coherent_set_)
+                        , coherent_set_end_(wparam.coherent_set_end_)
                     {
                     }
 
@@ -55,6 +57,8 @@ namespace eprosima
                     WriteParams(WriteParams &&wparam)
                         : sample_identity_(std::move(wparam.sample_identity_))
                         , related_sample_identity_(std::move(wparam.related_sample_identity_))
+                        , coherent_set_(wparam.coherent_set_)
+                        , coherent_set_end_(wparam.coherent_set_end_)
                     {
                     }
 
@@ -65,6 +69,8 @@ namespace eprosima
                     {
                         sample_identity_ = wparam.sample_identity_;
                         related_sample_identity_ = wparam.related_sample_identity_;
+                        coherent_set_ = wparam.coherent_set_;
+                        coherent_set_end_ = wparam.coherent_set_end_;
                         return *this;
                     }
 
@@ -75,6 +81,8 @@ namespace eprosima
                     {
                         sample_identity_ = std::move(wparam.sample_identity_);
                         related_sample_identity_ = std::move(wparam.related_sample_identity_);
+                        coherent_set_ = wparam.coherent_set_;
+                        coherent_set_end_ = wparam.coherent_set_end_;
                         return *this;
                     }
 
@@ -122,6 +130,40 @@ namespace eprosima
                         return related_sample_identity_;
                     }
 
+                    /*!
+                     * @brief Set the coherent set the change belongs to.
+                     * @param first_seq Sequence number of the first change of the coherent set.
+                     */
+                    WriteParams& coherent_set(const SequenceNumber_t &first_seq)
+                    {
+                        coherent_set_ = first_seq;
+                        return *this;
+                    }
+
+                    /*!
+                     * @brief Get the coherent set the change belongs to.
+                     * @return Sequence number of the first change of the coherent set, or unknown if the change does
+                     * not belong to a coherent set.
+                     */
+                    const SequenceNumber_t& coherent_set() const
+                    {
+                        return coherent_set_;
+                    }
+
+                    /*!
+                     * @brief Mark the change as the last one of its coherent set.
+                     */
+                    WriteParams& coherent_set_end(bool is_end)
+                    {
+                        coherent_set_end_ = is_end;
+                        return *this;
+                    }
+
+                    bool coherent_set_end() const
+                    {
+                        return coherent_set_end_;
+                    }
+
                     static WriteParams WRITE_PARAM_DEFAULT;
 
                 private:
@@ -129,6 +171,10 @@ namespace eprosima
                     SampleIdentity sample_identity_;
 
                     SampleIdentity related_sample_identity_;
+
+                    SequenceNumber_t coherent_set_ = SequenceNumber_t::unknown();
+
+                    bool coherent_set_end_ = false;
             };
 
         } //namespace rtps
@@ -23,10 +23,20 @@
 #include <fastdds/rtps/common/all_common.h>
 
 #include <unordered_map>
+#include <memory>
 #include <mutex>
 #include <functional>
+#include <vector>
 
 namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+struct ReceivedDatagram;
+
+} // namespace rtps
+} // namespace fastdds
+
 namespace fastrtps {
 namespace rtps {
 
@@ -65,6 +75,19 @@ public:
             const Locator_t& reception_locator,
             CDRMessage_t* msg);
 
+    /**
+     * Process a batch of CDR messages received on the same listening address.
+     * When crypto worker threads are enabled, the messages of the batch are decoded in parallel and then
+     * processed in the order they were received.
+     * @param [in] datagrams Pointer to the first received message.
+     * @param [in] count Number of messages in the batch.
+     * @param [in] reception_locator Locator indicating the listening address.
+     */
+    void processCDRMsgBatch(
+            const fastdds::rtps::ReceivedDatagram* datagrams,
+            size_t count,
+            const Locator_t& reception_locator);
+
     // Functions to associate/remove associatedendpoints
     void associateEndpoint(
             Endpoint* to_add);
@@ -98,6 +121,10 @@ private:
     CDRMessage_t crypto_submsg_;
     //!Buffer to process a decoded payload
     SerializedPayload_t crypto_payload_;
+    //!Buffers where the RTPS messages of a batch are decoded in parallel
+    std::vector<std::unique_ptr<CDRMessage_t>> crypto_batch_msgs_;
+    //!Result of decoding each RTPS message of a batch
+    std::vector<int> crypto_batch_results_;
 #endif // if HAVE_SECURITY
 
     //! Function used to process a received message
@@ -115,6 +142,22 @@ private:
     //!Reset the MessageReceiver to process a new message.
     void reset();
 
+    /**
+     * Process a new CDR message.
+     * @param [in] source_locator Locator indicating the sending address.
+     * @param [in] reception_locator Locator indicating the listening address.
+     * @param [in] msg Pointer to the message
+     * @param [in] decoded_msg Pointer to the message already decoded by the security plugin, or nullptr if it
+     * should be decoded here.
+     * @param [in] decode_ret Result of decoding decoded_msg, as returned by SecurityManager::decode_rtps_message.
+     */
+    void process_message(
+            const Locator_t& source_locator,
+            const Locator_t& reception_locator,
+            CDRMessage_t* msg,
+            CDRMessage_t* decoded_msg,
+            int decode_ret);
+
     /**
      * Check the RTPSHeader of a received message.
      * @param msg Pointer to the message.
@@ -190,7 +190,7 @@ public:
 private:
 
     static constexpr uint32_t data_frag_header_size_ = 28;
-    static constexpr uint32_t max_inline_qos_size_ = 32;
+    static constexpr uint32_t max_inline_qos_size_ = 48;
 
     void reset_to_header();
 
@@ -223,6 +223,19 @@ private:
     bool add_info_ts_in_buffer(
             const Time_t& timestamp);
 
+    /**
+     * Send the pending submessages together with a DATA or DATA_FRAG, building the message on a buffer loaned
+     * by the shared memory transport, which will not copy it again to its segment.
+     * @param payload_length Length of the payload of the submessage.
+     * @param add_submessage Functor adding the submessage to the message, with signature bool(CDRMessage_t*).
+     * @return false when the message could not be built on a loaned buffer, so the regular path should be used.
+     * @throw timeout if the message could not be sent in time.
+     */
+    template<typename SubmessageFunctor>
+    bool send_on_loaned_buffer(
+            uint32_t payload_length,
+            const SubmessageFunctor& add_submessage);
+
     bool create_gap_submessage(
             const SequenceNumber_t& gap_initial_sequence,
             const SequenceNumberSet_t& gap_bitmap,
@@ -15,6 +15,7 @@
 #ifndef _FASTDDS_RTPS_NETWORK_FACTORY_HPP
 #define _FASTDDS_RTPS_NETWORK_FACTORY_HPP
 
+#include <functional>
 #include <vector>
 #include <memory>
 
@@ -208,6 +209,12 @@ public:
      */
     void Shutdown();
 
+    /**
+     * Calls a function for each of the registered transports.
+     */
+    void for_each_transport(
+            const std::function<void(fastdds::rtps::TransportInterface&)>& function);
+
 private:
 
     std::vector<std::unique_ptr<fastdds::rtps::TransportInterface>> mRegisteredTransports;
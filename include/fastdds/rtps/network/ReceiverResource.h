@@ -50,6 +50,16 @@ public:
     virtual void OnDataReceived(const octet* data, const uint32_t size,
         const Locator_t& localLocator, const Locator_t& remoteLocator) override;
 
+    /**
+     * Method called by the transport when several datagrams have been received at once.
+     * The whole batch is processed holding the lock only once.
+     * @param datagrams Pointer to the first of the received datagrams.
+     * @param count Number of datagrams received.
+     * @param localLocator Locator identifying the local endpoint.
+     */
+    virtual void OnDataBatchReceived(const fastdds::rtps::ReceivedDatagram* datagrams, size_t count,
+        const Locator_t& localLocator) override;
+
     /**
      * Reports whether this resource supports the given local locator (i.e., said locator
      * maps to the transport channel managed by this resource).
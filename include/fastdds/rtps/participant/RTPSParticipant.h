@@ -31,6 +31,13 @@
 namespace eprosima {
 
 namespace fastdds {
+
+namespace rtps {
+
+struct ContentFilterProperty;
+
+} // namespace rtps
+
 namespace dds {
 namespace builtin {
 
@@ -141,12 +148,14 @@ public:
      * @param Reader Pointer to the RTPSReader.
      * @param topicAtt Topic Attributes where you want to register it.
      * @param rqos ReaderQos.
+     * @param content_filter Optional content filtering information.
      * @return True if correctly registered.
      */
     bool registerReader(
             RTPSReader* Reader,
             const TopicAttributes& topicAtt,
-            const ReaderQos& rqos);
+            const ReaderQos& rqos,
+            const fastdds::rtps::ContentFilterProperty* content_filter = nullptr);
 
     /**
      * Update writer QOS
@@ -165,12 +174,14 @@ public:
      * @param Reader to update
      * @param topicAtt Topic Attributes where you want to register it.
      * @param rqos New reader QoS
+     * @param content_filter Optional content filtering information.
      * @return true on success
      */
     bool updateReader(
             RTPSReader* Reader,
             const TopicAttributes& topicAtt,
-            const ReaderQos& rqos);
+            const ReaderQos& rqos,
+            const fastdds::rtps::ContentFilterProperty* content_filter = nullptr);
 
     /**
      * Returns a list with the participant names.
@@ -194,6 +205,10 @@ public:
      */
     uint32_t getMaxDataSize() const;
 
+    /**
+     * Retrieves the event thread for user visible events, like deadline and lifespan.
+     * It is the general event thread of the participant, unless there are threads dedicated to user callbacks.
+     */
     ResourceEvent& get_resource_event() const;
 
     /**
@@ -89,6 +89,19 @@ public:
         (void)change;
     }
 
+    /**
+     * This method is called once the changes of one or more coherent sets, made visible at the same time, have been
+     * notified through onNewCacheChangeAdded.
+     * It is called even if the last change of a set was lost or discarded, so listeners can defer the notifications
+     * of the changes of a set to this point.
+     * @param reader Pointer to the reader.
+     */
+    virtual void on_coherent_set_visible(
+            RTPSReader* reader)
+    {
+        (void)reader;
+    }
+
     /**
      * @brief Method called when the liveliness of a reader changes
      * @param reader The reader
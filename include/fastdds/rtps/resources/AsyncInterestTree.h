@@ -36,6 +36,7 @@ public:
 
     /*!
      * @brief Registers a writer in a hidden queue.
+     * Writers with higher priority are placed before the ones with lower priority.
      * @param writer Pointer to the writer.
      * @return true if the writer was queued or false if it already is queued.
      */
@@ -21,7 +21,10 @@
 
 #include <thread>
 #include <atomic>
+#include <cstdint>
 #include <list>
+#include <memory>
+#include <vector>
 
 #include <fastdds/rtps/resources/AsyncInterestTree.h>
 #include <fastrtps/utils/TimedMutex.hpp>
@@ -34,16 +37,25 @@ namespace rtps {
 class RTPSWriter;
 
 /**
- * @brief This static class owns a thread that manages asynchronous writes.
+ * @brief This class owns the threads that manage asynchronous writes.
  * Asynchronous writes happen directly (when using an async writer) and
  * indirectly (when responding to a NACK).
+ *
+ * Writers are distributed among the sending threads by their GUID, so a writer is always served by the same thread
+ * and a busy writer only delays the writers sharing its thread. Each thread serves its writers in priority order.
  * @ingroup COMMON_MODULE
  */
 class AsyncWriterThread
 {
 public:
 
-    AsyncWriterThread() = default;
+    /*!
+     * @brief Constructor.
+     * @param num_threads Number of sending threads. Values lower than 1 are treated as 1.
+     * @note Threads are only started when a writer on them needs to send.
+     */
+    explicit AsyncWriterThread(
+            uint32_t num_threads = 1);
 
     ~AsyncWriterThread();
 
@@ -73,23 +85,51 @@ public:
         RTPSWriter* interested_writer,
         const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
 
+    /*!
+     * @brief Retrieves the number of sending threads.
+     * @return Number of sending threads.
+     */
+    uint32_t num_threads() const
+    {
+        return static_cast<uint32_t>(shards_.size());
+    }
+
 private:
 
+    //! State of one of the sending threads.
+    struct Shard
+    {
+        std::thread* thread_ = nullptr;
+        RecursiveTimedMutex condition_variable_mutex_;
+
+        //! List of asynchronous writers.
+        AsyncInterestTree interestTree_;
+
+        bool running_ = false;
+        bool run_scheduled_ = false;
+        TimedConditionVariable cv_;
+    };
+
     AsyncWriterThread(const AsyncWriterThread&) = delete;
     const AsyncWriterThread& operator=(const AsyncWriterThread&) = delete;
 
-    //! @brief runs main method
-    void run();
+    //! @brief Returns the shard responsible for a writer.
+    Shard& shard_for(
+            const RTPSWriter* writer);
+
+    //! @brief Starts the thread of a shard, or notifies it if already started. Should be called with its mutex taken.
+    void schedule_nts(
+            Shard& shard);
 
-    std::thread* thread_ = nullptr;
-    RecursiveTimedMutex condition_variable_mutex_;
+    //! @brief Stops the thread of a shard and waits for it to finish.
+    void stop(
+            Shard& shard);
 
-    //! List of asynchronous writers.
-    AsyncInterestTree interestTree_;
+    //! @brief runs main method
+    void run(
+            Shard& shard);
 
-    bool running_ = false;
-    bool run_scheduled_ = false;
-    TimedConditionVariable cv_;
+    std::vector<std::unique_ptr<Shard>> shards_;
 };
 
 } // namespace rtps
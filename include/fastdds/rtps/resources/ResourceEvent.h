@@ -27,6 +27,7 @@
 
 #include <thread>
 #include <atomic>
+#include <memory>
 #include <vector>
 
 namespace eprosima {
@@ -34,16 +35,19 @@ namespace fastrtps {
 namespace rtps {
 
 class TimedEventImpl;
+class TimingWheel;
+struct TimingWheelNode;
 
 /**
  * This class centralizes all operations over timed events in the same thread.
+ * Active events are kept on a hierarchical timing wheel with a resolution of one millisecond.
  * @ingroup MANAGEMENT_MODULE
  */
 class ResourceEvent
 {
 public:
 
-    ResourceEvent() = default;
+    ResourceEvent();
 
     ~ResourceEvent();
 
@@ -102,11 +106,11 @@ private:
     //! Protects internal data.
     TimedMutex mutex_;
 
-    //! Used to warn about changes on allow_vector_manipulation_.
+    //! Used to warn about changes on allow_timer_manipulation_.
     TimedConditionVariable cv_manipulation_;
 
     //! Flag used to allow a thread to manipulate the timer collections when the execution thread is not using them.
-    bool allow_vector_manipulation_ = true;
+    bool allow_timer_manipulation_ = true;
 
     //! Used to warn there are new TimedEventImpl objects to be processed.
     TimedConditionVariable cv_;
@@ -114,11 +118,17 @@ private:
     //! The total number of created timers.
     size_t timers_count_ = 0;
 
+    //! Lock-free list of events notified since it was last taken, linked through the events themselves.
+    std::atomic<TimedEventImpl*> notified_timers_{ nullptr };
+
     //! Collection of events pending update action.
     std::vector<TimedEventImpl*> pending_timers_;
 
-    //! Collection of registered events waiting completion.
-    std::vector<TimedEventImpl*> active_timers_;
+    //! Registered events waiting completion.
+    std::unique_ptr<TimingWheel> active_timers_;
+
+    //! Events expired on the last advance of active_timers_.
+    std::vector<TimingWheelNode*> expired_timers_;
 
     //! Current time as seen by the execution thread.
     std::chrono::steady_clock::time_point current_time_;
@@ -127,20 +137,24 @@ private:
     std::thread thread_;
 
     /*!
-     * @brief Registers a new TimedEventImpl object in the internal queue to be processed.
-     * Non thread safe.
-     * @param event Event to be added in the queue.
-     * @return True value if the insertion was successful. In other case, it return False.
+     * @brief Adds a TimedEventImpl object to the list of notified events, if it is not already on it.
+     * Lock-free.
+     * @param event Event to be added to the list.
+     * @return True value if the execution thread has to be woken up. In other case, it return False.
      */
-    bool register_timer_nts(
+    bool push_notified_timer(
             TimedEventImpl* event);
 
+    /*!
+     * @brief Moves the notified events to pending_timers_.
+     * It has to be called by the execution thread, or with the timer collections manipulation allowed.
+     * @return True value if any event was moved. In other case, it return False.
+     */
+    bool take_notified_timers();
+
     //! Method called by the internal thread.
     void event_service();
 
-    //! Sorts waiting timers in ascending order of trigger time.
-    void sort_timers();
-
     //! Updates internal register of current time.
     void update_current_time();
 
@@ -151,7 +165,7 @@ private:
     void resize_collections()
     {
         pending_timers_.reserve(timers_count_);
-        active_timers_.reserve(timers_count_);
+        expired_timers_.reserve(timers_count_);
     }
 
 };
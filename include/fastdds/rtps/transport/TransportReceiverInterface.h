@@ -15,12 +15,28 @@
 #ifndef _FASTDDS_TRANSPORT_RECEIVER_INTERFACE_H
 #define _FASTDDS_TRANSPORT_RECEIVER_INTERFACE_H
 
+#include <cstddef>
+
 #include <fastdds/rtps/common/Locator.h>
 
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
 
+/**
+ * Description of one of the datagrams given to TransportReceiverInterface::OnDataBatchReceived.
+ * @ingroup TRANSPORT_MODULE
+ */
+struct ReceivedDatagram
+{
+    //! Pointer to the received data.
+    const fastrtps::rtps::octet* data = nullptr;
+    //! Number of bytes received.
+    uint32_t size = 0;
+    //! Locator identifying the remote endpoint.
+    Locator remote_locator;
+};
+
 /**
  * Interface against which to implement a data receiver, decoupled from transport internals.
  * @ingroup TRANSPORT_MODULE
@@ -44,6 +60,24 @@ public:
             const uint32_t size,
             const Locator& local_locator,
             const Locator& remote_locator) = 0;
+
+    /**
+     * Method to be called by the transport when several datagrams have been received on the same channel at once.
+     * The default implementation calls OnDataReceived for each one of them, in order.
+     * @param datagrams Pointer to the first of the received datagrams.
+     * @param count Number of datagrams received.
+     * @param local_locator Locator identifying the local endpoint.
+     */
+    virtual void OnDataBatchReceived(
+            const ReceivedDatagram* datagrams,
+            size_t count,
+            const Locator& local_locator)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            OnDataReceived(datagrams[i].data, datagrams[i].size, local_locator, datagrams[i].remote_locator);
+        }
+    }
 };
 
 } // namespace rtps
@@ -31,6 +31,11 @@ namespace rtps {
  * immediately if the buffer is full, but no error will be returned to the upper layer. This means that the
  * application will behave as if the datagram is sent and lost.
  *
+ * - receive_batch_size: maximum number of datagrams read from an input socket on each receive operation.
+ *
+ * - receive_threads_per_port: number of sockets, each one with its own reception thread, bound to each unicast
+ * input port.
+ *
  * @ingroup TRANSPORT_MODULE
  */
 struct UDPTransportDescriptor : public SocketTransportDescriptor
@@ -68,6 +73,28 @@ struct UDPTransportDescriptor : public SocketTransportDescriptor
      * datagram. This may hinder performance on high-frequency writers.
      */
     bool non_blocking_send = false;
+
+    /**
+     * Maximum number of datagrams read from an input socket on each receive operation.
+     *
+     * When greater than 1, input sockets are drained with a single recvmmsg() call per wake-up, and the received
+     * datagrams are given to the receiver as a batch. Each reception thread preallocates
+     * receive_batch_size * maxMessageSize bytes for this purpose. Values are capped to 1024.
+     *
+     * Only supported on Linux. On other platforms datagrams are always read one by one.
+     */
+    uint32_t receive_batch_size = 1;
+
+    /**
+     * Number of sockets, each one with its own reception thread, bound to each unicast input port.
+     *
+     * When greater than 1, the sockets of a unicast port are bound with SO_REUSEPORT and the kernel spreads the
+     * incoming datagrams among them. Datagrams coming from the same remote socket are always delivered to the same
+     * input socket, so their order is kept. Multicast ports always use a single socket.
+     *
+     * Only supported on Linux. On other platforms a single socket is bound to each port.
+     */
+    uint32_t receive_threads_per_port = 1;
 };
 
 } // namespace rtps
@@ -35,6 +35,19 @@ class TransportInterface;
  *
  * - rtps_dump_file_: full path of the protocol dump file.
  *
+ * - futex_notification_: notify listening ports through shared-memory futexes instead of
+ *   interprocess condition variables (only available on Linux).
+ *
+ * - notification_spin_us_: maximum time a listener busy-waits for a message before blocking,
+ *   when futex notification is used (us).
+ *
+ * - zero_copy_min_size_: minimum size of the messages built directly on a buffer of the segment,
+ *   instead of being copied to it when sent (in octets). 0 disables it.
+ *
+ * - huge_pages_: back the segment with transparent huge pages (only available on Linux).
+ *
+ * - numa_node_: NUMA node the segment memory is bound to, -1 for the default policy (only available on Linux).
+ *
  * @ingroup TRANSPORT_MODULE
  */
 struct SharedMemTransportDescriptor : public TransportDescriptorInterface
@@ -126,6 +139,71 @@ struct SharedMemTransportDescriptor : public TransportDescriptorInterface
         rtps_dump_file_ = rtps_dump_file;
     }
 
+    //! Return whether listening ports are notified through futexes
+    RTPS_DllAPI bool futex_notification() const
+    {
+        return futex_notification_;
+    }
+
+    //! Set whether listening ports are notified through futexes
+    RTPS_DllAPI void futex_notification(
+            bool futex_notification)
+    {
+        futex_notification_ = futex_notification;
+    }
+
+    //! Return the maximum time a listener busy-waits before blocking (us)
+    RTPS_DllAPI uint32_t notification_spin_us() const
+    {
+        return notification_spin_us_;
+    }
+
+    //! Set the maximum time a listener busy-waits before blocking (us)
+    RTPS_DllAPI void notification_spin_us(
+            uint32_t notification_spin_us)
+    {
+        notification_spin_us_ = notification_spin_us;
+    }
+
+    //! Return the minimum size of the messages built directly on the segment (0 means disabled)
+    RTPS_DllAPI uint32_t zero_copy_min_size() const
+    {
+        return zero_copy_min_size_;
+    }
+
+    //! Set the minimum size of the messages built directly on the segment (0 means disabled)
+    RTPS_DllAPI void zero_copy_min_size(
+            uint32_t zero_copy_min_size)
+    {
+        zero_copy_min_size_ = zero_copy_min_size;
+    }
+
+    //! Return whether the segment is backed with huge pages
+    RTPS_DllAPI bool huge_pages() const
+    {
+        return huge_pages_;
+    }
+
+    //! Set whether the segment is backed with huge pages
+    RTPS_DllAPI void huge_pages(
+            bool huge_pages)
+    {
+        huge_pages_ = huge_pages;
+    }
+
+    //! Return the NUMA node the segment memory is bound to (-1 means none)
+    RTPS_DllAPI int32_t numa_node() const
+    {
+        return numa_node_;
+    }
+
+    //! Set the NUMA node the segment memory is bound to (-1 means none)
+    RTPS_DllAPI void numa_node(
+            int32_t numa_node)
+    {
+        numa_node_ = numa_node;
+    }
+
     //! Comparison operator
     RTPS_DllAPI bool operator ==(
             const SharedMemTransportDescriptor& t) const;
@@ -136,6 +214,11 @@ private:
     uint32_t port_queue_capacity_;
     uint32_t healthy_check_timeout_ms_;
     std::string rtps_dump_file_;
+    bool futex_notification_;
+    uint32_t notification_spin_us_;
+    uint32_t zero_copy_min_size_;
+    bool huge_pages_;
+    int32_t numa_node_;
 
 };
 
@@ -165,6 +165,12 @@ public:
         return unsent_fragments_;
     }
 
+    void setUnsentFragments(
+            const FragmentNumberSet_t& unsentFragments)
+    {
+        unsent_fragments_ = unsentFragments;
+    }
+
     void markAllFragmentsAsUnsent()
     {
         if (change_ != nullptr && change_->getFragmentSize() != 0)
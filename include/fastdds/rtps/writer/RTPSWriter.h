@@ -31,6 +31,7 @@
 #include <fastdds/rtps/common/LocatorSelector.hpp>
 #include <fastdds/rtps/messages/RTPSMessageGroup.h>
 #include <fastdds/rtps/messages/RTPSMessageSenderInterface.hpp>
+#include <fastdds/rtps/writer/IReaderDataFilter.hpp>
 #include <fastrtps/qos/LivelinessLostStatus.h>
 #include <fastrtps/utils/collections/ResourceLimitedVector.hpp>
 
@@ -242,6 +243,27 @@ public:
         return is_async_;
     }
 
+    /**
+     * Start a coherent set of changes.
+     * All the changes added to the history until end_coherent_set() is called will belong to the same coherent set.
+     * Their delivery is held, so they are sent together when the set ends.
+     */
+    RTPS_DllAPI void begin_coherent_set();
+
+    /**
+     * End the current coherent set of changes, marking its last change and sending all the changes of the set.
+     */
+    RTPS_DllAPI void end_coherent_set();
+
+    /**
+     * Check whether a coherent set of changes has been started.
+     * @return true between calls to begin_coherent_set() and end_coherent_set()
+     */
+    RTPS_DllAPI inline bool is_coherent_set_open() const
+    {
+        return coherent_set_open_;
+    }
+
     /**
      * Remove an specified max number of changes
      * @param max Maximum number of changes to remove.
@@ -444,6 +466,18 @@ public:
      */
     bool is_datasharing_compatible() const;
 
+    /**
+     * @brief Set a reader data filter to filter the data sent to each matched reader
+     * @param reader_data_filter The reader data filter
+     */
+    void reader_data_filter(
+            fastdds::rtps::IReaderDataFilter* reader_data_filter);
+
+    /**
+     * @brief Get the reader data filter used to filter the data sent to each matched reader
+     */
+    const fastdds::rtps::IReaderDataFilter* reader_data_filter() const;
+
 protected:
 
     //!Is the data sent directly or announced by HB and THEN sent to the ones who ask for it?.
@@ -454,8 +488,14 @@ protected:
     WriterListener* mp_listener = nullptr;
     //!Asynchronous publication activated
     bool is_async_ = false;
+    //!Priority among the asynchronous writers served by the same thread
+    int32_t async_priority_ = 0;
     //!Separate sending activated
     bool m_separateSendingEnabled = false;
+    //!Whether a coherent set of changes is being written
+    bool coherent_set_open_ = false;
+    //!Sequence number of the first change of the coherent set being written
+    SequenceNumber_t coherent_set_first_ = SequenceNumber_t::unknown();
 
     LocatorSelector locator_selector_;
 
@@ -469,6 +509,9 @@ protected:
     //! The liveliness announcement period
     Duration_t liveliness_announcement_period_;
 
+    //! The filter for the matched readers
+    fastdds::rtps::IReaderDataFilter* reader_data_filter_ = nullptr;
+
     void add_guid(
             const GUID_t& remote_guid);
 
@@ -476,6 +519,48 @@ protected:
 
     void update_cached_info_nts();
 
+    /**
+     * Add a change to the coherent set being written, if any.
+     * @param change Pointer to the change just added to the history.
+     * @return true when the change belongs to a coherent set, and its delivery should be held.
+     */
+    bool add_to_coherent_set_nts(
+            CacheChange_t* change);
+
+    /**
+     * Check whether a change is held because it belongs to the coherent set being written.
+     * Held changes should not be sent nor announced on any path (new data, repairs, gaps or heartbeats).
+     * @param seq_num Sequence number of the change.
+     * @return true when the change should not leave the writer yet.
+     */
+    bool is_held_nts(
+            const SequenceNumber_t& seq_num) const
+    {
+        return coherent_set_open_ && coherent_set_first_ != SequenceNumber_t::unknown() &&
+               seq_num >= coherent_set_first_;
+    }
+
+    /**
+     * Start the delivery of a change held by a coherent set that has just ended.
+     * Writers that do not keep held changes out of their delivery structures do not need to override it.
+     * @param change Pointer to the change.
+     * @param max_blocking_time Maximum time this method has to complete the task.
+     */
+    virtual void release_held_change_nts(
+            CacheChange_t* change,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+    {
+        (void)change;
+        (void)max_blocking_time;
+    }
+
+    /**
+     * Get the sequence number of the last change that can be announced to the readers.
+     * @return Sequence number of the last change not held by a coherent set, or c_SequenceNumber_Unknown when the
+     * history is empty.
+     */
+    SequenceNumber_t get_seq_num_max_not_held_nts();
+
     /**
      * Add a change to the unsent list.
      * @param change Pointer to the change to add.
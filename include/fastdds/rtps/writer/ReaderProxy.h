@@ -37,9 +37,11 @@
 #include <fastrtps/utils/collections/ResourceLimitedVector.hpp>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <mutex>
 #include <set>
-#include <atomic>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
@@ -165,38 +167,24 @@ public:
             const SequenceNumber_t& max_seq,
             BinaryFunction f) const
     {
-        if (!changes_for_reader_.empty())
+        // Holes are informed as irrelevant, including those after the last change up to max_seq.
+        SequenceNumber_t end = max_seq;
+        if (0u < num_changes_)
         {
-            SequenceNumber_t current_seq = changes_low_mark_ + 1;
-            ChangeConstIterator it = changes_for_reader_.begin();
-            while (it != changes_for_reader_.end())
-            {
-                // Holes before this change are informed as irrelevant.
-                SequenceNumber_t change_seq = it->getSequenceNumber();
-                for (; current_seq < change_seq; ++current_seq)
-                {
-                    f(current_seq, nullptr);
-                }
-
-                // We then inform of this change if it is unsent, and go to the next one.
-                if (it->getStatus() == UNSENT)
-                {
-                    f(current_seq, &(*it));
-                }
-                ++current_seq;
-                ++it;
-            }
+            end = (std::max)(end, window_sequence(last_change_index()) + 1);
+        }
 
-            // After the last change has been checked, there may be a hole at the end.
-            for (; current_seq < max_seq; ++current_seq)
+        // The window is looked up again on each step, as the function may modify it.
+        for (SequenceNumber_t seq = next_unsent_or_hole(changes_low_mark_ + 1, end); seq < end;
+                seq = next_unsent_or_hole(seq + 1, end))
+        {
+            size_t index = 0;
+            if (window_index(seq, index) && is_tracked(index))
             {
-                f(current_seq, nullptr);
+                ChangeForReader_t change = change_for_reader(index);
+                f(seq, &change);
             }
-        }
-        else
-        {
-            // This may be entered if all changes where removed before being acknowledged.
-            for (SequenceNumber_t seq = changes_low_mark_ + 1; seq < max_seq; ++seq)
+            else
             {
                 f(seq, nullptr);
             }
@@ -448,8 +436,20 @@ private:
     bool disable_positive_acks_;
     //!Pointer to the associated StatefulWriter.
     StatefulWriter* writer_;
-    //!Set of the changes and its state.
-    ResourceLimitedVector<ChangeForReader_t, std::true_type> changes_for_reader_;
+    //! Sequence number of the first position of the window of changes. It is always a multiple of 32.
+    SequenceNumber_t window_base_;
+    //! Number of positions on the window of changes.
+    size_t window_size_;
+    //! Change on each slot of the ring, nullptr for holes and changes without data.
+    std::vector<CacheChange_t*> window_changes_;
+    //! One bitmap per ChangeForReaderStatus_t, with the slots of the ring holding a change on that status.
+    std::array<std::vector<uint32_t>, UNDERWAY + 1> status_bits_;
+    //! Bitmap with the slots of the ring holding a change whose fragments have all been sent.
+    std::vector<uint32_t> fragments_sent_bits_;
+    //! Unsent fragments of the changes that have only been partially sent.
+    ResourceLimitedVector<std::pair<SequenceNumber_t, FragmentNumberSet_t>> partial_fragments_;
+    //! Number of changes on the window.
+    size_t num_changes_;
     //! Timed Event to manage the delay to mark a change as UNACKED after sending it.
     TimedEvent* nack_supression_event_;
     TimedEvent* initial_heartbeat_event_;
@@ -462,9 +462,6 @@ private:
 
     SequenceNumber_t changes_low_mark_;
 
-    using ChangeIterator = ResourceLimitedVector<ChangeForReader_t, std::true_type>::iterator;
-    using ChangeConstIterator = ResourceLimitedVector<ChangeForReader_t, std::true_type>::const_iterator;
-
     void disable_timers();
 
     /*
@@ -491,23 +488,136 @@ private:
             const ChangeForReader_t& change);
 
     /**
-     * @brief Find a change with the specified sequence number.
-     * @param seq_num Sequence number to find.
-     * @param exact When false, the first change with a sequence number not less than seq_num will be returned.
-     * When true, the change with a sequence number value of seq_num will be returned.
-     * @return Iterator pointing to the change, changes_for_reader_.end() if not found.
+     * @brief Get the position of a sequence number on the window of changes.
+     * @param[in]  seq_num Sequence number to look for.
+     * @param[out] index Position of the sequence number, only valid when returning true.
+     * @return true when the sequence number is inside the window, false otherwise.
      */
-    ChangeIterator find_change(
+    bool window_index(
             const SequenceNumber_t& seq_num,
-            bool exact);
+            size_t& index) const;
+
+    SequenceNumber_t window_sequence(
+            size_t index) const
+    {
+        return window_base_ + static_cast<uint32_t>(index);
+    }
+
+    //! Number of bitmap words covered by the window.
+    size_t window_words() const
+    {
+        return (window_size_ + 31u) / 32u;
+    }
+
+    //! Slot of the ring holding a position of the window.
+    size_t ring_slot(
+            size_t index) const;
+
+    //! Word of the ring bitmaps holding a word of the window.
+    size_t ring_word(
+            size_t window_word) const;
+
+    //! 32 bits of a ring bitmap starting at any position of the window. Positions outside the window read as 0.
+    uint32_t window_bits_at(
+            const std::vector<uint32_t>& bits,
+            int64_t position) const;
+
+    //! Check whether a position of the window holds a change.
+    bool is_tracked(
+            size_t index) const;
+
+    //! Get the status of the change on a position of the window. The position should hold a change.
+    ChangeForReaderStatus_t status_at(
+            size_t index) const;
+
+    void set_status_at(
+            size_t index,
+            ChangeForReaderStatus_t status);
+
+    //! Position of the first change on the window. There should be at least one change.
+    size_t first_change_index() const;
+
+    //! Position of the last change on the window. There should be at least one change.
+    size_t last_change_index() const;
 
     /**
-     * @brief Find a change with the specified sequence number.
-     * @param seq_num Sequence number to find.
-     * @return Iterator pointing to the change, changes_for_reader_.end() if not found.
+     * @brief Find the first sequence number, not less than from, that is a hole or an UNSENT change.
+     * @return The sequence number found, or end if there is none before it.
      */
-    ChangeConstIterator find_change(
+    SequenceNumber_t next_unsent_or_hole(
+            const SequenceNumber_t& from,
+            const SequenceNumber_t& end) const;
+
+    /**
+     * @brief Find the first sequence number, not less than from, that is a hole.
+     * @return The sequence number found, or end if there is none before it.
+     */
+    SequenceNumber_t next_hole(
+            const SequenceNumber_t& from,
+            const SequenceNumber_t& end) const;
+
+    //! Build the ChangeForReader_t describing the change on a position of the window.
+    ChangeForReader_t change_for_reader(
+            size_t index) const;
+
+    //! Add a change to the window, extending it on any of its sides and growing the ring when needed.
+    void add_change_to_window(
+            const SequenceNumber_t& seq_num,
+            CacheChange_t* change,
+            ChangeForReaderStatus_t status);
+
+    //! Remove the change on a position of the window.
+    void remove_change_at(
+            size_t index);
+
+    //! Remove all the changes with a sequence number in [from, to).
+    void remove_changes(
+            const SequenceNumber_t& from,
+            const SequenceNumber_t& to);
+
+    //! Save the unsent fragments of the change on a position of the window.
+    void store_unsent_fragments(
+            size_t index,
+            const FragmentNumberSet_t& unsent_fragments);
+
+    //! Forget the fragment state of the change on a position of the window, so all of them are unsent.
+    void reset_fragments(
+            size_t index);
+
+    //! Get the unsent fragments of a partially sent change, or nullptr if it has not been partially sent.
+    const FragmentNumberSet_t* find_partial_fragments(
             const SequenceNumber_t& seq_num) const;
+
+    //! Remove the unsent fragments kept for a partially sent change, if any.
+    void remove_partial_fragments(
+            const SequenceNumber_t& seq_num);
+
+    //! Remove from the beginning of the window the words that only hold acknowledged positions.
+    void trim_window();
+
+    //! Remove from the beginning of the window the words without any change, so its base is on the first change.
+    void skip_leading_holes();
+
+    //! Remove some words from the beginning of the window.
+    void drop_window_words(
+            size_t num_words);
+
+    //! Empty the window, keeping its allocated memory.
+    void clear_window();
+
+    /**
+     * @brief Allocate an empty ring.
+     * @param num_changes Minimum number of positions of the ring.
+     */
+    void allocate_window(
+            size_t num_changes);
+
+    /**
+     * @brief Move the window to a bigger ring, when it spans more sequence numbers than the current one holds.
+     * @param num_positions Minimum number of positions of the new ring.
+     */
+    void grow_window(
+            size_t num_positions);
 };
 
 } /* namespace rtps */
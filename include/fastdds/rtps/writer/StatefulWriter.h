@@ -22,7 +22,6 @@
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
 #include <fastdds/rtps/writer/RTPSWriter.h>
-#include <fastdds/rtps/writer/IReaderDataFilter.hpp>
 #include <fastdds/rtps/history/IChangePool.h>
 #include <fastdds/rtps/history/IPayloadPool.h>
 #include <fastrtps/utils/collections/ResourceLimitedVector.hpp>
@@ -92,6 +91,12 @@ private:
             RTPSParticipantImpl* pimpl,
             const WriterAttributes& att);
 
+    //! Event thread where the events of the reader proxies should run.
+    ResourceEvent& event_service()
+    {
+        return *event_service_;
+    }
+
     //!Timed Event to manage the periodic HB to the Reader.
     TimedEvent* periodic_hb_event_;
 
@@ -101,6 +106,9 @@ private:
     //! A timed event to mark samples as acknowledget (used only if disable positive ACKs QoS is enabled)
     TimedEvent* ack_event_;
 
+    //! Event thread of the writer, also used by its reader proxies.
+    ResourceEvent* event_service_;
+
     //!Count of the sent heartbeats.
     Count_t m_heartbeatCount;
     //!WriterTimes
@@ -110,6 +118,8 @@ private:
     ResourceLimitedVector<ReaderProxy*> matched_remote_readers_;
     //! Vector containing all the inactive, ready for reuse, ReaderProxies.
     ResourceLimitedVector<ReaderProxy*> matched_readers_pool_;
+    //! Remote readers that filtered out the change being delivered by sync_delivery.
+    ResourceLimitedVector<ReaderProxy*> filtered_remote_readers_;
 
     using ReaderProxyIterator = ResourceLimitedVector<ReaderProxy*>::iterator;
     using ReaderProxyConstIterator = ResourceLimitedVector<ReaderProxy*>::const_iterator;
@@ -367,18 +377,6 @@ public:
             const FragmentNumberSet_t fragments_state,
             bool& result) override;
 
-    /**
-     * @brief Set a reader data filter to filter data in ReaderProxies
-     * @param reader_data_filter The reader data filter
-     */
-    void reader_data_filter(
-            fastdds::rtps::IReaderDataFilter* reader_data_filter);
-
-    /**
-     * @brief Get the reader data filter used to filter data in ReaderProxies
-     */
-    const fastdds::rtps::IReaderDataFilter* reader_data_filter() const;
-
 private:
 
     bool is_acked_by_all(
@@ -444,6 +442,22 @@ private:
             CacheChange_t* change,
             const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
 
+    /**
+     * Add a change to the matched readers and start its delivery.
+     * @param change Pointer to the change.
+     * @param max_blocking_time Maximum time this method has to complete the task.
+     * @param synchronous Whether the change should be sent right away.
+     * @return true when the change has been sent.
+     */
+    bool deliver_nts(
+            CacheChange_t* change,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time,
+            bool synchronous);
+
+    void release_held_change_nts(
+            CacheChange_t* change,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time) override;
+
     //! True to disable piggyback heartbeats
     bool disable_heartbeat_piggyback_;
     //! True to disable positive ACKs
@@ -467,8 +481,6 @@ private:
     StatefulWriter& operator =(
             const StatefulWriter&) = delete;
 
-    //! The filter for the reader
-    fastdds::rtps::IReaderDataFilter* reader_data_filter_ = nullptr;
     //! Vector containing all the active ReaderProxies for intraprocess delivery.
     ResourceLimitedVector<ReaderProxy*> matched_local_readers_;
     //! Vector containing all the active ReaderProxies for datasharing delivery.
@@ -196,10 +196,23 @@ private:
     bool datasharing_delivery(
             CacheChange_t* change);
 
+    void release_held_change_nts(
+            CacheChange_t* change,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time) override;
+
     bool intraprocess_delivery(
             CacheChange_t* change,
             ReaderLocator& reader_locator);
 
+    bool is_relevant(
+            const CacheChange_t& change,
+            const ReaderLocator& reader_locator) const;
+
+    bool select_relevant_remote_readers(
+            const CacheChange_t& change);
+
+    void restore_remote_readers_selection();
+
     void send_all_unsent_changes();
 
     void send_unsent_changes_with_flow_control();
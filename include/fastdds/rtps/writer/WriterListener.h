@@ -19,6 +19,7 @@
 #define _FASTDDS_RTPS_WRITERLISTENER_H_
 
 #include <fastdds/rtps/common/MatchingInfo.h>
+#include <fastdds/rtps/reader/ReaderDiscoveryInfo.h>
 #include <fastrtps/qos/LivelinessLostStatus.h>
 #include <fastdds/dds/core/status/PublicationMatchedStatus.hpp>
 #include <fastdds/dds/core/status/IncompatibleQosStatus.hpp>
@@ -110,6 +111,27 @@ public:
         (void)status;
     }
 
+    /**
+     * @brief Method called when a reader is discovered, updated or removed for this writer.
+     * It is called before the reader proxy is created (or after it is destroyed on removal),
+     * so the listener can prepare any per-reader information (i.e. content filters).
+     * @param writer The writer
+     * @param reason The reason motivating this method to be called
+     * @param reader_guid The GUID of the reader
+     * @param reader_info Information about the reader. nullptr when the reader is removed.
+     */
+    virtual void on_reader_discovery(
+            RTPSWriter* writer,
+            ReaderDiscoveryInfo::DISCOVERY_STATUS reason,
+            const GUID_t& reader_guid,
+            const ReaderProxyData* reader_info)
+    {
+        (void)writer;
+        (void)reason;
+        (void)reader_guid;
+        (void)reader_info;
+    }
+
 };
 
 } /* namespace rtps */
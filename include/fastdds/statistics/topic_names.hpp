@@ -59,6 +59,11 @@ constexpr const char* DISCOVERY_TOPIC = "_fastdds_statistics_discovered_entity";
 constexpr const char* SAMPLE_DATAS_TOPIC = "_fastdds_statistics_sample_datas";
 //! Statistics topic that reports the host, user and process where the module is running
 constexpr const char* PHYSICAL_DATA_TOPIC = "_fastdds_statistics_physical_data";
+//! Statistics topic that periodically reports the latency percentiles between any two pairs of matched
+//! DataWriter-DataReader histories
+constexpr const char* HISTORY_LATENCY_SUMMARY_TOPIC = "_fastdds_statistics_history2history_latency_summary";
+//! Statistics topic that periodically reports the network latency percentiles between any two communicating locators
+constexpr const char* NETWORK_LATENCY_SUMMARY_TOPIC = "_fastdds_statistics_network_latency_summary";
 
 } // statistics
 } // fastdds
@@ -0,0 +1,164 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InstanceDeadlineHeap.h
+ *
+ */
+
+#ifndef INSTANCEDEADLINEHEAP_H_
+#define INSTANCEDEADLINEHEAP_H_
+
+#include <fastrtps/common/KeyedChanges.h>
+
+#include <assert.h>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+
+/**
+ * @brief Binary min-heap of instances, ordered by their next deadline.
+ *
+ * Each instance keeps its position on the heap, so its deadline can be updated, or the instance removed, in
+ * logarithmic time, while the instance with the earliest deadline is always available in constant time.
+ * Instances should not be moved in memory while they are on the heap.
+ * @ingroup FASTRTPS_MODULE
+ */
+class InstanceDeadlineHeap
+{
+public:
+
+    /**
+     * @brief Add an instance to the heap, or update its position after its deadline has changed.
+     * @param instance The instance to add or update.
+     */
+    void update(
+            KeyedChanges& instance)
+    {
+        if (KeyedChanges::not_in_deadline_heap == instance.deadline_heap_index)
+        {
+            instance.deadline_heap_index = heap_.size();
+            heap_.push_back(&instance);
+        }
+
+        sift_down(sift_up(instance.deadline_heap_index));
+    }
+
+    /**
+     * @brief Remove an instance from the heap.
+     * @param instance The instance to remove. Nothing is done if it is not on the heap.
+     */
+    void remove(
+            KeyedChanges& instance)
+    {
+        size_t pos = instance.deadline_heap_index;
+        if (KeyedChanges::not_in_deadline_heap == pos)
+        {
+            return;
+        }
+
+        assert(heap_[pos] == &instance);
+        instance.deadline_heap_index = KeyedChanges::not_in_deadline_heap;
+
+        KeyedChanges* last = heap_.back();
+        heap_.pop_back();
+        if (pos < heap_.size())
+        {
+            place(pos, last);
+            sift_down(sift_up(pos));
+        }
+    }
+
+    /**
+     * @brief Get the instance with the earliest deadline.
+     * @return Pointer to the instance, or nullptr if the heap is empty.
+     */
+    KeyedChanges* top() const
+    {
+        return heap_.empty() ? nullptr : heap_.front();
+    }
+
+    bool empty() const
+    {
+        return heap_.empty();
+    }
+
+    size_t size() const
+    {
+        return heap_.size();
+    }
+
+private:
+
+    void place(
+            size_t pos,
+            KeyedChanges* instance)
+    {
+        heap_[pos] = instance;
+        instance->deadline_heap_index = pos;
+    }
+
+    size_t sift_up(
+            size_t pos)
+    {
+        KeyedChanges* instance = heap_[pos];
+        while (pos > 0)
+        {
+            size_t parent = (pos - 1) / 2;
+            if (!(instance->next_deadline_us < heap_[parent]->next_deadline_us))
+            {
+                break;
+            }
+            place(pos, heap_[parent]);
+            pos = parent;
+        }
+        place(pos, instance);
+        return pos;
+    }
+
+    void sift_down(
+            size_t pos)
+    {
+        KeyedChanges* instance = heap_[pos];
+        size_t count = heap_.size();
+        while (true)
+        {
+            size_t child = 2 * pos + 1;
+            if (child >= count)
+            {
+                break;
+            }
+            if (child + 1 < count && heap_[child + 1]->next_deadline_us < heap_[child]->next_deadline_us)
+            {
+                ++child;
+            }
+            if (!(heap_[child]->next_deadline_us < instance->next_deadline_us))
+            {
+                break;
+            }
+            place(pos, heap_[child]);
+            pos = child;
+        }
+        place(pos, instance);
+    }
+
+    //! Instances on the heap
+    std::vector<KeyedChanges*> heap_;
+};
+
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif /* INSTANCEDEADLINEHEAP_H_ */
@@ -22,6 +22,7 @@
 
 #include <fastdds/rtps/common/CacheChange.h>
 #include <chrono>
+#include <vector>
 
 namespace eprosima{
 namespace fastrtps{
@@ -36,6 +37,13 @@ struct KeyedChanges
     KeyedChanges()
         : cache_changes()
         , next_deadline_us()
+        , not_read_count(0)
+        , first_not_read_hint(0)
+        , handle()
+        , lru_prev(nullptr)
+        , lru_next(nullptr)
+        , in_lru(false)
+        , deadline_heap_index(not_in_deadline_heap)
     {
     }
 
@@ -43,6 +51,13 @@ struct KeyedChanges
     KeyedChanges(const KeyedChanges& other)
         : cache_changes(other.cache_changes)
         , next_deadline_us(other.next_deadline_us)
+        , not_read_count(other.not_read_count)
+        , first_not_read_hint(other.first_not_read_hint)
+        , handle(other.handle)
+        , lru_prev(nullptr)
+        , lru_next(nullptr)
+        , in_lru(false)
+        , deadline_heap_index(not_in_deadline_heap)
     {
     }
 
@@ -55,6 +70,23 @@ struct KeyedChanges
     std::vector<rtps::CacheChange_t*> cache_changes;
     //! The time when the group will miss the deadline
     std::chrono::steady_clock::time_point next_deadline_us;
+    //! Number of changes in the group not read by the user yet
+    size_t not_read_count;
+    //! Position of the first change that may not have been read. All the changes before it have been read.
+    size_t first_not_read_hint;
+    //! Instance handle of the group
+    rtps::InstanceHandle_t handle;
+    //! Previous group on the list of empty groups, ordered by the time they became empty
+    KeyedChanges* lru_prev;
+    //! Next group on the list of empty groups, ordered by the time they became empty
+    KeyedChanges* lru_next;
+    //! Whether the group is on the list of empty groups
+    bool in_lru;
+    //! Position of the group on the heap of deadlines
+    size_t deadline_heap_index;
+
+    //! Value of deadline_heap_index when the group is not on the heap of deadlines
+    static constexpr size_t not_in_deadline_heap = static_cast<size_t>(-1);
 };
 
 } /* namespace  */
@@ -25,6 +25,7 @@
 
 #include <fastdds/rtps/history/WriterHistory.h>
 #include <fastrtps/qos/QosPolicies.h>
+#include <fastrtps/common/InstanceDeadlineHeap.h>
 #include <fastrtps/common/KeyedChanges.h>
 #include <fastrtps/attributes/TopicAttributes.h>
 
@@ -147,6 +148,8 @@ private:
 
     //!Map where keys are instance handles and values are vectors of cache changes associated
     t_m_Inst_Caches keyed_changes_;
+    //!Instances ordered by their next deadline
+    InstanceDeadlineHeap deadlines_;
     //!Time point when the next deadline will occur (only used for topics with no key)
     std::chrono::steady_clock::time_point next_deadline_us_;
     //!HistoryQosPolicy values.
@@ -26,9 +26,11 @@
 #include <fastrtps/qos/ReaderQos.h>
 #include <fastdds/rtps/history/ReaderHistory.h>
 #include <fastrtps/qos/QosPolicies.h>
+#include <fastrtps/common/InstanceDeadlineHeap.h>
 #include <fastrtps/common/KeyedChanges.h>
 #include <fastrtps/subscriber/SampleInfo.h>
 #include <fastrtps/attributes/TopicAttributes.h>
+#include <fastrtps/utils/collections/FlatHashIndex.hpp>
 
 #include <chrono>
 #include <functional>
@@ -169,14 +171,60 @@ public:
             const rtps::InstanceHandle_t& handle,
             bool exact);
 
+    /**
+     * Called when a change is marked as read by the user, to keep the sample state counters updated.
+     * No Thread Safe
+     * @param change The change that has just been marked as read.
+     */
+    void change_was_read_nts(
+            const rtps::CacheChange_t* change);
+
+    /**
+     * @brief Get the number of changes in the history that have not been read by the user.
+     * @return Number of changes in NOT_READ sample state.
+     */
+    size_t get_not_read_count() const;
+
+    /**
+     * @brief Get the number of changes of an instance that have not been read by the user.
+     * No Thread Safe
+     * @param instance Instance information, as returned by lookup_instance.
+     * @return Number of changes of the instance in NOT_READ sample state.
+     */
+    size_t get_not_read_count(
+            const instance_info& instance) const;
+
+    /**
+     * @brief Get the first change of an instance that may not have been read by the user.
+     * All the changes before the returned one have already been read, so callers only interested in changes on the
+     * NOT_READ sample state can start traversing the instance from it.
+     * No Thread Safe
+     * @param instance Instance information, as returned by lookup_instance.
+     * @return Iterator on the list of changes of the instance.
+     */
+    iterator get_first_not_read_change(
+            const instance_info& instance);
+
 private:
 
     using t_m_Inst_Caches = std::map<rtps::InstanceHandle_t, KeyedChanges>;
 
     //!Map where keys are instance handles and values vectors of cache changes
     t_m_Inst_Caches keyed_changes_;
+    //!Hash index on keyed_changes_, used for exact lookups of instances
+    FlatHashIndex<rtps::InstanceHandle_t, t_m_Inst_Caches::iterator> instances_index_;
+    //!First instance on the list of instances without changes (i.e. the one that has been empty for longer)
+    KeyedChanges* empty_instances_head_;
+    //!Last instance on the list of instances without changes
+    KeyedChanges* empty_instances_tail_;
+    //!Instances ordered by their next deadline
+    InstanceDeadlineHeap deadlines_;
     //!Time point when the next deadline will occur (only used for topics with no key)
     std::chrono::steady_clock::time_point next_deadline_us_;
+    //!Number of changes in the history not read by the user
+    size_t not_read_count_;
+    //!Position of the first change that may not have been read (only used for topics with no key)
+    size_t first_not_read_hint_;
     //!HistoryQosPolicy values.
     HistoryQosPolicy history_qos_;
     //!ResourceLimitsQosPolicy values.
@@ -214,6 +262,41 @@ private:
             rtps::CacheChange_t* a_change,
             t_m_Inst_Caches::iterator& map_it);
 
+    /**
+     * @brief Look for an instance using the hash index
+     * @param handle The handle to the instance
+     * @return Pointer to the instance, or nullptr if not found
+     */
+    KeyedChanges* find_instance(
+            const rtps::InstanceHandle_t& handle);
+
+    const KeyedChanges* find_instance(
+            const rtps::InstanceHandle_t& handle) const;
+
+    /**
+     * @brief Add an instance at the end of the list of instances without changes
+     * @param instance The instance that has just become empty
+     */
+    void link_empty_instance(
+            KeyedChanges& instance);
+
+    /**
+     * @brief Remove an instance from the list of instances without changes
+     * @param instance The instance to remove from the list
+     */
+    void unlink_empty_instance(
+            KeyedChanges& instance);
+
+    /**
+     * @brief Remove a change from the list of changes of an instance, keeping its sample state counters updated
+     * @param instance The instance holding the change
+     * @param chit Iterator to the change on the list of changes of the instance
+     * @return Iterator to the next change of the instance
+     */
+    iterator remove_instance_change(
+            KeyedChanges& instance,
+            iterator chit);
+
     /**
      * @name Variants of incoming change processing.
      *       Will be called with the history mutex taken.
@@ -244,7 +327,7 @@ private:
 
     bool add_received_change_with_key(
             rtps::CacheChange_t* a_change,
-            std::vector<rtps::CacheChange_t*>& instance_changes);
+            KeyedChanges& instance);
 
     bool deserialize_change(
             rtps::CacheChange_t* change,
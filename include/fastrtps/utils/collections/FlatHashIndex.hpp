@@ -0,0 +1,241 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FlatHashIndex.hpp
+ *
+ */
+
+#ifndef FASTRTPS_UTILS_COLLECTIONS_FLATHASHINDEX_HPP_
+#define FASTRTPS_UTILS_COLLECTIONS_FLATHASHINDEX_HPP_
+
+#include <assert.h>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+
+/**
+ * Flat hash table mapping keys to small values.
+ *
+ * This template class holds its elements on a single contiguous array, using open addressing with linear probing.
+ * Removed elements are not marked with tombstones. The elements following them on the same probe sequence are moved
+ * back instead, so lookups never degrade after many insertions and removals.
+ *
+ * The table is grown when it gets half full, so the capacity is always a power of two.
+ * Pointers to values are invalidated by insertions and removals.
+ *
+ * @tparam _Key    Key type. Should be default constructible, copyable and equality comparable.
+ * @tparam _Value  Value type. Should be default constructible and copyable. Intended for small values, like pointers
+ *                 or iterators to the actual data.
+ * @tparam _Hash   Hash function for the keys, defaults to std::hash<_Key>.
+ *
+ * @ingroup UTILITIES_MODULE
+ */
+template <
+    typename _Key,
+    typename _Value,
+    typename _Hash = std::hash<_Key>>
+class FlatHashIndex
+{
+public:
+
+    using key_type = _Key;
+    using mapped_type = _Value;
+    using hasher = _Hash;
+    using size_type = std::size_t;
+
+    /**
+     * Construct a FlatHashIndex.
+     *
+     * @param initial_capacity  Minimum number of elements the table can hold before being grown.
+     */
+    explicit FlatHashIndex(
+            size_type initial_capacity = 8)
+        : size_(0)
+    {
+        size_type capacity = 16;
+        while (capacity < 2 * initial_capacity)
+        {
+            capacity <<= 1;
+        }
+        slots_.resize(capacity);
+    }
+
+    /**
+     * Look for a key in the table.
+     *
+     * @param key  The key to look for.
+     *
+     * @return Pointer to the value associated to the key, or nullptr if the key is not in the table.
+     */
+    mapped_type* find(
+            const key_type& key)
+    {
+        size_type mask = slots_.size() - 1;
+        for (size_type pos = hasher()(key) & mask; slots_[pos].used; pos = (pos + 1) & mask)
+        {
+            if (slots_[pos].key == key)
+            {
+                return &slots_[pos].value;
+            }
+        }
+
+        return nullptr;
+    }
+
+    const mapped_type* find(
+            const key_type& key) const
+    {
+        return const_cast<FlatHashIndex*>(this)->find(key);
+    }
+
+    /**
+     * Add a key to the table.
+     *
+     * @param key    The key to add.
+     * @param value  The value to associate to the key.
+     *
+     * @return true if the key was added, false if it was already on the table.
+     */
+    bool insert(
+            const key_type& key,
+            const mapped_type& value)
+    {
+        if (2 * (size_ + 1) > slots_.size())
+        {
+            grow();
+        }
+
+        size_type mask = slots_.size() - 1;
+        size_type pos = hasher()(key) & mask;
+        for (; slots_[pos].used; pos = (pos + 1) & mask)
+        {
+            if (slots_[pos].key == key)
+            {
+                return false;
+            }
+        }
+
+        slots_[pos].key = key;
+        slots_[pos].value = value;
+        slots_[pos].used = true;
+        ++size_;
+        return true;
+    }
+
+    /**
+     * Remove a key from the table.
+     *
+     * @param key  The key to remove.
+     *
+     * @return true if the key was removed, false if it was not on the table.
+     */
+    bool erase(
+            const key_type& key)
+    {
+        size_type mask = slots_.size() - 1;
+        size_type hole = hasher()(key) & mask;
+        while (slots_[hole].used && !(slots_[hole].key == key))
+        {
+            hole = (hole + 1) & mask;
+        }
+
+        if (!slots_[hole].used)
+        {
+            return false;
+        }
+
+        // Move back the elements on the probe sequence that would not be reachable with the hole.
+        size_type pos = hole;
+        while (true)
+        {
+            pos = (pos + 1) & mask;
+            if (!slots_[pos].used)
+            {
+                break;
+            }
+
+            size_type home = hasher()(slots_[pos].key) & mask;
+            bool reachable = (hole <= pos) ? (hole < home && home <= pos) : (hole < home || home <= pos);
+            if (!reachable)
+            {
+                slots_[hole] = slots_[pos];
+                hole = pos;
+            }
+        }
+
+        slots_[hole] = Slot();
+        --size_;
+        return true;
+    }
+
+    /**
+     * Remove all the elements of the table, keeping its capacity.
+     */
+    void clear()
+    {
+        for (Slot& slot : slots_)
+        {
+            slot = Slot();
+        }
+        size_ = 0;
+    }
+
+    size_type size() const
+    {
+        return size_;
+    }
+
+    bool empty() const
+    {
+        return 0 == size_;
+    }
+
+private:
+
+    struct Slot
+    {
+        key_type key{};
+        mapped_type value{};
+        bool used = false;
+    };
+
+    void grow()
+    {
+        std::vector<Slot> old_slots(slots_.size() * 2);
+        old_slots.swap(slots_);
+        size_ = 0;
+
+        for (const Slot& slot : old_slots)
+        {
+            if (slot.used)
+            {
+                bool inserted = insert(slot.key, slot.value);
+                static_cast<void>(inserted);
+                assert(inserted);
+            }
+        }
+    }
+
+    std::vector<Slot> slots_;
+    size_type size_;
+};
+
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif /* FASTRTPS_UTILS_COLLECTIONS_FLATHASHINDEX_HPP_ */
@@ -60,6 +60,8 @@ extern const char* RECEIVE_BUFFER_SIZE;
 extern const char* SEND_BUFFER_SIZE;
 extern const char* TTL;
 extern const char* NON_BLOCKING_SEND;
+extern const char* RECEIVE_BATCH_SIZE;
+extern const char* RECEIVE_THREADS_PER_PORT;
 extern const char* WHITE_LIST;
 extern const char* MAX_MESSAGE_SIZE;
 extern const char* MAX_INITIAL_PEERS_RANGE;
@@ -81,6 +83,12 @@ extern const char* HEALTHY_CHECK_TIMEOUT_MS;
 extern const char* DISCARD;
 extern const char* FAIL;
 extern const char* RTPS_DUMP_FILE;
+extern const char* FUTEX_NOTIFICATION;
+extern const char* NOTIFICATION_SPIN_US;
+extern const char* ZERO_COPY_MIN_SIZE;
+extern const char* HUGE_PAGES;
+extern const char* NUMA_NODE;
+extern const char* PREFAULT;
 extern const char* ON;
 
 // IntraprocessDeliveryType
@@ -211,6 +219,7 @@ extern const char* DATA_SHARING;
 
 extern const char* SYNCHRONOUS;
 extern const char* ASYNCHRONOUS;
+extern const char* PRIORITY;
 extern const char* NAMES;
 extern const char* INSTANCE;
 extern const char* GROUP;
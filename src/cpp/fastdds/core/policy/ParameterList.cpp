@@ -40,6 +40,7 @@ bool ParameterList::writeEncapsulationToCDRMsg(
 bool ParameterList::updateCacheChangeFromInlineQos(
         fastrtps::rtps::CacheChange_t& change,
         fastrtps::rtps::CDRMessage_t* msg,
+        const fastrtps::rtps::VendorId_t& source_vendor_id,
         uint32_t& qos_size)
 {
     auto parameter_process = [&](
@@ -77,6 +78,31 @@ bool ParameterList::updateCacheChangeFromInlineQos(
                         break;
                     }
 
+                    case PID_COHERENT_SET:
+                    {
+                        if (plength >= 8)
+                        {
+                            fastrtps::rtps::SequenceNumber_t first_seq;
+                            if (!fastrtps::rtps::CDRMessage::readSequenceNumber(msg, &first_seq))
+                            {
+                                return false;
+                            }
+
+                            change.write_params.coherent_set(first_seq);
+                        }
+                        break;
+                    }
+
+                    case PID_COHERENT_SET_END:
+                    {
+                        // Vendor specific parameter, other vendors may use its id for something else
+                        if (fastrtps::rtps::c_VendorId_eProsima == source_vendor_id)
+                        {
+                            change.write_params.coherent_set_end(true);
+                        }
+                        break;
+                    }
+
                     case PID_STATUS_INFO:
                     {
                         ParameterStatusInfo_t p(pid, plength);
@@ -20,7 +20,11 @@
 #ifndef FASTDDS_CORE_POLICY__PARAMETERSERIALIZER_HPP_
 #define FASTDDS_CORE_POLICY__PARAMETERSERIALIZER_HPP_
 
+#include <cstring>
+#include <limits>
+
 #include "ParameterList.hpp"
+#include <fastdds/rtps/builtin/data/ContentFilterProperty.hpp>
 #include <fastdds/rtps/common/CDRMessage_t.h>
 
 namespace eprosima {
@@ -96,6 +100,8 @@ public:
     static constexpr uint32_t PARAMETER_KEY_SIZE = 20u;
     static constexpr uint32_t PARAMETER_SENTINEL_SIZE = 4u;
     static constexpr uint32_t PARAMETER_SAMPLE_IDENTITY_SIZE = 28u;
+    static constexpr uint32_t PARAMETER_COHERENT_SET_SIZE = 12u;
+    static constexpr uint32_t PARAMETER_COHERENT_SET_END_SIZE = 4u;
 
     static bool add_parameter_status(
             fastrtps::rtps::CDRMessage_t* cdr_message,
@@ -161,6 +167,35 @@ public:
         return true;
     }
 
+    static bool add_parameter_coherent_set(
+            fastrtps::rtps::CDRMessage_t* cdr_message,
+            const fastrtps::rtps::SequenceNumber_t& first_seq)
+    {
+        if (cdr_message->pos + 12 > cdr_message->max_size)
+        {
+            return false;
+        }
+
+        fastrtps::rtps::CDRMessage::addUInt16(cdr_message, fastdds::dds::PID_COHERENT_SET);
+        fastrtps::rtps::CDRMessage::addUInt16(cdr_message, 8);
+        fastrtps::rtps::CDRMessage::addInt32(cdr_message, first_seq.high);
+        fastrtps::rtps::CDRMessage::addUInt32(cdr_message, first_seq.low);
+        return true;
+    }
+
+    static bool add_parameter_coherent_set_end(
+            fastrtps::rtps::CDRMessage_t* cdr_message)
+    {
+        if (cdr_message->pos + 4 > cdr_message->max_size)
+        {
+            return false;
+        }
+
+        fastrtps::rtps::CDRMessage::addUInt16(cdr_message, fastdds::dds::PID_COHERENT_SET_END);
+        fastrtps::rtps::CDRMessage::addUInt16(cdr_message, 0);
+        return true;
+    }
+
     static inline uint32_t cdr_serialized_size(
             const fastrtps::string_255& str)
     {
@@ -575,6 +610,97 @@ inline bool ParameterSerializer<ParameterBuiltinEndpointSet_t>::read_content_fro
     return fastrtps::rtps::CDRMessage::readUInt32(cdr_message, &parameter.endpointSet);
 }
 
+template<>
+class ParameterSerializer<fastdds::rtps::ContentFilterProperty>
+{
+public:
+
+    static uint32_t cdr_serialized_size(
+            const fastdds::rtps::ContentFilterProperty& parameter)
+    {
+        // p_id + p_length
+        uint32_t ret_val = 2 + 2;
+        ret_val += string_serialized_size(parameter.content_filtered_topic_name.c_str());
+        ret_val += string_serialized_size(parameter.related_topic_name.c_str());
+        ret_val += string_serialized_size(parameter.filter_class_name.c_str());
+        ret_val += string_serialized_size(parameter.filter_expression.c_str());
+        // n_parameters
+        ret_val += 4;
+        for (const std::string& param : parameter.expression_parameters)
+        {
+            ret_val += string_serialized_size(param.c_str());
+        }
+        return ret_val;
+    }
+
+    static bool add_to_cdr_message(
+            const fastdds::rtps::ContentFilterProperty& parameter,
+            fastrtps::rtps::CDRMessage_t* cdr_message)
+    {
+        uint32_t length = cdr_serialized_size(parameter) - 4;
+        if (length > std::numeric_limits<uint16_t>::max())
+        {
+            return false;
+        }
+
+        bool valid = fastrtps::rtps::CDRMessage::addUInt16(cdr_message, PID_CONTENT_FILTER_PROPERTY);
+        valid &= fastrtps::rtps::CDRMessage::addUInt16(cdr_message, static_cast<uint16_t>(length));
+        valid &= fastrtps::rtps::CDRMessage::add_string(cdr_message, parameter.content_filtered_topic_name);
+        valid &= fastrtps::rtps::CDRMessage::add_string(cdr_message, parameter.related_topic_name);
+        valid &= fastrtps::rtps::CDRMessage::add_string(cdr_message, parameter.filter_class_name);
+        valid &= fastrtps::rtps::CDRMessage::add_string(cdr_message, parameter.filter_expression);
+        valid &= fastrtps::rtps::CDRMessage::addUInt32(cdr_message,
+                        static_cast<uint32_t>(parameter.expression_parameters.size()));
+        for (const std::string& param : parameter.expression_parameters)
+        {
+            valid &= fastrtps::rtps::CDRMessage::add_string(cdr_message, param);
+        }
+        return valid;
+    }
+
+    static bool read_from_cdr_message(
+            fastdds::rtps::ContentFilterProperty& parameter,
+            fastrtps::rtps::CDRMessage_t* cdr_message,
+            const uint16_t parameter_length)
+    {
+        uint32_t pos_ref = cdr_message->pos;
+        bool valid = fastrtps::rtps::CDRMessage::readString(cdr_message, &parameter.content_filtered_topic_name);
+        valid = valid && fastrtps::rtps::CDRMessage::readString(cdr_message, &parameter.related_topic_name);
+        valid = valid && fastrtps::rtps::CDRMessage::readString(cdr_message, &parameter.filter_class_name);
+        valid = valid && fastrtps::rtps::CDRMessage::readString(cdr_message, &parameter.filter_expression);
+
+        uint32_t num_parameters = 0;
+        valid = valid && fastrtps::rtps::CDRMessage::readUInt32(cdr_message, &num_parameters);
+        // Each parameter takes at least 4 bytes
+        valid = valid && (num_parameters <= parameter_length / 4u);
+        if (!valid)
+        {
+            return false;
+        }
+
+        parameter.expression_parameters.resize(num_parameters);
+        for (std::string& param : parameter.expression_parameters)
+        {
+            if (!fastrtps::rtps::CDRMessage::readString(cdr_message, &param))
+            {
+                return false;
+            }
+        }
+
+        return parameter_length == cdr_message->pos - pos_ref;
+    }
+
+private:
+
+    static uint32_t string_serialized_size(
+            const char* str)
+    {
+        // str_len + str_data + null_char, aligned to 4
+        return (4 + static_cast<uint32_t>(strlen(str)) + 1 + 3) & ~3u;
+    }
+
+};
+
 template<>
 inline uint32_t ParameterSerializer<ParameterPropertyList_t>::cdr_serialized_size(
         const ParameterPropertyList_t& parameter)
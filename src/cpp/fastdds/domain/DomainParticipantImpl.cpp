@@ -28,6 +28,7 @@
 #include <fastdds/dds/subscriber/Subscriber.hpp>
 #include <fastdds/dds/subscriber/DataReader.hpp>
 #include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/topic/ContentFilteredTopic.hpp>
 
 #include <fastdds/rtps/RTPSDomain.h>
 #include <fastdds/rtps/builtin/liveliness/WLP.h>
@@ -49,6 +50,8 @@
 
 #include <fastdds/publisher/PublisherImpl.hpp>
 #include <fastdds/subscriber/SubscriberImpl.hpp>
+#include <fastdds/topic/ContentFilteredTopicImpl.hpp>
+#include <fastdds/topic/DDSSQLFilter/DDSFilterFactory.hpp>
 #include <fastdds/topic/TopicImpl.hpp>
 
 #include <rtps/RTPSDomainImpl.hpp>
@@ -221,6 +224,12 @@ DomainParticipantImpl::~DomainParticipantImpl()
     {
         std::lock_guard<std::mutex> lock(mtx_topics_);
 
+        for (auto topic_it = content_topics_.begin(); topic_it != content_topics_.end(); ++topic_it)
+        {
+            delete topic_it->second;
+        }
+        content_topics_.clear();
+
         for (auto topic_it = topics_.begin(); topic_it != topics_.end(); ++topic_it)
         {
             delete topic_it->second;
@@ -448,6 +457,99 @@ ReturnCode_t DomainParticipantImpl::delete_topic(
     return ReturnCode_t::RETCODE_ERROR;
 }
 
+ContentFilteredTopic* DomainParticipantImpl::create_contentfilteredtopic(
+        const std::string& name,
+        const Topic* related_topic,
+        const std::string& filter_expression,
+        const std::vector<std::string>& expression_parameters)
+{
+    if (related_topic == nullptr || participant_ != related_topic->get_participant())
+    {
+        logError(PARTICIPANT, "Related topic for ContentFilteredTopic " << name << " is not valid");
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx_topics_);
+
+    //Check there is no TopicDescription with the same name
+    if (topics_.find(name) != topics_.end() || content_topics_.find(name) != content_topics_.end())
+    {
+        logError(PARTICIPANT, "Topic with name : " << name << " already exists");
+        return nullptr;
+    }
+
+    auto related_it = topics_.find(related_topic->get_name());
+    if (related_it == topics_.end())
+    {
+        logError(PARTICIPANT, "Related topic " << related_topic->get_name() << " does not belong to this participant");
+        return nullptr;
+    }
+
+    // An empty expression means that every sample passes the filter
+    std::unique_ptr<DDSSQLFilter::DDSFilterExpression> filter;
+    if (!filter_expression.empty())
+    {
+        ReturnCode_t ret = DDSSQLFilter::DDSFilterFactory::create_filter(related_it->second->get_type(),
+                        filter_expression, expression_parameters, filter);
+        if (ReturnCode_t::RETCODE_OK != ret)
+        {
+            logError(PARTICIPANT, "Could not create filter '" << filter_expression << "' for ContentFilteredTopic "
+                                                              << name);
+            return nullptr;
+        }
+    }
+    else if (!expression_parameters.empty())
+    {
+        logError(PARTICIPANT, "Expression parameters given for an empty filter expression");
+        return nullptr;
+    }
+
+    Topic* topic = related_it->second->user_topic_;
+    ContentFilteredTopicImpl* topic_impl = new ContentFilteredTopicImpl(this, topic, filter_expression,
+                    expression_parameters, std::move(filter));
+    ContentFilteredTopic* content_topic = new ContentFilteredTopic(name, topic, topic_impl);
+    topic_impl->user_topic_ = content_topic;
+
+    // The related topic cannot be deleted while the ContentFilteredTopic exists
+    related_it->second->reference();
+
+    //SAVE THE TOPIC INTO MAPS
+    content_topics_[name] = topic_impl;
+
+    return content_topic;
+}
+
+ReturnCode_t DomainParticipantImpl::delete_contentfilteredtopic(
+        const ContentFilteredTopic* topic)
+{
+    if (topic == nullptr)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    if (participant_ != topic->get_participant())
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx_topics_);
+    auto it = content_topics_.find(topic->get_name());
+
+    if (it != content_topics_.end())
+    {
+        if (it->second->is_referenced())
+        {
+            return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+        }
+        it->second->get_related_topic()->get_impl()->dereference();
+        delete it->second;
+        content_topics_.erase(it);
+        return ReturnCode_t::RETCODE_OK;
+    }
+
+    return ReturnCode_t::RETCODE_ERROR;
+}
+
 const InstanceHandle_t& DomainParticipantImpl::get_instance_handle() const
 {
     return static_cast<const InstanceHandle_t&>(guid_);
@@ -958,7 +1060,7 @@ Topic* DomainParticipantImpl::create_topic(
     std::lock_guard<std::mutex> lock(mtx_topics_);
 
     //Check there is no Topic with the same name
-    if (topics_.find(topic_name) != topics_.end())
+    if (topics_.find(topic_name) != topics_.end() || content_topics_.find(topic_name) != content_topics_.end())
     {
         logError(PARTICIPANT, "Topic with name : " << topic_name << " already exists");
         return nullptr;
@@ -1017,6 +1119,13 @@ TopicDescription* DomainParticipantImpl::lookup_topicdescription(
         return it->second->user_topic_;
     }
 
+    auto content_it = content_topics_.find(topic_name);
+
+    if (content_it != content_topics_.end())
+    {
+        return content_it->second->user_topic_;
+    }
+
     return nullptr;
 }
 
@@ -1729,6 +1838,10 @@ bool DomainParticipantImpl::has_active_entities()
     {
         return true;
     }
+    if (!content_topics_.empty())
+    {
+        return true;
+    }
     return false;
 }
 
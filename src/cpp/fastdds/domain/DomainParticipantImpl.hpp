@@ -55,6 +55,8 @@ class SubscriberAttributes;
 namespace fastdds {
 namespace dds {
 
+class ContentFilteredTopic;
+class ContentFilteredTopicImpl;
 class DomainParticipant;
 class DomainParticipantListener;
 class Publisher;
@@ -196,6 +198,30 @@ public:
     ReturnCode_t delete_topic(
             const Topic* topic);
 
+    /**
+     * Create a ContentFilteredTopic in this Participant.
+     * @param name Name of the ContentFilteredTopic
+     * @param related_topic Related Topic to being subscribed
+     * @param filter_expression Logic expression to create filter
+     * @param expression_parameters Parameters to filter content
+     * @return Pointer to the created ContentFilteredTopic, nullptr in error case
+     */
+    ContentFilteredTopic* create_contentfilteredtopic(
+            const std::string& name,
+            const Topic* related_topic,
+            const std::string& filter_expression,
+            const std::vector<std::string>& expression_parameters);
+
+    /**
+     * Deletes an existing ContentFilteredTopic.
+     * @param topic ContentFilteredTopic to be deleted
+     * @return RETCODE_BAD_PARAMETER if the topic passed is a nullptr, RETCODE_PRECONDITION_NOT_MET if the topic does
+     * not belong to this participant or if it is referenced by any entity and RETCODE_OK if the ContentFilteredTopic
+     * was deleted.
+     */
+    ReturnCode_t delete_contentfilteredtopic(
+            const ContentFilteredTopic* topic);
+
     /**
      * Looks up an existing, locally created @ref TopicDescription, based on its name.
      * May be called on a disabled participant.
@@ -437,6 +463,7 @@ protected:
     //!Topic map
     std::map<std::string, TopicImpl*> topics_;
     std::map<InstanceHandle_t, Topic*> topics_by_handle_;
+    std::map<std::string, ContentFilteredTopicImpl*> content_topics_;
     mutable std::mutex mtx_topics_;
 
     TopicQos default_topic_qos_;
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <fastdds/dds/log/FileConsumer.hpp>
+#include <fastdds/dds/log/Colors.hpp>
 #include <iomanip>
 
 namespace eprosima {
@@ -45,6 +46,21 @@ FileConsumer::~FileConsumer()
     file_.close();
 }
 
+void FileConsumer::ConsumeBatch(
+        const std::vector<Log::Entry>& entries)
+{
+    for (const Log::Entry& entry : entries)
+    {
+        print_timestamp(file_, entry, true);
+        print_header(file_, entry, true);
+        print_message(file_, entry, true);
+        print_context(file_, entry, true);
+        // Avoid std::endl, as it would flush the file for every entry
+        file_ << C_DEF << '\n';
+    }
+    file_.flush();
+}
+
 std::ostream& FileConsumer::get_stream(
         const Log::Entry& entry)
 {
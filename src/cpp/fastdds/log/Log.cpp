@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <chrono>
 #include <iomanip>
 #include <mutex>
@@ -21,6 +22,7 @@
 #include <fastdds/dds/log/StdoutConsumer.hpp>
 #include <fastdds/dds/log/StdoutErrConsumer.hpp>
 #include <fastdds/dds/log/Colors.hpp>
+#include <fastdds/log/LogRingBuffer.hpp>
 #include <iostream>
 
 using namespace std;
@@ -28,8 +30,143 @@ namespace eprosima {
 namespace fastdds {
 namespace dds {
 
+using detail::LogRecord;
+using detail::LogRingBuffer;
+
+namespace {
+
+//! Size of the buffer of each logging thread. Should be a power of two.
+constexpr uint32_t thread_ring_capacity = 64u * 1024u;
+
+static_assert(Log::max_message_size < thread_ring_capacity / 2, "Formatted messages should fit on the thread buffers");
+
+//! Fixed part of the records stored on the thread buffers, followed by the binary encoded arguments.
+struct RecordHeader
+{
+    Log::Context context;
+    Log::Kind kind;
+    bool truncated;
+    //! Wall clock time, for the timestamp of the entry.
+    int64_t system_time;
+    //! Monotonic time, used to sort the entries of different threads.
+    int64_t steady_time;
+};
+
+//! Owns the buffer of a thread while it is alive.
+struct ThreadRing
+{
+    ~ThreadRing()
+    {
+        if (ring)
+        {
+            ring->close();
+        }
+    }
+
+    std::shared_ptr<LogRingBuffer> ring;
+};
+
+thread_local ThreadRing this_thread_ring;
+thread_local bool is_logging_thread = false;
+
+template<typename T>
+const uint8_t* read_argument(
+        const uint8_t* data,
+        std::ostream& stream)
+{
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    stream << value;
+    return data + sizeof(T);
+}
+
+// Formats the binary encoded arguments of a record, as built by LogRecord.
+void format_arguments(
+        const uint8_t* data,
+        const uint8_t* end,
+        std::ostringstream& stream)
+{
+    while (data < end)
+    {
+        LogRecord::ArgumentKind kind = static_cast<LogRecord::ArgumentKind>(*data++);
+        switch (kind)
+        {
+            case LogRecord::ARG_BOOL:
+                data = read_argument<bool>(data, stream);
+                break;
+            case LogRecord::ARG_CHAR:
+                data = read_argument<char>(data, stream);
+                break;
+            case LogRecord::ARG_SIGNED_CHAR:
+                data = read_argument<signed char>(data, stream);
+                break;
+            case LogRecord::ARG_UNSIGNED_CHAR:
+                data = read_argument<unsigned char>(data, stream);
+                break;
+            case LogRecord::ARG_SHORT:
+                data = read_argument<short>(data, stream);
+                break;
+            case LogRecord::ARG_UNSIGNED_SHORT:
+                data = read_argument<unsigned short>(data, stream);
+                break;
+            case LogRecord::ARG_INT:
+                data = read_argument<int>(data, stream);
+                break;
+            case LogRecord::ARG_UNSIGNED_INT:
+                data = read_argument<unsigned int>(data, stream);
+                break;
+            case LogRecord::ARG_LONG:
+                data = read_argument<long>(data, stream);
+                break;
+            case LogRecord::ARG_UNSIGNED_LONG:
+                data = read_argument<unsigned long>(data, stream);
+                break;
+            case LogRecord::ARG_LONG_LONG:
+                data = read_argument<long long>(data, stream);
+                break;
+            case LogRecord::ARG_UNSIGNED_LONG_LONG:
+                data = read_argument<unsigned long long>(data, stream);
+                break;
+            case LogRecord::ARG_FLOAT:
+                data = read_argument<float>(data, stream);
+                break;
+            case LogRecord::ARG_DOUBLE:
+                data = read_argument<double>(data, stream);
+                break;
+            case LogRecord::ARG_LONG_DOUBLE:
+                data = read_argument<long double>(data, stream);
+                break;
+            case LogRecord::ARG_POINTER:
+                data = read_argument<const void*>(data, stream);
+                break;
+            case LogRecord::ARG_OSTREAM_MANIPULATOR:
+                data = read_argument<LogRecord::OStreamManipulator>(data, stream);
+                break;
+            case LogRecord::ARG_IOS_MANIPULATOR:
+                data = read_argument<LogRecord::IosManipulator>(data, stream);
+                break;
+            case LogRecord::ARG_STRING:
+            {
+                uint32_t length = 0;
+                std::memcpy(&length, data, sizeof(uint32_t));
+                data += sizeof(uint32_t);
+                stream.write(reinterpret_cast<const char*>(data), length);
+                data += length;
+                break;
+            }
+            default:
+                // Unknown argument kind: the rest of the record cannot be decoded.
+                return;
+        }
+    }
+}
+
+} // namespace
+
 struct Log::Resources Log::resources_;
 
+constexpr uint32_t Log::max_message_size;
+
 Log::Resources::Resources()
     : logging(false)
     , work(false)
@@ -59,12 +196,7 @@ void Log::RegisterConsumer(
 
 void Log::ClearConsumers()
 {
-    std::unique_lock<std::mutex> working(resources_.cv_mutex);
-    resources_.cv.wait(working,
-            [&]()
-            {
-                return resources_.logs.BothEmpty();
-            });
+    Flush();
     std::unique_lock<std::mutex> guard(resources_.config_mutex);
     resources_.consumers.clear();
 }
@@ -98,35 +230,29 @@ void Log::Flush()
 
     /*   Flush() two steps strategy:
 
-         I must assure Log::Run swaps the queues because only swapping the queues the background content
-         will be consumed (first Run() loop).
+         The logging thread may be in the middle of a loop, having already visited the buffer of a thread whose
+         entries were logged before this call (first Run() loop).
 
-         Then, I must assure the new front queue content is consumed (second Run() loop).
+         Then, I must assure a whole Run() loop, which will take all the entries logged till now, is performed
+         (second Run() loop).
      */
 
-    int last_loop = -1;
-
     for (int i = 0; i < 2; ++i)
     {
+        int last_loop = resources_.current_loop;
+        resources_.work = true;
+        resources_.cv.notify_all();
         resources_.cv.wait(guard,
                 [&]()
                 {
-                    /* I must avoid:
-                     + the two calls be processed without an intermediate Run() loop (by using last_loop sequence number)
-                     + deadlock by absence of Run() loop activity (by using BothEmpty() call)
-                     */
-                    return !resources_.logging ||
-                    ( resources_.logs.Empty() &&
-                    ( last_loop != resources_.current_loop || resources_.logs.BothEmpty()));
+                    return !resources_.logging || last_loop != resources_.current_loop;
                 });
-
-        last_loop = resources_.current_loop;
-
     }
 }
 
 void Log::run()
 {
+    is_logging_thread = true;
     std::unique_lock<std::mutex> guard(resources_.cv_mutex);
 
     while (resources_.logging)
@@ -137,24 +263,11 @@ void Log::run()
                     return !resources_.logging || resources_.work;
                 });
 
-        resources_.work = false;
-
         guard.unlock();
         {
-            resources_.logs.Swap();
-            while (!resources_.logs.Empty())
-            {
-                std::unique_lock<std::mutex> configGuard(resources_.config_mutex);
-                if (preprocess(resources_.logs.Front()))
-                {
-                    for (auto& consumer : resources_.consumers)
-                    {
-                        consumer->Consume(resources_.logs.Front());
-                    }
-                }
-
-                resources_.logs.Pop();
-            }
+            // Producers only wake us up when they see this change from false to true.
+            resources_.work.exchange(false);
+            process_records();
         }
         guard.lock();
 
@@ -168,6 +281,80 @@ void Log::run()
     }
 }
 
+void Log::process_records()
+{
+    {
+        std::lock_guard<std::mutex> rings_guard(resources_.rings_mutex);
+
+        // Forget the buffers of threads that have finished, once they have been emptied.
+        resources_.rings.erase(
+            std::remove_if(resources_.rings.begin(), resources_.rings.end(),
+            [](const std::shared_ptr<LogRingBuffer>& ring)
+            {
+                return ring->is_closed() && ring->empty();
+            }),
+            resources_.rings.end());
+        resources_.rings_snapshot = resources_.rings;
+    }
+
+    std::vector<std::pair<int64_t, Entry>> records;
+    std::ostringstream message;
+    for (auto& ring : resources_.rings_snapshot)
+    {
+        ring->consume([&](const uint8_t* data, uint32_t size)
+                {
+                    RecordHeader header;
+                    std::memcpy(&header, data, sizeof(RecordHeader));
+
+                    message.str(std::string());
+                    message.clear();
+                    message.copyfmt(std::ios(nullptr));
+                    format_arguments(data + sizeof(RecordHeader), data + size, message);
+                    if (header.truncated)
+                    {
+                        message << "(...)";
+                    }
+
+                    std::string timestamp;
+                    get_timestamp(header.system_time, timestamp);
+                    records.emplace_back(header.steady_time,
+                    Entry{message.str(), header.context, header.kind, timestamp});
+                });
+    }
+    resources_.rings_snapshot.clear();
+
+    if (records.empty())
+    {
+        return;
+    }
+
+    // Entries of each thread are already sorted. Merge them keeping that order.
+    std::stable_sort(records.begin(), records.end(),
+            [](const std::pair<int64_t, Entry>& a, const std::pair<int64_t, Entry>& b)
+            {
+                return a.first < b.first;
+            });
+
+    std::unique_lock<std::mutex> configGuard(resources_.config_mutex);
+    std::vector<Entry> batch;
+    batch.reserve(records.size());
+    for (auto& record : records)
+    {
+        if (preprocess(record.second))
+        {
+            batch.push_back(std::move(record.second));
+        }
+    }
+
+    if (!batch.empty())
+    {
+        for (auto& consumer : resources_.consumers)
+        {
+            consumer->ConsumeBatch(batch);
+        }
+    }
+}
+
 void Log::ReportFilenames(
         bool report)
 {
@@ -235,23 +422,117 @@ void Log::QueueLog(
         const Log::Context& context,
         Log::Kind kind)
 {
+    QueueRecord(context, kind, message);
+}
+
+void Log::QueueRecord(
+        const Log::Context& context,
+        Log::Kind kind,
+        const void* arguments,
+        uint32_t arguments_size)
+{
+    push_record(context, kind, arguments, arguments_size, false);
+}
+
+void Log::QueueRecord(
+        const Log::Context& context,
+        Log::Kind kind,
+        const std::string& message)
+{
+    // Encoded as a single string argument
+    static thread_local std::vector<uint8_t> arguments;
+
+    bool truncated = message.size() > max_message_size;
+    uint32_t length = truncated ? max_message_size : static_cast<uint32_t>(message.size());
+    arguments.resize(1u + sizeof(uint32_t) + length);
+    arguments[0] = LogRecord::ARG_STRING;
+    std::memcpy(&arguments[1], &length, sizeof(uint32_t));
+    std::memcpy(&arguments[1 + sizeof(uint32_t)], message.data(), length);
+
+    push_record(context, kind, arguments.data(), static_cast<uint32_t>(arguments.size()), truncated);
+}
+
+void Log::push_record(
+        const Log::Context& context,
+        Log::Kind kind,
+        const void* arguments,
+        uint32_t arguments_size,
+        bool truncated)
+{
+    if (!resources_.logging)
     {
-        std::unique_lock<std::mutex> guard(resources_.cv_mutex);
-        if (!resources_.logging && !resources_.logging_thread)
+        start_thread();
+    }
+
+    RecordHeader header;
+    header.context = context;
+    header.kind = kind;
+    header.truncated = truncated;
+    header.system_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    header.steady_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+
+    LogRingBuffer& ring = thread_ring();
+    while (!ring.push(&header, sizeof(RecordHeader), arguments, arguments_size))
+    {
+        // Buffer full. Wait for the logging thread to make room, unless it is not there to do it.
+        if (is_logging_thread || !resources_.logging)
         {
-            resources_.logging = true;
-            resources_.logging_thread.reset(new thread(Log::run));
+            return;
         }
+        wake_up();
+        std::this_thread::yield();
     }
 
-    std::string timestamp;
-    get_timestamp(timestamp);
-    resources_.logs.Push(Log::Entry{message, context, kind, timestamp});
+    wake_up();
+}
+
+std::ostringstream& Log::GetFormatStream(
+        const void* arguments,
+        uint32_t arguments_size)
+{
+    static thread_local std::ostringstream stream;
+    stream.str(std::string());
+    stream.clear();
+    stream.copyfmt(std::ios(nullptr));
+
+    const uint8_t* data = static_cast<const uint8_t*>(arguments);
+    format_arguments(data, data + arguments_size, stream);
+    return stream;
+}
+
+void Log::start_thread()
+{
+    std::unique_lock<std::mutex> guard(resources_.cv_mutex);
+    if (!resources_.logging && !resources_.logging_thread)
     {
-        std::unique_lock<std::mutex> guard(resources_.cv_mutex);
-        resources_.work = true;
+        resources_.logging = true;
+        resources_.logging_thread.reset(new thread(Log::run));
+    }
+}
+
+void Log::wake_up()
+{
+    if (!resources_.work.exchange(true))
+    {
+        // Taking the mutex avoids notifying between the check of the logging thread and its wait.
+        {
+            std::lock_guard<std::mutex> guard(resources_.cv_mutex);
+        }
+        resources_.cv.notify_all();
     }
-    resources_.cv.notify_all();
+}
+
+LogRingBuffer& Log::thread_ring()
+{
+    if (!this_thread_ring.ring)
+    {
+        this_thread_ring.ring = std::make_shared<LogRingBuffer>(thread_ring_capacity);
+        std::lock_guard<std::mutex> guard(resources_.rings_mutex);
+        resources_.rings.push_back(this_thread_ring.ring);
+    }
+    return *this_thread_ring.ring;
 }
 
 Log::Kind Log::GetVerbosity()
@@ -289,9 +570,18 @@ void Log::SetErrorStringFilter(
 
 void Log::get_timestamp(
         std::string& timestamp)
+{
+    get_timestamp(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count(), timestamp);
+}
+
+void Log::get_timestamp(
+        int64_t nanoseconds_since_epoch,
+        std::string& timestamp)
 {
     std::stringstream stream;
-    auto now = std::chrono::system_clock::now();
+    std::chrono::system_clock::time_point now(std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                std::chrono::nanoseconds(nanoseconds_since_epoch)));
     std::time_t now_c = std::chrono::system_clock::to_time_t(now);
     std::chrono::system_clock::duration tp = now.time_since_epoch();
     tp -= std::chrono::duration_cast<std::chrono::seconds>(tp);
@@ -0,0 +1,181 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LogRingBuffer.hpp
+ */
+
+#ifndef _FASTDDS_LOG_LOGRINGBUFFER_HPP_
+#define _FASTDDS_LOG_LOGRINGBUFFER_HPP_
+
+#include <assert.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace detail {
+
+/**
+ * Single producer, single consumer ring of variable sized records.
+ *
+ * Each thread that logs owns one of these rings, and the logging thread is its only consumer.
+ * Neither side takes any lock: the producer only writes head_ and the consumer only writes tail_.
+ */
+class LogRingBuffer
+{
+public:
+
+    /**
+     * Construct a LogRingBuffer.
+     * @param capacity Size in bytes of the ring. Should be a power of two.
+     */
+    explicit LogRingBuffer(
+            uint32_t capacity)
+        : buffer_(capacity)
+        , mask_(capacity - 1u)
+        , head_(0)
+        , tail_(0)
+        , closed_(false)
+    {
+        assert(0u == (capacity & mask_));
+    }
+
+    /**
+     * Add a record to the ring. Only to be called from the producer thread.
+     * The record is made of two parts, to avoid copying them together before.
+     * @return false if there is not enough free space on the ring.
+     */
+    bool push(
+            const void* header,
+            uint32_t header_size,
+            const void* body,
+            uint32_t body_size)
+    {
+        uint32_t record_size = header_size + body_size;
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        uint64_t tail = tail_.load(std::memory_order_acquire);
+        if (buffer_.size() - (head - tail) < sizeof(uint32_t) + record_size)
+        {
+            return false;
+        }
+
+        head = write(head, &record_size, sizeof(uint32_t));
+        head = write(head, header, header_size);
+        head = write(head, body, body_size);
+        head_.store(head, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Take all the records currently on the ring. Only to be called from the consumer thread.
+     * @param functor Called with a pointer to each record and its size. The pointer is only valid during the call.
+     * @return Number of records taken.
+     */
+    template<typename Functor>
+    size_t consume(
+            Functor functor)
+    {
+        size_t count = 0;
+        uint64_t tail = tail_.load(std::memory_order_relaxed);
+        uint64_t head = head_.load(std::memory_order_acquire);
+        while (tail != head)
+        {
+            uint32_t record_size = 0;
+            tail = read(tail, &record_size, sizeof(uint32_t));
+            record_.resize(record_size);
+            tail = read(tail, record_.data(), record_size);
+            functor(record_.data(), record_size);
+            tail_.store(tail, std::memory_order_release);
+            ++count;
+        }
+        return count;
+    }
+
+    bool empty() const
+    {
+        return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+    }
+
+    //! Signals that the producer thread will not add more records.
+    void close()
+    {
+        closed_.store(true, std::memory_order_release);
+    }
+
+    bool is_closed() const
+    {
+        return closed_.load(std::memory_order_acquire);
+    }
+
+private:
+
+    uint64_t write(
+            uint64_t position,
+            const void* data,
+            uint32_t size)
+    {
+        uint32_t offset = static_cast<uint32_t>(position & mask_);
+        uint32_t first = (std::min)(size, static_cast<uint32_t>(buffer_.size()) - offset);
+        if (0u < first)
+        {
+            std::memcpy(&buffer_[offset], data, first);
+        }
+        if (first < size)
+        {
+            std::memcpy(&buffer_[0], static_cast<const uint8_t*>(data) + first, size - first);
+        }
+        return position + size;
+    }
+
+    uint64_t read(
+            uint64_t position,
+            void* data,
+            uint32_t size) const
+    {
+        uint32_t offset = static_cast<uint32_t>(position & mask_);
+        uint32_t first = (std::min)(size, static_cast<uint32_t>(buffer_.size()) - offset);
+        if (0u < first)
+        {
+            std::memcpy(data, &buffer_[offset], first);
+        }
+        if (first < size)
+        {
+            std::memcpy(static_cast<uint8_t*>(data) + first, &buffer_[0], size - first);
+        }
+        return position + size;
+    }
+
+    std::vector<uint8_t> buffer_;
+    uint64_t mask_;
+    //! Scratch space where records are copied to be consumed. Only used by the consumer.
+    std::vector<uint8_t> record_;
+
+    // Producer and consumer positions are kept on different cache lines
+    std::atomic<uint64_t> head_;
+    uint8_t padding_[64];
+    std::atomic<uint64_t> tail_;
+    std::atomic<bool> closed_;
+};
+
+} // namespace detail
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_LOG_LOGRINGBUFFER_HPP_
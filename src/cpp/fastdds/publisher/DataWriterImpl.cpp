@@ -135,6 +135,7 @@ DataWriterImpl::DataWriterImpl(
     , listener_(listen)
 #pragma warning (disable : 4355 )
     , writer_listener_(this)
+    , reader_filters_(type_, topic_->get_name())
     , high_mark_for_frag_(0)
     , deadline_duration_us_(qos_.deadline().period.to_ns() * 1e-3)
     , lifespan_duration_us_(qos_.lifespan().duration.to_ns() * 1e-3)
@@ -165,6 +166,7 @@ ReturnCode_t DataWriterImpl::enable()
     w_att.endpoint.unicastLocatorList = qos_.endpoint().unicast_locator_list;
     w_att.endpoint.remoteLocatorList = qos_.endpoint().remote_locator_list;
     w_att.mode = qos_.publish_mode().kind == SYNCHRONOUS_PUBLISH_MODE ? SYNCHRONOUS_WRITER : ASYNCHRONOUS_WRITER;
+    w_att.async_priority = qos_.publish_mode().priority;
     w_att.endpoint.properties = qos_.properties();
 
     if (qos_.endpoint().entity_id > 0)
@@ -278,6 +280,9 @@ ReturnCode_t DataWriterImpl::enable()
 
     writer_ = writer;
 
+    // Let the RTPS writer skip the samples filtered out by the matched readers
+    writer_->reader_data_filter(&reader_filters_);
+
     // In case it has been loaded from the persistence DB, rebuild instances on history
     history_.rebuild_instances();
 
@@ -1004,6 +1009,28 @@ void DataWriterImpl::InnerDataWriterListener::on_liveliness_lost(
     }
 }
 
+void DataWriterImpl::InnerDataWriterListener::on_reader_discovery(
+        fastrtps::rtps::RTPSWriter* /*writer*/,
+        fastrtps::rtps::ReaderDiscoveryInfo::DISCOVERY_STATUS reason,
+        const fastrtps::rtps::GUID_t& reader_guid,
+        const fastrtps::rtps::ReaderProxyData* reader_info)
+{
+    switch (reason)
+    {
+        case fastrtps::rtps::ReaderDiscoveryInfo::REMOVED_READER:
+            data_writer_->reader_filters_.update_reader(reader_guid, nullptr);
+            break;
+
+        case fastrtps::rtps::ReaderDiscoveryInfo::DISCOVERED_READER:
+        case fastrtps::rtps::ReaderDiscoveryInfo::CHANGED_QOS_READER:
+            data_writer_->reader_filters_.update_reader(reader_guid, reader_info);
+            break;
+
+        default:
+            break;
+    }
+}
+
 ReturnCode_t DataWriterImpl::wait_for_acknowledgments(
         const Duration_t& max_wait)
 {
@@ -1019,6 +1046,28 @@ ReturnCode_t DataWriterImpl::wait_for_acknowledgments(
     return ReturnCode_t::RETCODE_ERROR;
 }
 
+ReturnCode_t DataWriterImpl::begin_coherent_changes()
+{
+    if (writer_ == nullptr)
+    {
+        return ReturnCode_t::RETCODE_NOT_ENABLED;
+    }
+
+    writer_->begin_coherent_set();
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t DataWriterImpl::end_coherent_changes()
+{
+    if (writer_ == nullptr)
+    {
+        return ReturnCode_t::RETCODE_NOT_ENABLED;
+    }
+
+    writer_->end_coherent_set();
+    return ReturnCode_t::RETCODE_OK;
+}
+
 bool DataWriterImpl::deadline_timer_reschedule()
 {
     assert(qos_.deadline().period != c_TimeInfinite);
@@ -1483,6 +1532,18 @@ void DataWriterImpl::set_fragment_size_on_change(
             ParameterSerializer<Parameter_t>::PARAMETER_SAMPLE_IDENTITY_SIZE);
     }
 
+    // Changes written inside a coherent set carry the coherent set inlineqos, and maybe its end mark.
+    if (writer_->is_coherent_set_open())
+    {
+        final_high_mark_for_frag -= (
+            ParameterSerializer<Parameter_t>::PARAMETER_COHERENT_SET_SIZE +
+            ParameterSerializer<Parameter_t>::PARAMETER_COHERENT_SET_END_SIZE);
+        if (wparams.related_sample_identity() == SampleIdentity::unknown())
+        {
+            final_high_mark_for_frag -= ParameterSerializer<Parameter_t>::PARAMETER_SENTINEL_SIZE;
+        }
+    }
+
     // If it is big data, fragment it.
     if (ch->serializedPayload.length > final_high_mark_for_frag)
     {
@@ -40,6 +40,8 @@
 
 #include <fastrtps/types/TypesBase.h>
 
+#include <fastdds/publisher/filtering/ReaderFilterCollection.hpp>
+
 #include <rtps/common/PayloadInfo_t.hpp>
 #include <rtps/history/ITopicPayloadPool.h>
 #include <rtps/DataSharing/DataSharingPayloadPool.hpp>
@@ -221,6 +223,19 @@ public:
     ReturnCode_t wait_for_acknowledgments(
             const fastrtps::Duration_t& max_wait);
 
+    /**
+     * Start a coherent set on the underlying RTPS writer.
+     * Samples written until end_coherent_changes() is called will be delivered as a whole.
+     * @return RETCODE_OK if successful, RETCODE_NOT_ENABLED if the writer is not enabled.
+     */
+    ReturnCode_t begin_coherent_changes();
+
+    /**
+     * End the coherent set started with begin_coherent_changes(), sending all its samples.
+     * @return RETCODE_OK if successful, RETCODE_NOT_ENABLED if the writer is not enabled.
+     */
+    ReturnCode_t end_coherent_changes();
+
     ReturnCode_t get_offered_deadline_missed_status(
             fastrtps::OfferedDeadlineMissedStatus& status);
 
@@ -328,10 +343,19 @@ protected:
                 fastrtps::rtps::RTPSWriter* writer,
                 const fastrtps::LivelinessLostStatus& status) override;
 
+        void on_reader_discovery(
+                fastrtps::rtps::RTPSWriter* writer,
+                fastrtps::rtps::ReaderDiscoveryInfo::DISCOVERY_STATUS reason,
+                const fastrtps::rtps::GUID_t& reader_guid,
+                const fastrtps::rtps::ReaderProxyData* reader_info) override;
+
         DataWriterImpl* data_writer_;
     }
     writer_listener_;
 
+    //! Content filters of the matched readers, evaluated before sending the samples
+    ReaderFilterCollection reader_filters_;
+
     uint32_t high_mark_for_frag_;
 
     //! A timer used to check for deadlines
@@ -156,18 +156,12 @@ ReturnCode_t Publisher::resume_publications()
 
 ReturnCode_t Publisher::begin_coherent_changes()
 {
-    return ReturnCode_t::RETCODE_UNSUPPORTED;
-    /*
-       return impl_->begin_coherent_changes();
-     */
+    return impl_->begin_coherent_changes();
 }
 
 ReturnCode_t Publisher::end_coherent_changes()
 {
-    return ReturnCode_t::RETCODE_UNSUPPORTED;
-    /*
-       return impl_->end_coherent_changes();
-     */
+    return impl_->end_coherent_changes();
 }
 
 ReturnCode_t Publisher::wait_for_acknowledgments(
@@ -421,21 +421,44 @@ bool PublisherImpl::contains_entity(
    }
  */
 
-/* TODO
-   bool PublisherImpl::begin_coherent_changes()
-   {
-    logError(PUBLISHER, "Operation not implemented");
-    return false;
-   }
- */
+ReturnCode_t PublisherImpl::begin_coherent_changes()
+{
+    std::lock_guard<std::mutex> lock(mtx_writers_);
+    if (0 == coherent_changes_depth_++)
+    {
+        for (auto& vit : writers_)
+        {
+            for (DataWriterImpl* dw : vit.second)
+            {
+                // Writers not yet enabled will not take part on the coherent set
+                dw->begin_coherent_changes();
+            }
+        }
+    }
+    return ReturnCode_t::RETCODE_OK;
+}
 
-/* TODO
-   bool PublisherImpl::end_coherent_changes()
-   {
-    logError(PUBLISHER, "Operation not implemented");
-    return false;
-   }
- */
+ReturnCode_t PublisherImpl::end_coherent_changes()
+{
+    std::lock_guard<std::mutex> lock(mtx_writers_);
+    if (0 == coherent_changes_depth_)
+    {
+        logError(PUBLISHER, "end_coherent_changes called without a matching begin_coherent_changes");
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    if (0 == --coherent_changes_depth_)
+    {
+        for (auto& vit : writers_)
+        {
+            for (DataWriterImpl* dw : vit.second)
+            {
+                dw->end_coherent_changes();
+            }
+        }
+    }
+    return ReturnCode_t::RETCODE_OK;
+}
 
 
 ReturnCode_t PublisherImpl::set_default_datawriter_qos(
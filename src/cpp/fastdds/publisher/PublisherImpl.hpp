@@ -135,13 +135,9 @@ public:
        bool resume_publications();
      */
 
-    /* TODO
-       bool begin_coherent_changes();
-     */
+    ReturnCode_t begin_coherent_changes();
 
-    /* TODO
-       bool end_coherent_changes();
-     */
+    ReturnCode_t end_coherent_changes();
 
     ReturnCode_t wait_for_acknowledgments(
             const fastrtps::Duration_t& max_wait);
@@ -203,6 +199,9 @@ protected:
 
     mutable std::mutex mtx_writers_;
 
+    //! Nesting level of begin_coherent_changes calls. Protected by mtx_writers_.
+    uint32_t coherent_changes_depth_ = 0;
+
     //!PublisherListener
     PublisherListener* listener_;
 
@@ -0,0 +1,189 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReaderFilterCollection.hpp
+ */
+
+#ifndef _FASTDDS_PUBLISHER_FILTERING_READERFILTERCOLLECTION_HPP_
+#define _FASTDDS_PUBLISHER_FILTERING_READERFILTERCOLLECTION_HPP_
+
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/rtps/builtin/data/ContentFilterProperty.hpp>
+#include <fastdds/rtps/builtin/data/ReaderProxyData.h>
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/writer/IReaderDataFilter.hpp>
+#include <fastrtps/types/TypesBase.h>
+
+#include <fastdds/topic/DDSSQLFilter/DDSFilterExpression.hpp>
+#include <fastdds/topic/DDSSQLFilter/DDSFilterFactory.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+/**
+ * Keeps the compiled content filters of the readers matched with a DataWriter, and evaluates them on behalf of
+ * the RTPS writer.
+ * Readers using the same filter expression and parameters share the same compiled filter.
+ */
+class ReaderFilterCollection : public fastdds::rtps::IReaderDataFilter
+{
+    using GUID_t = fastrtps::rtps::GUID_t;
+    using DDSFilterExpression = DDSSQLFilter::DDSFilterExpression;
+
+public:
+
+    /**
+     * @param type        Type of the topic where the DataWriter publishes.
+     * @param topic_name  Name of the topic where the DataWriter publishes.
+     */
+    ReaderFilterCollection(
+            const TypeSupport& type,
+            const std::string& topic_name)
+        : type_(type)
+        , topic_name_(topic_name)
+    {
+    }
+
+    /**
+     * Update the filter information of a reader.
+     *
+     * @param reader_guid  GUID of the reader.
+     * @param reader_info  Discovery information of the reader, or nullptr when the reader has been removed.
+     */
+    void update_reader(
+            const GUID_t& reader_guid,
+            const fastrtps::rtps::ReaderProxyData* reader_info)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+
+        if (nullptr == reader_info || !reader_info->has_content_filter())
+        {
+            filters_.erase(reader_guid);
+            return;
+        }
+
+        const fastdds::rtps::ContentFilterProperty& property = reader_info->content_filter();
+        auto it = filters_.find(reader_guid);
+        if (it != filters_.end() && it->second.property == property)
+        {
+            return;
+        }
+
+        if (0 != strcmp(property.filter_class_name.c_str(), DDSSQLFilter::DDSFilterFactory::filter_class_name) ||
+                topic_name_ != property.related_topic_name.c_str())
+        {
+            // Unknown filter. The reader will receive all samples and filter them itself.
+            filters_.erase(reader_guid);
+            return;
+        }
+
+        std::shared_ptr<DDSFilterExpression> filter = find_filter(property);
+        if (!filter)
+        {
+            std::unique_ptr<DDSFilterExpression> new_filter;
+            if (fastrtps::types::ReturnCode_t::RETCODE_OK != DDSSQLFilter::DDSFilterFactory::create_filter(type_,
+                    property.filter_expression, property.expression_parameters, new_filter))
+            {
+                logWarning(DATA_WRITER, "Filter for reader " << reader_guid << " cannot be evaluated by the writer");
+                filters_.erase(reader_guid);
+                return;
+            }
+            filter.reset(new_filter.release());
+        }
+
+        FilterEntry& entry = filters_[reader_guid];
+        entry.property = property;
+        entry.filter = filter;
+    }
+
+    /**
+     * Remove all the filters.
+     */
+    void clear()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        filters_.clear();
+    }
+
+    bool is_relevant(
+            const fastrtps::rtps::CacheChange_t& change,
+            const GUID_t& reader_guid) const override
+    {
+        // Only samples carry the data needed to evaluate the filters
+        if (fastrtps::rtps::ALIVE != change.kind)
+        {
+            return true;
+        }
+
+        // The last change of a coherent set is what tells the readers the set is complete, so it is always sent.
+        // The readers apply their own filter to it once the set has been closed.
+        if (change.write_params.coherent_set_end())
+        {
+            return true;
+        }
+
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto it = filters_.find(reader_guid);
+        if (it == filters_.end())
+        {
+            return true;
+        }
+
+        return it->second.filter->evaluate(change.serializedPayload.data, change.serializedPayload.length);
+    }
+
+private:
+
+    struct FilterEntry
+    {
+        fastdds::rtps::ContentFilterProperty property;
+        std::shared_ptr<DDSFilterExpression> filter;
+    };
+
+    std::shared_ptr<DDSFilterExpression> find_filter(
+            const fastdds::rtps::ContentFilterProperty& property) const
+    {
+        for (const auto& entry : filters_)
+        {
+            if (entry.second.property.filter_expression == property.filter_expression &&
+                    entry.second.property.expression_parameters == property.expression_parameters)
+            {
+                return entry.second.filter;
+            }
+        }
+
+        return nullptr;
+    }
+
+    TypeSupport type_;
+    std::string topic_name_;
+    mutable std::mutex mutex_;
+    std::map<GUID_t, FilterEntry> filters_;
+};
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_PUBLISHER_FILTERING_READERFILTERCOLLECTION_HPP_
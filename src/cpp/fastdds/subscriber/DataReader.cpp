@@ -95,11 +95,7 @@ ReturnCode_t DataReader::read_w_condition(
         int32_t max_samples,
         ReadCondition* a_condition)
 {
-    static_cast<void> (data_values);
-    static_cast<void> (sample_infos);
-    static_cast<void> (max_samples);
-    static_cast<void> (a_condition);
-    return ReturnCode_t::RETCODE_UNSUPPORTED;
+    return impl_->read_w_condition(data_values, sample_infos, max_samples, a_condition);
 }
 
 ReturnCode_t DataReader::read_instance(
@@ -135,12 +131,7 @@ ReturnCode_t DataReader::read_next_instance_w_condition(
         const InstanceHandle_t& previous_handle,
         ReadCondition* a_condition)
 {
-    static_cast<void> (data_values);
-    static_cast<void> (sample_infos);
-    static_cast<void> (max_samples);
-    static_cast<void> (previous_handle);
-    static_cast<void> (a_condition);
-    return ReturnCode_t::RETCODE_UNSUPPORTED;
+    return impl_->read_next_instance_w_condition(data_values, sample_infos, max_samples, previous_handle, a_condition);
 }
 
 ReturnCode_t DataReader::take(
@@ -160,11 +151,7 @@ ReturnCode_t DataReader::take_w_condition(
         int32_t max_samples,
         ReadCondition* a_condition)
 {
-    static_cast<void> (data_values);
-    static_cast<void> (sample_infos);
-    static_cast<void> (max_samples);
-    static_cast<void> (a_condition);
-    return ReturnCode_t::RETCODE_UNSUPPORTED;
+    return impl_->take_w_condition(data_values, sample_infos, max_samples, a_condition);
 }
 
 ReturnCode_t DataReader::take_instance(
@@ -200,12 +187,7 @@ ReturnCode_t DataReader::take_next_instance_w_condition(
         const InstanceHandle_t& previous_handle,
         ReadCondition* a_condition)
 {
-    static_cast<void> (data_values);
-    static_cast<void> (sample_infos);
-    static_cast<void> (max_samples);
-    static_cast<void> (previous_handle);
-    static_cast<void> (a_condition);
-    return ReturnCode_t::RETCODE_UNSUPPORTED;
+    return impl_->take_next_instance_w_condition(data_values, sample_infos, max_samples, previous_handle, a_condition);
 }
 
 ReturnCode_t DataReader::return_loan(
@@ -393,14 +375,7 @@ ReadCondition* DataReader::create_readcondition(
         const std::vector<ViewStateKind>& view_states,
         const std::vector<InstanceStateKind>& instance_states)
 {
-    logWarning(DATA_READER, "create_readcondition method not implemented");
-    static_cast<void> (sample_states);
-    static_cast<void> (view_states);
-    static_cast<void> (instance_states);
-    return nullptr;
-    /*
-       return impl_->create_readcondition(sample_states, view_states, instance_states);
-     */
+    return impl_->create_readcondition(sample_states, view_states, instance_states);
 }
 
 QueryCondition* DataReader::create_querycondition(
@@ -410,34 +385,19 @@ QueryCondition* DataReader::create_querycondition(
         const std::string& query_expression,
         const std::vector<std::string>& query_parameters)
 {
-    logWarning(DATA_READER, "create_querycondition method not implemented");
-    static_cast<void> (sample_states);
-    static_cast<void> (view_states);
-    static_cast<void> (instance_states);
-    static_cast<void> (query_expression);
-    static_cast<void> (query_parameters);
-    return nullptr;
-    /*
-       return impl_->create_querycondition(sample_states, view_states, instance_states, query_expression, query_parameters);
-     */
+    return impl_->create_querycondition(sample_states, view_states, instance_states, query_expression,
+                   query_parameters);
 }
 
 ReturnCode_t DataReader::delete_readcondition(
         const ReadCondition* a_condition)
 {
-    static_cast<void> (a_condition);
-    return ReturnCode_t::RETCODE_UNSUPPORTED;
-    /*
-       return impl_->delete_readcondition(a_condition);
-     */
+    return impl_->delete_readcondition(a_condition);
 }
 
 ReturnCode_t DataReader::delete_contained_entities()
 {
-    return ReturnCode_t::RETCODE_UNSUPPORTED;
-    /*
-       return impl_->delete_contained_entities();
-     */
+    return impl_->delete_contained_entities();
 }
 
 const Subscriber* DataReader::get_subscriber() const
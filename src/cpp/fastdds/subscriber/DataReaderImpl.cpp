@@ -21,10 +21,14 @@
 
 #include <fastdds/subscriber/DataReaderImpl.hpp>
 
+#include <algorithm>
+
 #include <fastdds/dds/core/StackAllocatedSequence.hpp>
 #include <fastdds/dds/domain/DomainParticipant.hpp>
 #include <fastdds/dds/log/Log.hpp>
 #include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/QueryCondition.hpp>
+#include <fastdds/dds/subscriber/ReadCondition.hpp>
 #include <fastdds/dds/subscriber/SampleInfo.hpp>
 #include <fastdds/dds/subscriber/Subscriber.hpp>
 #include <fastdds/dds/subscriber/SubscriberListener.hpp>
@@ -39,8 +43,11 @@
 #include <fastdds/core/policy/QosPolicyUtils.hpp>
 
 #include <fastdds/subscriber/SubscriberImpl.hpp>
+#include <fastdds/topic/ContentFilteredTopicImpl.hpp>
+#include <fastdds/subscriber/DataReaderImpl/ReadConditionImpl.hpp>
 #include <fastdds/subscriber/DataReaderImpl/ReadTakeCommand.hpp>
 #include <fastdds/subscriber/DataReaderImpl/StateFilter.hpp>
+#include <fastdds/topic/DDSSQLFilter/DDSFilterFactory.hpp>
 
 #include <fastrtps/utils/TimeConversion.h>
 #include <fastrtps/subscriber/SampleInfo.h>
@@ -55,6 +62,25 @@ namespace eprosima {
 namespace fastdds {
 namespace dds {
 
+template<typename StateKind, typename StateMask>
+static StateMask states_to_mask(
+        const std::vector<StateKind>& states,
+        StateMask any_state)
+{
+    // An empty list does not restrict the state
+    if (states.empty())
+    {
+        return any_state;
+    }
+
+    StateMask mask = 0;
+    for (StateKind state : states)
+    {
+        mask |= static_cast<StateMask>(state);
+    }
+    return mask;
+}
+
 static void sample_info_to_dds (
         const SampleInfo_t& rtps_info,
         SampleInfo* dds_info)
@@ -122,6 +148,7 @@ DataReaderImpl::DataReaderImpl(
     : subscriber_(s)
     , type_(type)
     , topic_(topic)
+    , content_topic_(dynamic_cast<ContentFilteredTopicImpl*>(topic->get_impl()))
     , qos_(&qos == &DATAREADER_QOS_DEFAULT ? subscriber_->get_default_datareader_qos() : qos)
 #pragma warning (disable : 4355 )
     , history_(topic_attributes(),
@@ -175,7 +202,7 @@ ReturnCode_t DataReaderImpl::enable()
     // Insert topic_name and partitions
     Property property;
     property.name("topic_name");
-    property.value(topic_->get_name().c_str());
+    property.value(topic_->get_impl()->get_rtps_topic_name().c_str());
     att.endpoint.properties.properties().push_back(std::move(property));
     if (subscriber_->get_qos().partition().names().size() > 0)
     {
@@ -249,7 +276,14 @@ ReturnCode_t DataReaderImpl::enable()
     {
         rqos.data_sharing.off();
     }
-    subscriber_->rtps_participant()->registerReader(reader_, topic_attributes(), rqos);
+    if (nullptr != content_topic_)
+    {
+        content_topic_->add_reader(this);
+    }
+
+    fastdds::rtps::ContentFilterProperty filter_property;
+    subscriber_->rtps_participant()->registerReader(reader_, topic_attributes(), rqos,
+            content_filter_property(filter_property));
 
     return ReturnCode_t::RETCODE_OK;
 }
@@ -265,6 +299,13 @@ void DataReaderImpl::disable()
 
 DataReaderImpl::~DataReaderImpl()
 {
+    delete_contained_entities();
+
+    if (nullptr != content_topic_)
+    {
+        content_topic_->remove_reader(this);
+    }
+
     delete lifespan_timer_;
     delete deadline_timer_;
 
@@ -283,10 +324,14 @@ bool DataReaderImpl::can_be_deleted() const
     if (reader_ != nullptr)
     {
         std::lock_guard<RecursiveTimedMutex> lock(reader_->getMutex());
-        return !loan_manager_.has_outstanding_loans();
+        if (loan_manager_.has_outstanding_loans())
+        {
+            return false;
+        }
     }
 
-    return true;
+    std::lock_guard<std::mutex> guard(conditions_mutex_);
+    return read_conditions_.empty();
 }
 
 bool DataReaderImpl::wait_for_unread_message(
@@ -413,7 +458,8 @@ ReturnCode_t DataReaderImpl::read_or_take(
         InstanceStateMask instance_states,
         bool exact_instance,
         bool single_instance,
-        bool should_take)
+        bool should_take,
+        const detail::ReadConditionImpl* condition)
 {
     if (reader_ == nullptr)
     {
@@ -453,7 +499,8 @@ ReturnCode_t DataReaderImpl::read_or_take(
     }
 
     detail::StateFilter states{ sample_states, view_states, instance_states };
-    detail::ReadTakeCommand cmd(*this, data_values, sample_infos, max_samples, states, it.second, single_instance);
+    detail::ReadTakeCommand cmd(*this, data_values, sample_infos, max_samples, states, it.second, single_instance,
+            condition);
     while (!cmd.is_finished())
     {
         cmd.add_instance(should_take);
@@ -537,6 +584,76 @@ ReturnCode_t DataReaderImpl::take_next_instance(
                    sample_states, view_states, instance_states, false, true, true);
 }
 
+ReturnCode_t DataReaderImpl::read_or_take_w_condition(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos,
+        int32_t max_samples,
+        const InstanceHandle_t& handle,
+        ReadCondition* a_condition,
+        bool single_instance,
+        bool should_take)
+{
+    if (nullptr == a_condition)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(conditions_mutex_);
+        if (std::find(read_conditions_.begin(), read_conditions_.end(), a_condition) == read_conditions_.end())
+        {
+            return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+        }
+    }
+
+    const detail::StateFilter& states = a_condition->impl_->get_states();
+    return read_or_take(data_values, sample_infos, max_samples, handle,
+                   states.sample_states, states.view_states, states.instance_states,
+                   false, single_instance, should_take, a_condition->impl_);
+}
+
+ReturnCode_t DataReaderImpl::read_w_condition(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos,
+        int32_t max_samples,
+        ReadCondition* a_condition)
+{
+    return read_or_take_w_condition(data_values, sample_infos, max_samples, HANDLE_NIL,
+                   a_condition, false, false);
+}
+
+ReturnCode_t DataReaderImpl::read_next_instance_w_condition(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos,
+        int32_t max_samples,
+        const InstanceHandle_t& previous_handle,
+        ReadCondition* a_condition)
+{
+    return read_or_take_w_condition(data_values, sample_infos, max_samples, previous_handle,
+                   a_condition, true, false);
+}
+
+ReturnCode_t DataReaderImpl::take_w_condition(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos,
+        int32_t max_samples,
+        ReadCondition* a_condition)
+{
+    return read_or_take_w_condition(data_values, sample_infos, max_samples, HANDLE_NIL,
+                   a_condition, false, true);
+}
+
+ReturnCode_t DataReaderImpl::take_next_instance_w_condition(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos,
+        int32_t max_samples,
+        const InstanceHandle_t& previous_handle,
+        ReadCondition* a_condition)
+{
+    return read_or_take_w_condition(data_values, sample_infos, max_samples, previous_handle,
+                   a_condition, true, true);
+}
+
 ReturnCode_t DataReaderImpl::return_loan(
         LoanableCollection& data_values,
         SampleInfoSeq& sample_infos)
@@ -618,6 +735,12 @@ ReturnCode_t DataReaderImpl::read_or_take_next_sample(
         return ReturnCode_t::RETCODE_TIMEOUT;
     }
 
+    // Avoid traversing the history when all the samples have already been read
+    if (0 == history_.get_not_read_count())
+    {
+        return ReturnCode_t::RETCODE_NO_DATA;
+    }
+
     auto it = history_.lookup_instance(HANDLE_NIL, false);
     if (!it.first)
     {
@@ -679,6 +802,133 @@ uint64_t DataReaderImpl::get_unread_count() const
     return reader_ ? reader_->get_unread_count() : 0;
 }
 
+ReadCondition* DataReaderImpl::create_readcondition(
+        const std::vector<SampleStateKind>& sample_states,
+        const std::vector<ViewStateKind>& view_states,
+        const std::vector<InstanceStateKind>& instance_states)
+{
+    detail::StateFilter states{
+        states_to_mask(sample_states, ANY_SAMPLE_STATE),
+        states_to_mask(view_states, ANY_VIEW_STATE),
+        states_to_mask(instance_states, ANY_INSTANCE_STATE) };
+
+    ReadCondition* condition = new ReadCondition(new detail::ReadConditionImpl(*this, user_datareader_, states));
+
+    std::lock_guard<std::mutex> guard(conditions_mutex_);
+    read_conditions_.push_back(condition);
+    return condition;
+}
+
+QueryCondition* DataReaderImpl::create_querycondition(
+        const std::vector<SampleStateKind>& sample_states,
+        const std::vector<ViewStateKind>& view_states,
+        const std::vector<InstanceStateKind>& instance_states,
+        const std::string& query_expression,
+        const std::vector<std::string>& query_parameters)
+{
+    std::unique_ptr<DDSSQLFilter::DDSFilterExpression> query;
+    if (ReturnCode_t::RETCODE_OK != DDSSQLFilter::DDSFilterFactory::create_filter(type_, query_expression,
+            query_parameters, query))
+    {
+        logError(DATA_READER, "Cannot create QueryCondition with query '" << query_expression << "'");
+        return nullptr;
+    }
+
+    detail::StateFilter states{
+        states_to_mask(sample_states, ANY_SAMPLE_STATE),
+        states_to_mask(view_states, ANY_VIEW_STATE),
+        states_to_mask(instance_states, ANY_INSTANCE_STATE) };
+
+    QueryCondition* condition = new QueryCondition(new detail::ReadConditionImpl(*this, user_datareader_, states,
+                    query_expression, query_parameters, std::move(query)));
+
+    std::lock_guard<std::mutex> guard(conditions_mutex_);
+    read_conditions_.push_back(condition);
+    return condition;
+}
+
+ReturnCode_t DataReaderImpl::delete_readcondition(
+        const ReadCondition* a_condition)
+{
+    if (nullptr == a_condition)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    std::lock_guard<std::mutex> guard(conditions_mutex_);
+    auto it = std::find(read_conditions_.begin(), read_conditions_.end(), a_condition);
+    if (it == read_conditions_.end())
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    delete *it;
+    read_conditions_.erase(it);
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t DataReaderImpl::delete_contained_entities()
+{
+    std::lock_guard<std::mutex> guard(conditions_mutex_);
+    for (ReadCondition* condition : read_conditions_)
+    {
+        delete condition;
+    }
+    read_conditions_.clear();
+    return ReturnCode_t::RETCODE_OK;
+}
+
+bool DataReaderImpl::get_trigger_value(
+        const detail::ReadConditionImpl& condition)
+{
+    if (reader_ == nullptr)
+    {
+        return false;
+    }
+
+    std::lock_guard<RecursiveTimedMutex> lock(reader_->getMutex());
+
+    // Use the sample state counters of the history to avoid traversing it
+    const detail::StateFilter& states = condition.get_states();
+    size_t not_read = history_.get_not_read_count();
+    bool check_not_read = (states.sample_states & NOT_READ_SAMPLE_STATE) != 0 && 0 < not_read;
+    bool check_read = (states.sample_states & READ_SAMPLE_STATE) != 0 && history_.getHistorySize() > not_read;
+    if (!check_not_read && !check_read)
+    {
+        return false;
+    }
+
+    if (!condition.has_query())
+    {
+        return true;
+    }
+
+    // Look for a sample passing the query
+    auto it = history_.lookup_instance(HANDLE_NIL, false);
+    while (it.first)
+    {
+        auto& instance = it.second;
+        if (check_read || 0 < history_.get_not_read_count(instance))
+        {
+            auto chit = check_read ? instance.second->begin() : history_.get_first_not_read_change(instance);
+            for (; chit != instance.second->end(); ++chit)
+            {
+                CacheChange_t* change = *chit;
+                SampleStateMask state = change->isRead ? READ_SAMPLE_STATE : NOT_READ_SAMPLE_STATE;
+                if ((state & states.sample_states) != 0 && change->is_fully_assembled() &&
+                        condition.is_relevant(*change))
+                {
+                    return true;
+                }
+            }
+        }
+
+        it = history_.lookup_instance(instance.first, false);
+    }
+
+    return false;
+}
+
 const GUID_t& DataReaderImpl::guid() const
 {
     return reader_ ? reader_->getGuid() : c_Guid_Unknown;
@@ -695,7 +945,20 @@ void DataReaderImpl::subscriber_qos_updated()
     {
         //NOTIFY THE BUILTIN PROTOCOLS THAT THE READER HAS CHANGED
         ReaderQos rqos = qos_.get_readerqos(get_subscriber()->get_qos());
-        subscriber_->rtps_participant()->updateReader(reader_, topic_attributes(), rqos);
+        fastdds::rtps::ContentFilterProperty filter_property;
+        subscriber_->rtps_participant()->updateReader(reader_, topic_attributes(), rqos,
+                content_filter_property(filter_property));
+    }
+}
+
+void DataReaderImpl::filter_has_been_updated(
+        const fastdds::rtps::ContentFilterProperty& filter_property)
+{
+    if (reader_)
+    {
+        //NOTIFY THE BUILTIN PROTOCOLS THAT THE READER HAS CHANGED
+        ReaderQos rqos = qos_.get_readerqos(get_subscriber()->get_qos());
+        subscriber_->rtps_participant()->updateReader(reader_, topic_attributes(), rqos, &filter_property);
     }
 }
 
@@ -734,7 +997,9 @@ ReturnCode_t DataReaderImpl::set_qos(
     {
         //NOTIFY THE BUILTIN PROTOCOLS THAT THE READER HAS CHANGED
         ReaderQos rqos = qos.get_readerqos(get_subscriber()->get_qos());
-        subscriber_->rtps_participant()->updateReader(reader_, topic_attributes(), rqos);
+        fastdds::rtps::ContentFilterProperty filter_property;
+        subscriber_->rtps_participant()->updateReader(reader_, topic_attributes(), rqos,
+                content_filter_property(filter_property));
 
         // Deadline
         if (qos_.deadline().period != c_TimeInfinite)
@@ -774,21 +1039,45 @@ void DataReaderImpl::InnerDataReaderListener::onNewCacheChangeAdded(
 {
     if (data_reader_->on_new_cache_change_added(change_in))
     {
-        //First check if we can handle with on_data_on_readers
-        SubscriberListener* subscriber_listener =
-                data_reader_->subscriber_->get_listener_for(StatusMask::data_on_readers());
-        if (subscriber_listener != nullptr)
+        // The changes of a coherent set are notified together, so the callbacks are triggered once the set is visible
+        if (change_in->write_params.coherent_set() != SequenceNumber_t::unknown())
         {
-            subscriber_listener->on_data_on_readers(data_reader_->subscriber_->user_subscriber_);
+            coherent_set_pending_ = true;
+            return;
         }
-        else
+
+        // A set pending on the same notification is visible too, so this also covers its changes
+        coherent_set_pending_ = false;
+        notify_data_available();
+    }
+}
+
+void DataReaderImpl::InnerDataReaderListener::on_coherent_set_visible(
+        RTPSReader* /*reader*/)
+{
+    if (coherent_set_pending_)
+    {
+        coherent_set_pending_ = false;
+        notify_data_available();
+    }
+}
+
+void DataReaderImpl::InnerDataReaderListener::notify_data_available()
+{
+    //First check if we can handle with on_data_on_readers
+    SubscriberListener* subscriber_listener =
+            data_reader_->subscriber_->get_listener_for(StatusMask::data_on_readers());
+    if (subscriber_listener != nullptr)
+    {
+        subscriber_listener->on_data_on_readers(data_reader_->subscriber_->user_subscriber_);
+    }
+    else
+    {
+        // If not, try with on_data_available
+        DataReaderListener* listener = data_reader_->get_listener_for(StatusMask::data_available());
+        if (listener != nullptr)
         {
-            // If not, try with on_data_available
-            DataReaderListener* listener = data_reader_->get_listener_for(StatusMask::data_available());
-            if (listener != nullptr)
-            {
-                listener->on_data_available(data_reader_->user_datareader_);
-            }
+            listener->on_data_available(data_reader_->user_datareader_);
         }
     }
 }
@@ -839,6 +1128,13 @@ void DataReaderImpl::InnerDataReaderListener::on_requested_incompatible_qos(
 bool DataReaderImpl::on_new_cache_change_added(
         const CacheChange_t* const change)
 {
+    // Samples coming from writers that do not evaluate the content filter are discarded here
+    if (nullptr != content_topic_ && !content_topic_->is_relevant(*change))
+    {
+        history_.remove_change_sub(const_cast<CacheChange_t*>(change));
+        return false;
+    }
+
     if (qos_.deadline().period != c_TimeInfinite)
     {
         std::unique_lock<RecursiveTimedMutex> lock(reader_->getMutex());
@@ -1341,11 +1637,23 @@ void DataReaderImpl::set_qos(
     }
 }
 
+const fastdds::rtps::ContentFilterProperty* DataReaderImpl::content_filter_property(
+        fastdds::rtps::ContentFilterProperty& filter_property) const
+{
+    if (nullptr == content_topic_)
+    {
+        return nullptr;
+    }
+
+    content_topic_->fill_content_filter_property(filter_property);
+    return &filter_property;
+}
+
 fastrtps::TopicAttributes DataReaderImpl::topic_attributes() const
 {
     fastrtps::TopicAttributes topic_att;
     topic_att.topicKind = type_->m_isGetKeyDefined ? WITH_KEY : NO_KEY;
-    topic_att.topicName = topic_->get_name();
+    topic_att.topicName = topic_->get_impl()->get_rtps_topic_name();
     topic_att.topicDataType = topic_->get_type_name();
     topic_att.historyQos = qos_.history();
     topic_att.resourceLimitsQos = qos_.resource_limits();
@@ -1392,7 +1700,7 @@ std::shared_ptr<IPayloadPool> DataReaderImpl::get_payload_pool()
 
     if (!payload_pool_)
     {
-        payload_pool_ = TopicPayloadPoolRegistry::get(topic_->get_name(), config);
+        payload_pool_ = TopicPayloadPoolRegistry::get(topic_->get_impl()->get_rtps_topic_name(), config);
         sample_pool_ = std::make_shared<detail::SampleLoanManager>(config, type_);
     }
 
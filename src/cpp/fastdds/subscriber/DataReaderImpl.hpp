@@ -21,6 +21,10 @@
 #define _FASTRTPS_DATAREADERIMPL_HPP_
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <mutex>
+#include <string>
+#include <vector>
+
 #include <fastdds/dds/core/LoanableCollection.hpp>
 #include <fastdds/dds/core/LoanableSequence.hpp>
 #include <fastdds/dds/core/status/StatusMask.hpp>
@@ -30,6 +34,7 @@
 #include <fastdds/dds/topic/TypeSupport.hpp>
 
 #include <fastdds/rtps/attributes/ReaderAttributes.h>
+#include <fastdds/rtps/builtin/data/ContentFilterProperty.hpp>
 #include <fastdds/rtps/common/LocatorList.hpp>
 #include <fastdds/rtps/common/Guid.h>
 #include <fastdds/rtps/history/IPayloadPool.h>
@@ -61,6 +66,9 @@ class TimedEvent;
 namespace fastdds {
 namespace dds {
 
+class ContentFilteredTopicImpl;
+class QueryCondition;
+class ReadCondition;
 class Subscriber;
 class SubscriberImpl;
 class TopicDescription;
@@ -69,6 +77,7 @@ using SampleInfoSeq = LoanableSequence<SampleInfo>;
 
 namespace detail {
 
+class ReadConditionImpl;
 struct ReadTakeCommand;
 
 } // namespace detail
@@ -179,6 +188,65 @@ public:
             void* data,
             SampleInfo* info);
 
+    ReturnCode_t read_w_condition(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos,
+            int32_t max_samples,
+            ReadCondition* a_condition);
+
+    ReturnCode_t read_next_instance_w_condition(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos,
+            int32_t max_samples,
+            const InstanceHandle_t& previous_handle,
+            ReadCondition* a_condition);
+
+    ReturnCode_t take_w_condition(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos,
+            int32_t max_samples,
+            ReadCondition* a_condition);
+
+    ReturnCode_t take_next_instance_w_condition(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos,
+            int32_t max_samples,
+            const InstanceHandle_t& previous_handle,
+            ReadCondition* a_condition);
+
+    ///@}
+
+    /** @name Read conditions.
+     * Methods to manage the ReadCondition and QueryCondition objects attached to this reader.
+     */
+
+    ///@{
+
+    ReadCondition* create_readcondition(
+            const std::vector<SampleStateKind>& sample_states,
+            const std::vector<ViewStateKind>& view_states,
+            const std::vector<InstanceStateKind>& instance_states);
+
+    QueryCondition* create_querycondition(
+            const std::vector<SampleStateKind>& sample_states,
+            const std::vector<ViewStateKind>& view_states,
+            const std::vector<InstanceStateKind>& instance_states,
+            const std::string& query_expression,
+            const std::vector<std::string>& query_parameters);
+
+    ReturnCode_t delete_readcondition(
+            const ReadCondition* a_condition);
+
+    ReturnCode_t delete_contained_entities();
+
+    /**
+     * Compute the trigger value of a condition attached to this reader.
+     * @param condition Implementation of the condition.
+     * @return true if there is at least one sample matching the condition.
+     */
+    bool get_trigger_value(
+            const detail::ReadConditionImpl& condition);
+
     ///@}
 
     ReturnCode_t return_loan(
@@ -218,6 +286,14 @@ public:
      */
     const TopicDescription* get_topicdescription() const;
 
+    /**
+     * Announce a new content filter for this reader.
+     * Called by the ContentFilteredTopic when its expression parameters change.
+     * @param filter_property Information about the new content filter.
+     */
+    void filter_has_been_updated(
+            const fastdds::rtps::ContentFilterProperty& filter_property);
+
     ReturnCode_t get_requested_deadline_missed_status(
             fastrtps::RequestedDeadlineMissedStatus& status);
 
@@ -322,6 +398,9 @@ protected:
 
     TopicDescription* topic_ = nullptr;
 
+    //! Implementation of the ContentFilteredTopic, when the reader was created on one.
+    ContentFilteredTopicImpl* content_topic_ = nullptr;
+
     DataReaderQos qos_;
 
     //!History
@@ -360,7 +439,18 @@ protected:
                 fastrtps::rtps::RTPSReader* reader,
                 fastdds::dds::PolicyMask qos) override;
 
+        void on_coherent_set_visible(
+                fastrtps::rtps::RTPSReader* reader) override;
+
         DataReaderImpl* data_reader_;
+
+    private:
+
+        //! Call the data_on_readers or data_available callbacks
+        void notify_data_available();
+
+        //! Whether some change of a coherent set has been added since the set was last made visible
+        bool coherent_set_pending_ = false;
     }
     reader_listener_;
 
@@ -396,6 +486,11 @@ protected:
     detail::SampleInfoPool sample_info_pool_;
     detail::DataReaderLoanManager loan_manager_;
 
+    //! ReadCondition and QueryCondition objects attached to this reader
+    std::vector<ReadCondition*> read_conditions_;
+    //! Protects read_conditions_
+    mutable std::mutex conditions_mutex_;
+
     ReturnCode_t check_collection_preconditions_and_calc_max_samples(
             LoanableCollection& data_values,
             SampleInfoSeq& sample_infos,
@@ -416,6 +511,16 @@ protected:
             InstanceStateMask instance_states,
             bool exact_instance,
             bool single_instance,
+            bool should_take,
+            const detail::ReadConditionImpl* condition = nullptr);
+
+    ReturnCode_t read_or_take_w_condition(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos,
+            int32_t max_samples,
+            const InstanceHandle_t& handle,
+            ReadCondition* a_condition,
+            bool single_instance,
             bool should_take);
 
     ReturnCode_t read_or_take_next_sample(
@@ -448,6 +553,14 @@ protected:
 
     fastrtps::TopicAttributes topic_attributes() const;
 
+    /**
+     * Fill the content filter information to announce on discovery.
+     * @param [out] filter_property Content filter information to fill.
+     * @return a pointer to filter_property when the reader is created on a ContentFilteredTopic, nullptr otherwise.
+     */
+    const fastdds::rtps::ContentFilterProperty* content_filter_property(
+            fastdds::rtps::ContentFilterProperty& filter_property) const;
+
     void subscriber_qos_updated();
 
     RequestedIncompatibleQosStatus& update_requested_incompatible_qos(
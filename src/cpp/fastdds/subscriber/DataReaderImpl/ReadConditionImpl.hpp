@@ -0,0 +1,165 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReadConditionImpl.hpp
+ */
+
+#ifndef _FASTDDS_SUBSCRIBER_DATAREADERIMPL_READCONDITIONIMPL_HPP_
+#define _FASTDDS_SUBSCRIBER_DATAREADERIMPL_READCONDITIONIMPL_HPP_
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastrtps/types/TypesBase.h>
+
+#include <fastdds/subscriber/DataReaderImpl.hpp>
+#include <fastdds/subscriber/DataReaderImpl/StateFilter.hpp>
+#include <fastdds/topic/DDSSQLFilter/DDSFilterExpression.hpp>
+#include <fastdds/topic/DDSSQLFilter/DDSFilterParser.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+class DataReader;
+
+namespace detail {
+
+/**
+ * Implementation of ReadCondition and QueryCondition.
+ * Holds the states selected by the condition and, for a QueryCondition, the compiled query.
+ */
+class ReadConditionImpl
+{
+    using ReturnCode_t = eprosima::fastrtps::types::ReturnCode_t;
+    using DDSFilterExpression = DDSSQLFilter::DDSFilterExpression;
+
+public:
+
+    ReadConditionImpl(
+            DataReaderImpl& data_reader,
+            DataReader* user_reader,
+            const StateFilter& states)
+        : data_reader_(data_reader)
+        , user_reader_(user_reader)
+        , states_(states)
+    {
+    }
+
+    ReadConditionImpl(
+            DataReaderImpl& data_reader,
+            DataReader* user_reader,
+            const StateFilter& states,
+            const std::string& query_expression,
+            const std::vector<std::string>& query_parameters,
+            std::unique_ptr<DDSFilterExpression>&& query)
+        : data_reader_(data_reader)
+        , user_reader_(user_reader)
+        , states_(states)
+        , query_expression_(query_expression)
+        , query_parameters_(query_parameters)
+        , query_(std::move(query))
+    {
+    }
+
+    bool get_trigger_value() const
+    {
+        return data_reader_.get_trigger_value(*this);
+    }
+
+    DataReader* get_datareader() const
+    {
+        return user_reader_;
+    }
+
+    const StateFilter& get_states() const
+    {
+        return states_;
+    }
+
+    bool has_query() const
+    {
+        return static_cast<bool>(query_);
+    }
+
+    const std::string& get_query_expression() const
+    {
+        return query_expression_;
+    }
+
+    std::vector<std::string> get_query_parameters() const
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return query_parameters_;
+    }
+
+    ReturnCode_t set_query_parameters(
+            const std::vector<std::string>& query_parameters)
+    {
+        if (query_parameters.size() > DDSSQLFilter::DDSFilterParser::max_parameters)
+        {
+            logError(DATA_READER, "Too many query parameters");
+            return ReturnCode_t::RETCODE_BAD_PARAMETER;
+        }
+
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (query_ && !query_->set_parameters(query_parameters))
+        {
+            logError(DATA_READER, "Query parameters not valid for query '" << query_expression_ << "'");
+            return ReturnCode_t::RETCODE_BAD_PARAMETER;
+        }
+
+        query_parameters_ = query_parameters;
+        return ReturnCode_t::RETCODE_OK;
+    }
+
+    /**
+     * Check whether a change passes the query of the condition.
+     * @param change  The change to check. Should be fully assembled.
+     * @return true when the condition has no query, when the change has no valid data, or when its data passes
+     *         the query.
+     */
+    bool is_relevant(
+            const fastrtps::rtps::CacheChange_t& change) const
+    {
+        if (!query_ || fastrtps::rtps::ALIVE != change.kind)
+        {
+            return true;
+        }
+
+        return query_->evaluate(change.serializedPayload.data, change.serializedPayload.length);
+    }
+
+private:
+
+    DataReaderImpl& data_reader_;
+    DataReader* user_reader_;
+    StateFilter states_;
+    std::string query_expression_;
+    std::vector<std::string> query_parameters_;
+    std::unique_ptr<DDSFilterExpression> query_;
+    mutable std::mutex mutex_;
+};
+
+} /* namespace detail */
+} /* namespace dds */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif  // _FASTDDS_SUBSCRIBER_DATAREADERIMPL_READCONDITIONIMPL_HPP_
@@ -32,6 +32,7 @@
 
 #include <fastdds/subscriber/DataReaderImpl.hpp>
 #include <fastdds/subscriber/DataReaderImpl/DataReaderLoanManager.hpp>
+#include <fastdds/subscriber/DataReaderImpl/ReadConditionImpl.hpp>
 #include <fastdds/subscriber/DataReaderImpl/StateFilter.hpp>
 #include <fastdds/subscriber/DataReaderImpl/SampleInfoPool.hpp>
 #include <fastdds/subscriber/DataReaderImpl/SampleLoanManager.hpp>
@@ -65,7 +66,8 @@ struct ReadTakeCommand
             int32_t max_samples,
             const StateFilter& states,
             history_type::instance_info instance,
-            bool single_instance = false)
+            bool single_instance = false,
+            const ReadConditionImpl* condition = nullptr)
         : type_(reader.type_)
         , loan_manager_(reader.loan_manager_)
         , history_(reader.history_)
@@ -79,6 +81,7 @@ struct ReadTakeCommand
         , instance_(instance)
         , handle_(instance.first)
         , single_instance_(single_instance)
+        , condition_(condition)
     {
         assert(0 <= remaining_samples_);
 
@@ -105,15 +108,24 @@ struct ReadTakeCommand
             return false;
         }
 
-        // Traverse changes on current instance
+        // Traverse changes on current instance.
+        // When only unread samples are requested, the ones already read are skipped using the indexes kept by the
+        // history, and the traversal ends as soon as all the unread samples of the instance have been visited.
         bool ret_val = false;
         LoanableCollection::size_type first_slot = current_slot_;
-        auto it = instance_.second->begin();
-        while (!finished_ && it != instance_.second->end())
+        bool only_not_read = (states_.sample_states & READ_SAMPLE_STATE) == 0;
+        size_t pending_not_read = history_.get_not_read_count(instance_);
+        auto it = only_not_read ? history_.get_first_not_read_change(instance_) : instance_.second->begin();
+        while (!finished_ && it != instance_.second->end() && (!only_not_read || 0 < pending_not_read))
         {
             CacheChange_t* change = *it;
             SampleStateKind check;
             check = change->isRead ? SampleStateKind::READ_SAMPLE_STATE : SampleStateKind::NOT_READ_SAMPLE_STATE;
+            if (!change->isRead && 0 < pending_not_read)
+            {
+                --pending_not_read;
+            }
+
             if ((check & states_.sample_states) != 0)
             {
                 WriterProxy* wp = nullptr;
@@ -145,8 +157,17 @@ struct ReadTakeCommand
 
                     // Add sample and info to collections
                     ReturnCode_t previous_return_value = return_value_;
-                    bool added = add_sample(change, remove_change);
+                    bool was_read = change->isRead;
+                    bool added = false;
+                    if (nullptr == condition_ || condition_->is_relevant(*change))
+                    {
+                        added = add_sample(change, remove_change);
+                    }
                     reader_->end_sample_access_nts(change, wp, added);
+                    if (added && !was_read)
+                    {
+                        history_.change_was_read_nts(change);
+                    }
 
                     // Check if the payload is dirty
                     if (added && !check_datasharing_validity(change, data_values_.has_ownership(), wp))
@@ -223,6 +244,7 @@ private:
     history_type::instance_info instance_;
     InstanceHandle_t handle_;
     bool single_instance_;
+    const ReadConditionImpl* condition_;
 
     bool finished_ = false;
     ReturnCode_t return_value_ = ReturnCode_t::RETCODE_NO_DATA;
@@ -246,7 +268,13 @@ private:
         // We are not implementing instance_state or view_state yet, so all instances will be considered to have
         // a valid state. In the future this should check instance_state against states_.instance_states and
         // view_state against states_.view_states
-        return true;
+
+        // Skip instances without samples on the requested sample states
+        size_t not_read = history_.get_not_read_count(instance_);
+        bool has_not_read = 0 < not_read;
+        bool has_read = instance_.second->size() > not_read;
+        return (has_not_read && (states_.sample_states & NOT_READ_SAMPLE_STATE) != 0) ||
+               (has_read && (states_.sample_states & READ_SAMPLE_STATE) != 0);
     }
 
     bool next_instance()
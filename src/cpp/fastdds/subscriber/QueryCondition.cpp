@@ -0,0 +1,57 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file QueryCondition.cpp
+ *
+ */
+
+#include <fastdds/dds/subscriber/QueryCondition.hpp>
+#include <fastdds/subscriber/DataReaderImpl/ReadConditionImpl.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+QueryCondition::QueryCondition(
+        detail::ReadConditionImpl* impl)
+    : ReadCondition(impl)
+{
+}
+
+QueryCondition::~QueryCondition()
+{
+}
+
+const std::string& QueryCondition::get_query_expression() const
+{
+    return impl_->get_query_expression();
+}
+
+ReturnCode_t QueryCondition::get_query_parameters(
+        std::vector<std::string>& query_parameters) const
+{
+    query_parameters = impl_->get_query_parameters();
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t QueryCondition::set_query_parameters(
+        const std::vector<std::string>& query_parameters)
+{
+    return impl_->set_query_parameters(query_parameters);
+}
+
+} /* namespace dds */
+} /* namespace fastdds */
+} /* namespace eprosima */
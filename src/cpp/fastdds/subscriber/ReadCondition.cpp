@@ -0,0 +1,65 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReadCondition.cpp
+ *
+ */
+
+#include <fastdds/dds/subscriber/ReadCondition.hpp>
+#include <fastdds/subscriber/DataReaderImpl/ReadConditionImpl.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+ReadCondition::ReadCondition(
+        detail::ReadConditionImpl* impl)
+    : impl_(impl)
+{
+}
+
+ReadCondition::~ReadCondition()
+{
+    delete impl_;
+}
+
+bool ReadCondition::get_trigger_value() const
+{
+    return impl_->get_trigger_value();
+}
+
+DataReader* ReadCondition::get_datareader() const
+{
+    return impl_->get_datareader();
+}
+
+SampleStateMask ReadCondition::get_sample_state_mask() const
+{
+    return impl_->get_states().sample_states;
+}
+
+ViewStateMask ReadCondition::get_view_state_mask() const
+{
+    return impl_->get_states().view_states;
+}
+
+InstanceStateMask ReadCondition::get_instance_state_mask() const
+{
+    return impl_->get_states().instance_states;
+}
+
+} /* namespace dds */
+} /* namespace fastdds */
+} /* namespace eprosima */
@@ -161,18 +161,12 @@ bool Subscriber::has_datareaders() const
 
 ReturnCode_t Subscriber::begin_access()
 {
-    return ReturnCode_t::RETCODE_UNSUPPORTED;
-    /*
-       return impl_->begin_access();
-     */
+    return impl_->begin_access();
 }
 
 ReturnCode_t Subscriber::end_access()
 {
-    return ReturnCode_t::RETCODE_UNSUPPORTED;
-    /*
-       return impl_->end_access();
-     */
+    return impl_->end_access();
 }
 
 ReturnCode_t Subscriber::notify_datareaders() const
@@ -347,21 +347,26 @@ bool SubscriberImpl::has_datareaders() const
     return true;
 }
 
-/* TODO
-   bool SubscriberImpl::begin_access()
-   {
-    logError(PUBLISHER, "Operation not implemented");
-    return false;
-   }
- */
+ReturnCode_t SubscriberImpl::begin_access()
+{
+    // Coherent sets are made visible atomically by the readers, so there is nothing to hold here.
+    std::lock_guard<std::mutex> lock(mtx_readers_);
+    ++access_depth_;
+    return ReturnCode_t::RETCODE_OK;
+}
 
-/* TODO
-   bool SubscriberImpl::end_access()
-   {
-    logError(PUBLISHER, "Operation not implemented");
-    return false;
-   }
- */
+ReturnCode_t SubscriberImpl::end_access()
+{
+    std::lock_guard<std::mutex> lock(mtx_readers_);
+    if (0 == access_depth_)
+    {
+        logError(SUBSCRIBER, "end_access called without a matching begin_access");
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    --access_depth_;
+    return ReturnCode_t::RETCODE_OK;
+}
 
 ReturnCode_t SubscriberImpl::notify_datareaders() const
 {
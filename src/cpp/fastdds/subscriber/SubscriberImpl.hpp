@@ -113,13 +113,10 @@ public:
 
     bool contains_entity(
             const fastrtps::rtps::InstanceHandle_t& handle) const;
-    /* TODO
-       bool begin_access();
-     */
 
-    /* TODO
-       bool end_access();
-     */
+    ReturnCode_t begin_access();
+
+    ReturnCode_t end_access();
 
     /* TODO When StateKinds are implemented.
        bool get_datareaders(
@@ -232,6 +229,9 @@ protected:
 
     mutable std::mutex mtx_readers_;
 
+    //! Nesting level of begin_access calls. Protected by mtx_readers_.
+    uint32_t access_depth_ = 0;
+
     //!Listener
     SubscriberListener* listener_;
 
@@ -0,0 +1,158 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ContentFilteredTopicImpl.cpp
+ */
+
+#include <fastdds/topic/ContentFilteredTopicImpl.hpp>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/dds/topic/ContentFilteredTopic.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/domain/DomainParticipantImpl.hpp>
+#include <fastdds/subscriber/DataReaderImpl.hpp>
+#include <fastdds/topic/DDSSQLFilter/DDSFilterFactory.hpp>
+#include <fastdds/topic/DDSSQLFilter/DDSFilterParser.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+ContentFilteredTopicImpl::ContentFilteredTopicImpl(
+        DomainParticipantImpl* participant,
+        Topic* related_topic,
+        const std::string& filter_expression,
+        const std::vector<std::string>& expression_parameters,
+        std::unique_ptr<DDSSQLFilter::DDSFilterExpression>&& filter)
+    : participant_(participant)
+    , related_topic_(related_topic)
+    , filter_expression_(filter_expression)
+    , expression_parameters_(expression_parameters)
+    , filter_(std::move(filter))
+    , user_topic_(nullptr)
+{
+}
+
+ContentFilteredTopicImpl::~ContentFilteredTopicImpl()
+{
+    delete user_topic_;
+}
+
+DomainParticipant* ContentFilteredTopicImpl::get_participant() const
+{
+    return participant_->get_participant();
+}
+
+Topic* ContentFilteredTopicImpl::get_related_topic() const
+{
+    return related_topic_;
+}
+
+const ContentFilteredTopic* ContentFilteredTopicImpl::get_topic() const
+{
+    return user_topic_;
+}
+
+const std::string& ContentFilteredTopicImpl::get_filter_expression() const
+{
+    return filter_expression_;
+}
+
+std::vector<std::string> ContentFilteredTopicImpl::get_expression_parameters() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return expression_parameters_;
+}
+
+ReturnCode_t ContentFilteredTopicImpl::set_expression_parameters(
+        const std::vector<std::string>& expression_parameters)
+{
+    if (expression_parameters.size() > DDSSQLFilter::DDSFilterParser::max_parameters)
+    {
+        logError(CONTENT_FILTERED_TOPIC, "Too many expression parameters");
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (filter_ && !filter_->set_parameters(expression_parameters))
+    {
+        logError(CONTENT_FILTERED_TOPIC, "Expression parameters not valid for filter '" << filter_expression_ << "'");
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    expression_parameters_ = expression_parameters;
+
+    // Announce the new parameters through the readers created on this topic
+    fastdds::rtps::ContentFilterProperty property;
+    fill_content_filter_property_nts(property);
+    for (DataReaderImpl* reader : readers_)
+    {
+        reader->filter_has_been_updated(property);
+    }
+
+    return ReturnCode_t::RETCODE_OK;
+}
+
+const std::string& ContentFilteredTopicImpl::get_rtps_topic_name() const
+{
+    return related_topic_->get_name();
+}
+
+void ContentFilteredTopicImpl::fill_content_filter_property(
+        fastdds::rtps::ContentFilterProperty& property) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    fill_content_filter_property_nts(property);
+}
+
+void ContentFilteredTopicImpl::fill_content_filter_property_nts(
+        fastdds::rtps::ContentFilterProperty& property) const
+{
+    property.content_filtered_topic_name = user_topic_->get_name();
+    property.related_topic_name = related_topic_->get_name();
+    property.filter_class_name = DDSSQLFilter::DDSFilterFactory::filter_class_name;
+    property.filter_expression = filter_expression_;
+    property.expression_parameters = expression_parameters_;
+}
+
+bool ContentFilteredTopicImpl::is_relevant(
+        const fastrtps::rtps::CacheChange_t& change) const
+{
+    if (!filter_ || fastrtps::rtps::ALIVE != change.kind)
+    {
+        return true;
+    }
+
+    return filter_->evaluate(change.serializedPayload.data, change.serializedPayload.length);
+}
+
+void ContentFilteredTopicImpl::add_reader(
+        DataReaderImpl* reader)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    readers_.insert(reader);
+}
+
+void ContentFilteredTopicImpl::remove_reader(
+        DataReaderImpl* reader)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    readers_.erase(reader);
+}
+
+} // dds
+} // fastdds
+} // eprosima
@@ -0,0 +1,120 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ContentFilteredTopicImpl.hpp
+ */
+
+#ifndef _FASTDDS_TOPIC_CONTENTFILTEREDTOPICIMPL_HPP_
+#define _FASTDDS_TOPIC_CONTENTFILTEREDTOPICIMPL_HPP_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <fastdds/rtps/builtin/data/ContentFilterProperty.hpp>
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/topic/TopicDescriptionImpl.hpp>
+#include <fastdds/topic/DDSSQLFilter/DDSFilterExpression.hpp>
+#include <fastrtps/types/TypesBase.h>
+
+using eprosima::fastrtps::types::ReturnCode_t;
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+class ContentFilteredTopic;
+class DataReaderImpl;
+class DomainParticipant;
+class DomainParticipantImpl;
+class Topic;
+
+class ContentFilteredTopicImpl : public TopicDescriptionImpl
+{
+    friend class DomainParticipantImpl;
+
+    ContentFilteredTopicImpl(
+            DomainParticipantImpl* participant,
+            Topic* related_topic,
+            const std::string& filter_expression,
+            const std::vector<std::string>& expression_parameters,
+            std::unique_ptr<DDSSQLFilter::DDSFilterExpression>&& filter);
+
+public:
+
+    virtual ~ContentFilteredTopicImpl();
+
+    DomainParticipant* get_participant() const;
+
+    Topic* get_related_topic() const;
+
+    const ContentFilteredTopic* get_topic() const;
+
+    const std::string& get_filter_expression() const;
+
+    std::vector<std::string> get_expression_parameters() const;
+
+    ReturnCode_t set_expression_parameters(
+            const std::vector<std::string>& expression_parameters);
+
+    const std::string& get_rtps_topic_name() const override;
+
+    /**
+     * Fill the information announced on discovery by the readers created on this topic.
+     * @param [out] property  Content filter information to fill.
+     */
+    void fill_content_filter_property(
+            fastdds::rtps::ContentFilterProperty& property) const;
+
+    /**
+     * Evaluate the filter on a received change.
+     * Used on the reader side for the samples coming from writers that do not apply the filter.
+     * @param change  The change to evaluate.
+     * @return whether the change passes the filter.
+     */
+    bool is_relevant(
+            const fastrtps::rtps::CacheChange_t& change) const;
+
+    void add_reader(
+            DataReaderImpl* reader);
+
+    void remove_reader(
+            DataReaderImpl* reader);
+
+protected:
+
+    void fill_content_filter_property_nts(
+            fastdds::rtps::ContentFilterProperty& property) const;
+
+    DomainParticipantImpl* participant_;
+    Topic* related_topic_;
+    std::string filter_expression_;
+    std::vector<std::string> expression_parameters_;
+    std::unique_ptr<DDSSQLFilter::DDSFilterExpression> filter_;
+    ContentFilteredTopic* user_topic_;
+    std::set<DataReaderImpl*> readers_;
+    mutable std::mutex mutex_;
+
+};
+
+} // dds
+} // fastdds
+} // eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif /* _FASTDDS_TOPIC_CONTENTFILTEREDTOPICIMPL_HPP_ */
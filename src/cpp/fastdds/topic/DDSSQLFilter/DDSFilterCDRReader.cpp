@@ -0,0 +1,414 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DDSFilterCDRReader.cpp
+ */
+
+#include "DDSFilterCDRReader.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace DDSSQLFilter {
+
+// Size of the encapsulation header preceding the CDR stream
+static constexpr uint32_t encapsulation_size = 4u;
+
+// Maximum alignment used by CDR
+static constexpr uint32_t max_alignment = 8u;
+
+static bool is_host_big_endian()
+{
+    const uint16_t probe = 0x0100u;
+    uint8_t first_byte;
+    memcpy(&first_byte, &probe, 1);
+    return 0u != first_byte;
+}
+
+template<typename T>
+static T read_raw(
+        const uint8_t* src,
+        bool swap)
+{
+    uint8_t buffer[sizeof(T)];
+    if (swap)
+    {
+        std::reverse_copy(src, src + sizeof(T), buffer);
+    }
+    else
+    {
+        memcpy(buffer, src, sizeof(T));
+    }
+
+    T ret;
+    memcpy(&ret, buffer, sizeof(T));
+    return ret;
+}
+
+void DDSFilterCDRReader::add_skip(
+        uint32_t size,
+        uint32_t count)
+{
+    if (0u == count)
+    {
+        return;
+    }
+
+    // Consecutive elements of the same size can be skipped at once
+    if (!operations_.empty())
+    {
+        Operation& last = operations_.back();
+        if (OperationKind::SKIP == last.kind && size == last.size)
+        {
+            last.count += count;
+            return;
+        }
+    }
+
+    operations_.push_back({OperationKind::SKIP, PrimitiveKind::UINT8, size, count, 0u});
+}
+
+void DDSFilterCDRReader::add_skip_string(
+        uint32_t count)
+{
+    if (0u == count)
+    {
+        return;
+    }
+
+    if (!operations_.empty())
+    {
+        Operation& last = operations_.back();
+        if (OperationKind::SKIP_STRING == last.kind)
+        {
+            last.count += count;
+            return;
+        }
+    }
+
+    operations_.push_back({OperationKind::SKIP_STRING, PrimitiveKind::CHAR, 1u, count, 0u});
+}
+
+void DDSFilterCDRReader::add_skip_sequence(
+        uint32_t element_size)
+{
+    operations_.push_back({OperationKind::SKIP_SEQUENCE, PrimitiveKind::UINT8, element_size, 1u, 0u});
+}
+
+void DDSFilterCDRReader::add_skip_string_sequence()
+{
+    operations_.push_back({OperationKind::SKIP_STRING_SEQUENCE, PrimitiveKind::CHAR, 1u, 1u, 0u});
+}
+
+void DDSFilterCDRReader::add_read(
+        PrimitiveKind kind,
+        size_t slot)
+{
+    operations_.push_back({OperationKind::READ, kind, primitive_size(kind), 1u, slot});
+}
+
+void DDSFilterCDRReader::add_read_string(
+        size_t slot)
+{
+    operations_.push_back({OperationKind::READ_STRING, PrimitiveKind::CHAR, 1u, 1u, slot});
+}
+
+void DDSFilterCDRReader::trim()
+{
+    while (!operations_.empty() &&
+            OperationKind::READ != operations_.back().kind &&
+            OperationKind::READ_STRING != operations_.back().kind)
+    {
+        operations_.pop_back();
+    }
+}
+
+bool DDSFilterCDRReader::read(
+        const uint8_t* data,
+        uint32_t length,
+        DDSFilterValue* values) const
+{
+    if (nullptr == data || length < encapsulation_size || 0u != data[0])
+    {
+        return false;
+    }
+
+    // Only plain CDR (0x0000 big endian, 0x0001 little endian) is supported
+    bool big_endian;
+    switch (data[1])
+    {
+        case 0x00:
+            big_endian = true;
+            break;
+        case 0x01:
+            big_endian = false;
+            break;
+        default:
+            return false;
+    }
+
+    Cursor cursor{ data + encapsulation_size, length - encapsulation_size, 0u, big_endian != is_host_big_endian() };
+
+    for (const Operation& op : operations_)
+    {
+        switch (op.kind)
+        {
+            case OperationKind::SKIP:
+                if (!cursor.skip(op.size, op.count))
+                {
+                    return false;
+                }
+                break;
+
+            case OperationKind::SKIP_STRING:
+                for (uint32_t n = 0; n < op.count; ++n)
+                {
+                    if (!cursor.skip_string(nullptr, nullptr))
+                    {
+                        return false;
+                    }
+                }
+                break;
+
+            case OperationKind::SKIP_SEQUENCE:
+            {
+                uint32_t seq_length = 0;
+                if (!cursor.read_length(seq_length) || !cursor.skip(op.size, seq_length))
+                {
+                    return false;
+                }
+                break;
+            }
+
+            case OperationKind::SKIP_STRING_SEQUENCE:
+            {
+                uint32_t seq_length = 0;
+                if (!cursor.read_length(seq_length))
+                {
+                    return false;
+                }
+                for (uint32_t n = 0; n < seq_length; ++n)
+                {
+                    if (!cursor.skip_string(nullptr, nullptr))
+                    {
+                        return false;
+                    }
+                }
+                break;
+            }
+
+            case OperationKind::READ:
+                if (!read_primitive(cursor, op.primitive, values[op.slot]))
+                {
+                    return false;
+                }
+                break;
+
+            case OperationKind::READ_STRING:
+            {
+                const char* str = nullptr;
+                uint32_t str_length = 0;
+                if (!cursor.skip_string(&str, &str_length))
+                {
+                    return false;
+                }
+                values[op.slot].set_string(str, str_length);
+                break;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool DDSFilterCDRReader::Cursor::align(
+        uint32_t size)
+{
+    uint32_t alignment = std::min(size, max_alignment);
+    if (alignment > 1u)
+    {
+        offset = (offset + alignment - 1u) & ~(alignment - 1u);
+    }
+    return offset <= length;
+}
+
+bool DDSFilterCDRReader::Cursor::read_length(
+        uint32_t& value)
+{
+    if (!align(4u) || length - offset < 4u)
+    {
+        return false;
+    }
+
+    value = read_raw<uint32_t>(data + offset, swap);
+    offset += 4u;
+    return true;
+}
+
+bool DDSFilterCDRReader::Cursor::skip(
+        uint32_t size,
+        uint32_t count)
+{
+    if (0u == count)
+    {
+        return true;
+    }
+
+    if (!align(size))
+    {
+        return false;
+    }
+
+    uint64_t total = static_cast<uint64_t>(size) * count;
+    if (length - offset < total)
+    {
+        return false;
+    }
+
+    offset += static_cast<uint32_t>(total);
+    return true;
+}
+
+bool DDSFilterCDRReader::Cursor::skip_string(
+        const char** str,
+        uint32_t* str_length)
+{
+    uint32_t str_size = 0;
+    if (!read_length(str_size) || length - offset < str_size)
+    {
+        return false;
+    }
+
+    if (nullptr != str)
+    {
+        // Serialized length includes the null terminator
+        *str = reinterpret_cast<const char*>(data + offset);
+        *str_length = (str_size > 0u && '\0' == (*str)[str_size - 1u]) ? str_size - 1u : str_size;
+    }
+
+    offset += str_size;
+    return true;
+}
+
+uint32_t DDSFilterCDRReader::primitive_size(
+        PrimitiveKind kind)
+{
+    switch (kind)
+    {
+        case PrimitiveKind::BOOLEAN:
+        case PrimitiveKind::CHAR:
+        case PrimitiveKind::INT8:
+        case PrimitiveKind::UINT8:
+            return 1u;
+        case PrimitiveKind::INT16:
+        case PrimitiveKind::UINT16:
+            return 2u;
+        case PrimitiveKind::INT32:
+        case PrimitiveKind::UINT32:
+        case PrimitiveKind::FLOAT32:
+            return 4u;
+        case PrimitiveKind::INT64:
+        case PrimitiveKind::UINT64:
+        case PrimitiveKind::FLOAT64:
+            return 8u;
+        case PrimitiveKind::FLOAT128:
+            return 16u;
+    }
+
+    return 0u;
+}
+
+bool DDSFilterCDRReader::read_primitive(
+        Cursor& cursor,
+        PrimitiveKind kind,
+        DDSFilterValue& value)
+{
+    uint32_t size = primitive_size(kind);
+    if (!cursor.align(size) || cursor.length - cursor.offset < size)
+    {
+        return false;
+    }
+
+    const uint8_t* src = cursor.data + cursor.offset;
+    bool swap = cursor.swap;
+    cursor.offset += size;
+
+    switch (kind)
+    {
+        case PrimitiveKind::BOOLEAN:
+            value.set_boolean(0u != *src);
+            break;
+        case PrimitiveKind::CHAR:
+            value.set_char(static_cast<char>(*src));
+            break;
+        case PrimitiveKind::INT8:
+            value.set_signed(static_cast<int8_t>(*src));
+            break;
+        case PrimitiveKind::UINT8:
+            value.set_unsigned(*src);
+            break;
+        case PrimitiveKind::INT16:
+            value.set_signed(read_raw<int16_t>(src, swap));
+            break;
+        case PrimitiveKind::UINT16:
+            value.set_unsigned(read_raw<uint16_t>(src, swap));
+            break;
+        case PrimitiveKind::INT32:
+            value.set_signed(read_raw<int32_t>(src, swap));
+            break;
+        case PrimitiveKind::UINT32:
+            value.set_unsigned(read_raw<uint32_t>(src, swap));
+            break;
+        case PrimitiveKind::INT64:
+            value.set_signed(read_raw<int64_t>(src, swap));
+            break;
+        case PrimitiveKind::UINT64:
+            value.set_unsigned(read_raw<uint64_t>(src, swap));
+            break;
+        case PrimitiveKind::FLOAT32:
+            value.set_float(read_raw<float>(src, swap));
+            break;
+        case PrimitiveKind::FLOAT64:
+            value.set_float(read_raw<double>(src, swap));
+            break;
+        case PrimitiveKind::FLOAT128:
+        {
+            // Only the portion actually used by the platform's long double is meaningful
+            uint8_t buffer[16];
+            if (swap)
+            {
+                std::reverse_copy(src, src + 16, buffer);
+            }
+            else
+            {
+                memcpy(buffer, src, 16);
+            }
+            long double ld = 0;
+            memcpy(&ld, buffer, std::min(sizeof(long double), sizeof(buffer)));
+            value.set_float(ld);
+            break;
+        }
+    }
+
+    return true;
+}
+
+} // namespace DDSSQLFilter
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
@@ -0,0 +1,186 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DDSFilterCDRReader.hpp
+ */
+
+#ifndef _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTERCDRREADER_HPP_
+#define _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTERCDRREADER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "DDSFilterValue.hpp"
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace DDSSQLFilter {
+
+/**
+ * Flattened program that walks a plain CDR payload and extracts the values of the fields
+ * referenced on a filter expression.
+ *
+ * The program is generated once from the type description and consists of a linear list of
+ * skip / read operations, so evaluating a sample never needs to deserialize the whole type.
+ * Only the fields up to the last referenced one are visited.
+ */
+class DDSFilterCDRReader
+{
+public:
+
+    enum class PrimitiveKind : uint8_t
+    {
+        BOOLEAN,
+        CHAR,
+        INT8,
+        UINT8,
+        INT16,
+        UINT16,
+        INT32,
+        UINT32,
+        INT64,
+        UINT64,
+        FLOAT32,
+        FLOAT64,
+        FLOAT128
+    };
+
+    /**
+     * Adds an operation skipping @c count consecutive primitive elements of @c size bytes each.
+     */
+    void add_skip(
+            uint32_t size,
+            uint32_t count);
+
+    /**
+     * Adds an operation skipping @c count consecutive strings.
+     */
+    void add_skip_string(
+            uint32_t count);
+
+    /**
+     * Adds an operation skipping a sequence of primitive elements of @c element_size bytes each.
+     */
+    void add_skip_sequence(
+            uint32_t element_size);
+
+    /**
+     * Adds an operation skipping a sequence of strings.
+     */
+    void add_skip_string_sequence();
+
+    /**
+     * Adds an operation reading a primitive value into a value slot.
+     */
+    void add_read(
+            PrimitiveKind kind,
+            size_t slot);
+
+    /**
+     * Adds an operation reading a string value into a value slot.
+     */
+    void add_read_string(
+            size_t slot);
+
+    /**
+     * Removes all trailing skip operations, as they are not needed to extract any value.
+     */
+    void trim();
+
+    /**
+     * @return the number of operations on the program.
+     */
+    size_t size() const
+    {
+        return operations_.size();
+    }
+
+    /**
+     * Run the program on a serialized payload.
+     *
+     * @param data    Pointer to the serialized payload, including the encapsulation header.
+     * @param length  Length of the serialized payload.
+     * @param values  Array of value slots to fill.
+     *
+     * @return true when all the values could be extracted.
+     * @return false when the payload does not use plain CDR encapsulation or it is malformed.
+     */
+    bool read(
+            const uint8_t* data,
+            uint32_t length,
+            DDSFilterValue* values) const;
+
+private:
+
+    enum class OperationKind : uint8_t
+    {
+        SKIP,
+        SKIP_STRING,
+        SKIP_SEQUENCE,
+        SKIP_STRING_SEQUENCE,
+        READ,
+        READ_STRING
+    };
+
+    struct Operation
+    {
+        OperationKind kind;
+        PrimitiveKind primitive;
+        uint32_t size;
+        uint32_t count;
+        size_t slot;
+    };
+
+    struct Cursor
+    {
+        const uint8_t* data;
+        uint32_t length;
+        uint32_t offset;
+        bool swap;
+
+        bool align(
+                uint32_t size);
+
+        bool read_length(
+                uint32_t& value);
+
+        bool skip(
+                uint32_t size,
+                uint32_t count);
+
+        bool skip_string(
+                const char** str,
+                uint32_t* str_length);
+    };
+
+    static uint32_t primitive_size(
+            PrimitiveKind kind);
+
+    static bool read_primitive(
+            Cursor& cursor,
+            PrimitiveKind kind,
+            DDSFilterValue& value);
+
+    std::vector<Operation> operations_;
+};
+
+} // namespace DDSSQLFilter
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTERCDRREADER_HPP_
@@ -0,0 +1,305 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DDSFilterCondition.hpp
+ */
+
+#ifndef _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTERCONDITION_HPP_
+#define _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTERCONDITION_HPP_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "DDSFilterValue.hpp"
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace DDSSQLFilter {
+
+//! Map from enumeration literal names to their values.
+using EnumLiteralMap = std::map<std::string, int64_t>;
+
+/**
+ * Information about a field referenced on a filter expression.
+ */
+struct DDSFilterField
+{
+    //! Index of the value slot where the field value is extracted.
+    size_t slot = 0;
+    //! Kind of value the field holds.
+    DDSFilterValue::ValueKind kind = DDSFilterValue::ValueKind::BOOLEAN;
+    //! Literals of the field type when it is an enumeration. nullptr otherwise.
+    std::shared_ptr<const EnumLiteralMap> enum_literals;
+};
+
+/**
+ * An operand on a predicate: a field, a constant or a parameter.
+ */
+struct DDSFilterOperand
+{
+    enum class Kind
+    {
+        FIELD,
+        CONSTANT,
+        PARAMETER
+    };
+
+    Kind kind = Kind::CONSTANT;
+    //! Slot for FIELD operands, parameter index for PARAMETER operands.
+    size_t index = 0;
+    //! Value for CONSTANT operands.
+    DDSFilterValue constant;
+    //! Field information for FIELD operands.
+    DDSFilterField field;
+
+    const DDSFilterValue& value(
+            const DDSFilterValue* fields,
+            const std::vector<DDSFilterValue>& parameters) const
+    {
+        switch (kind)
+        {
+            case Kind::FIELD:
+                return fields[index];
+            case Kind::PARAMETER:
+                return parameters[index];
+            default:
+                return constant;
+        }
+    }
+
+};
+
+/**
+ * Base class for the nodes of a compiled filter expression.
+ */
+class DDSFilterCondition
+{
+public:
+
+    virtual ~DDSFilterCondition() = default;
+
+    /**
+     * Evaluate this condition.
+     *
+     * @param fields      Values extracted from the sample being evaluated.
+     * @param parameters  Current values of the expression parameters.
+     *
+     * @return whether the condition holds.
+     */
+    virtual bool evaluate(
+            const DDSFilterValue* fields,
+            const std::vector<DDSFilterValue>& parameters) const = 0;
+};
+
+/**
+ * A logical combination (AND / OR / NOT) of conditions.
+ */
+class DDSFilterCompoundCondition final : public DDSFilterCondition
+{
+public:
+
+    enum class OperationKind
+    {
+        NOT,
+        AND,
+        OR
+    };
+
+    DDSFilterCompoundCondition(
+            OperationKind op,
+            std::unique_ptr<DDSFilterCondition>&& left,
+            std::unique_ptr<DDSFilterCondition>&& right)
+        : op_(op)
+        , left_(std::move(left))
+        , right_(std::move(right))
+    {
+    }
+
+    bool evaluate(
+            const DDSFilterValue* fields,
+            const std::vector<DDSFilterValue>& parameters) const override
+    {
+        switch (op_)
+        {
+            case OperationKind::NOT:
+                return !left_->evaluate(fields, parameters);
+            case OperationKind::AND:
+                return left_->evaluate(fields, parameters) && right_->evaluate(fields, parameters);
+            case OperationKind::OR:
+                return left_->evaluate(fields, parameters) || right_->evaluate(fields, parameters);
+        }
+        return false;
+    }
+
+private:
+
+    OperationKind op_;
+    std::unique_ptr<DDSFilterCondition> left_;
+    std::unique_ptr<DDSFilterCondition> right_;
+};
+
+/**
+ * A relational predicate between two operands.
+ */
+class DDSFilterPredicate final : public DDSFilterCondition
+{
+public:
+
+    enum class OperationKind
+    {
+        EQUAL,
+        NOT_EQUAL,
+        LESS_THAN,
+        LESS_EQUAL,
+        GREATER_THAN,
+        GREATER_EQUAL,
+        LIKE
+    };
+
+    DDSFilterPredicate(
+            OperationKind op,
+            const DDSFilterOperand& left,
+            const DDSFilterOperand& right)
+        : op_(op)
+        , left_(left)
+        , right_(right)
+    {
+    }
+
+    bool evaluate(
+            const DDSFilterValue* fields,
+            const std::vector<DDSFilterValue>& parameters) const override
+    {
+        DDSFilterValue enum_value;
+        const DDSFilterValue* lhs = &left_.value(fields, parameters);
+        const DDSFilterValue* rhs = &right_.value(fields, parameters);
+
+        if (!resolve_enum(left_, rhs, enum_value) || !resolve_enum(right_, lhs, enum_value))
+        {
+            return false;
+        }
+
+        if (OperationKind::LIKE == op_)
+        {
+            return lhs->is_like(*rhs);
+        }
+
+        if (!DDSFilterValue::are_compatible(*lhs, *rhs))
+        {
+            return false;
+        }
+
+        int cmp = DDSFilterValue::compare(*lhs, *rhs);
+        switch (op_)
+        {
+            case OperationKind::EQUAL:
+                return 0 == cmp;
+            case OperationKind::NOT_EQUAL:
+                return 0 != cmp;
+            case OperationKind::LESS_THAN:
+                return cmp < 0;
+            case OperationKind::LESS_EQUAL:
+                return cmp <= 0;
+            case OperationKind::GREATER_THAN:
+                return cmp > 0;
+            case OperationKind::GREATER_EQUAL:
+                return cmp >= 0;
+            default:
+                return false;
+        }
+    }
+
+    /**
+     * Translates a string value compared against an enumeration field into the literal value.
+     *
+     * @param field_operand  Operand that may be an enumeration field.
+     * @param other          Value compared against the field. May be replaced by @c storage.
+     * @param storage        Storage for the translated value.
+     *
+     * @return false when the string does not name any literal of the enumeration.
+     */
+    static bool resolve_enum(
+            const DDSFilterOperand& field_operand,
+            const DDSFilterValue*& other,
+            DDSFilterValue& storage)
+    {
+        if (DDSFilterOperand::Kind::FIELD != field_operand.kind ||
+                !field_operand.field.enum_literals ||
+                DDSFilterValue::ValueKind::STRING != other->kind)
+        {
+            return true;
+        }
+
+        auto it = field_operand.field.enum_literals->find(other->string_value);
+        if (it == field_operand.field.enum_literals->end())
+        {
+            return false;
+        }
+
+        storage.set_signed(it->second);
+        other = &storage;
+        return true;
+    }
+
+private:
+
+    OperationKind op_;
+    DDSFilterOperand left_;
+    DDSFilterOperand right_;
+};
+
+/**
+ * A [NOT] BETWEEN predicate.
+ */
+class DDSFilterBetweenPredicate final : public DDSFilterCondition
+{
+public:
+
+    DDSFilterBetweenPredicate(
+            bool negated,
+            const DDSFilterOperand& value,
+            const DDSFilterOperand& low,
+            const DDSFilterOperand& high)
+        : negated_(negated)
+        , lower_(DDSFilterPredicate::OperationKind::GREATER_EQUAL, value, low)
+        , upper_(DDSFilterPredicate::OperationKind::LESS_EQUAL, value, high)
+    {
+    }
+
+    bool evaluate(
+            const DDSFilterValue* fields,
+            const std::vector<DDSFilterValue>& parameters) const override
+    {
+        bool in_range = lower_.evaluate(fields, parameters) && upper_.evaluate(fields, parameters);
+        return negated_ ? !in_range : in_range;
+    }
+
+private:
+
+    bool negated_;
+    DDSFilterPredicate lower_;
+    DDSFilterPredicate upper_;
+};
+
+} // namespace DDSSQLFilter
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTERCONDITION_HPP_
@@ -0,0 +1,81 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DDSFilterExpression.cpp
+ */
+
+#include "DDSFilterExpression.hpp"
+
+#include "DDSFilterParser.hpp"
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace DDSSQLFilter {
+
+DDSFilterExpression::DDSFilterExpression(
+        std::unique_ptr<DDSFilterCondition>&& condition,
+        DDSFilterCDRReader&& reader,
+        size_t num_fields,
+        const std::vector<std::pair<size_t, DDSFilterField>>& parameter_usages)
+    : condition_(std::move(condition))
+    , reader_(std::move(reader))
+    , parameter_usages_(parameter_usages)
+    , fields_(num_fields)
+{
+}
+
+bool DDSFilterExpression::set_parameters(
+        const std::vector<std::string>& parameters)
+{
+    std::vector<DDSFilterValue> values(parameters.size());
+    for (size_t i = 0; i < parameters.size(); ++i)
+    {
+        if (!DDSFilterParser::parse_literal(parameters[i], values[i]))
+        {
+            return false;
+        }
+    }
+
+    for (const std::pair<size_t, DDSFilterField>& usage : parameter_usages_)
+    {
+        if (usage.first >= values.size() || !DDSFilterParser::is_compatible(usage.second, values[usage.first]))
+        {
+            return false;
+        }
+    }
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    parameters_.swap(values);
+    return true;
+}
+
+bool DDSFilterExpression::evaluate(
+        const uint8_t* data,
+        uint32_t length) const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (!reader_.read(data, length, fields_.data()))
+    {
+        return true;
+    }
+
+    return condition_->evaluate(fields_.data(), parameters_);
+}
+
+} // namespace DDSSQLFilter
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
@@ -0,0 +1,98 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DDSFilterExpression.hpp
+ */
+
+#ifndef _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTEREXPRESSION_HPP_
+#define _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTEREXPRESSION_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DDSFilterCDRReader.hpp"
+#include "DDSFilterCondition.hpp"
+#include "DDSFilterValue.hpp"
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace DDSSQLFilter {
+
+/**
+ * A compiled DDS-SQL filter expression, ready to be evaluated against serialized samples.
+ */
+class DDSFilterExpression
+{
+public:
+
+    /**
+     * @param condition         Root of the compiled condition tree.
+     * @param reader            Program extracting the referenced fields from a serialized sample.
+     * @param num_fields        Number of value slots used by the condition tree.
+     * @param parameter_usages  List of (parameter index, field) pairs compared on the condition tree.
+     */
+    DDSFilterExpression(
+            std::unique_ptr<DDSFilterCondition>&& condition,
+            DDSFilterCDRReader&& reader,
+            size_t num_fields,
+            const std::vector<std::pair<size_t, DDSFilterField>>& parameter_usages);
+
+    /**
+     * Set the values of the expression parameters.
+     *
+     * @param parameters  New values for the parameters.
+     *
+     * @return false when some parameter is not a valid literal or is incompatible with the fields it is
+     *         compared against. The current parameters are kept in that case.
+     */
+    bool set_parameters(
+            const std::vector<std::string>& parameters);
+
+    /**
+     * Evaluate the expression on a serialized sample.
+     *
+     * @param data    Pointer to the serialized payload, including the encapsulation header.
+     * @param length  Length of the serialized payload.
+     *
+     * @return whether the sample passes the filter. Samples whose payload cannot be interpreted are
+     *         considered to pass the filter, so they are never silently discarded.
+     */
+    bool evaluate(
+            const uint8_t* data,
+            uint32_t length) const;
+
+private:
+
+    std::unique_ptr<DDSFilterCondition> condition_;
+    DDSFilterCDRReader reader_;
+    std::vector<std::pair<size_t, DDSFilterField>> parameter_usages_;
+    std::vector<DDSFilterValue> parameters_;
+
+    //! Protects the value slots, which are reused between evaluations.
+    mutable std::mutex mutex_;
+    mutable std::vector<DDSFilterValue> fields_;
+};
+
+} // namespace DDSSQLFilter
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTEREXPRESSION_HPP_
@@ -0,0 +1,521 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DDSFilterFactory.cpp
+ */
+
+#include "DDSFilterFactory.hpp"
+
+#include <map>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastrtps/types/DynamicPubSubType.h>
+#include <fastrtps/types/DynamicType.h>
+#include <fastrtps/types/DynamicTypeMember.h>
+#include <fastrtps/types/TypeDescriptor.h>
+#include <fastrtps/types/TypeObjectFactory.h>
+
+#include "DDSFilterCDRReader.hpp"
+#include "DDSFilterParser.hpp"
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace DDSSQLFilter {
+
+using namespace eprosima::fastrtps::types;
+
+constexpr const char* DDSFilterFactory::filter_class_name;
+
+using PrimitiveKind = DDSFilterCDRReader::PrimitiveKind;
+using ValueKind = DDSFilterValue::ValueKind;
+
+static DynamicType_ptr resolve_alias(
+        DynamicType_ptr type)
+{
+    while (type && TK_ALIAS == type->get_kind())
+    {
+        type = type->get_descriptor()->get_base_type();
+    }
+    return type;
+}
+
+/**
+ * Get the size of a primitive type on the CDR stream.
+ *
+ * @return 0 when the type is not a fixed-size primitive.
+ */
+static uint32_t primitive_size(
+        const DynamicType_ptr& type)
+{
+    switch (type->get_kind())
+    {
+        case TK_BOOLEAN:
+        case TK_BYTE:
+        case TK_CHAR8:
+            return 1u;
+        case TK_INT16:
+        case TK_UINT16:
+            return 2u;
+        case TK_INT32:
+        case TK_UINT32:
+        case TK_FLOAT32:
+        case TK_CHAR16:
+        case TK_ENUM:
+            return 4u;
+        case TK_INT64:
+        case TK_UINT64:
+        case TK_FLOAT64:
+            return 8u;
+        case TK_FLOAT128:
+            return 16u;
+        case TK_BITMASK:
+            return static_cast<uint32_t>(type->get_size());
+        default:
+            return 0u;
+    }
+}
+
+/**
+ * Resolves field names against a type, and generates the program extracting them from the serialized data.
+ */
+class DDSFilterTypeCompiler final : public IDDSFilterFieldResolver
+{
+public:
+
+    explicit DDSFilterTypeCompiler(
+            const DynamicType_ptr& type)
+        : type_(resolve_alias(type))
+    {
+    }
+
+    bool resolve_field(
+            const std::string& field_path,
+            DDSFilterField& field) override
+    {
+        auto it = resolved_.find(field_path);
+        if (it != resolved_.end())
+        {
+            field = it->second;
+            return true;
+        }
+
+        DynamicType_ptr current = type_;
+        RequestNode* node = &root_;
+        size_t start = 0;
+        while (true)
+        {
+            size_t dot = field_path.find('.', start);
+            std::string name = field_path.substr(start, (std::string::npos == dot) ? std::string::npos : dot - start);
+
+            DynamicTypeMember* member = nullptr;
+            if (!current || TK_STRUCTURE != current->get_kind() || !find_member(current, name, member))
+            {
+                return false;
+            }
+
+            node = &node->children[name];
+            if (node->leaf)
+            {
+                // A prefix of this path was already requested as a leaf
+                return false;
+            }
+            current = resolve_alias(member->get_descriptor()->get_type());
+
+            if (std::string::npos == dot)
+            {
+                break;
+            }
+            start = dot + 1;
+        }
+
+        if (!node->children.empty() || !set_leaf(current, *node, field))
+        {
+            return false;
+        }
+
+        field.slot = num_fields_++;
+        node->slot = field.slot;
+        resolved_[field_path] = field;
+        return true;
+    }
+
+    /**
+     * Generate the program extracting all resolved fields.
+     *
+     * @return false if the type contains unsupported members before some of the resolved fields.
+     */
+    bool build(
+            DDSFilterCDRReader& reader)
+    {
+        reader_ = &reader;
+        remaining_ = num_fields_;
+        failed_ = false;
+        if (0u < remaining_)
+        {
+            emit_struct(type_, &root_);
+        }
+        reader.trim();
+        return !failed_ && 0u == remaining_;
+    }
+
+    size_t num_fields() const
+    {
+        return num_fields_;
+    }
+
+private:
+
+    struct RequestNode
+    {
+        std::map<std::string, RequestNode> children;
+        bool leaf = false;
+        bool is_string = false;
+        PrimitiveKind primitive = PrimitiveKind::UINT8;
+        size_t slot = 0;
+    };
+
+    static bool find_member(
+            const DynamicType_ptr& type,
+            const std::string& name,
+            DynamicTypeMember*& member)
+    {
+        std::map<std::string, DynamicTypeMember*> members;
+        type->get_all_members_by_name(members);
+        auto it = members.find(name);
+        if (it != members.end())
+        {
+            member = it->second;
+            return !member->get_descriptor()->annotation_is_non_serialized();
+        }
+
+        DynamicType_ptr base = resolve_alias(type->get_descriptor()->get_base_type());
+        return base && find_member(base, name, member);
+    }
+
+    static bool set_leaf(
+            const DynamicType_ptr& type,
+            RequestNode& node,
+            DDSFilterField& field)
+    {
+        node.leaf = true;
+        switch (type->get_kind())
+        {
+            case TK_BOOLEAN:
+                node.primitive = PrimitiveKind::BOOLEAN;
+                field.kind = ValueKind::BOOLEAN;
+                break;
+            case TK_CHAR8:
+                node.primitive = PrimitiveKind::CHAR;
+                field.kind = ValueKind::CHAR;
+                break;
+            case TK_BYTE:
+                node.primitive = PrimitiveKind::UINT8;
+                field.kind = ValueKind::UNSIGNED_INTEGER;
+                break;
+            case TK_INT16:
+                node.primitive = PrimitiveKind::INT16;
+                field.kind = ValueKind::SIGNED_INTEGER;
+                break;
+            case TK_UINT16:
+                node.primitive = PrimitiveKind::UINT16;
+                field.kind = ValueKind::UNSIGNED_INTEGER;
+                break;
+            case TK_INT32:
+                node.primitive = PrimitiveKind::INT32;
+                field.kind = ValueKind::SIGNED_INTEGER;
+                break;
+            case TK_UINT32:
+                node.primitive = PrimitiveKind::UINT32;
+                field.kind = ValueKind::UNSIGNED_INTEGER;
+                break;
+            case TK_INT64:
+                node.primitive = PrimitiveKind::INT64;
+                field.kind = ValueKind::SIGNED_INTEGER;
+                break;
+            case TK_UINT64:
+                node.primitive = PrimitiveKind::UINT64;
+                field.kind = ValueKind::UNSIGNED_INTEGER;
+                break;
+            case TK_FLOAT32:
+                node.primitive = PrimitiveKind::FLOAT32;
+                field.kind = ValueKind::FLOAT;
+                break;
+            case TK_FLOAT64:
+                node.primitive = PrimitiveKind::FLOAT64;
+                field.kind = ValueKind::FLOAT;
+                break;
+            case TK_FLOAT128:
+                node.primitive = PrimitiveKind::FLOAT128;
+                field.kind = ValueKind::FLOAT;
+                break;
+            case TK_STRING8:
+                node.is_string = true;
+                field.kind = ValueKind::STRING;
+                break;
+            case TK_ENUM:
+            {
+                node.primitive = PrimitiveKind::UINT32;
+                field.kind = ValueKind::UNSIGNED_INTEGER;
+
+                std::map<MemberId, DynamicTypeMember*> literals;
+                type->get_all_members(literals);
+                std::shared_ptr<EnumLiteralMap> enum_literals = std::make_shared<EnumLiteralMap>();
+                for (const auto& literal : literals)
+                {
+                    (*enum_literals)[literal.second->get_name()] = static_cast<int64_t>(literal.first);
+                }
+                field.enum_literals = enum_literals;
+                break;
+            }
+            default:
+                node.leaf = false;
+                return false;
+        }
+
+        return true;
+    }
+
+    // Returns false when the generation should stop
+    bool emit_type(
+            const DynamicType_ptr& member_type,
+            const RequestNode* node)
+    {
+        if (0u == remaining_)
+        {
+            return false;
+        }
+
+        DynamicType_ptr type = resolve_alias(member_type);
+
+        if (nullptr != node && node->leaf)
+        {
+            if (node->is_string)
+            {
+                reader_->add_read_string(node->slot);
+            }
+            else
+            {
+                reader_->add_read(node->primitive, node->slot);
+            }
+            return 0u < --remaining_;
+        }
+
+        uint32_t size = primitive_size(type);
+        if (0u < size)
+        {
+            reader_->add_skip(size, 1u);
+            return true;
+        }
+
+        switch (type->get_kind())
+        {
+            case TK_STRING8:
+                reader_->add_skip_string(1u);
+                return true;
+
+            case TK_STRING16:
+                // Length followed by 4-byte wide characters
+                reader_->add_skip_sequence(4u);
+                return true;
+
+            case TK_STRUCTURE:
+                return emit_struct(type, node);
+
+            case TK_ARRAY:
+            {
+                DynamicType_ptr element = resolve_alias(type->get_descriptor()->get_element_type());
+                uint32_t count = type->get_total_bounds();
+                uint32_t element_size = primitive_size(element);
+                if (0u < element_size)
+                {
+                    reader_->add_skip(element_size, count);
+                    return true;
+                }
+                if (TK_STRING8 == element->get_kind())
+                {
+                    reader_->add_skip_string(count);
+                    return true;
+                }
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    if (!emit_type(element, nullptr))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            case TK_SEQUENCE:
+            {
+                DynamicType_ptr element = resolve_alias(type->get_descriptor()->get_element_type());
+                uint32_t element_size = primitive_size(element);
+                if (0u < element_size)
+                {
+                    reader_->add_skip_sequence(element_size);
+                    return true;
+                }
+                if (TK_STRING8 == element->get_kind())
+                {
+                    reader_->add_skip_string_sequence();
+                    return true;
+                }
+                break;
+            }
+
+            default:
+                break;
+        }
+
+        // Variable layout types (unions, maps, sequences of complex types, ...) cannot be skipped
+        failed_ = true;
+        return false;
+    }
+
+    bool emit_struct(
+            const DynamicType_ptr& type,
+            const RequestNode* node)
+    {
+        DynamicType_ptr base = resolve_alias(type->get_descriptor()->get_base_type());
+        if (base && !emit_struct(base, node))
+        {
+            return false;
+        }
+
+        std::map<MemberId, DynamicTypeMember*> members;
+        type->get_all_members(members);
+        for (const auto& member : members)
+        {
+            const MemberDescriptor* descriptor = member.second->get_descriptor();
+            if (descriptor->annotation_is_non_serialized())
+            {
+                continue;
+            }
+
+            const RequestNode* child = nullptr;
+            if (nullptr != node)
+            {
+                auto it = node->children.find(descriptor->get_name());
+                if (it != node->children.end())
+                {
+                    child = &it->second;
+                }
+            }
+
+            if (!emit_type(descriptor->get_type(), child))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    DynamicType_ptr type_;
+    RequestNode root_;
+    std::map<std::string, DDSFilterField> resolved_;
+    size_t num_fields_ = 0;
+
+    DDSFilterCDRReader* reader_ = nullptr;
+    size_t remaining_ = 0;
+    bool failed_ = false;
+};
+
+ReturnCode_t DDSFilterFactory::create_filter(
+        const TypeSupport& type,
+        const std::string& filter_expression,
+        const std::vector<std::string>& parameters,
+        std::unique_ptr<DDSFilterExpression>& filter)
+{
+    const DynamicPubSubType* dynamic_type = dynamic_cast<const DynamicPubSubType*>(type.get());
+    if (nullptr != dynamic_type && dynamic_type->GetDynamicType())
+    {
+        return create_filter(dynamic_type->GetDynamicType(), filter_expression, parameters, filter);
+    }
+
+    return create_filter(type->getName(), filter_expression, parameters, filter);
+}
+
+ReturnCode_t DDSFilterFactory::create_filter(
+        const std::string& type_name,
+        const std::string& filter_expression,
+        const std::vector<std::string>& parameters,
+        std::unique_ptr<DDSFilterExpression>& filter)
+{
+    TypeObjectFactory* factory = TypeObjectFactory::get_instance();
+    const TypeIdentifier* identifier = factory->get_type_identifier_trying_complete(type_name);
+    const TypeObject* object = (nullptr != identifier) ? factory->get_type_object(identifier) : nullptr;
+    if (nullptr == object)
+    {
+        logWarning(DDSSQLFILTER, "No type information available for type '" << type_name << "'");
+        return ReturnCode_t::RETCODE_UNSUPPORTED;
+    }
+
+    DynamicType_ptr type = factory->build_dynamic_type(type_name, identifier, object);
+    if (!type)
+    {
+        logWarning(DDSSQLFILTER, "Could not build type information for type '" << type_name << "'");
+        return ReturnCode_t::RETCODE_UNSUPPORTED;
+    }
+
+    return create_filter(type, filter_expression, parameters, filter);
+}
+
+ReturnCode_t DDSFilterFactory::create_filter(
+        const DynamicType_ptr& type,
+        const std::string& filter_expression,
+        const std::vector<std::string>& parameters,
+        std::unique_ptr<DDSFilterExpression>& filter)
+{
+    if (parameters.size() > DDSFilterParser::max_parameters)
+    {
+        logError(DDSSQLFILTER, "Too many expression parameters (" << parameters.size() << ")");
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    DDSFilterTypeCompiler compiler(type);
+    DDSFilterParser parser(filter_expression, parameters.size(), compiler);
+    std::unique_ptr<DDSFilterCondition> condition = parser.parse();
+    if (!condition)
+    {
+        logError(DDSSQLFILTER, "Error parsing filter expression '" << filter_expression << "': " << parser.error());
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    DDSFilterCDRReader reader;
+    if (!compiler.build(reader))
+    {
+        logError(DDSSQLFILTER, "Type '" << type->get_name() << "' contains members not supported by the filter"
+                                        " before the fields used on expression '" << filter_expression << "'");
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    std::unique_ptr<DDSFilterExpression> ret(new DDSFilterExpression(
+                std::move(condition), std::move(reader), compiler.num_fields(), parser.parameter_usages()));
+    if (!ret->set_parameters(parameters))
+    {
+        logError(DDSSQLFILTER, "Invalid expression parameters for filter expression '" << filter_expression << "'");
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    filter = std::move(ret);
+    return ReturnCode_t::RETCODE_OK;
+}
+
+} // namespace DDSSQLFilter
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
@@ -0,0 +1,110 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DDSFilterFactory.hpp
+ */
+
+#ifndef _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTERFACTORY_HPP_
+#define _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTERFACTORY_HPP_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastrtps/types/DynamicTypePtr.h>
+#include <fastrtps/types/TypesBase.h>
+
+#include "DDSFilterExpression.hpp"
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace DDSSQLFilter {
+
+using eprosima::fastrtps::types::ReturnCode_t;
+
+/**
+ * Builds compiled DDS-SQL filter expressions.
+ */
+class DDSFilterFactory
+{
+public:
+
+    //! Name of the only filter class supported.
+    static constexpr const char* filter_class_name = "DDSSQL";
+
+    /**
+     * Create a compiled filter for a registered type.
+     * Type information is taken from the type itself when it is a dynamic type, and from the TypeObjectFactory
+     * otherwise.
+     *
+     * @param type               Type of the filtered topic.
+     * @param filter_expression  The filter expression.
+     * @param parameters         Values for the expression parameters.
+     * @param [out] filter       The compiled filter.
+     *
+     * @return RETCODE_OK on success.
+     * @return RETCODE_UNSUPPORTED when no type information is available for the type.
+     * @return RETCODE_BAD_PARAMETER when the expression or the parameters are not valid for the type.
+     */
+    static ReturnCode_t create_filter(
+            const TypeSupport& type,
+            const std::string& filter_expression,
+            const std::vector<std::string>& parameters,
+            std::unique_ptr<DDSFilterExpression>& filter);
+
+    /**
+     * Create a compiled filter for a type registered on the TypeObjectFactory.
+     *
+     * @param type_name          Name of the type of the filtered topic.
+     * @param filter_expression  The filter expression.
+     * @param parameters         Values for the expression parameters.
+     * @param [out] filter       The compiled filter.
+     *
+     * @return RETCODE_OK on success.
+     * @return RETCODE_UNSUPPORTED when no type information is available for the type.
+     * @return RETCODE_BAD_PARAMETER when the expression or the parameters are not valid for the type.
+     */
+    static ReturnCode_t create_filter(
+            const std::string& type_name,
+            const std::string& filter_expression,
+            const std::vector<std::string>& parameters,
+            std::unique_ptr<DDSFilterExpression>& filter);
+
+    /**
+     * Create a compiled filter for a type.
+     *
+     * @param type               Type of the filtered topic.
+     * @param filter_expression  The filter expression.
+     * @param parameters         Values for the expression parameters.
+     * @param [out] filter       The compiled filter.
+     *
+     * @return RETCODE_OK on success.
+     * @return RETCODE_BAD_PARAMETER when the expression or the parameters are not valid for the type.
+     */
+    static ReturnCode_t create_filter(
+            const fastrtps::types::DynamicType_ptr& type,
+            const std::string& filter_expression,
+            const std::vector<std::string>& parameters,
+            std::unique_ptr<DDSFilterExpression>& filter);
+};
+
+} // namespace DDSSQLFilter
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTERFACTORY_HPP_
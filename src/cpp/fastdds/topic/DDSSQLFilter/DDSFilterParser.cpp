@@ -0,0 +1,647 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DDSFilterParser.cpp
+ */
+
+#include "DDSFilterParser.hpp"
+
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace DDSSQLFilter {
+
+constexpr size_t DDSFilterParser::max_parameters;
+
+static bool equals_ignore_case(
+        const std::string& text,
+        const char* keyword)
+{
+    size_t i = 0;
+    for (; i < text.size() && '\0' != keyword[i]; ++i)
+    {
+        if (std::toupper(static_cast<unsigned char>(text[i])) != keyword[i])
+        {
+            return false;
+        }
+    }
+    return i == text.size() && '\0' == keyword[i];
+}
+
+static bool is_identifier_start(
+        char c)
+{
+    return std::isalpha(static_cast<unsigned char>(c)) || '_' == c;
+}
+
+static bool is_identifier_char(
+        char c)
+{
+    return std::isalnum(static_cast<unsigned char>(c)) || '_' == c || '.' == c;
+}
+
+static bool parse_number(
+        const std::string& text,
+        DDSFilterValue& value)
+{
+    const char* begin = text.c_str();
+    char* end = nullptr;
+    errno = 0;
+
+    bool is_hex = text.find("0x") != std::string::npos || text.find("0X") != std::string::npos;
+    bool is_float = !is_hex && text.find_first_of(".eE") != std::string::npos;
+
+    if (is_float)
+    {
+        long double ld = std::strtold(begin, &end);
+        if (0 != errno || '\0' != *end)
+        {
+            return false;
+        }
+        value.set_float(ld);
+    }
+    else if ('-' == text[0])
+    {
+        long long ll = std::strtoll(begin, &end, is_hex ? 16 : 10);
+        if (0 != errno || '\0' != *end)
+        {
+            return false;
+        }
+        value.set_signed(static_cast<int64_t>(ll));
+    }
+    else
+    {
+        unsigned long long ull = std::strtoull(begin, &end, is_hex ? 16 : 10);
+        if (0 != errno || '\0' != *end)
+        {
+            return false;
+        }
+        value.set_unsigned(static_cast<uint64_t>(ull));
+    }
+
+    return true;
+}
+
+DDSFilterParser::DDSFilterParser(
+        const std::string& expression,
+        size_t num_parameters,
+        IDDSFilterFieldResolver& resolver)
+    : expression_(expression)
+    , num_parameters_(num_parameters)
+    , resolver_(resolver)
+{
+}
+
+std::unique_ptr<DDSFilterCondition> DDSFilterParser::parse()
+{
+    pos_ = 0;
+    error_.clear();
+    parameter_usages_.clear();
+    advance();
+
+    std::unique_ptr<DDSFilterCondition> ret = parse_or();
+    if (ret && TokenKind::END != current_.kind)
+    {
+        set_error("Unexpected '" + current_.text + "'");
+        ret.reset();
+    }
+
+    return ret;
+}
+
+bool DDSFilterParser::parse_literal(
+        const std::string& text,
+        DDSFilterValue& value)
+{
+    size_t pos = 0;
+    Token token;
+    if (!next_token(text, pos, token) || TokenKind::LITERAL != token.kind)
+    {
+        return false;
+    }
+
+    value = token.value;
+
+    Token end_token;
+    return next_token(text, pos, end_token) && TokenKind::END == end_token.kind;
+}
+
+bool DDSFilterParser::is_compatible(
+        const DDSFilterField& field,
+        const DDSFilterValue& value)
+{
+    if (field.enum_literals && DDSFilterValue::ValueKind::STRING == value.kind)
+    {
+        return field.enum_literals->find(value.string_value) != field.enum_literals->end();
+    }
+
+    DDSFilterValue field_value;
+    field_value.kind = field.kind;
+    if (DDSFilterValue::ValueKind::STRING == field.kind && DDSFilterValue::ValueKind::CHAR == value.kind)
+    {
+        return true;
+    }
+    return DDSFilterValue::are_compatible(field_value, value);
+}
+
+bool DDSFilterParser::next_token(
+        const std::string& input,
+        size_t& pos,
+        Token& token)
+{
+    const size_t size = input.size();
+    while (pos < size && std::isspace(static_cast<unsigned char>(input[pos])))
+    {
+        ++pos;
+    }
+
+    token.text.clear();
+    if (pos >= size)
+    {
+        token.kind = TokenKind::END;
+        return true;
+    }
+
+    size_t start = pos;
+    char c = input[pos];
+
+    if ('(' == c || ')' == c)
+    {
+        token.kind = ('(' == c) ? TokenKind::LEFT_PAREN : TokenKind::RIGHT_PAREN;
+        token.text.assign(1, c);
+        ++pos;
+        return true;
+    }
+
+    if ('=' == c || '<' == c || '>' == c || '!' == c)
+    {
+        char next = (pos + 1 < size) ? input[pos + 1] : '\0';
+        token.kind = TokenKind::OPERATOR;
+        pos += 1;
+        switch (c)
+        {
+            case '=':
+                token.op = DDSFilterPredicate::OperationKind::EQUAL;
+                break;
+            case '<':
+                if ('=' == next)
+                {
+                    token.op = DDSFilterPredicate::OperationKind::LESS_EQUAL;
+                    ++pos;
+                }
+                else if ('>' == next)
+                {
+                    token.op = DDSFilterPredicate::OperationKind::NOT_EQUAL;
+                    ++pos;
+                }
+                else
+                {
+                    token.op = DDSFilterPredicate::OperationKind::LESS_THAN;
+                }
+                break;
+            case '>':
+                if ('=' == next)
+                {
+                    token.op = DDSFilterPredicate::OperationKind::GREATER_EQUAL;
+                    ++pos;
+                }
+                else
+                {
+                    token.op = DDSFilterPredicate::OperationKind::GREATER_THAN;
+                }
+                break;
+            default:
+                if ('=' != next)
+                {
+                    token.kind = TokenKind::INVALID;
+                    token.text.assign(1, c);
+                    return false;
+                }
+                token.op = DDSFilterPredicate::OperationKind::NOT_EQUAL;
+                ++pos;
+                break;
+        }
+        token.text = input.substr(start, pos - start);
+        return true;
+    }
+
+    if ('%' == c)
+    {
+        ++pos;
+        while (pos < size && std::isdigit(static_cast<unsigned char>(input[pos])))
+        {
+            ++pos;
+        }
+        token.text = input.substr(start, pos - start);
+        size_t digits = pos - start - 1;
+        if (digits < 1 || digits > 2)
+        {
+            token.kind = TokenKind::INVALID;
+            return false;
+        }
+        token.kind = TokenKind::PARAMETER;
+        token.parameter = static_cast<size_t>(std::strtoul(token.text.c_str() + 1, nullptr, 10));
+        return true;
+    }
+
+    if ('\'' == c || '`' == c)
+    {
+        // String literals may be enclosed either in 'simple quotes' or in `back and forward quotes'
+        size_t end = input.find('\'', pos + 1);
+        if (std::string::npos == end)
+        {
+            token.kind = TokenKind::INVALID;
+            token.text = input.substr(start);
+            return false;
+        }
+        token.kind = TokenKind::LITERAL;
+        token.value.set_string(input.c_str() + pos + 1, end - pos - 1);
+        pos = end + 1;
+        token.text = input.substr(start, pos - start);
+        return true;
+    }
+
+    bool has_sign = ('-' == c || '+' == c);
+    if (std::isdigit(static_cast<unsigned char>(c)) || '.' == c ||
+            (has_sign && pos + 1 < size &&
+            (std::isdigit(static_cast<unsigned char>(input[pos + 1])) || '.' == input[pos + 1])))
+    {
+        ++pos;
+        while (pos < size)
+        {
+            char d = input[pos];
+            if (std::isalnum(static_cast<unsigned char>(d)) || '.' == d)
+            {
+                ++pos;
+            }
+            else if (('-' == d || '+' == d) && ('e' == input[pos - 1] || 'E' == input[pos - 1]))
+            {
+                // Exponent sign
+                ++pos;
+            }
+            else
+            {
+                break;
+            }
+        }
+        token.text = input.substr(start, pos - start);
+        if (!parse_number(token.text, token.value))
+        {
+            token.kind = TokenKind::INVALID;
+            return false;
+        }
+        token.kind = TokenKind::LITERAL;
+        return true;
+    }
+
+    if (is_identifier_start(c))
+    {
+        while (pos < size && is_identifier_char(input[pos]))
+        {
+            ++pos;
+        }
+        token.text = input.substr(start, pos - start);
+
+        if (equals_ignore_case(token.text, "AND"))
+        {
+            token.kind = TokenKind::KEYWORD_AND;
+        }
+        else if (equals_ignore_case(token.text, "OR"))
+        {
+            token.kind = TokenKind::KEYWORD_OR;
+        }
+        else if (equals_ignore_case(token.text, "NOT"))
+        {
+            token.kind = TokenKind::KEYWORD_NOT;
+        }
+        else if (equals_ignore_case(token.text, "LIKE"))
+        {
+            token.kind = TokenKind::KEYWORD_LIKE;
+        }
+        else if (equals_ignore_case(token.text, "BETWEEN"))
+        {
+            token.kind = TokenKind::KEYWORD_BETWEEN;
+        }
+        else if (equals_ignore_case(token.text, "TRUE") || equals_ignore_case(token.text, "FALSE"))
+        {
+            token.kind = TokenKind::LITERAL;
+            token.value.set_boolean(equals_ignore_case(token.text, "TRUE"));
+        }
+        else
+        {
+            token.kind = TokenKind::IDENTIFIER;
+        }
+        return true;
+    }
+
+    token.kind = TokenKind::INVALID;
+    token.text.assign(1, c);
+    return false;
+}
+
+void DDSFilterParser::advance()
+{
+    if (!next_token(expression_, pos_, current_))
+    {
+        current_.kind = TokenKind::INVALID;
+    }
+}
+
+std::unique_ptr<DDSFilterCondition> DDSFilterParser::parse_or()
+{
+    std::unique_ptr<DDSFilterCondition> left = parse_and();
+    while (left && TokenKind::KEYWORD_OR == current_.kind)
+    {
+        advance();
+        std::unique_ptr<DDSFilterCondition> right = parse_and();
+        if (!right)
+        {
+            return nullptr;
+        }
+        left.reset(new DDSFilterCompoundCondition(
+                    DDSFilterCompoundCondition::OperationKind::OR, std::move(left), std::move(right)));
+    }
+    return left;
+}
+
+std::unique_ptr<DDSFilterCondition> DDSFilterParser::parse_and()
+{
+    std::unique_ptr<DDSFilterCondition> left = parse_not();
+    while (left && TokenKind::KEYWORD_AND == current_.kind)
+    {
+        advance();
+        std::unique_ptr<DDSFilterCondition> right = parse_not();
+        if (!right)
+        {
+            return nullptr;
+        }
+        left.reset(new DDSFilterCompoundCondition(
+                    DDSFilterCompoundCondition::OperationKind::AND, std::move(left), std::move(right)));
+    }
+    return left;
+}
+
+std::unique_ptr<DDSFilterCondition> DDSFilterParser::parse_not()
+{
+    if (TokenKind::KEYWORD_NOT == current_.kind)
+    {
+        advance();
+        std::unique_ptr<DDSFilterCondition> inner = parse_not();
+        if (!inner)
+        {
+            return nullptr;
+        }
+        return std::unique_ptr<DDSFilterCondition>(new DDSFilterCompoundCondition(
+                           DDSFilterCompoundCondition::OperationKind::NOT, std::move(inner), nullptr));
+    }
+
+    if (TokenKind::LEFT_PAREN == current_.kind)
+    {
+        advance();
+        std::unique_ptr<DDSFilterCondition> inner = parse_or();
+        if (!inner)
+        {
+            return nullptr;
+        }
+        if (TokenKind::RIGHT_PAREN != current_.kind)
+        {
+            set_error("Expected ')'");
+            return nullptr;
+        }
+        advance();
+        return inner;
+    }
+
+    return parse_predicate();
+}
+
+std::unique_ptr<DDSFilterCondition> DDSFilterParser::parse_predicate()
+{
+    DDSFilterOperand left;
+    if (!parse_operand(left))
+    {
+        return nullptr;
+    }
+
+    bool negated = false;
+    if (TokenKind::KEYWORD_NOT == current_.kind)
+    {
+        negated = true;
+        advance();
+        if (TokenKind::KEYWORD_BETWEEN != current_.kind)
+        {
+            set_error("Expected BETWEEN after NOT");
+            return nullptr;
+        }
+    }
+
+    if (TokenKind::KEYWORD_BETWEEN == current_.kind)
+    {
+        advance();
+        DDSFilterOperand low;
+        DDSFilterOperand high;
+        if (!parse_operand(low))
+        {
+            return nullptr;
+        }
+        if (TokenKind::KEYWORD_AND != current_.kind)
+        {
+            set_error("Expected AND on BETWEEN predicate");
+            return nullptr;
+        }
+        advance();
+        if (!parse_operand(high) || !check_operands(left, low, false) || !check_operands(left, high, false))
+        {
+            return nullptr;
+        }
+        return std::unique_ptr<DDSFilterCondition>(new DDSFilterBetweenPredicate(negated, left, low, high));
+    }
+
+    DDSFilterPredicate::OperationKind op;
+    if (TokenKind::OPERATOR == current_.kind)
+    {
+        op = current_.op;
+    }
+    else if (TokenKind::KEYWORD_LIKE == current_.kind)
+    {
+        op = DDSFilterPredicate::OperationKind::LIKE;
+    }
+    else
+    {
+        set_error("Expected relational operator");
+        return nullptr;
+    }
+    advance();
+
+    DDSFilterOperand right;
+    if (!parse_operand(right) ||
+            !check_operands(left, right, DDSFilterPredicate::OperationKind::LIKE == op))
+    {
+        return nullptr;
+    }
+
+    // Translate enumeration literals only once
+    DDSFilterValue enum_value;
+    const DDSFilterValue* translated = &right.constant;
+    if (DDSFilterOperand::Kind::CONSTANT == right.kind &&
+            DDSFilterPredicate::resolve_enum(left, translated, enum_value) && translated == &enum_value)
+    {
+        right.constant = enum_value;
+    }
+    translated = &left.constant;
+    if (DDSFilterOperand::Kind::CONSTANT == left.kind &&
+            DDSFilterPredicate::resolve_enum(right, translated, enum_value) && translated == &enum_value)
+    {
+        left.constant = enum_value;
+    }
+
+    return std::unique_ptr<DDSFilterCondition>(new DDSFilterPredicate(op, left, right));
+}
+
+bool DDSFilterParser::parse_operand(
+        DDSFilterOperand& operand)
+{
+    switch (current_.kind)
+    {
+        case TokenKind::IDENTIFIER:
+            operand.kind = DDSFilterOperand::Kind::FIELD;
+            if (!resolver_.resolve_field(current_.text, operand.field))
+            {
+                set_error("Field '" + current_.text + "' not found or not supported");
+                return false;
+            }
+            operand.index = operand.field.slot;
+            break;
+
+        case TokenKind::LITERAL:
+            operand.kind = DDSFilterOperand::Kind::CONSTANT;
+            operand.constant = current_.value;
+            break;
+
+        case TokenKind::PARAMETER:
+            if (current_.parameter >= num_parameters_)
+            {
+                set_error("Parameter " + current_.text + " not provided");
+                return false;
+            }
+            operand.kind = DDSFilterOperand::Kind::PARAMETER;
+            operand.index = current_.parameter;
+            break;
+
+        case TokenKind::END:
+            set_error("Unexpected end of expression");
+            return false;
+
+        default:
+            set_error("Unexpected '" + current_.text + "'");
+            return false;
+    }
+
+    advance();
+    return true;
+}
+
+bool DDSFilterParser::check_operands(
+        const DDSFilterOperand& left,
+        const DDSFilterOperand& right,
+        bool is_like)
+{
+    const DDSFilterOperand* field = nullptr;
+    const DDSFilterOperand* other = &right;
+    if (DDSFilterOperand::Kind::FIELD == left.kind)
+    {
+        field = &left;
+    }
+    else if (DDSFilterOperand::Kind::FIELD == right.kind)
+    {
+        field = &right;
+        other = &left;
+    }
+
+    if (is_like)
+    {
+        if (nullptr != field && DDSFilterValue::ValueKind::STRING != field->field.kind &&
+                DDSFilterValue::ValueKind::CHAR != field->field.kind)
+        {
+            set_error("LIKE can only be used with string fields");
+            return false;
+        }
+        if (DDSFilterOperand::Kind::CONSTANT == other->kind && !other->constant.is_string_like())
+        {
+            set_error("LIKE pattern should be a string");
+            return false;
+        }
+    }
+
+    if (nullptr == field)
+    {
+        if (DDSFilterOperand::Kind::CONSTANT == left.kind && DDSFilterOperand::Kind::CONSTANT == right.kind &&
+                !DDSFilterValue::are_compatible(left.constant, right.constant))
+        {
+            set_error("Incompatible constants");
+            return false;
+        }
+        return true;
+    }
+
+    switch (other->kind)
+    {
+        case DDSFilterOperand::Kind::CONSTANT:
+            if (!is_like && !is_compatible(field->field, other->constant))
+            {
+                set_error("Constant is not compatible with field type");
+                return false;
+            }
+            break;
+
+        case DDSFilterOperand::Kind::PARAMETER:
+            parameter_usages_.emplace_back(other->index, field->field);
+            break;
+
+        case DDSFilterOperand::Kind::FIELD:
+        {
+            DDSFilterValue lhs;
+            DDSFilterValue rhs;
+            lhs.kind = field->field.kind;
+            rhs.kind = other->field.kind;
+            if (lhs.kind != rhs.kind && !(lhs.is_numeric() && rhs.is_numeric()))
+            {
+                set_error("Fields have incompatible types");
+                return false;
+            }
+            break;
+        }
+    }
+
+    return true;
+}
+
+void DDSFilterParser::set_error(
+        const std::string& message)
+{
+    if (error_.empty())
+    {
+        error_ = message + " (at position " + std::to_string(pos_) + ")";
+    }
+}
+
+} // namespace DDSSQLFilter
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
@@ -0,0 +1,196 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DDSFilterParser.hpp
+ */
+
+#ifndef _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTERPARSER_HPP_
+#define _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTERPARSER_HPP_
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DDSFilterCondition.hpp"
+#include "DDSFilterValue.hpp"
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace DDSSQLFilter {
+
+/**
+ * Interface used by the parser to resolve the field names on a filter expression.
+ */
+class IDDSFilterFieldResolver
+{
+public:
+
+    virtual ~IDDSFilterFieldResolver() = default;
+
+    /**
+     * Resolve a field name.
+     *
+     * @param [in]  field_path  Name of the field, with nested members separated by dots.
+     * @param [out] field       Information about the resolved field.
+     *
+     * @return whether the field exists and can be used on a filter expression.
+     */
+    virtual bool resolve_field(
+            const std::string& field_path,
+            DDSFilterField& field) = 0;
+};
+
+/**
+ * Recursive descent parser for the DDS-SQL filter grammar defined in Annex B of the DDS specification.
+ *
+ * @code
+ * Condition   ::= Predicate | Condition 'AND' Condition | Condition 'OR' Condition
+ *               | 'NOT' Condition | '(' Condition ')'
+ * Predicate   ::= Operand RelOp Operand | Operand ['NOT'] 'BETWEEN' Operand 'AND' Operand
+ * RelOp       ::= '=' | '>' | '>=' | '<' | '<=' | '<>' | '!=' | 'LIKE'
+ * Operand     ::= FieldName | Literal | Parameter
+ * Parameter   ::= '%' [0-9]{1,2}
+ * @endcode
+ */
+class DDSFilterParser
+{
+public:
+
+    //! Maximum number of expression parameters.
+    static constexpr size_t max_parameters = 100u;
+
+    /**
+     * @param expression      The filter expression to parse.
+     * @param num_parameters  Number of available expression parameters.
+     * @param resolver        Resolver for the field names.
+     */
+    DDSFilterParser(
+            const std::string& expression,
+            size_t num_parameters,
+            IDDSFilterFieldResolver& resolver);
+
+    /**
+     * Parse the expression.
+     *
+     * @return the root of the compiled condition, or nullptr on error.
+     */
+    std::unique_ptr<DDSFilterCondition> parse();
+
+    /**
+     * @return a description of the last error.
+     */
+    const std::string& error() const
+    {
+        return error_;
+    }
+
+    /**
+     * @return the list of (parameter index, field) pairs that are compared against each other.
+     */
+    const std::vector<std::pair<size_t, DDSFilterField>>& parameter_usages() const
+    {
+        return parameter_usages_;
+    }
+
+    /**
+     * Parse a literal value, as used for the expression parameters.
+     *
+     * @param [in]  text   Text of the literal.
+     * @param [out] value  Parsed value.
+     *
+     * @return whether the text is a valid literal.
+     */
+    static bool parse_literal(
+            const std::string& text,
+            DDSFilterValue& value);
+
+    /**
+     * Check whether a value can be compared against a field.
+     */
+    static bool is_compatible(
+            const DDSFilterField& field,
+            const DDSFilterValue& value);
+
+private:
+
+    enum class TokenKind
+    {
+        END,
+        IDENTIFIER,
+        LITERAL,
+        PARAMETER,
+        OPERATOR,
+        LEFT_PAREN,
+        RIGHT_PAREN,
+        KEYWORD_AND,
+        KEYWORD_OR,
+        KEYWORD_NOT,
+        KEYWORD_LIKE,
+        KEYWORD_BETWEEN,
+        INVALID
+    };
+
+    struct Token
+    {
+        TokenKind kind = TokenKind::END;
+        std::string text;
+        DDSFilterValue value;
+        size_t parameter = 0;
+        DDSFilterPredicate::OperationKind op = DDSFilterPredicate::OperationKind::EQUAL;
+    };
+
+    static bool next_token(
+            const std::string& input,
+            size_t& pos,
+            Token& token);
+
+    void advance();
+
+    std::unique_ptr<DDSFilterCondition> parse_or();
+
+    std::unique_ptr<DDSFilterCondition> parse_and();
+
+    std::unique_ptr<DDSFilterCondition> parse_not();
+
+    std::unique_ptr<DDSFilterCondition> parse_predicate();
+
+    bool parse_operand(
+            DDSFilterOperand& operand);
+
+    bool check_operands(
+            const DDSFilterOperand& left,
+            const DDSFilterOperand& right,
+            bool is_like);
+
+    void set_error(
+            const std::string& message);
+
+    std::string expression_;
+    size_t num_parameters_;
+    IDDSFilterFieldResolver& resolver_;
+    size_t pos_ = 0;
+    Token current_;
+    std::string error_;
+    std::vector<std::pair<size_t, DDSFilterField>> parameter_usages_;
+};
+
+} // namespace DDSSQLFilter
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTERPARSER_HPP_
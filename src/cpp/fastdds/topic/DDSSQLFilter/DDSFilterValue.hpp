@@ -0,0 +1,332 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DDSFilterValue.hpp
+ */
+
+#ifndef _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTERVALUE_HPP_
+#define _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTERVALUE_HPP_
+
+#include <cstdint>
+#include <string>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace DDSSQLFilter {
+
+/**
+ * Represents a value (either constant, parameter or field) on a filter expression.
+ */
+struct DDSFilterValue
+{
+    enum class ValueKind
+    {
+        BOOLEAN,
+        CHAR,
+        SIGNED_INTEGER,
+        UNSIGNED_INTEGER,
+        FLOAT,
+        STRING
+    };
+
+    ValueKind kind = ValueKind::BOOLEAN;
+
+    union
+    {
+        bool boolean_value;
+        char char_value;
+        int64_t signed_integer_value;
+        uint64_t unsigned_integer_value;
+        long double float_value;
+    };
+
+    std::string string_value;
+
+    DDSFilterValue()
+        : unsigned_integer_value(0)
+    {
+    }
+
+    DDSFilterValue(
+            const DDSFilterValue& other)
+        : kind(other.kind)
+        , string_value(other.string_value)
+    {
+        copy_union(other);
+    }
+
+    DDSFilterValue& operator =(
+            const DDSFilterValue& other)
+    {
+        kind = other.kind;
+        string_value = other.string_value;
+        copy_union(other);
+        return *this;
+    }
+
+    void set_boolean(
+            bool value)
+    {
+        kind = ValueKind::BOOLEAN;
+        boolean_value = value;
+    }
+
+    void set_char(
+            char value)
+    {
+        kind = ValueKind::CHAR;
+        char_value = value;
+    }
+
+    void set_signed(
+            int64_t value)
+    {
+        kind = ValueKind::SIGNED_INTEGER;
+        signed_integer_value = value;
+    }
+
+    void set_unsigned(
+            uint64_t value)
+    {
+        kind = ValueKind::UNSIGNED_INTEGER;
+        unsigned_integer_value = value;
+    }
+
+    void set_float(
+            long double value)
+    {
+        kind = ValueKind::FLOAT;
+        float_value = value;
+    }
+
+    void set_string(
+            const char* data,
+            size_t length)
+    {
+        kind = ValueKind::STRING;
+        // assign() keeps the already reserved capacity, so no allocations happen on the hot path
+        string_value.assign(data, length);
+    }
+
+    bool is_numeric() const
+    {
+        return ValueKind::SIGNED_INTEGER == kind ||
+               ValueKind::UNSIGNED_INTEGER == kind ||
+               ValueKind::FLOAT == kind ||
+               ValueKind::BOOLEAN == kind;
+    }
+
+    bool is_string_like() const
+    {
+        return ValueKind::STRING == kind || ValueKind::CHAR == kind;
+    }
+
+    /**
+     * Check whether two values can be compared with each other.
+     */
+    static bool are_compatible(
+            const DDSFilterValue& lhs,
+            const DDSFilterValue& rhs)
+    {
+        if (lhs.is_numeric() && rhs.is_numeric())
+        {
+            return true;
+        }
+
+        if (ValueKind::CHAR == lhs.kind && ValueKind::STRING == rhs.kind)
+        {
+            return rhs.string_value.size() == 1;
+        }
+
+        if (ValueKind::STRING == lhs.kind && ValueKind::CHAR == rhs.kind)
+        {
+            return lhs.string_value.size() == 1;
+        }
+
+        return lhs.kind == rhs.kind;
+    }
+
+    /**
+     * Three-way comparison of two compatible values.
+     *
+     * @return negative if lhs < rhs, 0 if lhs == rhs, positive if lhs > rhs.
+     */
+    static int compare(
+            const DDSFilterValue& lhs,
+            const DDSFilterValue& rhs)
+    {
+        if (lhs.is_string_like() && rhs.is_string_like())
+        {
+            if (ValueKind::CHAR == lhs.kind && ValueKind::CHAR == rhs.kind)
+            {
+                return three_way(lhs.char_value, rhs.char_value);
+            }
+            if (ValueKind::CHAR == lhs.kind)
+            {
+                return three_way(lhs.char_value, rhs.string_value.empty() ? '\0' : rhs.string_value[0]);
+            }
+            if (ValueKind::CHAR == rhs.kind)
+            {
+                return three_way(lhs.string_value.empty() ? '\0' : lhs.string_value[0], rhs.char_value);
+            }
+            return lhs.string_value.compare(rhs.string_value);
+        }
+
+        if (ValueKind::FLOAT == lhs.kind || ValueKind::FLOAT == rhs.kind)
+        {
+            return three_way(lhs.as_float(), rhs.as_float());
+        }
+
+        bool lhs_negative = ValueKind::SIGNED_INTEGER == lhs.kind && lhs.signed_integer_value < 0;
+        bool rhs_negative = ValueKind::SIGNED_INTEGER == rhs.kind && rhs.signed_integer_value < 0;
+        if (lhs_negative != rhs_negative)
+        {
+            return lhs_negative ? -1 : 1;
+        }
+        if (lhs_negative)
+        {
+            return three_way(lhs.signed_integer_value, rhs.signed_integer_value);
+        }
+        return three_way(lhs.as_unsigned(), rhs.as_unsigned());
+    }
+
+    /**
+     * Check whether this string value matches a SQL LIKE pattern.
+     * '%' matches any sequence of characters and '_' matches exactly one character.
+     */
+    bool is_like(
+            const DDSFilterValue& pattern) const
+    {
+        if (!pattern.is_string_like() || !is_string_like())
+        {
+            return false;
+        }
+
+        char lhs_char[1] = { char_value };
+        const char* str = (ValueKind::CHAR == kind) ? lhs_char : string_value.c_str();
+        size_t str_len = (ValueKind::CHAR == kind) ? 1u : string_value.size();
+        char rhs_char[1] = { pattern.char_value };
+        const char* pat = (ValueKind::CHAR == pattern.kind) ? rhs_char : pattern.string_value.c_str();
+        size_t pat_len = (ValueKind::CHAR == pattern.kind) ? 1u : pattern.string_value.size();
+
+        // Iterative wildcard matching with single backtracking point
+        size_t s = 0;
+        size_t p = 0;
+        size_t star_p = pat_len;
+        size_t star_s = 0;
+        while (s < str_len)
+        {
+            if (p < pat_len && ('_' == pat[p] || str[s] == pat[p]))
+            {
+                ++s;
+                ++p;
+            }
+            else if (p < pat_len && '%' == pat[p])
+            {
+                star_p = p++;
+                star_s = s;
+            }
+            else if (star_p != pat_len)
+            {
+                p = star_p + 1;
+                s = ++star_s;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        while (p < pat_len && '%' == pat[p])
+        {
+            ++p;
+        }
+        return p == pat_len;
+    }
+
+private:
+
+    template<typename T>
+    static int three_way(
+            const T& lhs,
+            const T& rhs)
+    {
+        return (lhs < rhs) ? -1 : ((rhs < lhs) ? 1 : 0);
+    }
+
+    long double as_float() const
+    {
+        switch (kind)
+        {
+            case ValueKind::BOOLEAN:
+                return boolean_value ? 1.0L : 0.0L;
+            case ValueKind::SIGNED_INTEGER:
+                return static_cast<long double>(signed_integer_value);
+            case ValueKind::UNSIGNED_INTEGER:
+                return static_cast<long double>(unsigned_integer_value);
+            case ValueKind::FLOAT:
+                return float_value;
+            default:
+                return 0.0L;
+        }
+    }
+
+    uint64_t as_unsigned() const
+    {
+        switch (kind)
+        {
+            case ValueKind::BOOLEAN:
+                return boolean_value ? 1u : 0u;
+            case ValueKind::SIGNED_INTEGER:
+                return static_cast<uint64_t>(signed_integer_value);
+            case ValueKind::UNSIGNED_INTEGER:
+                return unsigned_integer_value;
+            default:
+                return 0u;
+        }
+    }
+
+    void copy_union(
+            const DDSFilterValue& other)
+    {
+        switch (other.kind)
+        {
+            case ValueKind::BOOLEAN:
+                boolean_value = other.boolean_value;
+                break;
+            case ValueKind::CHAR:
+                char_value = other.char_value;
+                break;
+            case ValueKind::SIGNED_INTEGER:
+                signed_integer_value = other.signed_integer_value;
+                break;
+            case ValueKind::FLOAT:
+                float_value = other.float_value;
+                break;
+            default:
+                unsigned_integer_value = other.unsigned_integer_value;
+                break;
+        }
+    }
+
+};
+
+} // namespace DDSSQLFilter
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTERVALUE_HPP_
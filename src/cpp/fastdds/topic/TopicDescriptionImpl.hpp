@@ -21,6 +21,9 @@
 #define _FASTDDS_TOPICDESCRIPTIONIMPL_HPP_
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <atomic>
+#include <string>
+
 namespace eprosima {
 namespace fastdds {
 namespace dds {
@@ -57,6 +60,12 @@ public:
         --num_refs_;
     }
 
+    /**
+     * Get the name of the topic announced on the wire for the entities created on this TopicDescription.
+     * @return the name of the RTPS topic.
+     */
+    virtual const std::string& get_rtps_topic_name() const = 0;
+
 private:
     std::atomic_size_t num_refs_;
 
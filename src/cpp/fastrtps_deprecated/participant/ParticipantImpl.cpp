@@ -178,6 +178,7 @@ Publisher* ParticipantImpl::createPublisher(
     watt.endpoint.remoteLocatorList = att.remoteLocatorList;
     watt.mode = att.qos.m_publishMode.kind ==
             eprosima::fastrtps::SYNCHRONOUS_PUBLISH_MODE ? SYNCHRONOUS_WRITER : ASYNCHRONOUS_WRITER;
+    watt.async_priority = att.qos.m_publishMode.priority;
     watt.endpoint.properties = att.properties;
     if (att.getEntityID() > 0)
     {
@@ -245,7 +245,10 @@ bool PublisherHistory::find_or_add_key(
 
     if (static_cast<int>(keyed_changes_.size()) < resource_limited_qos_.max_instances)
     {
-        *vit_out = keyed_changes_.insert(std::make_pair(instance_handle, KeyedChanges())).first;
+        vit = keyed_changes_.insert(std::make_pair(instance_handle, KeyedChanges())).first;
+        vit->second.handle = instance_handle;
+        deadlines_.update(vit->second);
+        *vit_out = vit;
         return true;
     }
 
@@ -387,6 +390,7 @@ bool PublisherHistory::remove_instance_changes(
 
     if (vit->second.cache_changes.empty())
     {
+        deadlines_.remove(vit->second);
         keyed_changes_.erase(vit);
     }
 
@@ -411,12 +415,14 @@ bool PublisherHistory::set_next_deadline(
     }
     else if (topic_att_.getTopicKind() == WITH_KEY)
     {
-        if (keyed_changes_.find(handle) == keyed_changes_.end())
+        t_m_Inst_Caches::iterator vit = keyed_changes_.find(handle);
+        if (vit == keyed_changes_.end())
         {
             return false;
         }
 
-        keyed_changes_[handle].next_deadline_us = next_deadline_us;
+        vit->second.next_deadline_us = next_deadline_us;
+        deadlines_.update(vit->second);
         return true;
     }
 
@@ -436,18 +442,14 @@ bool PublisherHistory::get_next_deadline(
 
     if (topic_att_.getTopicKind() == WITH_KEY)
     {
-        auto min = std::min_element(
-            keyed_changes_.begin(),
-            keyed_changes_.end(),
-            [](
-                const std::pair<InstanceHandle_t, KeyedChanges>& lhs,
-                const std::pair<InstanceHandle_t, KeyedChanges>& rhs)
-            {
-                return lhs.second.next_deadline_us < rhs.second.next_deadline_us;
-            });
+        KeyedChanges* min = deadlines_.top();
+        if (nullptr == min)
+        {
+            return false;
+        }
 
-        handle = min->first;
-        next_deadline_us = min->second.next_deadline_us;
+        handle = min->handle;
+        next_deadline_us = min->next_deadline_us;
         return true;
     }
     else if (topic_att_.getTopicKind() == NO_KEY)
@@ -26,6 +26,7 @@
 #include <fastdds/dds/topic/TopicDataType.hpp>
 #include <fastdds/dds/log/Log.hpp>
 
+#include <algorithm>
 #include <limits>
 #include <mutex>
 
@@ -80,6 +81,10 @@ SubscriberHistory::SubscriberHistory(
         uint32_t payloadMaxSize,
         MemoryManagementPolicy_t mempolicy)
     : ReaderHistory(to_history_attributes(topic_att, payloadMaxSize, mempolicy))
+    , empty_instances_head_(nullptr)
+    , empty_instances_tail_(nullptr)
+    , not_read_count_(0)
+    , first_not_read_hint_(0)
     , history_qos_(topic_att.historyQos)
     , resource_limited_qos_(topic_att.resourceLimitsQos)
     , topic_att_(topic_att)
@@ -196,7 +201,7 @@ bool SubscriberHistory::received_change_keep_all_with_key(
         std::vector<CacheChange_t*>& instance_changes = vit->second.cache_changes;
         if (instance_changes.size() < static_cast<size_t>(resource_limited_qos_.max_samples_per_instance))
         {
-            return add_received_change_with_key(a_change, vit->second.cache_changes);
+            return add_received_change_with_key(a_change, vit->second);
         }
 
         logWarning(SUBSCRIBER, "Change not added due to maximum number of samples per instance");
@@ -228,7 +233,7 @@ bool SubscriberHistory::received_change_keep_last_with_key(
 
         if (add)
         {
-            return add_received_change_with_key(a_change, instance_changes);
+            return add_received_change_with_key(a_change, vit->second);
         }
     }
 
@@ -252,6 +257,16 @@ bool SubscriberHistory::add_received_change(
             m_isHistoryFull = true;
         }
 
+        ++not_read_count_;
+
+        // Changes are ordered by source timestamp, so the new one may have been inserted before the hint
+        if (first_not_read_hint_ > 0)
+        {
+            auto rit = std::find(m_changes.rbegin(), m_changes.rend(), a_change);
+            size_t position = static_cast<size_t>(std::distance(rit, m_changes.rend())) - 1u;
+            first_not_read_hint_ = std::min(first_not_read_hint_, position);
+        }
+
         logInfo(SUBSCRIBER, topic_att_.getTopicDataType()
                 << ": Change " << a_change->sequenceNumber << " added from: "
                 << a_change->writerGUID; );
@@ -264,7 +279,7 @@ bool SubscriberHistory::add_received_change(
 
 bool SubscriberHistory::add_received_change_with_key(
         CacheChange_t* a_change,
-        std::vector<CacheChange_t*>& instance_changes)
+        KeyedChanges& instance)
 {
     if (m_isHistoryFull)
     {
@@ -284,7 +299,13 @@ bool SubscriberHistory::add_received_change_with_key(
 
         // As the instance should be ordered following the presentation QoS, and
         // we only support ordering by reception timestamp, we can always add at the end.
-        instance_changes.push_back(a_change);
+        instance.cache_changes.push_back(a_change);
+        if (instance.in_lru)
+        {
+            unlink_empty_instance(instance);
+        }
+        ++instance.not_read_count;
+        ++not_read_count_;
 
         logInfo(SUBSCRIBER, mp_reader->getGuid().entityId
                 << ": Change " << a_change->sequenceNumber << " added from: "
@@ -381,6 +402,7 @@ bool SubscriberHistory::readNextData(
                     wp->ownership_strength() : 0;
             bool deserialized = deserialize_change(change, ownership, data, info);
             mp_reader->change_read_by_user(change, wp);
+            change_was_read_nts(change);
             return deserialized;
         }
     }
@@ -410,8 +432,13 @@ bool SubscriberHistory::takeNextData(
                     " from writer: " << change->writerGUID);
             uint32_t ownership = wp && qos_.m_ownership.kind == EXCLUSIVE_OWNERSHIP_QOS ?
                     wp->ownership_strength() : 0;
+            bool was_read = change->isRead;
             bool deserialized = deserialize_change(change, ownership, data, info);
             mp_reader->change_read_by_user(change, wp);
+            if (!was_read)
+            {
+                change_was_read_nts(change);
+            }
             bool removed = remove_change_sub(change);
             return (deserialized && removed);
         }
@@ -442,33 +469,37 @@ bool SubscriberHistory::find_key(
         CacheChange_t* a_change,
         t_m_Inst_Caches::iterator* vit_out)
 {
-    t_m_Inst_Caches::iterator vit;
-    vit = keyed_changes_.find(a_change->instanceHandle);
-    if (vit != keyed_changes_.end())
+    const InstanceHandle_t& handle = a_change->instanceHandle;
+    t_m_Inst_Caches::iterator* found = instances_index_.find(handle);
+    if (nullptr != found)
     {
-        *vit_out = vit;
+        *vit_out = *found;
         return true;
     }
 
-    if (keyed_changes_.size() < static_cast<size_t>(resource_limited_qos_.max_instances))
+    if (keyed_changes_.size() >= static_cast<size_t>(resource_limited_qos_.max_instances))
     {
-        *vit_out = keyed_changes_.insert(std::make_pair(a_change->instanceHandle, KeyedChanges())).first;
-        return true;
-    }
-    else
-    {
-        for (vit = keyed_changes_.begin(); vit != keyed_changes_.end(); ++vit)
+        if (nullptr == empty_instances_head_)
         {
-            if (vit->second.cache_changes.size() == 0)
-            {
-                keyed_changes_.erase(vit);
-                *vit_out = keyed_changes_.insert(std::make_pair(a_change->instanceHandle, KeyedChanges())).first;
-                return true;
-            }
+            logWarning(SUBSCRIBER, "History has reached the maximum number of instances");
+            return false;
         }
-        logWarning(SUBSCRIBER, "History has reached the maximum number of instances");
+
+        // Make room by evicting the instance that has been empty for longer
+        InstanceHandle_t evicted = empty_instances_head_->handle;
+        deadlines_.remove(*empty_instances_head_);
+        unlink_empty_instance(*empty_instances_head_);
+        keyed_changes_.erase(*instances_index_.find(evicted));
+        instances_index_.erase(evicted);
     }
-    return false;
+
+    t_m_Inst_Caches::iterator vit = keyed_changes_.insert(std::make_pair(handle, KeyedChanges())).first;
+    vit->second.handle = handle;
+    instances_index_.insert(handle, vit);
+    link_empty_instance(vit->second);
+    deadlines_.update(vit->second);
+    *vit_out = vit;
+    return true;
 }
 
 bool SubscriberHistory::remove_change_sub(
@@ -491,7 +522,7 @@ bool SubscriberHistory::remove_change_sub(
             {
                 if ((*chit)->sequenceNumber == change->sequenceNumber && (*chit)->writerGUID == change->writerGUID)
                 {
-                    vit->second.cache_changes.erase(chit);
+                    remove_instance_change(vit->second, chit);
                     found = true;
                     break;
                 }
@@ -534,7 +565,7 @@ bool SubscriberHistory::remove_change_sub(
                 if ((*chit)->sequenceNumber == change->sequenceNumber && (*chit)->writerGUID == change->writerGUID)
                 {
                     assert(it == chit);
-                    it = vit->second.cache_changes.erase(chit);
+                    it = remove_instance_change(vit->second, chit);
                     found = true;
                     break;
                 }
@@ -582,12 +613,14 @@ bool SubscriberHistory::set_next_deadline(
     }
     else if (topic_att_.getTopicKind() == WITH_KEY)
     {
-        if (keyed_changes_.find(handle) == keyed_changes_.end())
+        KeyedChanges* instance = find_instance(handle);
+        if (nullptr == instance)
         {
             return false;
         }
 
-        keyed_changes_[handle].next_deadline_us = next_deadline_us;
+        instance->next_deadline_us = next_deadline_us;
+        deadlines_.update(*instance);
         return true;
     }
 
@@ -612,16 +645,14 @@ bool SubscriberHistory::get_next_deadline(
     }
     else if (topic_att_.getTopicKind() == WITH_KEY)
     {
-        auto min = std::min_element(keyed_changes_.begin(),
-                        keyed_changes_.end(),
-                        [](
-                            const std::pair<InstanceHandle_t, KeyedChanges>& lhs,
-                            const std::pair<InstanceHandle_t, KeyedChanges>& rhs)
-                        {
-                            return lhs.second.next_deadline_us < rhs.second.next_deadline_us;
-                        });
-        handle = min->first;
-        next_deadline_us = min->second.next_deadline_us;
+        KeyedChanges* min = deadlines_.top();
+        if (nullptr == min)
+        {
+            return false;
+        }
+
+        handle = min->handle;
+        next_deadline_us = min->next_deadline_us;
         return true;
     }
 
@@ -658,21 +689,19 @@ std::pair<bool, SubscriberHistory::instance_info> SubscriberHistory::lookup_inst
         }
     }
 
-    t_m_Inst_Caches::iterator it;
-
     if (exact)
     {
-        it = keyed_changes_.find(handle);
-    }
-    else
-    {
-        auto comp = [](const InstanceHandle_t& h, const std::pair<InstanceHandle_t, KeyedChanges>& it)
-                {
-                    return h < it.first;
-                };
-        it = std::upper_bound(keyed_changes_.begin(), keyed_changes_.end(), handle, comp);
+        KeyedChanges* instance = find_instance(handle);
+        if (nullptr != instance)
+        {
+            return { true, {instance->handle, &(instance->cache_changes)} };
+        }
+        return { false, {InstanceHandle_t(), nullptr} };
     }
 
+    // Ordered lookup on the map, as instances are traversed following the order of their handles
+    t_m_Inst_Caches::iterator it = keyed_changes_.upper_bound(handle);
+
     if (it != keyed_changes_.end())
     {
         return { true, {it->first, &(it->second.cache_changes)} };
@@ -680,24 +709,189 @@ std::pair<bool, SubscriberHistory::instance_info> SubscriberHistory::lookup_inst
     return { false, {InstanceHandle_t(), nullptr} };
 }
 
+void SubscriberHistory::change_was_read_nts(
+        const CacheChange_t* change)
+{
+    if (0 < not_read_count_)
+    {
+        --not_read_count_;
+    }
+
+    if (topic_att_.getTopicKind() == WITH_KEY)
+    {
+        KeyedChanges* instance = find_instance(change->instanceHandle);
+        if (nullptr != instance && 0 < instance->not_read_count)
+        {
+            --instance->not_read_count;
+        }
+    }
+}
+
+size_t SubscriberHistory::get_not_read_count() const
+{
+    return not_read_count_;
+}
+
+size_t SubscriberHistory::get_not_read_count(
+        const instance_info& instance) const
+{
+    if (topic_att_.getTopicKind() == NO_KEY)
+    {
+        return not_read_count_;
+    }
+
+    const KeyedChanges* keyed = find_instance(instance.first);
+    return nullptr != keyed ? keyed->not_read_count : 0u;
+}
+
+SubscriberHistory::iterator SubscriberHistory::get_first_not_read_change(
+        const instance_info& instance)
+{
+    size_t* hint = &first_not_read_hint_;
+    if (topic_att_.getTopicKind() == WITH_KEY)
+    {
+        KeyedChanges* keyed = find_instance(instance.first);
+        if (nullptr == keyed)
+        {
+            return instance.second->begin();
+        }
+        hint = &keyed->first_not_read_hint;
+    }
+
+    // Changes never go back to the NOT_READ state, so the hint can only move forward until some change before it
+    // is added or removed.
+    std::vector<CacheChange_t*>& changes = *instance.second;
+    size_t position = std::min(*hint, changes.size());
+    while (position < changes.size() && changes[position]->isRead)
+    {
+        ++position;
+    }
+    *hint = position;
+
+    return changes.begin() + position;
+}
+
+SubscriberHistory::iterator SubscriberHistory::remove_instance_change(
+        KeyedChanges& instance,
+        iterator chit)
+{
+    size_t position = static_cast<size_t>(std::distance(instance.cache_changes.begin(), chit));
+    if (position < instance.first_not_read_hint)
+    {
+        --instance.first_not_read_hint;
+    }
+
+    if (!(*chit)->isRead && 0 < instance.not_read_count)
+    {
+        --instance.not_read_count;
+    }
+
+    iterator ret = instance.cache_changes.erase(chit);
+    if (instance.cache_changes.empty())
+    {
+        link_empty_instance(instance);
+    }
+    return ret;
+}
+
+KeyedChanges* SubscriberHistory::find_instance(
+        const InstanceHandle_t& handle)
+{
+    t_m_Inst_Caches::iterator* it = instances_index_.find(handle);
+    return nullptr != it ? &((*it)->second) : nullptr;
+}
+
+const KeyedChanges* SubscriberHistory::find_instance(
+        const InstanceHandle_t& handle) const
+{
+    const t_m_Inst_Caches::iterator* it = instances_index_.find(handle);
+    return nullptr != it ? &((*it)->second) : nullptr;
+}
+
+void SubscriberHistory::link_empty_instance(
+        KeyedChanges& instance)
+{
+    assert(!instance.in_lru);
+
+    instance.lru_prev = empty_instances_tail_;
+    instance.lru_next = nullptr;
+    instance.in_lru = true;
+    if (nullptr != empty_instances_tail_)
+    {
+        empty_instances_tail_->lru_next = &instance;
+    }
+    else
+    {
+        empty_instances_head_ = &instance;
+    }
+    empty_instances_tail_ = &instance;
+}
+
+void SubscriberHistory::unlink_empty_instance(
+        KeyedChanges& instance)
+{
+    assert(instance.in_lru);
+
+    if (nullptr != instance.lru_prev)
+    {
+        instance.lru_prev->lru_next = instance.lru_next;
+    }
+    else
+    {
+        empty_instances_head_ = instance.lru_next;
+    }
+
+    if (nullptr != instance.lru_next)
+    {
+        instance.lru_next->lru_prev = instance.lru_prev;
+    }
+    else
+    {
+        empty_instances_tail_ = instance.lru_prev;
+    }
+
+    instance.lru_prev = nullptr;
+    instance.lru_next = nullptr;
+    instance.in_lru = false;
+}
+
 ReaderHistory::iterator SubscriberHistory::remove_change_nts(
         ReaderHistory::const_iterator removal,
         bool release)
 {
     CacheChange_t* p_sample = nullptr;
 
-    if ( removal != changesEnd()
-            && (p_sample = *removal)->instanceHandle.isDefined()
-            && topic_att_.getTopicKind() == WITH_KEY)
+    if (removal != changesEnd())
     {
-        // clean any references to this CacheChange in the key state collection
-        auto it = keyed_changes_.find(p_sample->instanceHandle);
+        p_sample = *removal;
+        if (!p_sample->isRead && 0 < not_read_count_)
+        {
+            --not_read_count_;
+        }
+
+        if (topic_att_.getTopicKind() == NO_KEY)
+        {
+            size_t position = static_cast<size_t>(std::distance(m_changes.cbegin(), removal));
+            if (position < first_not_read_hint_)
+            {
+                --first_not_read_hint_;
+            }
+        }
+        else if (p_sample->instanceHandle.isDefined())
+        {
+            // clean any references to this CacheChange in the key state collection
+            KeyedChanges* instance = find_instance(p_sample->instanceHandle);
 
-        // if keyed and in history must be in the map
-        assert(it != keyed_changes_.end());
+            // if keyed and in history must be in the map
+            assert(nullptr != instance);
 
-        auto& c = it->second.cache_changes;
-        c.erase(std::remove(c.begin(), c.end(), p_sample), c.end());
+            auto& c = instance->cache_changes;
+            auto chit = std::find(c.begin(), c.end(), p_sample);
+            if (chit != c.end())
+            {
+                remove_instance_change(*instance, chit);
+            }
+        }
     }
 
     // call the base class
@@ -0,0 +1,160 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DataSharingDispatcher.cpp
+ */
+
+#include <rtps/DataSharing/DataSharingDispatcher.hpp>
+
+#include <chrono>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+constexpr uint32_t DataSharingDispatcher::poll_period_ms;
+
+DataSharingDispatcher::DataSharingDispatcher(
+        const GuidPrefix_t& participant_prefix,
+        uint32_t max_threads)
+    : participant_prefix_(participant_prefix)
+    , max_threads_(max_threads)
+{
+}
+
+DataSharingDispatcher::~DataSharingDispatcher()
+{
+    for (std::unique_ptr<DispatchThread>& dispatch_thread : threads_)
+    {
+        dispatch_thread->running.store(false);
+        dispatch_thread->notification->notify();
+        dispatch_thread->thread.join();
+        dispatch_thread->notification->destroy();
+    }
+}
+
+bool DataSharingDispatcher::add_listener(
+        Listener* listener,
+        DataSharingNotification& notification)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    DispatchThread* selected = nullptr;
+    uint32_t index = 0;
+    if (threads_.size() < max_threads_)
+    {
+        index = static_cast<uint32_t>(threads_.size());
+        std::shared_ptr<DataSharingNotification> dispatcher_notification =
+                DataSharingNotification::create_dispatcher_notification(participant_prefix_, index);
+        if (dispatcher_notification)
+        {
+            std::unique_ptr<DispatchThread> dispatch_thread(new DispatchThread());
+            dispatch_thread->notification = dispatcher_notification;
+            dispatch_thread->running.store(true);
+            dispatch_thread->thread = std::thread(&DataSharingDispatcher::run, this, dispatch_thread.get());
+            selected = dispatch_thread.get();
+            threads_.push_back(std::move(dispatch_thread));
+        }
+    }
+
+    if (nullptr == selected)
+    {
+        // Thread with less readers
+        for (size_t i = 0; i < threads_.size(); ++i)
+        {
+            if (nullptr == selected || threads_[i]->listeners.size() < selected->listeners.size())
+            {
+                selected = threads_[i].get();
+                index = static_cast<uint32_t>(i);
+            }
+        }
+    }
+
+    if (nullptr == selected)
+    {
+        return false;
+    }
+
+    if (!notification.dispatch_to(selected->notification, index))
+    {
+        return false;
+    }
+
+    selected->listeners.add(listener);
+    return true;
+}
+
+void DataSharingDispatcher::remove_listener(
+        Listener* listener)
+{
+    std::vector<DispatchThread*> threads;
+    {
+        // The lock is not kept while waiting for the dispatcher thread, which may be adding a reader
+        std::lock_guard<std::mutex> guard(mutex_);
+        for (std::unique_ptr<DispatchThread>& dispatch_thread : threads_)
+        {
+            threads.push_back(dispatch_thread.get());
+        }
+    }
+
+    for (DispatchThread* dispatch_thread : threads)
+    {
+        bool wait_round = std::this_thread::get_id() != dispatch_thread->thread.get_id();
+        if (dispatch_thread->listeners.remove(listener, wait_round))
+        {
+            return;
+        }
+    }
+}
+
+void DataSharingDispatcher::run(
+        DispatchThread* dispatch_thread)
+{
+    DataSharingNotification::Notification* notification = dispatch_thread->notification->notification_;
+
+    std::unique_lock<DataSharingNotification::Segment::mutex> lock(notification->notification_mutex,
+            std::defer_lock);
+    while (dispatch_thread->running.load())
+    {
+        // Writers not knowing about dispatchers only notify the reader, so the readers are also polled
+        // periodically
+        lock.lock();
+        notification->notification_cv.timed_wait(lock,
+                std::chrono::steady_clock::now() + std::chrono::milliseconds(poll_period_ms), [&]
+                {
+                    return !dispatch_thread->running.load() || notification->new_data.load();
+                });
+
+        lock.unlock();
+
+        if (!dispatch_thread->running.load())
+        {
+            // Woke up because the dispatcher is destroyed
+            return;
+        }
+
+        // Writers flag the notification of the reader before this one, so clearing this one first
+        // guarantees that data arriving during the round is not missed
+        do
+        {
+            notification->new_data.store(false);
+            dispatch_thread->listeners.poll_round();
+        } while (dispatch_thread->running.load() && notification->new_data.load());
+    }
+}
+
+}  // namespace rtps
+}  // namespace fastrtps
+}  // namespace eprosima
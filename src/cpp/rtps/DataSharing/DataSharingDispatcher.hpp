@@ -0,0 +1,116 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DataSharingDispatcher.hpp
+ */
+
+#ifndef RTPS_DATASHARING_DATASHARINGDISPATCHER_HPP
+#define RTPS_DATASHARING_DATASHARINGDISPATCHER_HPP
+
+#include <fastdds/rtps/common/GuidPrefix_t.hpp>
+#include <rtps/DataSharing/DataSharingNotification.hpp>
+#include <rtps/resources/PolledSourceList.hpp>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Threads listening to the data-sharing notifications of several readers of a participant.
+ * Each thread waits on a notification of its own, which the writers of its readers signal after flagging the
+ * notification of the reader. When woken up, the thread processes the readers whose notification is flagged.
+ * Threads are created as readers are added, up to a maximum, and each new reader goes to the thread with less
+ * readers.
+ */
+class DataSharingDispatcher
+{
+public:
+
+    //! Reader listener processing its pending notifications from a dispatcher thread.
+    using Listener = PolledSourceList::Source;
+
+    //! Period of the rounds done without being notified, for readers matched with writers not using the dispatcher.
+    static constexpr uint32_t poll_period_ms = 100;
+
+    /**
+     * @param participant_prefix Prefix of the participant owning the dispatcher.
+     * @param max_threads Maximum number of dispatcher threads.
+     */
+    DataSharingDispatcher(
+            const GuidPrefix_t& participant_prefix,
+            uint32_t max_threads);
+
+    ~DataSharingDispatcher();
+
+    DataSharingDispatcher(
+            const DataSharingDispatcher&) = delete;
+
+    DataSharingDispatcher& operator =(
+            const DataSharingDispatcher&) = delete;
+
+    /**
+     * Start dispatching the notifications of a reader.
+     * It should be called before any writer opens the reader's notification.
+     * @param listener Listener of the reader.
+     * @param notification Notification of the reader.
+     * @return false if no dispatcher thread could be started, so the reader should use its own listening thread.
+     */
+    bool add_listener(
+            Listener* listener,
+            DataSharingNotification& notification);
+
+    /**
+     * Stop dispatching the notifications of a reader.
+     * When called from other thread than the dispatcher one, it waits until the listener is not being processed.
+     * @param listener Listener of the reader.
+     */
+    void remove_listener(
+            Listener* listener);
+
+private:
+
+    struct DispatchThread
+    {
+        std::shared_ptr<DataSharingNotification> notification;
+        PolledSourceList listeners;
+        std::atomic<bool> running{false};
+        std::thread thread;
+    };
+
+    void run(
+            DispatchThread* dispatch_thread);
+
+    GuidPrefix_t participant_prefix_;
+
+    uint32_t max_threads_;
+
+    //! Protects the creation of threads.
+    std::mutex mutex_;
+
+    //! Threads are only destroyed with the dispatcher.
+    std::vector<std::unique_ptr<DispatchThread>> threads_;
+};
+
+}  // namespace rtps
+}  // namespace fastrtps
+}  // namespace eprosima
+
+#endif  // RTPS_DATASHARING_DATASHARINGDISPATCHER_HPP
@@ -31,13 +31,18 @@ DataSharingListener::DataSharingListener(
         std::shared_ptr<DataSharingNotification> notification,
         const std::string& datasharing_pools_directory,
         ResourceLimitedContainerConfig limits,
-        RTPSReader* reader)
+        RTPSReader* reader,
+        BusyPoller* busy_poller,
+        DataSharingDispatcher* dispatcher)
     : notification_(notification)
     , is_running_(false)
     , reader_(reader)
+    , listening_thread_(nullptr)
     , writer_pools_(limits)
     , writer_pools_changed_(false)
     , datasharing_pools_directory_(datasharing_pools_directory)
+    , busy_poller_(busy_poller)
+    , dispatcher_(dispatcher)
 {
 }
 
@@ -77,6 +82,18 @@ void DataSharingListener::run()
     }
 }
 
+bool DataSharingListener::poll()
+{
+    // The writers still signal the condition variable, but nobody waits on it
+    if (!notification_->notification_->new_data.load() && !writer_pools_changed_.load(std::memory_order_relaxed))
+    {
+        return false;
+    }
+
+    process_new_data();
+    return true;
+}
+
 void DataSharingListener::start()
 {
     std::lock_guard<std::mutex> guard(mutex_);
@@ -88,6 +105,17 @@ void DataSharingListener::start()
         return;
     }
 
+    if (nullptr != busy_poller_)
+    {
+        busy_poller_->add_source(this);
+        return;
+    }
+
+    if (nullptr != dispatcher_ && dispatcher_->add_listener(this, *notification_))
+    {
+        return;
+    }
+
     // Initialize the thread
     listening_thread_ = new std::thread(&DataSharingListener::run, this);
 }
@@ -110,6 +138,20 @@ void DataSharingListener::stop()
         listening_thread_ = nullptr;
     }
 
+    if (nullptr == thr)
+    {
+        // Waits until the busy-poll or dispatcher thread is not processing our data
+        if (nullptr != busy_poller_)
+        {
+            busy_poller_->remove_source(this);
+        }
+        else
+        {
+            dispatcher_->remove_listener(this);
+        }
+        return;
+    }
+
     // Notify the thread and wait for it to finish
     notification_->notify();
     thr->join();
@@ -21,8 +21,10 @@
 
 #include <fastdds/dds/log/Log.hpp>
 #include <rtps/DataSharing/IDataSharingListener.hpp>
+#include <rtps/DataSharing/DataSharingDispatcher.hpp>
 #include <rtps/DataSharing/DataSharingNotification.hpp>
 #include <rtps/DataSharing/ReaderPool.hpp>
+#include <rtps/resources/BusyPoller.hpp>
 #include <fastrtps/utils/collections/ResourceLimitedVector.hpp>
 
 #include <memory>
@@ -35,7 +37,7 @@ namespace rtps {
 
 class RTPSReader;
 
-class DataSharingListener : public IDataSharingListener
+class DataSharingListener : public IDataSharingListener, private BusyPoller::Source
 {
 
 public:
@@ -43,11 +45,19 @@ public:
     typedef DataSharingNotification::Notification Notification;
     typedef DataSharingNotification::Segment Segment;
 
+    /**
+     * @param busy_poller When not nullptr, the notifications are polled by this thread instead of
+     * being waited for on a listening thread.
+     * @param dispatcher When not nullptr and there is no busy_poller, the notifications are processed by
+     * the threads of this dispatcher instead of a listening thread.
+     */
     DataSharingListener(
             std::shared_ptr<DataSharingNotification> notification,
             const std::string& datasharing_pools_directory,
             ResourceLimitedContainerConfig limits,
-            RTPSReader* reader);
+            RTPSReader* reader,
+            BusyPoller* busy_poller = nullptr,
+            DataSharingDispatcher* dispatcher = nullptr);
 
     virtual ~DataSharingListener();
 
@@ -92,6 +102,11 @@ protected:
      */
     void process_new_data();
 
+    /**
+     * Called from the busy-poll or dispatcher thread instead of run()
+     */
+    bool poll() override;
+
     struct WriterInfo
     {
         std::shared_ptr<ReaderPool> pool;
@@ -116,6 +131,8 @@ protected:
     std::atomic<bool> writer_pools_changed_;
     std::string datasharing_pools_directory_;
     mutable std::mutex mutex_;
+    BusyPoller* busy_poller_;
+    DataSharingDispatcher* dispatcher_;
 
 };
 
@@ -19,6 +19,8 @@
 #include <rtps/DataSharing/DataSharingNotification.hpp>
 #include <fastdds/rtps/common/Time_t.h>
 
+#include <iterator>
+#include <map>
 #include <memory>
 #include <mutex>
 
@@ -50,6 +52,73 @@ std::shared_ptr<DataSharingNotification> DataSharingNotification::open_notificat
     return notification;
 }
 
+std::shared_ptr<DataSharingNotification> DataSharingNotification::create_dispatcher_notification(
+        const GuidPrefix_t& participant_prefix,
+        uint32_t index)
+{
+    std::shared_ptr<DataSharingNotification> notification = std::make_shared<DataSharingNotification>();
+    notification->segment_id_ = GUID_t(participant_prefix, c_EntityId_RTPSParticipant);
+    if (!notification->create_and_init_segment(generate_dispatcher_segment_name(participant_prefix, index)))
+    {
+        notification.reset();
+    }
+    return notification;
+}
+
+std::shared_ptr<DataSharingNotification> DataSharingNotification::open_dispatcher_notification(
+        const GuidPrefix_t& participant_prefix,
+        uint32_t index)
+{
+    // Every reader of a dispatcher would map the same segment, so it is mapped once per process
+    static std::mutex mutex;
+    static std::map<std::string, std::weak_ptr<DataSharingNotification>> opened;
+
+    std::string segment_name = generate_dispatcher_segment_name(participant_prefix, index);
+
+    std::lock_guard<std::mutex> guard(mutex);
+
+    // Forget the segments of dispatchers no reader of this process is using anymore
+    for (auto it = opened.begin(); it != opened.end();)
+    {
+        it = it->second.expired() ? opened.erase(it) : std::next(it);
+    }
+
+    auto it = opened.find(segment_name);
+    if (it != opened.end())
+    {
+        return it->second.lock();
+    }
+
+    std::shared_ptr<DataSharingNotification> notification = std::make_shared<DataSharingNotification>();
+    notification->segment_id_ = GUID_t(participant_prefix, c_EntityId_RTPSParticipant);
+    if (!notification->open_and_init_segment(segment_name))
+    {
+        return nullptr;
+    }
+    opened[segment_name] = notification;
+    return notification;
+}
+
+bool DataSharingNotification::dispatch_to(
+        const std::shared_ptr<DataSharingNotification>& dispatcher,
+        uint32_t index)
+{
+    try
+    {
+        DispatcherNode* node = segment_->get().construct<DispatcherNode>("dispatcher_node")();
+        node->index = index;
+    }
+    catch (std::exception& e)
+    {
+        logWarning(HISTORY_DATASHARING_LISTENER, "Failed to record the dispatcher on " << segment_name_
+                                                                                      << ": " << e.what());
+        return false;
+    }
+
+    dispatcher_ = dispatcher;
+    return true;
+}
+
 void DataSharingNotification::destroy()
 {
     if (owned_)
@@ -71,11 +140,19 @@ bool DataSharingNotification::create_and_init_notification(
         const std::string& shared_dir)
 {
     segment_id_ = reader_guid;
-    segment_name_ = generate_segment_name(shared_dir, reader_guid);
+    return create_and_init_segment(generate_segment_name(shared_dir, reader_guid));
+}
 
+bool DataSharingNotification::create_and_init_segment(
+        const std::string& segment_name)
+{
+    segment_name_ = segment_name;
+
+    // Room is left for a DispatcherNode too
     uint32_t per_allocation_extra_size = Segment::compute_per_allocation_extra_size(
         alignof(Notification), DataSharingNotification::domain_name());
-    uint32_t segment_size = static_cast<uint32_t>(sizeof(Notification)) + per_allocation_extra_size;
+    uint32_t segment_size = static_cast<uint32_t>(sizeof(Notification) + sizeof(DispatcherNode)) +
+            2 * per_allocation_extra_size;
 
     //Open the segment
     Segment::remove(segment_name_);
@@ -117,7 +194,31 @@ bool DataSharingNotification::open_and_init_notification(
         const std::string& shared_dir)
 {
     segment_id_ = reader_guid;
-    segment_name_ = generate_segment_name(shared_dir, reader_guid);
+    if (!open_and_init_segment(generate_segment_name(shared_dir, reader_guid)))
+    {
+        return false;
+    }
+
+    // Readers without a DispatcherNode are notified directly
+    DispatcherNode* dispatcher_node = segment_->get().find<DispatcherNode>("dispatcher_node").first;
+    if (nullptr != dispatcher_node)
+    {
+        // The reader is listened by a dispatcher thread of its participant
+        dispatcher_ = open_dispatcher_notification(reader_guid.guidPrefix, dispatcher_node->index);
+        if (!dispatcher_)
+        {
+            segment_.reset();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool DataSharingNotification::open_and_init_segment(
+        const std::string& segment_name)
+{
+    segment_name_ = segment_name;
 
     //Open the segment
     try
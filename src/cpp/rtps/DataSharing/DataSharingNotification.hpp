@@ -39,6 +39,7 @@ class DataSharingNotification
 
     friend class DataSharingListener;
     friend class DataSharingNotifier;
+    friend class DataSharingDispatcher;
 
 public:
 
@@ -53,6 +54,14 @@ public:
      */
     inline void notify()
     {
+        if (dispatcher_)
+        {
+            // The dispatcher thread checks the flag of all its readers when woken up
+            notification_->new_data.store(true);
+            dispatcher_->notify();
+            return;
+        }
+
         std::unique_lock<Segment::mutex> lock(notification_->notification_mutex);
         notification_->new_data.store(true);
         lock.unlock();
@@ -75,6 +84,37 @@ public:
             const GUID_t& reader_guid,
             const std::string& shared_dir = std::string());
 
+    /**
+     * Creates the notification a dispatcher thread waits on.
+     * @param participant_prefix Prefix of the participant owning the dispatcher.
+     * @param index Index of the dispatcher thread on the participant.
+     */
+    static std::shared_ptr<DataSharingNotification> create_dispatcher_notification(
+            const GuidPrefix_t& participant_prefix,
+            uint32_t index);
+
+    /**
+     * Opens the notification of a dispatcher thread.
+     * Notifications are shared by all the readers of the process notifying the same dispatcher.
+     * @param participant_prefix Prefix of the participant owning the dispatcher.
+     * @param index Index of the dispatcher thread on the participant.
+     */
+    static std::shared_ptr<DataSharingNotification> open_dispatcher_notification(
+            const GuidPrefix_t& participant_prefix,
+            uint32_t index);
+
+    /**
+     * Makes writers wake up a dispatcher thread, instead of the listening thread of the reader.
+     * It should be called before any writer opens this notification.
+     * @param dispatcher Notification the dispatcher thread waits on.
+     * @param index Index of the dispatcher thread on the participant.
+     * @return false if the dispatcher could not be recorded on the segment, so the reader should use its own
+     * listening thread.
+     */
+    bool dispatch_to(
+            const std::shared_ptr<DataSharingNotification>& dispatcher,
+            uint32_t index);
+
     void destroy();
 
     static std::string get_default_directory()
@@ -106,6 +146,17 @@ protected:
     };
 #pragma warning(pop)
 
+    /**
+     * Only present on the segment of readers served by a dispatcher thread.
+     * It is a separate object so the layout of Notification is the same for writers not knowing about it,
+     * which keep notifying the reader directly.
+     */
+    struct DispatcherNode
+    {
+        //! Dispatcher thread of the reader's participant to wake up
+        uint32_t index;
+    };
+
     static std::string generate_segment_name(
             const std::string& /*shared_dir*/,
             const GUID_t& reader_guid)
@@ -115,15 +166,29 @@ protected:
         return ss.str();
     }
 
+    static std::string generate_dispatcher_segment_name(
+            const GuidPrefix_t& participant_prefix,
+            uint32_t index)
+    {
+        std::stringstream ss;
+        ss << DataSharingNotification::domain_name() << "_" << participant_prefix << "_dispatcher_" << index;
+        return ss.str();
+    }
+
     bool create_and_init_notification(
             const GUID_t& reader_guid,
             const std::string& shared_dir = std::string());
 
+    bool create_and_init_segment(
+            const std::string& segment_name);
 
     bool open_and_init_notification(
             const GUID_t& reader_guid,
             const std::string& shared_dir = std::string());
 
+    bool open_and_init_segment(
+            const std::string& segment_name);
+
 
     GUID_t segment_id_;         //< The ID of the segment is the GUID of the reader
     std::string segment_name_;  //< Segment name
@@ -131,6 +196,8 @@ protected:
     std::unique_ptr<Segment> segment_;  //< Shared memory segment
     Notification* notification_;        //< The notification data
     bool owned_ = false;                //< Whether the shared segment is owned by this instance
+
+    std::shared_ptr<DataSharingNotification> dispatcher_;   //< Dispatcher woken up instead of the reader
 };
 
 }  // namespace rtps
@@ -79,7 +79,8 @@ public:
 
     virtual bool init_shared_memory(
             const RTPSWriter* /*writer*/,
-            const std::string& /*shared_dir*/)
+            const std::string& /*shared_dir*/,
+            const Segment::MemoryPolicy& /*memory_policy*/)
     {
         // Default implementation is NOP
         // will be overriden by children if needed
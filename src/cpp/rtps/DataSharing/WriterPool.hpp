@@ -138,7 +138,8 @@ public:
 
     bool init_shared_memory(
             const RTPSWriter* writer,
-            const std::string& shared_dir) override
+            const std::string& shared_dir,
+            const Segment::MemoryPolicy& memory_policy) override
     {
         writer_ = writer;
         segment_id_ = writer_->getGuid();
@@ -193,6 +194,8 @@ public:
             return false;
         }
 
+        segment_->apply_memory_policy(memory_policy);
+
         try
         {
             // Alloc the memory for the pool
@@ -97,6 +97,7 @@ ReaderProxyData::ReaderProxyData(
     , m_type(nullptr)
     , m_type_information(nullptr)
     , m_properties(readerInfo.m_properties)
+    , content_filter_(readerInfo.content_filter_)
 {
     if (readerInfo.m_type_id)
     {
@@ -136,6 +137,7 @@ ReaderProxyData& ReaderProxyData::operator =(
     m_topicKind = readerInfo.m_topicKind;
     m_qos.setQos(readerInfo.m_qos, true);
     m_properties = readerInfo.m_properties;
+    content_filter_ = readerInfo.content_filter_;
 
     if (readerInfo.m_type_id)
     {
@@ -306,6 +308,13 @@ uint32_t ReaderProxyData::get_serialized_size(
         ret_val += fastdds::dds::ParameterSerializer<ParameterPropertyList_t>::cdr_serialized_size(m_properties);
     }
 
+    if (has_content_filter())
+    {
+        // PID_CONTENT_FILTER_PROPERTY
+        ret_val += fastdds::dds::ParameterSerializer<fastdds::rtps::ContentFilterProperty>::cdr_serialized_size(
+            content_filter_);
+    }
+
 #if HAVE_SECURITY
     if ((this->security_attributes_ != 0UL) || (this->plugin_security_attributes_ != 0UL))
     {
@@ -544,6 +553,15 @@ bool ReaderProxyData::writeToCDRMessage(
         }
     }
 
+    if (has_content_filter())
+    {
+        if (!fastdds::dds::ParameterSerializer<fastdds::rtps::ContentFilterProperty>::add_to_cdr_message(
+                    content_filter_, msg))
+        {
+            return false;
+        }
+    }
+
 #if HAVE_SECURITY
     if ((security_attributes_ != 0UL) || (plugin_security_attributes_ != 0UL))
     {
@@ -955,6 +973,18 @@ bool ReaderProxyData::readFromCDRMessage(
                         break;
                     }
 
+                    case fastdds::dds::PID_CONTENT_FILTER_PROPERTY:
+                    {
+                        if (!fastdds::dds::ParameterSerializer<fastdds::rtps::ContentFilterProperty>::
+                                read_from_cdr_message(content_filter_, msg, plength))
+                        {
+                            logError(RTPS_READER_PROXY_DATA,
+                                    "Received with error.");
+                            return false;
+                        }
+                        break;
+                    }
+
                     case fastdds::dds::PID_DATASHARING:
                     {
                         if (!fastdds::dds::QosPoliciesSerializer<DataSharingQosPolicy>::read_from_cdr_message(
@@ -1034,6 +1064,7 @@ void ReaderProxyData::clear()
     m_qos.clear();
     m_properties.clear();
     m_properties.length = 0;
+    content_filter_ = fastdds::rtps::ContentFilterProperty();
 
     if (m_type_id)
     {
@@ -1073,6 +1104,7 @@ void ReaderProxyData::update(
     m_qos.setQos(rdata->m_qos, false);
     m_isAlive = rdata->m_isAlive;
     m_expectsInlineQos = rdata->m_expectsInlineQos;
+    content_filter_ = rdata->content_filter_;
 }
 
 void ReaderProxyData::copy(
@@ -1090,6 +1122,7 @@ void ReaderProxyData::copy(
     m_isAlive = rdata->m_isAlive;
     m_topicKind = rdata->m_topicKind;
     m_properties = rdata->m_properties;
+    content_filter_ = rdata->content_filter_;
 
     if (rdata->m_type_id)
     {
@@ -34,8 +34,6 @@
 
 #include <fastrtps/attributes/TopicAttributes.h>
 
-#include <fastrtps/utils/StringMatching.h>
-
 #include <fastrtps/types/TypeObjectFactory.h>
 
 #include <fastdds/core/policy/ParameterList.hpp>
@@ -47,7 +45,9 @@
 #include <rtps/participant/RTPSParticipantImpl.h>
 
 #include <utils/collections/node_size_helpers.hpp>
+#include <utils/PartitionMatcher.hpp>
 
+#include <algorithm>
 #include <mutex>
 
 using namespace eprosima::fastrtps;
@@ -63,6 +63,22 @@ namespace rtps {
 using reader_map_helper = utilities::collections::map_size_helper<GUID_t, SubscriptionMatchedStatus>;
 using writer_map_helper = utilities::collections::map_size_helper<GUID_t, PublicationMatchedStatus>;
 
+namespace {
+
+template<typename ProxyData>
+bool is_on_topic(
+        const std::vector<ProxyData*>& topic_proxies,
+        const GUID_t& guid)
+{
+    return std::any_of(topic_proxies.begin(), topic_proxies.end(),
+                   [&guid](const ProxyData* proxy)
+                   {
+                       return proxy->guid() == guid;
+                   });
+}
+
+} // namespace
+
 EDP::EDP(
         PDP* p,
         RTPSParticipantImpl* part)
@@ -86,6 +102,7 @@ EDP::EDP(
             part->getRTPSParticipantAttributes().allocation.total_writers().initial))
     , reader_status_(reader_status_allocator_)
     , writer_status_(writer_status_allocator_)
+    , partition_matchers_(new PartitionMatcherCache())
 {
 }
 
@@ -97,11 +114,12 @@ EDP::~EDP()
 bool EDP::newLocalReaderProxyData(
         RTPSReader* reader,
         const TopicAttributes& att,
-        const ReaderQos& rqos)
+        const ReaderQos& rqos,
+        const fastdds::rtps::ContentFilterProperty* content_filter)
 {
     logInfo(RTPS_EDP, "Adding " << reader->getGuid().entityId << " in topic " << att.topicName);
 
-    auto init_fun = [this, reader, &att, &rqos](
+    auto init_fun = [this, reader, &att, &rqos, content_filter](
         ReaderProxyData* rpd,
         bool updating,
         const ParticipantProxyData& participant_data)
@@ -146,6 +164,10 @@ bool EDP::newLocalReaderProxyData(
                 }
                 rpd->m_qos.setQos(rqos, true);
                 rpd->userDefinedId(reader->getAttributes().getUserDefinedID());
+                if (nullptr != content_filter)
+                {
+                    rpd->content_filter(*content_filter);
+                }
 #if HAVE_SECURITY
                 if (mp_RTPSParticipant->is_secure())
                 {
@@ -354,9 +376,10 @@ bool EDP::newLocalWriterProxyData(
 bool EDP::updatedLocalReader(
         RTPSReader* reader,
         const TopicAttributes& att,
-        const ReaderQos& rqos)
+        const ReaderQos& rqos,
+        const fastdds::rtps::ContentFilterProperty* content_filter)
 {
-    auto init_fun = [this, reader, &rqos, &att](
+    auto init_fun = [this, reader, &rqos, &att, content_filter](
         ReaderProxyData* rdata,
         bool updating,
         const ParticipantProxyData& participant_data)
@@ -379,6 +402,10 @@ bool EDP::updatedLocalReader(
                 rdata->m_qos.setQos(rqos, false);
                 rdata->isAlive(true);
                 rdata->m_expectsInlineQos = reader->expectsInlineQos();
+                if (nullptr != content_filter)
+                {
+                    rdata->content_filter(*content_filter);
+                }
 
                 if (att.auto_fill_type_information)
                 {
@@ -704,55 +731,7 @@ bool EDP::valid_matching(
     }
 
     //Partition check:
-    bool matched = false;
-    if (wdata->m_qos.m_partition.empty() && rdata->m_qos.m_partition.empty())
-    {
-        matched = true;
-    }
-    else if (wdata->m_qos.m_partition.empty() && rdata->m_qos.m_partition.size() > 0)
-    {
-        for (auto rnameit = rdata->m_qos.m_partition.begin();
-                rnameit != rdata->m_qos.m_partition.end(); ++rnameit)
-        {
-            if (rnameit->size() == 0)
-            {
-                matched = true;
-                break;
-            }
-        }
-    }
-    else if (wdata->m_qos.m_partition.size() > 0 && rdata->m_qos.m_partition.empty())
-    {
-        for (auto wnameit = wdata->m_qos.m_partition.begin();
-                wnameit !=  wdata->m_qos.m_partition.end(); ++wnameit)
-        {
-            if (wnameit->size() == 0)
-            {
-                matched = true;
-                break;
-            }
-        }
-    }
-    else
-    {
-        for (auto wnameit = wdata->m_qos.m_partition.begin();
-                wnameit !=  wdata->m_qos.m_partition.end(); ++wnameit)
-        {
-            for (auto rnameit = rdata->m_qos.m_partition.begin();
-                    rnameit != rdata->m_qos.m_partition.end(); ++rnameit)
-            {
-                if (StringMatching::matchString(wnameit->name(), rnameit->name()))
-                {
-                    matched = true;
-                    break;
-                }
-            }
-            if (matched)
-            {
-                break;
-            }
-        }
-    }
+    bool matched = partition_matchers_->match(wdata->m_qos.m_partition, rdata->m_qos.m_partition);
     if (!matched) //Different partitions
     {
         logWarning(RTPS_EDP, "INCOMPATIBLE QOS (topic: " << rdata->topicName() << "): Different Partitions");
@@ -930,55 +909,7 @@ bool EDP::valid_matching(
     }
 
     //Partition check:
-    bool matched = false;
-    if (rdata->m_qos.m_partition.empty() && wdata->m_qos.m_partition.empty())
-    {
-        matched = true;
-    }
-    else if (rdata->m_qos.m_partition.empty() && wdata->m_qos.m_partition.size() > 0)
-    {
-        for (auto rnameit = wdata->m_qos.m_partition.begin();
-                rnameit != wdata->m_qos.m_partition.end(); ++rnameit)
-        {
-            if (rnameit->size() == 0)
-            {
-                matched = true;
-                break;
-            }
-        }
-    }
-    else if (rdata->m_qos.m_partition.size() > 0 && wdata->m_qos.m_partition.empty())
-    {
-        for (auto wnameit = rdata->m_qos.m_partition.begin();
-                wnameit !=  rdata->m_qos.m_partition.end(); ++wnameit)
-        {
-            if (wnameit->size() == 0)
-            {
-                matched = true;
-                break;
-            }
-        }
-    }
-    else
-    {
-        for (auto wnameit = rdata->m_qos.m_partition.begin();
-                wnameit !=  rdata->m_qos.m_partition.end(); ++wnameit)
-        {
-            for (auto rnameit = wdata->m_qos.m_partition.begin();
-                    rnameit != wdata->m_qos.m_partition.end(); ++rnameit)
-            {
-                if (StringMatching::matchString(wnameit->name(), rnameit->name()))
-                {
-                    matched = true;
-                    break;
-                }
-            }
-            if (matched)
-            {
-                break;
-            }
-        }
-    }
+    bool matched = partition_matchers_->match(wdata->m_qos.m_partition, rdata->m_qos.m_partition);
     if (!matched) //Different partitions
     {
         logWarning(RTPS_EDP, "INCOMPATIBLE QOS (topic: " <<  wdata->topicName() <<
@@ -1002,75 +933,75 @@ bool EDP::pairingReader(
     logInfo(RTPS_EDP, rdata.guid() << " in topic: \"" << rdata.topicName() << "\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
 
-    for (ResourceLimitedVector<ParticipantProxyData*>::const_iterator pit = mp_PDP->ParticipantProxiesBegin();
-            pit != mp_PDP->ParticipantProxiesEnd(); ++pit)
+    // Endpoints on other topics never match, so only the writers on the topic of the reader are checked
+    // Indexes are used as matching callbacks may add endpoints to the collection
+    const std::vector<WriterProxyData*>& writers = mp_PDP->writer_proxies_on_topic(rdata.topicName());
+    for (size_t i = 0; i < writers.size(); ++i)
     {
-        for (auto& pair : *(*pit)->m_writers)
+        WriterProxyData* wdatait = writers[i];
+        MatchingFailureMask no_match_reason;
+        fastdds::dds::PolicyMask incompatible_qos;
+        bool valid = valid_matching(&rdata, wdatait, no_match_reason, incompatible_qos);
+        const GUID_t& reader_guid = R->getGuid();
+        const GUID_t& writer_guid = wdatait->guid();
+
+        if (valid)
         {
-            WriterProxyData* wdatait = pair.second;
-            MatchingFailureMask no_match_reason;
-            fastdds::dds::PolicyMask incompatible_qos;
-            bool valid = valid_matching(&rdata, wdatait, no_match_reason, incompatible_qos);
-            const GUID_t& reader_guid = R->getGuid();
-            const GUID_t& writer_guid = wdatait->guid();
-
-            if (valid)
-            {
 #if HAVE_SECURITY
-                if (!mp_RTPSParticipant->security_manager().discovered_writer(R->m_guid, (*pit)->m_guid,
-                        *wdatait, R->getAttributes().security_attributes()))
-                {
-                    logError(RTPS_EDP, "Security manager returns an error for reader " << reader_guid);
-                }
+            if (!mp_RTPSParticipant->security_manager().discovered_writer(R->m_guid,
+                    GUID_t(writer_guid.guidPrefix, c_EntityId_RTPSParticipant),
+                    *wdatait, R->getAttributes().security_attributes()))
+            {
+                logError(RTPS_EDP, "Security manager returns an error for reader " << reader_guid);
+            }
 #else
-                if (R->matched_writer_add(*wdatait))
+            if (R->matched_writer_add(*wdatait))
+            {
+                logInfo(RTPS_EDP_MATCH,
+                        "WP:" << wdatait->guid() << " match R:" << R->getGuid() << ". RLoc:" <<
+                        wdatait->remote_locators());
+                //MATCHED AND ADDED CORRECTLY:
+                if (R->getListener() != nullptr)
                 {
-                    logInfo(RTPS_EDP_MATCH,
-                            "WP:" << wdatait->guid() << " match R:" << R->getGuid() << ". RLoc:" <<
-                            wdatait->remote_locators());
-                    //MATCHED AND ADDED CORRECTLY:
-                    if (R->getListener() != nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = MATCHED_MATCHING;
-                        info.remoteEndpointGuid = writer_guid;
-                        R->getListener()->onReaderMatched(R, info);
+                    MatchingInfo info;
+                    info.status = MATCHED_MATCHING;
+                    info.remoteEndpointGuid = writer_guid;
+                    R->getListener()->onReaderMatched(R, info);
 
-                        const SubscriptionMatchedStatus& sub_info =
-                                update_subscription_matched_status(reader_guid, writer_guid, 1);
-                        R->getListener()->onReaderMatched(R, sub_info);
-                    }
+                    const SubscriptionMatchedStatus& sub_info =
+                            update_subscription_matched_status(reader_guid, writer_guid, 1);
+                    R->getListener()->onReaderMatched(R, sub_info);
                 }
-#endif // if HAVE_SECURITY
             }
-            else
+#endif // if HAVE_SECURITY
+        }
+        else
+        {
+            if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && R->getListener() != nullptr)
             {
-                if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && R->getListener() != nullptr)
-                {
-                    R->getListener()->on_requested_incompatible_qos(R, incompatible_qos);
-                }
+                R->getListener()->on_requested_incompatible_qos(R, incompatible_qos);
+            }
 
-                //logInfo(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<wdatait->m_guid<<RTPS_DEF<<endl);
-                if (R->matched_writer_is_matched(wdatait->guid())
-                        && R->matched_writer_remove(wdatait->guid()))
-                {
+            //logInfo(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<wdatait->m_guid<<RTPS_DEF<<endl);
+            if (R->matched_writer_is_matched(wdatait->guid())
+                    && R->matched_writer_remove(wdatait->guid()))
+            {
 #if HAVE_SECURITY
-                    mp_RTPSParticipant->security_manager().remove_writer(reader_guid, participant_guid,
-                            wdatait->guid());
+                mp_RTPSParticipant->security_manager().remove_writer(reader_guid, participant_guid,
+                        wdatait->guid());
 #endif // if HAVE_SECURITY
 
-                    //MATCHED AND ADDED CORRECTLY:
-                    if (R->getListener() != nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = REMOVED_MATCHING;
-                        info.remoteEndpointGuid = writer_guid;
-                        R->getListener()->onReaderMatched(R, info);
+                //MATCHED AND ADDED CORRECTLY:
+                if (R->getListener() != nullptr)
+                {
+                    MatchingInfo info;
+                    info.status = REMOVED_MATCHING;
+                    info.remoteEndpointGuid = writer_guid;
+                    R->getListener()->onReaderMatched(R, info);
 
-                        const SubscriptionMatchedStatus& sub_info =
-                                update_subscription_matched_status(reader_guid, writer_guid, -1);
-                        R->getListener()->onReaderMatched(R, sub_info);
-                    }
+                    const SubscriptionMatchedStatus& sub_info =
+                            update_subscription_matched_status(reader_guid, writer_guid, -1);
+                    R->getListener()->onReaderMatched(R, sub_info);
                 }
             }
         }
@@ -1089,80 +1020,80 @@ bool EDP::pairingWriter(
     logInfo(RTPS_EDP, W->getGuid() << " in topic: \"" << wdata.topicName() << "\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
 
-    for (ResourceLimitedVector<ParticipantProxyData*>::const_iterator pit = mp_PDP->ParticipantProxiesBegin();
-            pit != mp_PDP->ParticipantProxiesEnd(); ++pit)
+    // Endpoints on other topics never match, so only the readers on the topic of the writer are checked
+    // Indexes are used as matching callbacks may add endpoints to the collection
+    const std::vector<ReaderProxyData*>& readers = mp_PDP->reader_proxies_on_topic(wdata.topicName());
+    for (size_t i = 0; i < readers.size(); ++i)
     {
-        for (auto& pair : *(*pit)->m_readers)
+        ReaderProxyData* rdatait = readers[i];
+        const GUID_t& reader_guid = rdatait->guid();
+        if (reader_guid == c_Guid_Unknown)
         {
-            ReaderProxyData* rdatait = pair.second;
-            const GUID_t& reader_guid = rdatait->guid();
-            if (reader_guid == c_Guid_Unknown)
-            {
-                continue;
-            }
+            continue;
+        }
 
-            MatchingFailureMask no_match_reason;
-            fastdds::dds::PolicyMask incompatible_qos;
-            bool valid = valid_matching(&wdata, rdatait, no_match_reason, incompatible_qos);
+        MatchingFailureMask no_match_reason;
+        fastdds::dds::PolicyMask incompatible_qos;
+        bool valid = valid_matching(&wdata, rdatait, no_match_reason, incompatible_qos);
 
-            if (valid)
-            {
+        if (valid)
+        {
 #if HAVE_SECURITY
-                if (!mp_RTPSParticipant->security_manager().discovered_reader(W->getGuid(), (*pit)->m_guid,
-                        *rdatait, W->getAttributes().security_attributes()))
-                {
-                    logError(RTPS_EDP, "Security manager returns an error for writer " << W->getGuid());
-                }
+            if (!mp_RTPSParticipant->security_manager().discovered_reader(W->getGuid(),
+                    GUID_t(reader_guid.guidPrefix, c_EntityId_RTPSParticipant),
+                    *rdatait, W->getAttributes().security_attributes()))
+            {
+                logError(RTPS_EDP, "Security manager returns an error for writer " << W->getGuid());
+            }
 #else
-                if (W->matched_reader_add(*rdatait))
+            if (W->matched_reader_add(*rdatait))
+            {
+                logInfo(RTPS_EDP_MATCH,
+                        "RP:" << rdatait->guid() << " match W:" << W->getGuid() << ". WLoc:" <<
+                        rdatait->remote_locators());
+                //MATCHED AND ADDED CORRECTLY:
+                if (W->getListener() != nullptr)
                 {
-                    logInfo(RTPS_EDP_MATCH,
-                            "RP:" << rdatait->guid() << " match W:" << W->getGuid() << ". WLoc:" <<
-                            rdatait->remote_locators());
-                    //MATCHED AND ADDED CORRECTLY:
-                    if (W->getListener() != nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = MATCHED_MATCHING;
-                        info.remoteEndpointGuid = reader_guid;
-                        W->getListener()->onWriterMatched(W, info);
+                    MatchingInfo info;
+                    info.status = MATCHED_MATCHING;
+                    info.remoteEndpointGuid = reader_guid;
+                    W->getListener()->onWriterMatched(W, info);
 
-                        const GUID_t& writer_guid = W->getGuid();
-                        const PublicationMatchedStatus& pub_info =
-                                update_publication_matched_status(reader_guid, writer_guid, 1);
-                        W->getListener()->onWriterMatched(W, pub_info);
-                    }
+                    const GUID_t& writer_guid = W->getGuid();
+                    const PublicationMatchedStatus& pub_info =
+                            update_publication_matched_status(reader_guid, writer_guid, 1);
+                    W->getListener()->onWriterMatched(W, pub_info);
                 }
-#endif // if HAVE_SECURITY
             }
-            else
+#endif // if HAVE_SECURITY
+        }
+        else
+        {
+            if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && W->getListener() != nullptr)
             {
-                if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && W->getListener() != nullptr)
-                {
-                    W->getListener()->on_offered_incompatible_qos(W, incompatible_qos);
-                }
+                W->getListener()->on_offered_incompatible_qos(W, incompatible_qos);
+            }
 
-                //logInfo(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<wdatait->m_guid<<RTPS_DEF<<endl);
-                if (W->matched_reader_is_matched(reader_guid) && W->matched_reader_remove(reader_guid))
-                {
+            //logInfo(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<wdatait->m_guid<<RTPS_DEF<<endl);
+            if (W->matched_reader_is_matched(reader_guid) && W->matched_reader_remove(reader_guid))
+            {
 #if HAVE_SECURITY
-                    mp_RTPSParticipant->security_manager().remove_reader(W->getGuid(), participant_guid, reader_guid);
+                mp_RTPSParticipant->security_manager().remove_reader(W->getGuid(), participant_guid, reader_guid);
 #endif // if HAVE_SECURITY
-                    //MATCHED AND ADDED CORRECTLY:
-                    if (W->getListener() != nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = REMOVED_MATCHING;
-                        info.remoteEndpointGuid = reader_guid;
-                        W->getListener()->onWriterMatched(W, info);
+                //MATCHED AND ADDED CORRECTLY:
+                if (W->getListener() != nullptr)
+                {
+                    MatchingInfo info;
+                    info.status = REMOVED_MATCHING;
+                    info.remoteEndpointGuid = reader_guid;
+                    W->getListener()->onWriterMatched(W, info);
 
-                        const GUID_t& writer_guid = W->getGuid();
-                        const PublicationMatchedStatus& pub_info =
-                                update_publication_matched_status(reader_guid, writer_guid, -1);
-                        W->getListener()->onWriterMatched(W, pub_info);
+                    const GUID_t& writer_guid = W->getGuid();
+                    const PublicationMatchedStatus& pub_info =
+                            update_publication_matched_status(reader_guid, writer_guid, -1);
+                    W->getListener()->onWriterMatched(W, pub_info);
 
 
-                    }
                 }
             }
         }
@@ -1177,19 +1108,33 @@ bool EDP::pairing_reader_proxy_with_any_local_writer(
     (void)participant_guid;
 
     logInfo(RTPS_EDP, rdata->guid() << " in topic: \"" << rdata->topicName() << "\"");
+    const GuidPrefix_t& local_prefix = mp_RTPSParticipant->getGuid().guidPrefix;
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
     std::lock_guard<std::recursive_mutex> guard(*mp_RTPSParticipant->getParticipantMutex());
-    for (std::vector<RTPSWriter*>::iterator wit = mp_RTPSParticipant->userWritersListBegin();
-            wit != mp_RTPSParticipant->userWritersListEnd(); ++wit)
+
+    // Only the local writers on the topic of the reader are checked, using the data already kept by PDP
+    const std::vector<WriterProxyData*>& writers = mp_PDP->writer_proxies_on_topic(rdata->topicName());
+    for (size_t i = 0; i < writers.size(); ++i)
     {
-        (*wit)->getMutex().lock();
-        GUID_t writerGUID = (*wit)->getGuid();
-        (*wit)->getMutex().unlock();
-        if (mp_PDP->lookupWriterProxyData(writerGUID, temp_writer_proxy_data_))
+        WriterProxyData* wdata = writers[i];
+        GUID_t writerGUID = wdata->guid();
+        if (writerGUID.guidPrefix != local_prefix)
+        {
+            continue;
+        }
+
+        std::vector<RTPSWriter*>::iterator wit = std::find_if(
+            mp_RTPSParticipant->userWritersListBegin(),
+            mp_RTPSParticipant->userWritersListEnd(),
+            [&writerGUID](RTPSWriter* writer)
+            {
+                return writer->getGuid() == writerGUID;
+            });
+        if (wit != mp_RTPSParticipant->userWritersListEnd())
         {
             MatchingFailureMask no_match_reason;
             fastdds::dds::PolicyMask incompatible_qos;
-            bool valid = valid_matching(&temp_writer_proxy_data_, rdata, no_match_reason, incompatible_qos);
+            bool valid = valid_matching(wdata, rdata, no_match_reason, incompatible_qos);
             const GUID_t& reader_guid = rdata->guid();
 
             if (valid)
@@ -1252,6 +1197,35 @@ bool EDP::pairing_reader_proxy_with_any_local_writer(
         }
     }
 
+
+    // A remote reader reusing its GUID on another topic is not on the collection of its former topic anymore, so it
+    // is unmatched here from the local writers it was matched with
+    const GUID_t& reader_guid = rdata->guid();
+    for (std::vector<RTPSWriter*>::iterator wit = mp_RTPSParticipant->userWritersListBegin();
+            wit != mp_RTPSParticipant->userWritersListEnd(); ++wit)
+    {
+        const GUID_t& writer_guid = (*wit)->getGuid();
+        if (!is_on_topic(writers, writer_guid)
+                && (*wit)->matched_reader_is_matched(reader_guid)
+                && (*wit)->matched_reader_remove(reader_guid))
+        {
+#if HAVE_SECURITY
+            mp_RTPSParticipant->security_manager().remove_reader(writer_guid, participant_guid, reader_guid);
+#endif // if HAVE_SECURITY
+            if ((*wit)->getListener() != nullptr)
+            {
+                MatchingInfo info;
+                info.status = REMOVED_MATCHING;
+                info.remoteEndpointGuid = reader_guid;
+                (*wit)->getListener()->onWriterMatched((*wit), info);
+
+                const PublicationMatchedStatus& pub_info =
+                        update_publication_matched_status(reader_guid, writer_guid, -1);
+                (*wit)->getListener()->onWriterMatched((*wit), pub_info);
+            }
+        }
+    }
+
     return true;
 }
 
@@ -1372,20 +1346,33 @@ bool EDP::pairing_writer_proxy_with_any_local_reader(
     (void)participant_guid;
 
     logInfo(RTPS_EDP, wdata->guid() << " in topic: \"" << wdata->topicName() << "\"");
+    const GuidPrefix_t& local_prefix = mp_RTPSParticipant->getGuid().guidPrefix;
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
     std::lock_guard<std::recursive_mutex> guard(*mp_RTPSParticipant->getParticipantMutex());
-    for (std::vector<RTPSReader*>::iterator rit = mp_RTPSParticipant->userReadersListBegin();
-            rit != mp_RTPSParticipant->userReadersListEnd(); ++rit)
+
+    // Only the local readers on the topic of the writer are checked, using the data already kept by PDP
+    const std::vector<ReaderProxyData*>& readers = mp_PDP->reader_proxies_on_topic(wdata->topicName());
+    for (size_t i = 0; i < readers.size(); ++i)
     {
-        GUID_t readerGUID;
-        (*rit)->getMutex().lock();
-        readerGUID = (*rit)->getGuid();
-        (*rit)->getMutex().unlock();
-        if (mp_PDP->lookupReaderProxyData(readerGUID, temp_reader_proxy_data_))
+        ReaderProxyData* rdata = readers[i];
+        GUID_t readerGUID = rdata->guid();
+        if (readerGUID.guidPrefix != local_prefix)
+        {
+            continue;
+        }
+
+        std::vector<RTPSReader*>::iterator rit = std::find_if(
+            mp_RTPSParticipant->userReadersListBegin(),
+            mp_RTPSParticipant->userReadersListEnd(),
+            [&readerGUID](RTPSReader* reader)
+            {
+                return reader->getGuid() == readerGUID;
+            });
+        if (rit != mp_RTPSParticipant->userReadersListEnd())
         {
             MatchingFailureMask no_match_reason;
             fastdds::dds::PolicyMask incompatible_qos;
-            bool valid = valid_matching(&temp_reader_proxy_data_, wdata, no_match_reason, incompatible_qos);
+            bool valid = valid_matching(rdata, wdata, no_match_reason, incompatible_qos);
             const GUID_t& writer_guid = wdata->guid();
 
             if (valid)
@@ -1447,6 +1434,35 @@ bool EDP::pairing_writer_proxy_with_any_local_reader(
             }
         }
     }
+
+    // A remote writer reusing its GUID on another topic is not on the collection of its former topic anymore, so it
+    // is unmatched here from the local readers it was matched with
+    const GUID_t& writer_guid = wdata->guid();
+    for (std::vector<RTPSReader*>::iterator rit = mp_RTPSParticipant->userReadersListBegin();
+            rit != mp_RTPSParticipant->userReadersListEnd(); ++rit)
+    {
+        const GUID_t& reader_guid = (*rit)->getGuid();
+        if (!is_on_topic(readers, reader_guid)
+                && (*rit)->matched_writer_is_matched(writer_guid)
+                && (*rit)->matched_writer_remove(writer_guid))
+        {
+#if HAVE_SECURITY
+            mp_RTPSParticipant->security_manager().remove_writer(reader_guid, participant_guid, writer_guid);
+#endif // if HAVE_SECURITY
+            if ((*rit)->getListener() != nullptr)
+            {
+                MatchingInfo info;
+                info.status = REMOVED_MATCHING;
+                info.remoteEndpointGuid = writer_guid;
+                (*rit)->getListener()->onReaderMatched((*rit), info);
+
+                const SubscriptionMatchedStatus& sub_info =
+                        update_subscription_matched_status(reader_guid, writer_guid, -1);
+                (*rit)->getListener()->onReaderMatched((*rit), sub_info);
+            }
+        }
+    }
+
     return true;
 }
 
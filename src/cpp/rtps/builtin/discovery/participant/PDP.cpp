@@ -55,11 +55,13 @@
 
 #include <fastdds/dds/builtin/typelookup/TypeLookupManager.hpp>
 #include <rtps/builtin/data/ProxyHashTables.hpp>
+#include <rtps/builtin/discovery/participant/ProxyTopicIndex.hpp>
 
 #include <fastdds/dds/log/Log.hpp>
 
 #include <rtps/history/TopicPayloadPoolRegistry.hpp>
 
+#include <algorithm>
 #include <mutex>
 #include <chrono>
 
@@ -77,7 +79,6 @@ const Duration_t pdp_heartbeat_response_delay{ 0, 11 * 1000000 }; // 11 millisec
 
 const int32_t pdp_initial_reserved_caches = 20;
 
-
 PDP::PDP (
         BuiltinProtocols* built,
         const RTPSParticipantAllocationAttributes& allocation)
@@ -195,7 +196,8 @@ ParticipantProxyData* PDP::add_participant_proxy_data(
             ret_val = new ParticipantProxyData(mp_RTPSParticipant->getRTPSParticipantAttributes().allocation);
             if (participant_guid != mp_RTPSParticipant->getGuid())
             {
-                ret_val->lease_duration_event = new TimedEvent(mp_RTPSParticipant->getEventResource(),
+                ret_val->lease_duration_event = new TimedEvent(
+                    mp_RTPSParticipant->getEventResource(EventThreadClass::DISCOVERY),
                                 [this, ret_val]() -> bool
                                 {
                                     check_remote_participant_liveliness(ret_val);
@@ -379,7 +381,8 @@ bool PDP::initPDP(
     // Create lease events on already created proxy data objects
     for (ParticipantProxyData* pool_item : participant_proxies_pool_)
     {
-        pool_item->lease_duration_event = new TimedEvent(mp_RTPSParticipant->getEventResource(),
+        pool_item->lease_duration_event = new TimedEvent(
+            mp_RTPSParticipant->getEventResource(EventThreadClass::DISCOVERY),
                         [this, pool_item]() -> bool
                         {
                             check_remote_participant_liveliness(pool_item);
@@ -387,7 +390,7 @@ bool PDP::initPDP(
                         }, 0.0);
     }
 
-    resend_participant_info_event_ = new TimedEvent(mp_RTPSParticipant->getEventResource(),
+    resend_participant_info_event_ = new TimedEvent(mp_RTPSParticipant->getEventResource(EventThreadClass::DISCOVERY),
                     [&]() -> bool
                     {
                         announceParticipantState(false);
@@ -601,6 +604,7 @@ bool PDP::removeReaderProxyData(
             if (rit != pit->m_readers->end())
             {
                 ReaderProxyData* pR = rit->second;
+                remove_from_topic_index(reader_proxies_by_topic_, pR);
                 mp_EDP->unpairReaderProxy(pit->m_guid, reader_guid);
 
                 RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
@@ -638,6 +642,7 @@ bool PDP::removeWriterProxyData(
             if (wit != pit->m_writers->end())
             {
                 WriterProxyData* pW = wit->second;
+                remove_from_topic_index(writer_proxies_by_topic_, pW);
                 mp_EDP->unpairWriterProxy(pit->m_guid, writer_guid, false);
 
                 RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
@@ -661,6 +666,18 @@ bool PDP::removeWriterProxyData(
     return false;
 }
 
+const std::vector<ReaderProxyData*>& PDP::reader_proxies_on_topic(
+        const string_255& topic_name) const
+{
+    return find_in_topic_index(reader_proxies_by_topic_, topic_name);
+}
+
+const std::vector<WriterProxyData*>& PDP::writer_proxies_on_topic(
+        const string_255& topic_name) const
+{
+    return find_in_topic_index(writer_proxies_by_topic_, topic_name);
+}
+
 bool PDP::lookup_participant_name(
         const GUID_t& guid,
         string_255& name)
@@ -720,7 +737,13 @@ ReaderProxyData* PDP::addReaderProxyData(
             {
                 ret_val = rpi->second;
 
-                if (!initializer_func(ret_val, true, *pit))
+                // The initializer may change the topic of the existing entry
+                bool updated = update_in_topic_index(reader_proxies_by_topic_, ret_val,
+                                [&initializer_func, pit](ReaderProxyData* data)
+                                {
+                                    return initializer_func(data, true, *pit);
+                                });
+                if (!updated)
                 {
                     return nullptr;
                 }
@@ -772,6 +795,8 @@ ReaderProxyData* PDP::addReaderProxyData(
                 return nullptr;
             }
 
+            add_to_topic_index(reader_proxies_by_topic_, ret_val);
+
             RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
             if (listener)
             {
@@ -815,7 +840,13 @@ WriterProxyData* PDP::addWriterProxyData(
             {
                 ret_val = wpi->second;
 
-                if (!initializer_func(ret_val, true, *pit))
+                // The initializer may change the topic of the existing entry
+                bool updated = update_in_topic_index(writer_proxies_by_topic_, ret_val,
+                                [&initializer_func, pit](WriterProxyData* data)
+                                {
+                                    return initializer_func(data, true, *pit);
+                                });
+                if (!updated)
                 {
                     return nullptr;
                 }
@@ -867,6 +898,8 @@ WriterProxyData* PDP::addWriterProxyData(
                 return nullptr;
             }
 
+            add_to_topic_index(writer_proxies_by_topic_, ret_val);
+
             RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
             if (listener)
             {
@@ -905,6 +938,10 @@ bool PDP::remove_remote_participant(
         {
             pdata = *pit;
             participant_proxies_.erase(pit);
+
+            // Its endpoints should not be found on their topics from now on
+            remove_all_from_topic_index(reader_proxies_by_topic_, *pdata->m_readers);
+            remove_all_from_topic_index(writer_proxies_by_topic_, *pdata->m_writers);
             break;
         }
     }
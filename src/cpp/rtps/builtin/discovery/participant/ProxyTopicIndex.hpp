@@ -0,0 +1,130 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ProxyTopicIndex.hpp
+ *
+ */
+
+#ifndef FASTRTPS_RTPS_BUILTIN_DISCOVERY_PARTICIPANT_PROXYTOPICINDEX_HPP_
+#define FASTRTPS_RTPS_BUILTIN_DISCOVERY_PARTICIPANT_PROXYTOPICINDEX_HPP_
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fastrtps/utils/fixed_size_string.hpp>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Add a proxy to the collection of its topic.
+ * @param index  Proxies indexed by topic name.
+ * @param data   Proxy to add.
+ */
+template<typename ProxyData>
+void add_to_topic_index(
+        std::unordered_map<std::string, std::vector<ProxyData*>>& index,
+        ProxyData* data)
+{
+    index[data->topicName().to_string()].push_back(data);
+}
+
+/**
+ * Remove a proxy from the collection of its topic.
+ * Empty collections are kept, so references to them remain valid while matching.
+ * @param index  Proxies indexed by topic name.
+ * @param data   Proxy to remove.
+ */
+template<typename ProxyData>
+void remove_from_topic_index(
+        std::unordered_map<std::string, std::vector<ProxyData*>>& index,
+        ProxyData* data)
+{
+    auto topic_it = index.find(data->topicName().to_string());
+    if (topic_it != index.end())
+    {
+        std::vector<ProxyData*>& proxies = topic_it->second;
+        auto proxy_it = std::find(proxies.begin(), proxies.end(), data);
+        if (proxy_it != proxies.end())
+        {
+            proxies.erase(proxy_it);
+        }
+    }
+}
+
+/**
+ * Update a proxy already on the index, moving it to the collection of its new topic if the update changes it.
+ * @param index   Proxies indexed by topic name.
+ * @param data    Proxy to update.
+ * @param update  Functor called with the proxy to update it.
+ * @return The value returned by the functor.
+ */
+template<typename ProxyData, typename Functor>
+bool update_in_topic_index(
+        std::unordered_map<std::string, std::vector<ProxyData*>>& index,
+        ProxyData* data,
+        Functor update)
+{
+    remove_from_topic_index(index, data);
+    bool ret_val = update(data);
+    add_to_topic_index(index, data);
+    return ret_val;
+}
+
+/**
+ * Remove all the proxies of a participant from the index.
+ * @param index    Proxies indexed by topic name.
+ * @param proxies  Collection of pairs whose second element is a proxy of the participant.
+ */
+template<typename ProxyData, typename ProxyCollection>
+void remove_all_from_topic_index(
+        std::unordered_map<std::string, std::vector<ProxyData*>>& index,
+        const ProxyCollection& proxies)
+{
+    for (const auto& proxy : proxies)
+    {
+        remove_from_topic_index(index, proxy.second);
+    }
+}
+
+/**
+ * Get the proxies on a topic.
+ * @param index       Proxies indexed by topic name.
+ * @param topic_name  Name of the topic.
+ * @return The proxies on the topic, which is an empty collection when there are none.
+ */
+template<typename ProxyData>
+const std::vector<ProxyData*>& find_in_topic_index(
+        const std::unordered_map<std::string, std::vector<ProxyData*>>& index,
+        const string_255& topic_name)
+{
+    static const std::vector<ProxyData*> no_proxies;
+
+    auto topic_it = index.find(topic_name.to_string());
+    return (topic_it != index.end()) ? topic_it->second : no_proxies;
+}
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#endif /* FASTRTPS_RTPS_BUILTIN_DISCOVERY_PARTICIPANT_PROXYTOPICINDEX_HPP_ */
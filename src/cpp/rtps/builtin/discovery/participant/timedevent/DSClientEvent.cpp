@@ -37,7 +37,7 @@ namespace rtps {
 DSClientEvent::DSClientEvent(
         PDPClient* p_PDP,
         double interval)
-    : TimedEvent(p_PDP->getRTPSParticipant()->getEventResource(),
+    : TimedEvent(p_PDP->getRTPSParticipant()->getEventResource(fastrtps::rtps::EventThreadClass::DISCOVERY),
             [this]()
             {
                 return event();
@@ -65,7 +65,7 @@ bool DServerRoutineEvent::server_routine_event()
 DServerPingEvent::DServerPingEvent(
         PDPServer* pdp,
         double interval)
-    : TimedEvent(pdp->getRTPSParticipant()->getEventResource(),
+    : TimedEvent(pdp->getRTPSParticipant()->getEventResource(fastrtps::rtps::EventThreadClass::DISCOVERY),
             [this]()
             {
                 return server_ping_event();
@@ -200,7 +200,7 @@ bool WLP::initWL(
                 alive_count,
                 not_alive_count);
         },
-        mp_participant->getEventResource(),
+        mp_participant->getEventResource(EventThreadClass::USER_CALLBACKS),
         false);
 
     sub_liveliness_manager_ = new LivelinessManager(
@@ -217,7 +217,7 @@ bool WLP::initWL(
                 alive_count,
                 not_alive_count);
         },
-        mp_participant->getEventResource());
+        mp_participant->getEventResource(EventThreadClass::USER_CALLBACKS));
 
     bool retVal = createEndpoints();
 #if HAVE_SECURITY
@@ -629,7 +629,8 @@ bool WLP::add_local_writer(
     {
         if (automatic_liveliness_assertion_ == nullptr)
         {
-            automatic_liveliness_assertion_ = new TimedEvent(mp_participant->getEventResource(),
+            automatic_liveliness_assertion_ = new TimedEvent(
+                mp_participant->getEventResource(EventThreadClass::DISCOVERY),
                             [&]() -> bool
                             {
                                 automatic_liveliness_assertion();
@@ -656,7 +657,8 @@ bool WLP::add_local_writer(
     {
         if (manual_liveliness_assertion_ == nullptr)
         {
-            manual_liveliness_assertion_ = new TimedEvent(mp_participant->getEventResource(),
+            manual_liveliness_assertion_ = new TimedEvent(
+                mp_participant->getEventResource(EventThreadClass::DISCOVERY),
                             [&]() -> bool
                             {
                                 participant_liveliness_assertion();
@@ -31,6 +31,7 @@ namespace rtps{
 
 class ReaderLocator;
 class ReaderProxy;
+class RTPSWriter;
 
 /**
  * Flow Controllers take a vector of cache changes (by reference) and return a filtered
@@ -48,6 +49,17 @@ class FlowController
         virtual void operator()(RTPSWriterCollector<ReaderLocator*>& changesToSend) = 0;
         virtual void operator()(RTPSWriterCollector<ReaderProxy*>& changesToSend) = 0;
 
+        //! Controller operator used by a writer on its own changes. Lets the controller know who to wake up later.
+        virtual void operator()(RTPSWriterCollector<ReaderLocator*>& changesToSend, RTPSWriter*)
+        {
+            (*this)(changesToSend);
+        }
+
+        virtual void operator()(RTPSWriterCollector<ReaderProxy*>& changesToSend, RTPSWriter*)
+        {
+            (*this)(changesToSend);
+        }
+
         virtual void disable() = 0;
 
         virtual ~FlowController();
@@ -19,7 +19,10 @@
 #include <fastdds/rtps/writer/RTPSWriter.h>
 #include <asio.hpp>
 #include <asio/steady_timer.hpp>
+
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 
 
 namespace eprosima {
@@ -30,10 +33,14 @@ ThroughputController::ThroughputController(
         const ThroughputControllerDescriptor& descriptor,
         RTPSWriter* associatedWriter)
     : mBytesPerPeriod(descriptor.bytesPerPeriod)
-    , mAccumulatedPayloadSize(0)
     , mPeriodMillisecs(descriptor.periodMillisecs)
+    , mBytesPerMicrosec(static_cast<double>(descriptor.bytesPerPeriod) / (descriptor.periodMillisecs * 1000.0))
+    , mAvailableBytes(descriptor.bytesPerPeriod)
+    , mLastRefill(std::chrono::steady_clock::now())
     , mAssociatedParticipant(nullptr)
     , mAssociatedWriter(associatedWriter)
+    , mRefillTimer(*FlowController::ControllerService)
+    , mRefillScheduled(false)
 {
 }
 
@@ -41,10 +48,14 @@ ThroughputController::ThroughputController(
         const ThroughputControllerDescriptor& descriptor,
         RTPSParticipantImpl* associatedParticipant)
     : mBytesPerPeriod(descriptor.bytesPerPeriod)
-    , mAccumulatedPayloadSize(0)
     , mPeriodMillisecs(descriptor.periodMillisecs)
+    , mBytesPerMicrosec(static_cast<double>(descriptor.bytesPerPeriod) / (descriptor.periodMillisecs * 1000.0))
+    , mAvailableBytes(descriptor.bytesPerPeriod)
+    , mLastRefill(std::chrono::steady_clock::now())
     , mAssociatedParticipant(associatedParticipant)
     , mAssociatedWriter(nullptr)
+    , mRefillTimer(*FlowController::ControllerService)
+    , mRefillScheduled(false)
 {
 }
 
@@ -52,14 +63,30 @@ void ThroughputController::operator ()(
         RTPSWriterCollector<ReaderLocator*>& changesToSend)
 {
     std::unique_lock<std::recursive_mutex> scopedLock(mThroughputControllerMutex);
-    process_nts(changesToSend);
+    process_nts(changesToSend, mAssociatedWriter);
 }
 
 void ThroughputController::operator ()(
         RTPSWriterCollector<ReaderProxy*>& changesToSend)
 {
     std::unique_lock<std::recursive_mutex> scopedLock(mThroughputControllerMutex);
-    process_nts(changesToSend);
+    process_nts(changesToSend, mAssociatedWriter);
+}
+
+void ThroughputController::operator ()(
+        RTPSWriterCollector<ReaderLocator*>& changesToSend,
+        RTPSWriter* writer)
+{
+    std::unique_lock<std::recursive_mutex> scopedLock(mThroughputControllerMutex);
+    process_nts(changesToSend, writer);
+}
+
+void ThroughputController::operator ()(
+        RTPSWriterCollector<ReaderProxy*>& changesToSend,
+        RTPSWriter* writer)
+{
+    std::unique_lock<std::recursive_mutex> scopedLock(mThroughputControllerMutex);
+    process_nts(changesToSend, writer);
 }
 
 void ThroughputController::disable()
@@ -67,33 +94,51 @@ void ThroughputController::disable()
     std::unique_lock<std::recursive_mutex> scopedLock(mThroughputControllerMutex);
     mAssociatedWriter = nullptr;
     mAssociatedParticipant = nullptr;
+    mWaitingWriters.clear();
+    mRefillTimer.cancel();
+    mRefillScheduled = false;
 }
 
 template<typename Collector>
-void ThroughputController::process_nts(Collector& changesToSend)
+void ThroughputController::process_nts(
+        Collector& changesToSend,
+        RTPSWriter* writer)
 {
-    uint32_t size_to_restore = 0;
+    refill_nts();
+
     auto it = changesToSend.items().begin();
-    while (
-        it != changesToSend.items().end() &&
-        process_change_nts_(it->cacheChange, it->sequenceNumber, it->fragmentNumber, &size_to_restore))
+    while (it != changesToSend.items().end())
     {
+        uint32_t dataLength = data_length(it->cacheChange, it->fragmentNumber);
+
+        // An item larger than the maximum burst is only let through when the bucket is full, so it is not blocked
+        // forever. The resulting debt is paid by the next refills.
+        if (dataLength > mAvailableBytes && mAvailableBytes < mBytesPerPeriod)
+        {
+            break;
+        }
+
+        mAvailableBytes -= dataLength;
         ++it;
     }
 
-    changesToSend.items().erase(it, changesToSend.items().end());
-
-    if (size_to_restore > 0)
+    if (it != changesToSend.items().end())
     {
-        ScheduleRefresh(size_to_restore);
+        uint32_t bytes_needed = data_length(it->cacheChange, it->fragmentNumber);
+        changesToSend.items().erase(it, changesToSend.items().end());
+
+        if (nullptr != writer &&
+                std::find(mWaitingWriters.begin(), mWaitingWriters.end(), writer) == mWaitingWriters.end())
+        {
+            mWaitingWriters.push_back(writer);
+        }
+        schedule_refill_nts(bytes_needed);
     }
 }
 
-bool ThroughputController::process_change_nts_(
-        CacheChange_t* change,
-        const SequenceNumber_t& /*seqNum*/,
-        const FragmentNumber_t fragNum,
-        uint32_t* accumulated_size)
+uint32_t ThroughputController::data_length(
+        const CacheChange_t* change,
+        const FragmentNumber_t fragNum)
 {
     assert(change != nullptr);
 
@@ -105,50 +150,76 @@ bool ThroughputController::process_change_nts_(
                 change->getFragmentSize() : change->serializedPayload.length - (fragNum * change->getFragmentSize());
     }
 
-    if ((mAccumulatedPayloadSize + dataLength) <= mBytesPerPeriod)
+    return dataLength;
+}
+
+void ThroughputController::refill_nts()
+{
+    auto now = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(now - mLastRefill);
+    mLastRefill = now;
+
+    mAvailableBytes += elapsed.count() * mBytesPerMicrosec;
+    if (mAvailableBytes > mBytesPerPeriod)
     {
-        mAccumulatedPayloadSize += dataLength;
-        *accumulated_size += dataLength;
-        return true;
+        mAvailableBytes = mBytesPerPeriod;
     }
-
-    return false;
 }
 
-void ThroughputController::ScheduleRefresh(
-        uint32_t sizeToRestore)
+void ThroughputController::schedule_refill_nts(
+        uint32_t bytesNeeded)
 {
-    std::shared_ptr<asio::steady_timer> throwawayTimer(std::make_shared<asio::steady_timer>(
-                *FlowController::ControllerService));
-    auto refresh = [throwawayTimer, this, sizeToRestore]
-                (const asio::error_code& error)
+    if (mRefillScheduled)
+    {
+        return;
+    }
+
+    // Larger items are let through once the bucket is full
+    double target = bytesNeeded < mBytesPerPeriod ? bytesNeeded : mBytesPerPeriod;
+    double missing = target - mAvailableBytes;
+    auto wait_time = std::chrono::microseconds(static_cast<int64_t>(std::ceil(missing / mBytesPerMicrosec)));
+
+    mRefillScheduled = true;
+    mRefillTimer.expires_from_now(wait_time);
+    mRefillTimer.async_wait([this](const asio::error_code& error)
             {
                 if ((error != asio::error::operation_aborted) &&
-                        FlowController::IsListening(this))
+                FlowController::IsListening(this))
                 {
-                    std::unique_lock<std::recursive_mutex> scopedLock(mThroughputControllerMutex);
-                    throwawayTimer->cancel();
-                    mAccumulatedPayloadSize = sizeToRestore > mAccumulatedPayloadSize ?
-                        0 : mAccumulatedPayloadSize - sizeToRestore;
-
-                    if (mAssociatedWriter)
-                    {
-                        mAssociatedWriter->getRTPSParticipant()->async_thread().wake_up(mAssociatedWriter);
-                    }
-                    else if (mAssociatedParticipant)
-                    {
-                        std::unique_lock<std::recursive_mutex> lock(*mAssociatedParticipant->getParticipantMutex());
-                        for (auto it = mAssociatedParticipant->userWritersListBegin();
-                                it != mAssociatedParticipant->userWritersListEnd(); ++it)
-                        {
-                            mAssociatedParticipant->async_thread().wake_up(*it);
-                        }
-                    }
+                    on_refill_timer();
                 }
-            };
+            });
+}
+
+void ThroughputController::on_refill_timer()
+{
+    std::unique_lock<std::recursive_mutex> scopedLock(mThroughputControllerMutex);
+    mRefillScheduled = false;
+
+    if (mWaitingWriters.empty())
+    {
+        return;
+    }
+
+    if (mAssociatedWriter)
+    {
+        mAssociatedWriter->getRTPSParticipant()->async_thread().wake_up(mAssociatedWriter);
+    }
+    else if (mAssociatedParticipant)
+    {
+        // Waiting writers are looked up on the participant, as they may have been removed in the meantime.
+        std::unique_lock<std::recursive_mutex> lock(*mAssociatedParticipant->getParticipantMutex());
+        for (auto it = mAssociatedParticipant->userWritersListBegin();
+                it != mAssociatedParticipant->userWritersListEnd(); ++it)
+        {
+            if (std::find(mWaitingWriters.begin(), mWaitingWriters.end(), *it) != mWaitingWriters.end())
+            {
+                mAssociatedParticipant->async_thread().wake_up(*it);
+            }
+        }
+    }
 
-    throwawayTimer->expires_from_now(std::chrono::milliseconds(mPeriodMillisecs));
-    throwawayTimer->async_wait(refresh);
+    mWaitingWriters.clear();
 }
 
 } // namespace rtps
@@ -18,7 +18,11 @@
 #include <rtps/flowcontrol/FlowController.h>
 #include <fastdds/rtps/flowcontrol/ThroughputControllerDescriptor.h>
 
+#include <asio/steady_timer.hpp>
+
+#include <chrono>
 #include <thread>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
@@ -28,10 +32,10 @@ class RTPSWriter;
 class RTPSParticipantImpl;
 
 /**
- * Simple filter that only clears changes up to a certain accumulated payload size.
- * It refreshes after a given time in MS, in a staggered way (e.g. if it clears
- * 500kb at t=0 and 800 kb at t=10, it will refresh 500kb at t = 0 + period, and
- * then fully refresh at t = 10 + period).
+ * Token bucket filter that only clears changes while there is enough credit for them.
+ * Credit is refilled continuously at a rate of bytesPerPeriod every periodMillisecs, up to a maximum burst of
+ * bytesPerPeriod bytes. When a writer runs out of credit, it is woken up again as soon as enough credit has been
+ * refilled for it to continue sending. Only the writers waiting for credit are woken up.
  */
 class ThroughputController : public FlowController
 {
@@ -48,34 +52,55 @@ public:
             RTPSWriterCollector<ReaderLocator*>& changesToSend) override;
     virtual void operator ()(
             RTPSWriterCollector<ReaderProxy*>& changesToSend) override;
+    virtual void operator ()(
+            RTPSWriterCollector<ReaderLocator*>& changesToSend,
+            RTPSWriter* writer) override;
+    virtual void operator ()(
+            RTPSWriterCollector<ReaderProxy*>& changesToSend,
+            RTPSWriter* writer) override;
 
     virtual void disable() override;
 
 private:
 
     template<typename Collector>
-    void process_nts(Collector& changesToSend);
+    void process_nts(
+            Collector& changesToSend,
+            RTPSWriter* writer);
+
+    //! Returns the number of bytes an item of a collector will put on the wire.
+    static uint32_t data_length(
+            const CacheChange_t* change,
+            const FragmentNumber_t fragNum);
+
+    //! Adds the credit accumulated since the last refill.
+    void refill_nts();
 
-    bool process_change_nts_(
-            CacheChange_t* change,
-            const SequenceNumber_t& seqNum,
-            const FragmentNumber_t fragNum,
-            uint32_t* accumulated_size);
+    /*
+     * Schedules the waiting writers to be woken up when there is enough credit to send "bytesNeeded" bytes.
+     */
+    void schedule_refill_nts(
+            uint32_t bytesNeeded);
+
+    //! Wakes up the writers waiting for credit.
+    void on_refill_timer();
 
     uint32_t mBytesPerPeriod;
-    uint32_t mAccumulatedPayloadSize;
     uint32_t mPeriodMillisecs;
+    //! Credit refilled per microsecond.
+    double mBytesPerMicrosec;
+    //! Credit available. May be negative after sending an item larger than the maximum burst.
+    double mAvailableBytes;
+    std::chrono::steady_clock::time_point mLastRefill;
     std::recursive_mutex mThroughputControllerMutex;
 
     RTPSParticipantImpl* mAssociatedParticipant;
     RTPSWriter* mAssociatedWriter;
 
-    /*
-     * Schedules the filter to be refreshed in period ms. When it does, its capacity
-     * will be partially restored, by "sizeToRestore" bytes.
-     */
-    void ScheduleRefresh(
-            uint32_t sizeToRestore);
+    //! Writers that ran out of credit.
+    std::vector<RTPSWriter*> mWaitingWriters;
+    asio::steady_timer mRefillTimer;
+    bool mRefillScheduled;
 };
 
 } // namespace rtps
@@ -20,6 +20,7 @@
 #include <fastdds/rtps/messages/MessageReceiver.h>
 
 #include <cassert>
+#include <cstring>
 #include <limits>
 #include <mutex>
 
@@ -27,9 +28,13 @@
 #include <fastdds/dds/log/Log.hpp>
 
 #include <fastdds/rtps/reader/RTPSReader.h>
+#include <fastdds/rtps/transport/TransportReceiverInterface.h>
 #include <fastdds/rtps/writer/RTPSWriter.h>
 
 #include <rtps/participant/RTPSParticipantImpl.h>
+#if HAVE_SECURITY
+#include <rtps/security/CryptoWorkerPool.h>
+#endif // if HAVE_SECURITY
 #include <statistics/rtps/StatisticsBase.hpp>
 #include <statistics/rtps/messages/RTPSStatisticsMessages.hpp>
 
@@ -317,6 +322,83 @@ void MessageReceiver::processCDRMsg(
         const Locator_t& reception_locator,
         CDRMessage_t* msg)
 {
+    process_message(source_locator, reception_locator, msg, nullptr, 1);
+}
+
+void MessageReceiver::processCDRMsgBatch(
+        const fastdds::rtps::ReceivedDatagram* datagrams,
+        size_t count,
+        const Locator_t& reception_locator)
+{
+    auto wrap_datagram = [](const fastdds::rtps::ReceivedDatagram& datagram, CDRMessage_t& msg)
+            {
+                msg.wraps = true;
+                msg.buffer = const_cast<octet*>(datagram.data);
+                msg.length = datagram.size;
+                msg.max_size = datagram.size;
+                msg.reserved_size = datagram.size;
+            };
+
+#if HAVE_SECURITY
+    security::CryptoWorkerPool* workers =
+            participant_->is_secure() ? participant_->security_manager().crypto_workers() : nullptr;
+    if (nullptr != workers && 1u < count)
+    {
+        while (crypto_batch_msgs_.size() < count)
+        {
+            crypto_batch_msgs_.emplace_back(new CDRMessage_t(crypto_msg_.max_size));
+        }
+        crypto_batch_results_.assign(count, 1);
+
+        security::SecurityManager& security = participant_->security_manager();
+        workers->run(count, [&](size_t i)
+                {
+                    const fastdds::rtps::ReceivedDatagram& datagram = datagrams[i];
+                    // Messages without a valid header are left to be rejected when processed
+                    if (datagram.size <= RTPSMESSAGE_HEADER_SIZE || 0 != memcmp(datagram.data, "RTPS", 4))
+                    {
+                        return;
+                    }
+
+                    CDRMessage_t msg(0);
+                    wrap_datagram(datagram, msg);
+                    msg.pos = RTPSMESSAGE_HEADER_SIZE;
+                    GuidPrefix_t source_guid_prefix;
+                    memcpy(source_guid_prefix.value, &datagram.data[8], GuidPrefix_t::size);
+                    crypto_batch_results_[i] =
+                            security.decode_rtps_message(msg, *crypto_batch_msgs_[i], source_guid_prefix);
+                });
+
+        // Messages are processed in the order they were received
+        for (size_t i = 0; i < count; ++i)
+        {
+            CDRMessage_t msg(0);
+            wrap_datagram(datagrams[i], msg);
+            process_message(datagrams[i].remote_locator, reception_locator, &msg, crypto_batch_msgs_[i].get(),
+                    crypto_batch_results_[i]);
+        }
+        return;
+    }
+#endif // if HAVE_SECURITY
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        CDRMessage_t msg(0);
+        wrap_datagram(datagrams[i], msg);
+        processCDRMsg(datagrams[i].remote_locator, reception_locator, &msg);
+    }
+}
+
+void MessageReceiver::process_message(
+        const Locator_t& source_locator,
+        const Locator_t& reception_locator,
+        CDRMessage_t* msg,
+        CDRMessage_t* decoded_msg,
+        int decode_ret)
+{
+    (void)decoded_msg;
+    (void)decode_ret;
+
     if (msg->length < RTPSMESSAGE_HEADER_SIZE)
     {
         logWarning(RTPS_MSG_IN, IDSTRING "Received message too short, ignoring");
@@ -346,7 +428,11 @@ void MessageReceiver::processCDRMsg(
     security::SecurityManager& security = participant_->security_manager();
     CDRMessage_t* auxiliary_buffer = &crypto_msg_;
 
-    int decode_ret = security.decode_rtps_message(*msg, *auxiliary_buffer, source_guid_prefix_);
+    if (nullptr == decoded_msg)
+    {
+        decoded_msg = auxiliary_buffer;
+        decode_ret = security.decode_rtps_message(*msg, *decoded_msg, source_guid_prefix_);
+    }
 
     if (decode_ret < 0)
     {
@@ -355,10 +441,11 @@ void MessageReceiver::processCDRMsg(
 
     if (decode_ret == 0)
     {
-        // The original CDRMessage buffer (msg) now points to the proprietary temporary buffer crypto_msg_.
+        // The original CDRMessage buffer (msg) now points to the buffer where it was decoded (crypto_msg_ or one of
+        // crypto_batch_msgs_).
         // The auxiliary buffer now points to the propietary temporary buffer crypto_submsg_.
         // This way each decoded sub-message will be processed using the crypto_submsg_ buffer.
-        msg = auxiliary_buffer;
+        msg = decoded_msg;
         auxiliary_buffer = &crypto_submsg_;
     }
 #endif // if HAVE_SECURITY
@@ -760,7 +847,7 @@ bool MessageReceiver::proc_Submsg_Data(
 
     if (inlineQosFlag)
     {
-        if (!ParameterList::updateCacheChangeFromInlineQos(ch, msg, inlineQosSize))
+        if (!ParameterList::updateCacheChangeFromInlineQos(ch, msg, source_vendor_id_, inlineQosSize))
         {
             logInfo(RTPS_MSG_IN, IDSTRING "SubMessage Data ERROR, Inline Qos ParameterList error");
             return false;
@@ -934,7 +1021,7 @@ bool MessageReceiver::proc_Submsg_DataFrag(
 
     if (inlineQosFlag)
     {
-        if (!ParameterList::updateCacheChangeFromInlineQos(ch, msg, inlineQosSize))
+        if (!ParameterList::updateCacheChangeFromInlineQos(ch, msg, source_vendor_id_, inlineQosSize))
         {
             logInfo(RTPS_MSG_IN, IDSTRING "SubMessage Data ERROR, Inline Qos ParameterList error");
             return false;
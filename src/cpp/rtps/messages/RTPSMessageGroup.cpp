@@ -51,6 +51,9 @@ static bool append_message(
 #endif // FASTDDS_STATISTICS
 }
 
+// Room for the header, fixed fields and inline QoS of a DATA or DATA_FRAG submessage
+static constexpr uint32_t loaned_submessage_overhead = 256;
+
 bool sort_changes_group (
         CacheChange_t* c1,
         CacheChange_t* c2)
@@ -240,6 +243,79 @@ void RTPSMessageGroup::send()
     }
 }
 
+template<typename SubmessageFunctor>
+bool RTPSMessageGroup::send_on_loaned_buffer(
+        uint32_t payload_length,
+        const SubmessageFunctor& add_submessage)
+{
+    // Checked first, as loaning is disabled unless the shared memory transport asks for it
+    uint32_t min_size = participant_->loaned_send_buffer_min_size();
+    if (0 == min_size)
+    {
+        return false;
+    }
+
+#if HAVE_SECURITY
+    // Protected messages and submessages are built on the encryption buffer
+    if ((participant_->security_attributes().is_rtps_protected && endpoint_->supports_rtps_protection()) ||
+            endpoint_->getAttributes().security_attributes().is_payload_protected ||
+            endpoint_->getAttributes().security_attributes().is_submessage_protected)
+    {
+        return false;
+    }
+#endif // if HAVE_SECURITY
+
+    uint32_t statistics_length = 0;
+#ifdef FASTDDS_STATISTICS
+    statistics_length = eprosima::fastdds::statistics::rtps::statistics_submessage_length;
+#endif // FASTDDS_STATISTICS
+
+    // Other transports also send the message, so it cannot be bigger than the send buffers
+    uint32_t size = full_msg_->length + submessage_msg_->length + payload_length + loaned_submessage_overhead +
+            statistics_length;
+    size = (std::min)(size, full_msg_->max_size);
+    if (size < min_size)
+    {
+        return false;
+    }
+
+    octet* buffer = participant_->loan_send_buffer(size);
+    if (nullptr == buffer)
+    {
+        return false;
+    }
+
+    CDRMessage_t msg(0u);
+    msg.init(buffer, size);
+
+    // Keep room for the statistics submessage
+    msg.max_size -= statistics_length;
+    bool built = CDRMessage::appendMsg(&msg, full_msg_) && CDRMessage::appendMsg(&msg, submessage_msg_) &&
+            add_submessage(&msg);
+    msg.max_size += statistics_length;
+
+    if (!built)
+    {
+        participant_->return_loaned_send_buffer(buffer);
+        return false;
+    }
+
+    // The pending submessages are sent on this message
+    reset_to_header();
+
+    eprosima::fastdds::statistics::rtps::add_statistics_submessage(&msg);
+
+    bool sent = sender_.send(&msg, max_blocking_time_point_);
+    participant_->return_loaned_send_buffer(buffer);
+    if (!sent)
+    {
+        throw timeout();
+    }
+    currentBytesSent_ += msg.length;
+
+    return true;
+}
+
 void RTPSMessageGroup::flush_and_reset()
 {
     // Flush
@@ -381,6 +457,17 @@ bool RTPSMessageGroup::add_data(
     change_to_add.serializedPayload.data = change.serializedPayload.data;
     change_to_add.serializedPayload.length = change.serializedPayload.length;
 
+    if (send_on_loaned_buffer(change_to_add.serializedPayload.length, [&](CDRMessage_t* msg)
+            {
+                bool is_big_submessage;
+                return RTPSMessageCreator::addSubmessageData(msg, &change_to_add,
+                endpoint_->getAttributes().topicKind, readerId, expectsInlineQos, inlineQos, &is_big_submessage);
+            }))
+    {
+        change_to_add.serializedPayload.data = nullptr;
+        return true;
+    }
+
 #if HAVE_SECURITY
     if (endpoint_->getAttributes().security_attributes().is_payload_protected)
     {
@@ -479,6 +566,17 @@ bool RTPSMessageGroup::add_data_frag(
     change_to_add.serializedPayload.data = change.serializedPayload.data + fragment_start;
     change_to_add.serializedPayload.length = fragment_size;
 
+    if (send_on_loaned_buffer(fragment_size, [&](CDRMessage_t* msg)
+            {
+                return RTPSMessageCreator::addSubmessageDataFrag(msg, &change, fragment_number,
+                change_to_add.serializedPayload, endpoint_->getAttributes().topicKind, readerId,
+                expectsInlineQos, inlineQos);
+            }))
+    {
+        change_to_add.serializedPayload.data = nullptr;
+        return true;
+    }
+
 #if HAVE_SECURITY
     if (endpoint_->getAttributes().security_attributes().is_payload_protected)
     {
@@ -99,7 +99,8 @@ bool RTPSMessageCreator::addSubmessageData(
         }
     }
     // Maybe the inline QoS because a WriteParam.
-    else if (change->write_params.related_sample_identity() != SampleIdentity::unknown())
+    else if (change->write_params.related_sample_identity() != SampleIdentity::unknown() ||
+            change->write_params.coherent_set() != SequenceNumber_t::unknown())
     {
         inlineQosFlag = true;
         flags = flags | BIT(1);
@@ -159,6 +160,17 @@ bool RTPSMessageCreator::addSubmessageData(
                     change->write_params.related_sample_identity());
         }
 
+        if (change->write_params.coherent_set() != SequenceNumber_t::unknown())
+        {
+            fastdds::dds::ParameterSerializer<Parameter_t>::add_parameter_coherent_set(msg,
+                    change->write_params.coherent_set());
+
+            if (change->write_params.coherent_set_end())
+            {
+                fastdds::dds::ParameterSerializer<Parameter_t>::add_parameter_coherent_set_end(msg);
+            }
+        }
+
         if (topicKind == WITH_KEY)
         {
             //cout << "ADDDING PARAMETER KEY " << endl;
@@ -329,7 +341,8 @@ bool RTPSMessageCreator::addSubmessageDataFrag(
         }
     }
     // Maybe the inline QoS because a WriteParam.
-    else if (change->write_params.related_sample_identity() != SampleIdentity::unknown())
+    else if (change->write_params.related_sample_identity() != SampleIdentity::unknown() ||
+            change->write_params.coherent_set() != SequenceNumber_t::unknown())
     {
         inlineQosFlag = true;
         flags = flags | BIT(1);
@@ -400,6 +413,17 @@ bool RTPSMessageCreator::addSubmessageDataFrag(
                     change->write_params.related_sample_identity());
         }
 
+        if (change->write_params.coherent_set() != SequenceNumber_t::unknown())
+        {
+            fastdds::dds::ParameterSerializer<Parameter_t>::add_parameter_coherent_set(msg,
+                    change->write_params.coherent_set());
+
+            if (change->write_params.coherent_set_end())
+            {
+                fastdds::dds::ParameterSerializer<Parameter_t>::add_parameter_coherent_set_end(msg);
+            }
+        }
+
         if (topicKind == WITH_KEY)
         {
             fastdds::dds::ParameterSerializer<Parameter_t>::add_parameter_key(msg, change->instanceHandle);
@@ -357,6 +357,15 @@ void NetworkFactory::Shutdown()
     }
 }
 
+void NetworkFactory::for_each_transport(
+        const std::function<void(fastdds::rtps::TransportInterface&)>& function)
+{
+    for (auto& transport : mRegisteredTransports)
+    {
+        function(*transport);
+    }
+}
+
 uint16_t NetworkFactory::calculate_well_known_port(
         uint32_t domain_id,
         const RTPSParticipantAttributes& att,
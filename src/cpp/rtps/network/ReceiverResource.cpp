@@ -123,6 +123,20 @@ void ReceiverResource::OnDataReceived(
 
 }
 
+void ReceiverResource::OnDataBatchReceived(
+        const fastdds::rtps::ReceivedDatagram* datagrams,
+        size_t count,
+        const Locator_t& localLocator)
+{
+    std::unique_lock<std::mutex> lock(mtx);
+    MessageReceiver* rcv = receiver;
+
+    if (rcv != nullptr)
+    {
+        rcv->processCDRMsgBatch(datagrams, count, localLocator);
+    }
+}
+
 void ReceiverResource::disable()
 {
     if (Cleanup)
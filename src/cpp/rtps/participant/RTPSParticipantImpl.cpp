@@ -21,8 +21,11 @@
 
 #include <algorithm>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <mutex>
+#include <stdexcept>
+#include <string>
 
 #include <rtps/flowcontrol/ThroughputController.h>
 #include <rtps/persistence/PersistenceService.h>
@@ -57,6 +60,10 @@
 #include <fastdds/rtps/transport/TCPv4TransportDescriptor.h>
 #include <fastdds/rtps/transport/TCPv6TransportDescriptor.h>
 #include <fastdds/rtps/transport/shared_mem/SharedMemTransportDescriptor.h>
+#ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+#include <rtps/transport/shared_mem/SharedMemTransport.h>
+#endif // ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+#include <rtps/DataSharing/DataSharingDispatcher.hpp>
 
 #include <fastdds/rtps/builtin/BuiltinProtocols.h>
 #include <fastdds/rtps/builtin/discovery/participant/PDPSimple.h>
@@ -113,6 +120,119 @@ static bool get_unique_flows_parameters(
     return true;
 }
 
+static uint32_t get_async_writer_threads(
+        const RTPSParticipantAttributes& part_att)
+{
+    const std::string* value = PropertyPolicyHelper::find_property(part_att.properties,
+                    "fastdds.async_writer_threads");
+
+    if (nullptr != value)
+    {
+        try
+        {
+            unsigned long num_threads = std::stoul(*value);
+            if (0 < num_threads && num_threads <= 64)
+            {
+                return static_cast<uint32_t>(num_threads);
+            }
+        }
+        catch (const std::exception&)
+        {
+        }
+
+        logWarning(RTPS_PARTICIPANT, "Invalid value '" << *value << "' for property fastdds.async_writer_threads. "
+                "A single asynchronous sending thread will be used");
+    }
+
+    return 1;
+}
+
+static uint32_t get_event_threads(
+        const RTPSParticipantAttributes& part_att,
+        const char* property_name,
+        uint32_t num_threads)
+{
+    const std::string* value = PropertyPolicyHelper::find_property(part_att.properties, property_name);
+
+    if (nullptr != value)
+    {
+        try
+        {
+            unsigned long value_threads = std::stoul(*value);
+            if (value_threads <= 64)
+            {
+                return static_cast<uint32_t>(value_threads);
+            }
+        }
+        catch (const std::exception&)
+        {
+        }
+
+        logWarning(RTPS_PARTICIPANT, "Invalid value '" << *value << "' for property " << property_name << ". "
+                "Using " << num_threads << " dedicated event threads");
+    }
+
+    return num_threads;
+}
+
+static EventThreadAttributes get_event_thread_attributes(
+        const RTPSParticipantAttributes& part_att)
+{
+    EventThreadAttributes att = part_att.event_threads;
+    att.reliability_threads = get_event_threads(part_att, "fastdds.event_threads.reliability",
+                    att.reliability_threads);
+    att.discovery_threads = get_event_threads(part_att, "fastdds.event_threads.discovery",
+                    att.discovery_threads);
+    att.user_callback_threads = get_event_threads(part_att, "fastdds.event_threads.user_callbacks",
+                    att.user_callback_threads);
+    return att;
+}
+
+template<typename T>
+static void get_numeric_property(
+        const RTPSParticipantAttributes& part_att,
+        const char* property_name,
+        T& value)
+{
+    const std::string* property = PropertyPolicyHelper::find_property(part_att.properties, property_name);
+
+    if (nullptr != property)
+    {
+        try
+        {
+            long long property_value = std::stoll(*property);
+            if (property_value >= (std::numeric_limits<T>::min)() && property_value <= (std::numeric_limits<T>::max)())
+            {
+                value = static_cast<T>(property_value);
+                return;
+            }
+        }
+        catch (const std::exception&)
+        {
+        }
+
+        logWarning(RTPS_PARTICIPANT, "Invalid value '" << *property << "' for property " << property_name << ". "
+                "Using " << value);
+    }
+}
+
+static BusyPollAttributes get_busy_poll_attributes(
+        const RTPSParticipantAttributes& part_att)
+{
+    BusyPollAttributes att = part_att.busy_poll;
+
+    const std::string* enabled = PropertyPolicyHelper::find_property(part_att.properties, "fastdds.busy_poll");
+    if (nullptr != enabled)
+    {
+        att.enabled = (0 == enabled->compare("true") || 0 == enabled->compare("1"));
+    }
+
+    get_numeric_property(part_att, "fastdds.busy_poll.cpu", att.cpu);
+    get_numeric_property(part_att, "fastdds.busy_poll.spin_rounds", att.spin_rounds);
+    get_numeric_property(part_att, "fastdds.busy_poll.max_backoff_us", att.max_backoff_us);
+    return att;
+}
+
 Locator_t& RTPSParticipantImpl::applyLocatorAdaptRule(
         Locator_t& loc)
 {
@@ -132,9 +252,11 @@ RTPSParticipantImpl::RTPSParticipantImpl(
     : domain_id_(domain_id)
     , m_att(PParam)
     , m_guid(guidP, c_EntityId_RTPSParticipant)
+    , mp_event_thr(get_event_thread_attributes(PParam))
     , mp_builtinProtocols(nullptr)
     , mp_ResourceSemaphore(new Semaphore(0))
     , IdCounter(0)
+    , async_thread_(get_async_writer_threads(PParam))
     , type_check_fn_(nullptr)
 #if HAVE_SECURITY
     , m_security_manager(this)
@@ -225,8 +347,51 @@ RTPSParticipantImpl::RTPSParticipantImpl(
         }
     }
 
+#ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+    // Shared memory transport where messages can be built without being copied to its segment
+    m_network_Factory.for_each_transport([this](fastdds::rtps::TransportInterface& transport)
+            {
+                fastdds::rtps::SharedMemTransport* shm_transport =
+                dynamic_cast<fastdds::rtps::SharedMemTransport*>(&transport);
+                if (nullptr != shm_transport && nullptr == loaning_transport_ &&
+                0 != shm_transport->zero_copy_min_size())
+                {
+                    loaning_transport_ = shm_transport;
+                    loaned_send_buffer_min_size_ = shm_transport->zero_copy_min_size();
+                }
+            });
+#endif // ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+
+    // Busy-poll receive mode
+    BusyPollAttributes busy_poll_att = get_busy_poll_attributes(PParam);
+    if (busy_poll_att.enabled)
+    {
+        busy_poller_.reset(new BusyPoller(busy_poll_att));
+#ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+        m_network_Factory.for_each_transport([this](fastdds::rtps::TransportInterface& transport)
+                {
+                    fastdds::rtps::SharedMemTransport* shm_transport =
+                    dynamic_cast<fastdds::rtps::SharedMemTransport*>(&transport);
+                    if (nullptr != shm_transport)
+                    {
+                        shm_transport->busy_poller(busy_poller_.get());
+                    }
+                });
+#endif // ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+    }
+    else
+    {
+        // Data-sharing dispatcher, not used when the readers are busy-polled
+        uint32_t dispatcher_threads = PParam.data_sharing_dispatcher_threads;
+        get_numeric_property(PParam, "fastdds.datasharing.dispatcher_threads", dispatcher_threads);
+        if (0 < dispatcher_threads)
+        {
+            datasharing_dispatcher_.reset(new DataSharingDispatcher(m_guid.guidPrefix, dispatcher_threads));
+        }
+    }
+
     mp_userParticipant->mp_impl = this;
-    mp_event_thr.init_thread();
+    mp_event_thr.init_threads();
 
     if (!networkFactoryHasRegisteredTransports())
     {
@@ -434,6 +599,11 @@ void RTPSParticipantImpl::enable()
 
 void RTPSParticipantImpl::disable()
 {
+#ifdef FASTDDS_STATISTICS
+    // The timer publishing the latency summaries runs on the event resources of the participant
+    stop_latency_summaries();
+#endif // FASTDDS_STATISTICS
+
     // Ensure that other participants will not accidentally discover this one
     if (mp_builtinProtocols && mp_builtinProtocols->mp_PDP)
     {
@@ -1096,9 +1266,10 @@ bool RTPSParticipantImpl::registerWriter(
 bool RTPSParticipantImpl::registerReader(
         RTPSReader* reader,
         const TopicAttributes& topicAtt,
-        const ReaderQos& rqos)
+        const ReaderQos& rqos,
+        const fastdds::rtps::ContentFilterProperty* content_filter)
 {
-    return this->mp_builtinProtocols->addLocalReader(reader, topicAtt, rqos);
+    return this->mp_builtinProtocols->addLocalReader(reader, topicAtt, rqos, content_filter);
 }
 
 bool RTPSParticipantImpl::updateLocalWriter(
@@ -1112,9 +1283,10 @@ bool RTPSParticipantImpl::updateLocalWriter(
 bool RTPSParticipantImpl::updateLocalReader(
         RTPSReader* reader,
         const TopicAttributes& topicAtt,
-        const ReaderQos& rqos)
+        const ReaderQos& rqos,
+        const fastdds::rtps::ContentFilterProperty* content_filter)
 {
-    return this->mp_builtinProtocols->updateLocalReader(reader, topicAtt, rqos);
+    return this->mp_builtinProtocols->updateLocalReader(reader, topicAtt, rqos, content_filter);
 }
 
 /*
@@ -1814,6 +1986,34 @@ void RTPSParticipantImpl::return_send_buffer(
     send_buffers_->return_buffer(std::move(buffer));
 }
 
+octet* RTPSParticipantImpl::loan_send_buffer(
+        uint32_t size)
+{
+#ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+    if (nullptr != loaning_transport_)
+    {
+        return loaning_transport_->loan_buffer(size);
+    }
+#else
+    (void)size;
+#endif // ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+
+    return nullptr;
+}
+
+void RTPSParticipantImpl::return_loaned_send_buffer(
+        const octet* buffer)
+{
+#ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+    if (nullptr != loaning_transport_)
+    {
+        loaning_transport_->return_loan(buffer);
+    }
+#else
+    (void)buffer;
+#endif // ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+}
+
 uint32_t RTPSParticipantImpl::get_domain_id() const
 {
     return domain_id_;
@@ -53,6 +53,8 @@
 
 #include <fastdds/rtps/resources/ResourceEvent.h>
 #include <fastdds/rtps/resources/AsyncWriterThread.h>
+#include <rtps/resources/BusyPoller.hpp>
+#include <rtps/resources/ResourceEventPool.hpp>
 
 #include <statistics/rtps/StatisticsBase.hpp>
 
@@ -72,6 +74,12 @@ class TypeLookupManager;
 
 } // namespace builtin
 } // namespace dds
+
+namespace rtps {
+
+class SharedMemTransport;
+
+} // namespace rtps
 } // namespace fastdds
 
 namespace fastrtps {
@@ -99,6 +107,7 @@ class PDPSimple;
 class FlowController;
 class IPersistenceService;
 class WLP;
+class DataSharingDispatcher;
 
 /**
  * @brief Class RTPSParticipantImpl, it contains the private implementation of the RTPSParticipant functions and
@@ -250,7 +259,36 @@ public:
     //!Get Pointer to the Event Resource.
     ResourceEvent& getEventResource()
     {
-        return mp_event_thr;
+        return mp_event_thr.general();
+    }
+
+    /**
+     * Get the Event Resource on which a new event of a class should run.
+     * @param event_class Class of the event.
+     * @return One of the event threads dedicated to the class, or the general one.
+     */
+    ResourceEvent& getEventResource(
+            EventThreadClass event_class)
+    {
+        return mp_event_thr.get(event_class);
+    }
+
+    /**
+     * Get the thread polling the shared memory ports and data-sharing readers of this participant.
+     * @return nullptr when the busy-poll receive mode is disabled.
+     */
+    BusyPoller* busy_poller() const
+    {
+        return busy_poller_.get();
+    }
+
+    /**
+     * Get the threads processing the data-sharing notifications of the readers of this participant.
+     * @return nullptr when each reader has its own listening thread.
+     */
+    DataSharingDispatcher* datasharing_dispatcher() const
+    {
+        return datasharing_dispatcher_.get();
     }
 
     /**
@@ -484,6 +522,31 @@ public:
     void return_send_buffer(
             std::unique_ptr <RTPSMessageGroup_t>&& buffer);
 
+    /**
+     * Minimum size of the messages that may be built on a buffer loaned by the shared memory transport.
+     * @return 0 when there is no shared memory transport or it does not loan buffers.
+     */
+    uint32_t loaned_send_buffer_min_size() const
+    {
+        return loaned_send_buffer_min_size_;
+    }
+
+    /**
+     * Loan a buffer from the segment of the shared memory transport, so a message built on it is not copied
+     * when sent through that transport.
+     * @param size Maximum size of the message.
+     * @return nullptr if no buffer could be loaned.
+     */
+    octet* loan_send_buffer(
+            uint32_t size);
+
+    /**
+     * Give back a buffer obtained from loan_send_buffer, once its message has been sent.
+     * @param buffer Address returned by loan_send_buffer.
+     */
+    void return_loaned_send_buffer(
+            const octet* buffer);
+
     uint32_t get_domain_id() const;
 
     //!Compare metatraffic locators list searching for mutations
@@ -503,8 +566,12 @@ private:
     GUID_t m_persistence_guid;
     //! Sending resources. - DEPRECATED -Stays commented for reference purposes
     // ResourceSend* mp_send_thr;
-    //! Event Resource
-    ResourceEvent mp_event_thr;
+    //! Event Resources
+    ResourceEventPool mp_event_thr;
+    //! Busy-poll receive thread. It should outlive the transports.
+    std::unique_ptr<BusyPoller> busy_poller_;
+    //! Data-sharing dispatcher threads. They should outlive the readers.
+    std::unique_ptr<DataSharingDispatcher> datasharing_dispatcher_;
     //! BuiltinProtocols of this RTPSParticipant
     BuiltinProtocols* mp_builtinProtocols;
     //!Semaphore to wait for the listen thread creation.
@@ -522,13 +589,19 @@ private:
     std::vector<RTPSReader*> m_userReaderList;
     //!Network Factory
     NetworkFactory m_network_Factory;
-    //!Async writer thread
+    //!Async writer threads
     AsyncWriterThread async_thread_;
     //! Type cheking function
     std::function<bool(const std::string&)> type_check_fn_;
     //!Pool of send buffers
     std::unique_ptr<SendBuffersManager> send_buffers_;
 
+    //! Shared memory transport loaning send buffers, nullptr when none does.
+    fastdds::rtps::SharedMemTransport* loaning_transport_ = nullptr;
+
+    //! Minimum size of the messages built on loaned buffers.
+    uint32_t loaned_send_buffer_min_size_ = 0;
+
 #if HAVE_SECURITY
     // Security manager
     security::SecurityManager m_security_manager;
@@ -806,7 +879,8 @@ public:
     bool registerReader(
             RTPSReader* Reader,
             const TopicAttributes& topicAtt,
-            const ReaderQos& rqos);
+            const ReaderQos& rqos,
+            const fastdds::rtps::ContentFilterProperty* content_filter = nullptr);
 
     /**
      * Update local writer QoS
@@ -828,7 +902,8 @@ public:
     bool updateLocalReader(
             RTPSReader* Reader,
             const TopicAttributes& topicAtt,
-            const ReaderQos& rqos);
+            const ReaderQos& rqos,
+            const fastdds::rtps::ContentFilterProperty* content_filter = nullptr);
 
     /**
      * Get the participant attributes
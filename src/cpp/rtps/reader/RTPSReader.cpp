@@ -131,7 +131,9 @@ void RTPSReader::init(
                         notification,
                         att.endpoint.data_sharing_configuration().shm_directory(),
                         att.matched_writers_allocation,
-                        this));
+                        this,
+                        mp_RTPSParticipant->busy_poller(),
+                        mp_RTPSParticipant->datasharing_dispatcher()));
 
             // We can start the listener here, as no writer can be matched already,
             // so no notification will occur until the non-virtual instance is constructed.
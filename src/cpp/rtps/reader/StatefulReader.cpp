@@ -749,7 +749,7 @@ bool StatefulReader::change_removed_by_history(
         {
             if (a_change->is_fully_assembled())
             {
-                if (!a_change->isRead && wp->available_changes_max() >= a_change->sequenceNumber)
+                if (!a_change->isRead && wp->visible_changes_max() >= a_change->sequenceNumber)
                 {
                     if (0 < total_unread_)
                     {
@@ -850,6 +850,7 @@ bool StatefulReader::change_received(
 
         if (a_change->is_fully_assembled())
         {
+            prox->coherent_set_update(*a_change);
             ret = prox->received_change_set(a_change->sequenceNumber);
         }
 
@@ -869,7 +870,8 @@ void StatefulReader::NotifyChanges(
         WriterProxy* prox)
 {
     GUID_t proxGUID = prox->guid();
-    update_last_notified(proxGUID, prox->available_changes_max());
+    update_last_notified(proxGUID, prox->visible_changes_max());
+    bool coherent_changes_notified = false;
     SequenceNumber_t nextChangeToNotify = prox->next_cache_change_to_be_notified();
     while (nextChangeToNotify != SequenceNumber_t::unknown())
     {
@@ -883,6 +885,9 @@ void StatefulReader::NotifyChanges(
 
                 on_data_notify(ch_to_give->writerGUID, ch_to_give->sourceTimestamp);
 
+                // The listener could remove the change
+                coherent_changes_notified |= ch_to_give->write_params.coherent_set() != SequenceNumber_t::unknown();
+
                 if (getListener() != nullptr)
                 {
                     getListener()->onNewCacheChangeAdded((RTPSReader*)this, ch_to_give);
@@ -900,6 +905,13 @@ void StatefulReader::NotifyChanges(
 
         nextChangeToNotify = prox->next_cache_change_to_be_notified();
     }
+
+    // The WriterProxy only makes the changes of a coherent set visible once all of them are available, so they
+    // have all been notified on this call.
+    if (coherent_changes_notified && getListener() != nullptr)
+    {
+        getListener()->on_coherent_set_visible(this);
+    }
 }
 
 void StatefulReader::remove_changes_from(
@@ -950,7 +962,7 @@ bool StatefulReader::nextUntakenCache(
         {
             // TODO Revisar la comprobacion
             SequenceNumber_t seq;
-            seq = wp->available_changes_max();
+            seq = wp->visible_changes_max();
             if (seq < (*it)->sequenceNumber)
             {
                 ++it;
@@ -1009,7 +1021,7 @@ bool StatefulReader::nextUnreadCache(
         if (matched_writer_lookup((*it)->writerGUID, &wp))
         {
             SequenceNumber_t seq;
-            seq = wp->available_changes_max();
+            seq = wp->visible_changes_max();
             if (seq < (*it)->sequenceNumber)
             {
                 ++it;
@@ -1093,7 +1105,7 @@ bool StatefulReader::begin_sample_access_nts(
     }
 
     SequenceNumber_t seq;
-    seq = wp->available_changes_max();
+    seq = wp->visible_changes_max();
     if (seq < change->sequenceNumber)
     {
         is_future_change = true;
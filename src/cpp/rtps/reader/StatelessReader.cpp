@@ -254,8 +254,16 @@ bool StatelessReader::change_received(
 
             if (getListener() != nullptr)
             {
+                // Coherent sets are not held by stateless readers, so each change is visible on its own
+                bool is_coherent = change->write_params.coherent_set() != SequenceNumber_t::unknown();
+
                 // WARNING! This method could destroy the change
                 getListener()->onNewCacheChangeAdded(this, change);
+
+                if (is_coherent)
+                {
+                    getListener()->on_coherent_set_visible(this);
+                }
             }
 
             new_notification_cv_.notify_all();
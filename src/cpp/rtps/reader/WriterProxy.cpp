@@ -31,7 +31,7 @@
 #include <rtps/participant/RTPSParticipantImpl.h>
 
 #include "rtps/RTPSDomainImpl.hpp"
-#include "utils/collections/node_size_helpers.hpp"
+#include "utils/collections/word_bitmap.hpp"
 
 #if !defined(NDEBUG) && defined(FASTRTPS_SOURCE) && defined(__linux__)
 #define SHOULD_DEBUG_LINUX
@@ -65,7 +65,10 @@ WriterProxy::~WriterProxy()
     delete(heartbeat_response_);
 }
 
-using set_helper = utilities::collections::set_size_helper<SequenceNumber_t>;
+using utilities::collections::bit_mask;
+using utilities::collections::bits_at;
+using utilities::collections::count_bits;
+using utilities::collections::first_bit_set;
 
 WriterProxy::WriterProxy(
         StatefulReader* reader,
@@ -77,10 +80,6 @@ WriterProxy::WriterProxy(
     , last_heartbeat_count_(0)
     , heartbeat_final_flag_(false)
     , is_alive_(false)
-    , changes_pool_(
-        set_helper::node_size,
-        set_helper::min_pool_size<pool_allocator_t>(changes_allocation.initial))
-    , changes_received_(changes_pool_)
     , guid_as_vector_(ResourceLimitedContainerConfig::fixed_size_configuration(1u))
     , guid_prefix_as_vector_(ResourceLimitedContainerConfig::fixed_size_configuration(1u))
     , is_on_same_process_(false)
@@ -90,7 +89,7 @@ WriterProxy::WriterProxy(
     , is_datasharing_writer_(false)
 {
     //Create Events
-    ResourceEvent& event_manager = reader_->getRTPSParticipant()->getEventResource();
+    ResourceEvent& event_manager = reader_->getRTPSParticipant()->getEventResource(EventThreadClass::RELIABILITY);
     auto heartbeat_lambda = [this]() -> bool
             {
                 perform_heartbeat_response();
@@ -105,6 +104,11 @@ WriterProxy::WriterProxy(
     heartbeat_response_ = new TimedEvent(event_manager, heartbeat_lambda, 0);
     initial_acknack_ = new TimedEvent(event_manager, acknack_lambda, 0);
 
+    // The bitmap always covers the range of an ACKNACK. Changes further ahead, like those of a corrupt packet, are
+    // kept apart, so they do not make the bitmap span the whole gap.
+    max_received_words_ = (std::max)(static_cast<size_t>(32u), (changes_allocation.initial + 31u) / 32u + 1u);
+    changes_received_.reserve(max_received_words_);
+
     clear();
     logInfo(RTPS_READER, "Writer Proxy created in reader: " << reader_->getGuid().entityId);
 }
@@ -175,6 +179,9 @@ void WriterProxy::clear()
     guid_as_vector_.clear();
     guid_prefix_as_vector_.clear();
     changes_received_.clear();
+    changes_received_base_ = SequenceNumber_t();
+    changes_received_beyond_.clear();
+    coherent_sets_.clear();
     is_on_same_process_ = false;
     loaded_from_storage(SequenceNumber_t());
 }
@@ -218,11 +225,7 @@ void WriterProxy::lost_changes_update(
     // Check was not removed from container.
     if (seq_num > changes_from_writer_low_mark_)
     {
-        // Remove all received changes with a sequence lower than seq_num
-        ChangeIterator it = std::lower_bound(changes_received_.begin(), changes_received_.end(), seq_num);
-        changes_received_.erase(changes_received_.begin(), it);
-
-        // Update low mark
+        // Update low mark. Received changes below it are discarded by cleanup.
         changes_from_writer_low_mark_ = seq_num - 1;
         if (changes_from_writer_low_mark_ > max_sequence_number_)
         {
@@ -273,9 +276,10 @@ bool WriterProxy::received_change_set(
         }
         else
         {
-            changes_received_.insert(changes_received_.end(), seq_num);
+            set_received(seq_num);
         }
         max_sequence_number_ = seq_num;
+        trim_received();
     }
     else
     {
@@ -288,12 +292,12 @@ bool WriterProxy::received_change_set(
         else
         {
             // Check if already received
-            if (changes_received_.find(seq_num) != changes_received_.end())
+            if (is_received(seq_num))
             {
                 return false;
             }
 
-            changes_received_.insert(seq_num);
+            set_received(seq_num);
         }
     }
 
@@ -310,20 +314,17 @@ SequenceNumberSet_t WriterProxy::missing_changes() const
     SequenceNumber_t max_missing = std::min(first_missing + 256UL, max_sequence_number_ + 1);
     SequenceNumberSet_t sns(first_missing);
 
-    for (SequenceNumber_t seq : changes_received_)
+    if (first_missing < max_missing)
     {
-        seq = std::min(seq, max_missing);
-        sns.add_range(first_missing, seq);
-        first_missing = seq + 1;
-        if (first_missing >= max_missing)
+        // The missing changes are the complement of the received bitmap
+        uint32_t num_bits = (max_missing - first_missing).low;
+        uint32_t num_longs = (num_bits + 31u) / 32u;
+        SequenceNumberSet_t::bitmap_type bitmap;
+        for (uint32_t i = 0; i < num_longs; ++i)
         {
-            break;
+            bitmap[i] = ~received_bits(first_missing + 32u * i);
         }
-    }
-
-    if (first_missing < max_missing)
-    {
-        sns.add_range(first_missing, max_missing);
+        sns.bitmap_set(num_bits, bitmap.data());
     }
 
     return sns;
@@ -341,8 +342,7 @@ bool WriterProxy::change_was_received(
         return true;
     }
 
-    ChangeIterator chit = changes_received_.find(seq_num);
-    return chit != changes_received_.end();
+    return is_received(seq_num);
 }
 
 const SequenceNumber_t WriterProxy::available_changes_max() const
@@ -354,6 +354,86 @@ const SequenceNumber_t WriterProxy::available_changes_max() const
     return changes_from_writer_low_mark_;
 }
 
+const SequenceNumber_t WriterProxy::visible_changes_max() const
+{
+#ifdef SHOULD_DEBUG_LINUX
+    assert(get_mutex_owner() == get_thread_id());
+#endif // SHOULD_DEBUG_LINUX
+
+    for (const CoherentSet& coherent_set : coherent_sets_)
+    {
+        if (coherent_set.first > changes_from_writer_low_mark_)
+        {
+            break;
+        }
+
+        if (coherent_set.last == SequenceNumber_t::unknown() || coherent_set.last > changes_from_writer_low_mark_)
+        {
+            // Hold the incomplete set
+            return coherent_set.first - 1;
+        }
+    }
+
+    return changes_from_writer_low_mark_;
+}
+
+void WriterProxy::coherent_set_update(
+        const CacheChange_t& change)
+{
+#ifdef SHOULD_DEBUG_LINUX
+    assert(get_mutex_owner() == get_thread_id());
+#endif // SHOULD_DEBUG_LINUX
+
+    const SequenceNumber_t& seq_num = change.sequenceNumber;
+    const SequenceNumber_t& set_first = change.write_params.coherent_set();
+
+    // Forget the sets already completed
+    auto completed = coherent_sets_.begin();
+    while (completed != coherent_sets_.end() && completed->last != SequenceNumber_t::unknown() &&
+            completed->last <= changes_from_writer_low_mark_)
+    {
+        ++completed;
+    }
+    coherent_sets_.erase(coherent_sets_.begin(), completed);
+
+    // A change after the beginning of a set, but not belonging to it, bounds the end of that set
+    SequenceNumber_t bound = (set_first == SequenceNumber_t::unknown()) ? seq_num : set_first;
+    for (CoherentSet& coherent_set : coherent_sets_)
+    {
+        if (coherent_set.first < bound && coherent_set.first != set_first &&
+                (coherent_set.last == SequenceNumber_t::unknown() || coherent_set.last >= bound))
+        {
+            coherent_set.last = bound - 1;
+        }
+    }
+
+    if (set_first == SequenceNumber_t::unknown() || set_first > seq_num)
+    {
+        return;
+    }
+
+    auto it = coherent_sets_.begin();
+    while (it != coherent_sets_.end() && it->first < set_first)
+    {
+        ++it;
+    }
+
+    if (it == coherent_sets_.end() || it->first != set_first)
+    {
+        if (set_first <= last_notified_)
+        {
+            // Beginning of the set already notified. Do not hold the rest of it.
+            return;
+        }
+        it = coherent_sets_.insert(it, CoherentSet{set_first, SequenceNumber_t::unknown()});
+    }
+
+    if (change.write_params.coherent_set_end())
+    {
+        it->last = seq_num;
+    }
+}
+
 void WriterProxy::change_removed_from_history(
         const SequenceNumber_t& seq_num)
 {
@@ -367,12 +447,8 @@ void WriterProxy::change_removed_from_history(
         return;
     }
 
-    ChangeIterator chit = changes_received_.find(seq_num);
-
-    (void)chit;
-
     // Element must be in the container. In other case, bug.
-    assert(chit != changes_received_.end());
+    assert(is_received(seq_num));
 
     // Previously, it was asserted that the change couldn't be the first and should have RECEIVED
     // status. As we only keep received changes now, status is already checked by the previous assert.
@@ -396,17 +472,154 @@ void WriterProxy::change_removed_from_history(
 
 void WriterProxy::cleanup()
 {
-    ChangeIterator chit = changes_received_.begin();
+    // Moving the low mark may bring changes received far ahead into the bitmap, so it is checked again then
+    do
+    {
+        // Jump over all consecutive received changes starting on the next to low_mark
+        uint32_t bits = received_bits(changes_from_writer_low_mark_ + 1);
+        while (0xFFFFFFFFu == bits)
+        {
+            changes_from_writer_low_mark_ = changes_from_writer_low_mark_ + 32u;
+            bits = received_bits(changes_from_writer_low_mark_ + 1);
+        }
+        changes_from_writer_low_mark_ = changes_from_writer_low_mark_ + first_bit_set(~bits);
+
+        // Remove all those changes
+    } while (trim_received());
+}
 
-    // Jump over all consecutive received changes starting on the next to low_mark
-    while (chit != changes_received_.end() && *chit == changes_from_writer_low_mark_ + 1)
+bool WriterProxy::is_received(
+        const SequenceNumber_t& seq_num) const
+{
+    if (seq_num < changes_received_base_)
     {
-        chit++;
-        changes_from_writer_low_mark_++;
+        return false;
     }
 
-    // Remove all those changes
-    changes_received_.erase(changes_received_.begin(), chit);
+    uint64_t position = (seq_num - changes_received_base_).to64long();
+    if (position / 32u < changes_received_.size())
+    {
+        return 0u != (changes_received_[static_cast<size_t>(position / 32u)] & bit_mask(static_cast<size_t>(position)));
+    }
+
+    return !changes_received_beyond_.empty() && changes_received_beyond_.count(seq_num) > 0u;
+}
+
+void WriterProxy::set_received(
+        const SequenceNumber_t& seq_num)
+{
+    SequenceNumber_t first_word_base((changes_from_writer_low_mark_ + 1).to64long() & ~static_cast<uint64_t>(31u));
+    if ((seq_num - first_word_base).to64long() / 32u >= max_received_words_)
+    {
+        changes_received_beyond_.insert(seq_num);
+        return;
+    }
+
+    SequenceNumber_t word_base(seq_num.to64long() & ~static_cast<uint64_t>(31u));
+    if (changes_received_.empty())
+    {
+        changes_received_base_ = word_base;
+    }
+    else if (seq_num < changes_received_base_)
+    {
+        size_t num_words = static_cast<size_t>((changes_received_base_ - word_base).to64long() / 32u);
+        changes_received_.insert(changes_received_.begin(), num_words, 0u);
+        changes_received_base_ = word_base;
+    }
+
+    size_t position = static_cast<size_t>((seq_num - changes_received_base_).to64long());
+    if (position / 32u >= changes_received_.size())
+    {
+        changes_received_.resize(position / 32u + 1u, 0u);
+    }
+    changes_received_[position / 32u] |= bit_mask(position);
+}
+
+uint32_t WriterProxy::received_bits(
+        const SequenceNumber_t& first) const
+{
+    return bits_at(changes_received_,
+                   static_cast<int64_t>(first.to64long()) - static_cast<int64_t>(changes_received_base_.to64long()));
+}
+
+uint32_t WriterProxy::count_missing(
+        const SequenceNumber_t& first,
+        const SequenceNumber_t& last) const
+{
+    uint32_t missing = 0;
+    SequenceNumber_t bitmap_end = changes_received_base_ + static_cast<uint32_t>(32u * changes_received_.size());
+    SequenceNumber_t seq = first;
+
+    // Only the range covered by the bitmap needs to be checked
+    while (seq < last && seq < bitmap_end)
+    {
+        uint32_t bits = ~received_bits(seq);
+        uint64_t remaining = (last - seq).to64long();
+        if (remaining < 32u)
+        {
+            bits &= ~(0xFFFFFFFFu >> remaining);
+        }
+        missing += count_bits(bits);
+        seq = seq + 32u;
+    }
+
+    if (seq < last)
+    {
+        SequenceNumberDiff d_fun;
+        missing += d_fun(last, seq);
+
+        // The changes received far ahead are after the end of the bitmap, where everything was counted as missing
+        if (!changes_received_beyond_.empty())
+        {
+            missing -= static_cast<uint32_t>(std::distance(changes_received_beyond_.lower_bound(first),
+                    changes_received_beyond_.lower_bound(last)));
+        }
+    }
+
+    return missing;
+}
+
+bool WriterProxy::trim_received()
+{
+    // Nothing is kept when there are no missing changes
+    if (changes_from_writer_low_mark_ >= max_sequence_number_)
+    {
+        changes_received_.clear();
+        changes_received_beyond_.clear();
+        return false;
+    }
+
+    SequenceNumber_t first = changes_from_writer_low_mark_ + 1;
+    if (!changes_received_.empty() && changes_received_base_ <= first)
+    {
+        size_t num_words = static_cast<size_t>(
+            std::min<uint64_t>((first - changes_received_base_).to64long() / 32u, changes_received_.size()));
+        if (0u < num_words)
+        {
+            changes_received_.erase(changes_received_.begin(), changes_received_.begin() + num_words);
+            changes_received_base_ = changes_received_base_ + static_cast<uint32_t>(32u * num_words);
+        }
+    }
+
+    if (changes_received_beyond_.empty())
+    {
+        return false;
+    }
+
+    // Forget the changes below the low mark, and move to the bitmap those which now fit on it
+    changes_received_beyond_.erase(changes_received_beyond_.begin(), changes_received_beyond_.lower_bound(first));
+    SequenceNumber_t first_word_base(first.to64long() & ~static_cast<uint64_t>(31u));
+    SequenceNumber_t bitmap_limit = first_word_base + static_cast<uint32_t>(32u * max_received_words_);
+    bool moved = false;
+    while (!changes_received_beyond_.empty() && *changes_received_beyond_.begin() < bitmap_limit)
+    {
+        SequenceNumber_t seq_num = *changes_received_beyond_.begin();
+        changes_received_beyond_.erase(changes_received_beyond_.begin());
+        set_received(seq_num);
+        moved = true;
+    }
+
+    return moved;
 }
 
 bool WriterProxy::are_there_missing_changes() const
@@ -431,26 +644,10 @@ size_t WriterProxy::unknown_missing_changes_up_to(
     {
         SequenceNumber_t first_missing = changes_from_writer_low_mark_ + 1;
         SequenceNumber_t max_missing = std::min(seq_num, max_sequence_number_ + 1);
-        SequenceNumberSet_t sns(first_missing);
-        SequenceNumberDiff d_fun;
-
-        for (SequenceNumber_t seq : changes_received_)
-        {
-            seq = std::min(seq, max_missing);
-            if (first_missing < seq)
-            {
-                returnedValue += d_fun(seq, first_missing);
-            }
-            first_missing = seq + 1;
-            if (first_missing >= max_missing)
-            {
-                break;
-            }
-        }
 
         if (first_missing < max_missing)
         {
-            returnedValue += d_fun(max_missing, first_missing);
+            returnedValue = count_missing(first_missing, max_missing);
         }
     }
 
@@ -478,7 +675,7 @@ SequenceNumber_t WriterProxy::next_cache_change_to_be_notified()
     assert(get_mutex_owner() == get_thread_id());
 #endif // SHOULD_DEBUG_LINUX
 
-    if (last_notified_ < changes_from_writer_low_mark_)
+    if (last_notified_ < visible_changes_max())
     {
         ++last_notified_;
         return last_notified_;
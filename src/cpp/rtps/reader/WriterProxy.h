@@ -30,10 +30,8 @@
 #include <fastdds/rtps/builtin/data/WriterProxyData.h>
 #include <fastdds/rtps/common/LocatorSelectorEntry.hpp>
 
-#include <foonathan/memory/container.hpp>
-#include <foonathan/memory/memory_pool.hpp>
-
 #include <set>
+#include <vector>
 
 // Testing purpose
 #ifndef TEST_FRIENDS
@@ -109,6 +107,21 @@ public:
      */
     const SequenceNumber_t available_changes_max() const;
 
+    /**
+     * Get the maximum sequenceNumber that can be made visible to the user.
+     * It is the same as available_changes_max(), except when a coherent set is being received. In that case, the
+     * changes of the set are held until all of them have been received.
+     * @return the maximum sequence number that can be notified.
+     */
+    const SequenceNumber_t visible_changes_max() const;
+
+    /**
+     * Update the state of the coherent sets being received with a newly received change.
+     * @param change The change received. Should be fully assembled.
+     */
+    void coherent_set_update(
+            const CacheChange_t& change);
+
     /**
      * Update the missing changes up to the provided sequenceNumber.
      * All changes with status UNKNOWN with seq_num <= input seq_num are marked MISSING.
@@ -354,6 +367,34 @@ private:
 
     void clear();
 
+    bool is_received(
+            const SequenceNumber_t& seq_num) const;
+
+    void set_received(
+            const SequenceNumber_t& seq_num);
+
+    /**
+     * Get the received state of 32 consecutive sequence numbers.
+     * @param first First sequence number, which will be on the most significant bit.
+     */
+    uint32_t received_bits(
+            const SequenceNumber_t& first) const;
+
+    /**
+     * Count the sequence numbers not received on a range.
+     * Only valid for ranges above changes_from_writer_low_mark_.
+     */
+    uint32_t count_missing(
+            const SequenceNumber_t& first,
+            const SequenceNumber_t& last) const;
+
+    /**
+     * Remove the words of changes_received_ below changes_from_writer_low_mark_, and move into it the changes
+     * of changes_received_beyond_ which now fit on it.
+     * @return true when some change was moved into changes_received_.
+     */
+    bool trim_received();
+
     //! Pointer to associated StatefulReader.
     StatefulReader* reader_;
     //!Timed event to postpone the heartbeatResponse.
@@ -367,13 +408,14 @@ private:
     //!Is the writer alive
     bool is_alive_;
 
-    using pool_allocator_t =
-            foonathan::memory::memory_pool<foonathan::memory::node_pool, foonathan::memory::heap_allocator>;
-
-    //! Memory pool allocator for changes_received_
-    pool_allocator_t changes_pool_;
-    //! Vector containing the sequence number of the received ChangeFromWriter_t objects.
-    foonathan::memory::set<SequenceNumber_t, pool_allocator_t> changes_received_;
+    //! Sequence number of the first position of changes_received_. Always a multiple of 32.
+    SequenceNumber_t changes_received_base_;
+    //! Bitmap of the changes received above changes_from_writer_low_mark_, with the layout of SequenceNumberSet_t.
+    std::vector<uint32_t> changes_received_;
+    //! Maximum number of words of changes_received_, counted from the word following changes_from_writer_low_mark_.
+    size_t max_received_words_;
+    //! Changes received too far ahead of changes_from_writer_low_mark_ to be kept on changes_received_.
+    std::set<SequenceNumber_t> changes_received_beyond_;
     //! Sequence number of the highest available change
     SequenceNumber_t changes_from_writer_low_mark_;
     //! Highest sequence number informed by writer
@@ -397,7 +439,15 @@ private:
     //! Is the writer datasharing
     bool is_datasharing_writer_;
 
-    using ChangeIterator = decltype(changes_received_)::iterator;
+    //! Range of sequence numbers of a coherent set. last is unknown until the end of the set is detected.
+    struct CoherentSet
+    {
+        SequenceNumber_t first;
+        SequenceNumber_t last;
+    };
+
+    //! Coherent sets not yet completely received, ordered by their first sequence number.
+    std::vector<CoherentSet> coherent_sets_;
 
 #if !defined(NDEBUG) && defined(FASTRTPS_SOURCE) && defined(__linux__)
     int get_mutex_owner() const;
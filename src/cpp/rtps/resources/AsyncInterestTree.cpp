@@ -44,7 +44,8 @@ bool AsyncInterestTree::register_interest(
 bool AsyncInterestTree::register_interest_nts(
         RTPSWriter* writer)
 {
-    RTPSWriter *curr = hidden_front_, *prev = nullptr;
+    // Queue is kept sorted by descending priority. Writers with the same priority are served in arrival order.
+    RTPSWriter *curr = hidden_front_, *insert_after = nullptr;
 
     while (curr)
     {
@@ -53,17 +54,22 @@ bool AsyncInterestTree::register_interest_nts(
             return false;
         }
 
-        prev = curr;
+        if (curr->async_priority_ >= writer->async_priority_)
+        {
+            insert_after = curr;
+        }
         curr = curr->next_[hidden_pos_];
     }
 
-    if (!prev)
+    if (!insert_after)
     {
+        writer->next_[hidden_pos_] = hidden_front_;
         hidden_front_ = writer;
     }
     else
     {
-        prev->next_[hidden_pos_] = writer;
+        writer->next_[hidden_pos_] = insert_after->next_[hidden_pos_];
+        insert_after->next_[hidden_pos_] = writer;
     }
 
     return true;
@@ -17,24 +17,78 @@
 
 #include <mutex>
 #include <algorithm>
+#include <functional>
 #include <cassert>
 #include <stdexcept>
 
 using namespace eprosima::fastrtps::rtps;
 
+AsyncWriterThread::AsyncWriterThread(
+        uint32_t num_threads)
+{
+    if (num_threads < 1)
+    {
+        num_threads = 1;
+    }
+
+    shards_.reserve(num_threads);
+    for (uint32_t i = 0; i < num_threads; ++i)
+    {
+        shards_.emplace_back(new Shard());
+    }
+}
+
 AsyncWriterThread::~AsyncWriterThread()
 {
-    std::unique_lock<RecursiveTimedMutex> lock(condition_variable_mutex_);
-    running_ = false;
-    run_scheduled_ = false;
-    cv_.notify_all();
-    if (thread_)
+    for (std::unique_ptr<Shard>& shard : shards_)
+    {
+        stop(*shard);
+    }
+}
+
+AsyncWriterThread::Shard& AsyncWriterThread::shard_for(
+        const RTPSWriter* writer)
+{
+    if (shards_.size() == 1)
+    {
+        return *shards_.front();
+    }
+
+    // User entities get consecutive keys, so this spreads the writers of a participant evenly among the threads.
+    size_t index = std::hash<EntityId_t>()(writer->getGuid().entityId) % shards_.size();
+    return *shards_[index];
+}
+
+void AsyncWriterThread::schedule_nts(
+        Shard& shard)
+{
+    shard.run_scheduled_ = true;
+    // If thread not running, start it.
+    if (shard.thread_ == nullptr)
+    {
+        shard.running_ = true;
+        shard.thread_ = new std::thread(&AsyncWriterThread::run, this, std::ref(shard));
+    }
+    else
+    {
+        shard.cv_.notify_all();
+    }
+}
+
+void AsyncWriterThread::stop(
+        Shard& shard)
+{
+    std::unique_lock<RecursiveTimedMutex> lock(shard.condition_variable_mutex_);
+    shard.running_ = false;
+    shard.run_scheduled_ = false;
+    shard.cv_.notify_all();
+    if (shard.thread_)
     {
         lock.unlock();
-        thread_->join();
+        shard.thread_->join();
         lock.lock();
-        delete thread_;
-        thread_ = nullptr;
+        delete shard.thread_;
+        shard.thread_ = nullptr;
     }
 }
 
@@ -43,42 +97,24 @@ AsyncWriterThread::~AsyncWriterThread()
  * @param writer Asynchronous writer to be removed.
  * @return Result of the operation.
  */
-void AsyncWriterThread::unregister_writer(RTPSWriter* writer)
+void AsyncWriterThread::unregister_writer(
+        RTPSWriter* writer)
 {
-    if(interestTree_.unregister_interest(writer))
+    Shard& shard = shard_for(writer);
+    if (shard.interestTree_.unregister_interest(writer))
     {
-        std::unique_lock<RecursiveTimedMutex> lock(condition_variable_mutex_);
-        running_ = false;
-        run_scheduled_ = false;
-        cv_.notify_all();
-        if (thread_)
-        {
-            lock.unlock();
-            thread_->join();
-            lock.lock();
-            delete thread_;
-            thread_ = nullptr;
-        }
+        stop(shard);
     }
 }
 
 void AsyncWriterThread::wake_up(
         RTPSWriter* interested_writer)
 {
-    if (interestTree_.register_interest(interested_writer))
+    Shard& shard = shard_for(interested_writer);
+    if (shard.interestTree_.register_interest(interested_writer))
     {
-        std::unique_lock<RecursiveTimedMutex> lock(condition_variable_mutex_);
-        run_scheduled_ = true;
-        // If thread not running, start it.
-        if (thread_ == nullptr)
-        {
-            running_ = true;
-            thread_ = new std::thread(&AsyncWriterThread::run, this);
-        }
-        else
-        {
-            cv_.notify_all();
-        }
+        std::unique_lock<RecursiveTimedMutex> lock(shard.condition_variable_mutex_);
+        schedule_nts(shard);
     }
 }
 
@@ -86,53 +122,45 @@ void AsyncWriterThread::wake_up(
         RTPSWriter* interested_writer,
         const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
 {
-    if (interestTree_.register_interest(interested_writer, max_blocking_time))
+    Shard& shard = shard_for(interested_writer);
+    if (shard.interestTree_.register_interest(interested_writer, max_blocking_time))
     {
-        std::unique_lock<RecursiveTimedMutex> lock(condition_variable_mutex_, std::defer_lock);
+        std::unique_lock<RecursiveTimedMutex> lock(shard.condition_variable_mutex_, std::defer_lock);
 
         if (lock.try_lock_until(max_blocking_time))
         {
-            run_scheduled_ = true;
-            // If thread not running, start it.
-            if (thread_ == nullptr)
-            {
-                running_ = true;
-                thread_ = new std::thread(&AsyncWriterThread::run, this);
-            }
-            else
-            {
-                cv_.notify_all();
-            }
+            schedule_nts(shard);
         }
     }
 }
 
-void AsyncWriterThread::run()
+void AsyncWriterThread::run(
+        Shard& shard)
 {
-    std::unique_lock<RecursiveTimedMutex> cond_guard(condition_variable_mutex_);
-    while(running_)
+    std::unique_lock<RecursiveTimedMutex> cond_guard(shard.condition_variable_mutex_);
+    while (shard.running_)
     {
-        if(run_scheduled_)
+        if (shard.run_scheduled_)
         {
-            run_scheduled_ = false;
+            shard.run_scheduled_ = false;
             cond_guard.unlock();
-            interestTree_.swap();
+            shard.interestTree_.swap();
 
-            interestTree_.mMutexActive.lock();
-            RTPSWriter* curr = interestTree_.next_active_nts();
+            shard.interestTree_.mMutexActive.lock();
+            RTPSWriter* curr = shard.interestTree_.next_active_nts();
 
             while (curr)
             {
                 curr->send_any_unsent_changes();
-                curr = interestTree_.next_active_nts();
+                curr = shard.interestTree_.next_active_nts();
             }
-            interestTree_.mMutexActive.unlock();
+            shard.interestTree_.mMutexActive.unlock();
 
             cond_guard.lock();
         }
         else
         {
-            cv_.wait(cond_guard);
+            shard.cv_.wait(cond_guard);
         }
     }
 }
@@ -0,0 +1,166 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BusyPoller.hpp
+ */
+
+#ifndef _RTPS_RESOURCES_BUSYPOLLER_HPP_
+#define _RTPS_RESOURCES_BUSYPOLLER_HPP_
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+
+#include <rtps/resources/PolledSourceList.hpp>
+#include <utils/shared_memory/SharedMemFutex.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif // ifdef __linux__
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Thread polling several receive sources, used instead of one blocking thread per source.
+ * When no source has data for BusyPollAttributes::spin_rounds consecutive rounds, the thread backs off by
+ * yielding the CPU or, if BusyPollAttributes::max_backoff_us is not 0, by sleeping an exponentially growing time.
+ * @ingroup MANAGEMENT_MODULE
+ */
+class BusyPoller
+{
+public:
+
+    //! Something the poller checks for new data.
+    using Source = PolledSourceList::Source;
+
+    explicit BusyPoller(
+            const BusyPollAttributes& att)
+        : att_(att)
+    {
+        running_ = true;
+        thread_ = std::thread(&BusyPoller::run, this);
+    }
+
+    ~BusyPoller()
+    {
+        running_ = false;
+        thread_.join();
+    }
+
+    BusyPoller(
+            const BusyPoller&) = delete;
+
+    BusyPoller& operator =(
+            const BusyPoller&) = delete;
+
+    /**
+     * Start polling a source.
+     * @param source Source to add. It should not be destroyed before being removed.
+     */
+    void add_source(
+            Source* source)
+    {
+        sources_.add(source);
+    }
+
+    /**
+     * Stop polling a source.
+     * When called from other thread than the polling one, it waits until the source is not being polled.
+     * @param source Source to remove.
+     */
+    void remove_source(
+            Source* source)
+    {
+        sources_.remove(source, std::this_thread::get_id() != thread_.get_id());
+    }
+
+private:
+
+    void run()
+    {
+        pin_thread();
+
+        uint32_t empty_rounds = 0;
+        uint32_t backoff_us = 1;
+
+        while (running_.load(std::memory_order_relaxed))
+        {
+            if (sources_.poll_round())
+            {
+                empty_rounds = 0;
+                backoff_us = 1;
+            }
+            else if (empty_rounds < att_.spin_rounds)
+            {
+                ++empty_rounds;
+                fastdds::rtps::SharedMemFutex::cpu_relax();
+            }
+            else if (0 == att_.max_backoff_us)
+            {
+                std::this_thread::yield();
+            }
+            else
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(backoff_us));
+                backoff_us = (std::min)(backoff_us * 2, att_.max_backoff_us);
+            }
+        }
+    }
+
+    void pin_thread()
+    {
+        if (att_.cpu < 0)
+        {
+            return;
+        }
+
+#ifdef __linux__
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        if (att_.cpu < CPU_SETSIZE)
+        {
+            CPU_SET(att_.cpu, &cpu_set);
+        }
+        if (att_.cpu >= CPU_SETSIZE || 0 != pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set))
+        {
+            logWarning(RTPS_PARTICIPANT, "Could not pin the busy-poll thread to CPU " << att_.cpu);
+        }
+#else
+        logWarning(RTPS_PARTICIPANT, "Pinning the busy-poll thread is only supported on Linux");
+#endif // ifdef __linux__
+    }
+
+    BusyPollAttributes att_;
+
+    std::atomic<bool> running_{false};
+
+    std::thread thread_;
+
+    PolledSourceList sources_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _RTPS_RESOURCES_BUSYPOLLER_HPP_
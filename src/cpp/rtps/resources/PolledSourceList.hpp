@@ -0,0 +1,192 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PolledSourceList.hpp
+ */
+
+#ifndef _RTPS_RESOURCES_POLLEDSOURCELIST_HPP_
+#define _RTPS_RESOURCES_POLLEDSOURCELIST_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * List of sources polled in rounds by a single thread, while other threads add and remove sources.
+ * The polling thread only takes the mutex when the list has changed since its previous round.
+ */
+class PolledSourceList
+{
+public:
+
+    //! Something the polling thread checks for new data.
+    class Source
+    {
+    public:
+
+        virtual ~Source() = default;
+
+        /**
+         * Process the data available, without blocking.
+         * @return true if some data was processed.
+         */
+        virtual bool poll() = 0;
+    };
+
+    PolledSourceList()
+        : sources_(std::make_shared<const SourceVector>())
+    {
+    }
+
+    PolledSourceList(
+            const PolledSourceList&) = delete;
+
+    PolledSourceList& operator =(
+            const PolledSourceList&) = delete;
+
+    /**
+     * Start polling a source.
+     * @param source Source to add. It should not be destroyed before being removed.
+     */
+    void add(
+            Source* source)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        std::shared_ptr<SourceVector> sources = std::make_shared<SourceVector>(*sources_);
+        sources->push_back(source);
+        sources_ = sources;
+        ++generation_;
+    }
+
+    /**
+     * Stop polling a source.
+     * @param source Source to remove.
+     * @param wait_round Whether to wait until the source is not being polled. It should be false when called
+     * from the polling thread.
+     * @return false if the source was not on the list.
+     */
+    bool remove(
+            Source* source,
+            bool wait_round)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto it = std::find(sources_->begin(), sources_->end(), source);
+        if (it == sources_->end())
+        {
+            return false;
+        }
+
+        std::shared_ptr<SourceVector> sources = std::make_shared<SourceVector>(*sources_);
+        sources->erase(sources->begin() + (it - sources_->begin()));
+        sources_ = sources;
+        ++generation_;
+        lock.unlock();
+
+        // Rounds started from now on use the new list, so wait for the one in progress
+        if (wait_round)
+        {
+            uint64_t round = started_rounds_.load();
+            while (finished_rounds_.load() < round)
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        return true;
+    }
+
+    bool empty() const
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return sources_->empty();
+    }
+
+    size_t size() const
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return sources_->size();
+    }
+
+    /**
+     * Poll all the sources once. It should always be called from the same thread.
+     * @return true if some source had data.
+     */
+    bool poll_round()
+    {
+        // The round is started before checking the generation, so remove either
+        // waits for this round or this round sees the new list
+        uint64_t round = started_rounds_.fetch_add(1) + 1;
+        if (polled_generation_ != generation_.load())
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            polled_sources_ = sources_;
+            polled_generation_ = generation_.load();
+        }
+
+        bool has_data = false;
+        for (Source* source : *polled_sources_)
+        {
+            if (polled_generation_ != generation_.load())
+            {
+                // A source may have been removed from its own poll call
+                has_data = true;
+                break;
+            }
+
+            has_data |= source->poll();
+        }
+
+        finished_rounds_.store(round);
+        return has_data;
+    }
+
+private:
+
+    using SourceVector = std::vector<Source*>;
+
+    //! Protects the list of sources.
+    mutable std::mutex mutex_;
+
+    //! Sources being polled. It is replaced on every change, so the polling thread can keep using its copy.
+    std::shared_ptr<const SourceVector> sources_;
+
+    //! Incremented on every change of sources_.
+    std::atomic<uint64_t> generation_{0};
+
+    std::atomic<uint64_t> started_rounds_{0};
+
+    std::atomic<uint64_t> finished_rounds_{0};
+
+    //! Copy of sources_ used by the polling thread.
+    std::shared_ptr<const SourceVector> polled_sources_;
+
+    //! Generation of polled_sources_.
+    uint64_t polled_generation_ = (std::numeric_limits<uint64_t>::max)();
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _RTPS_RESOURCES_POLLEDSOURCELIST_HPP_
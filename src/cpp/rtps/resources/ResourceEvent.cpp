@@ -20,7 +20,9 @@
 #include <fastdds/dds/log/Log.hpp>
 
 #include "TimedEventImpl.h"
+#include "TimingWheel.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <thread>
 
@@ -28,17 +30,19 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
-static bool event_compare(
-        TimedEventImpl* lhs,
-        TimedEventImpl* rhs)
+//! Resolution of the timing wheel. Events expiring on the same tick are triggered together.
+static constexpr std::chrono::microseconds timer_tick{1000};
+
+ResourceEvent::ResourceEvent()
+    : active_timers_(new TimingWheel(std::chrono::steady_clock::now(), timer_tick))
 {
-    return lhs->next_trigger_time() < rhs->next_trigger_time();
 }
 
 ResourceEvent::~ResourceEvent()
 {
     // All timer should be unregistered before destroying this object.
     assert(pending_timers_.empty());
+    assert(nullptr == notified_timers_.load());
     assert(timers_count_ == 0);
 
     logInfo(RTPS_PARTICIPANT, "Removing event thread");
@@ -75,14 +79,14 @@ void ResourceEvent::unregister_timer(
 
     cv_manipulation_.wait(lock, [&]()
             {
-                return allow_vector_manipulation_;
+                return allow_timer_manipulation_;
             });
 
-    bool should_notify = false;
-    std::vector<TimedEventImpl*>::iterator it;
+    // The event may still be on the list of notified events
+    bool should_notify = take_notified_timers();
 
     // Remove from pending
-    it = std::find(pending_timers_.begin(), pending_timers_.end(), event);
+    auto it = std::find(pending_timers_.begin(), pending_timers_.end(), event);
     if (it != pending_timers_.end())
     {
         pending_timers_.erase(it);
@@ -90,10 +94,9 @@ void ResourceEvent::unregister_timer(
     }
 
     // Remove from active
-    it = std::find(active_timers_.begin(), active_timers_.end(), event);
-    if (it != active_timers_.end())
+    if (TimingWheel::contains(event))
     {
-        active_timers_.erase(it);
+        active_timers_->remove(event);
         should_notify = true;
     }
 
@@ -110,11 +113,10 @@ void ResourceEvent::unregister_timer(
 void ResourceEvent::notify(
         TimedEventImpl* event)
 {
-    std::lock_guard<TimedMutex> lock(mutex_);
-
-    if (register_timer_nts(event))
+    if (push_notified_timer(event))
     {
-        // Notify the execution thread that something changed
+        // Taking the mutex ensures the execution thread is either waiting or will see the event before waiting
+        std::lock_guard<TimedMutex> lock(mutex_);
         cv_.notify_one();
     }
 }
@@ -123,28 +125,63 @@ void ResourceEvent::notify(
         TimedEventImpl* event,
         const std::chrono::steady_clock::time_point& timeout)
 {
-    std::unique_lock<TimedMutex> lock(mutex_, std::defer_lock);
-
-    if (lock.try_lock_until(timeout))
+    if (push_notified_timer(event))
     {
-        if (register_timer_nts(event))
-        {
-            // Notify the execution thread that something changed
-            cv_.notify_one();
-        }
+        std::unique_lock<TimedMutex> lock(mutex_, std::defer_lock);
+
+        // The event is already recorded, so when the mutex cannot be taken in time the execution thread is woken up
+        // anyway. It is just not guaranteed to be waiting yet.
+        lock.try_lock_until(timeout);
+        cv_.notify_one();
     }
 }
 
-bool ResourceEvent::register_timer_nts(
+bool ResourceEvent::push_notified_timer(
         TimedEventImpl* event)
 {
-    if (std::find(pending_timers_.begin(), pending_timers_.end(), event) == pending_timers_.end())
+    bool expected = false;
+    if (!event->is_pending_.compare_exchange_strong(expected, true))
     {
-        pending_timers_.push_back(event);
-        return true;
+        // Already on the list, and the execution thread has been warned about it.
+        return false;
     }
 
-    return false;
+    TimedEventImpl* head = notified_timers_.load(std::memory_order_relaxed);
+    do
+    {
+        event->next_pending_ = head;
+    } while (!notified_timers_.compare_exchange_weak(head, event, std::memory_order_release,
+            std::memory_order_relaxed));
+
+    // Only the first event on the list needs to wake up the execution thread.
+    return nullptr == head;
+}
+
+bool ResourceEvent::take_notified_timers()
+{
+    TimedEventImpl* event = notified_timers_.exchange(nullptr, std::memory_order_acquire);
+    if (nullptr == event)
+    {
+        return false;
+    }
+
+    // Events are taken in the order they were notified, so the list (which is LIFO) is reversed
+    size_t first = pending_timers_.size();
+    while (nullptr != event)
+    {
+        // The link should be read before allowing the event to be notified again
+        TimedEventImpl* next = event->next_pending_;
+        event->is_pending_.store(false);
+        if (std::find(pending_timers_.begin(), pending_timers_.begin() + first, event) ==
+                pending_timers_.begin() + first)
+        {
+            pending_timers_.push_back(event);
+        }
+        event = next;
+    }
+    std::reverse(pending_timers_.begin() + first, pending_timers_.end());
+
+    return true;
 }
 
 void ResourceEvent::event_service()
@@ -164,20 +201,20 @@ void ResourceEvent::event_service()
         }
 
         // If pending timers exist, there is some work to be done, so no need to wait.
-        if (!pending_timers_.empty())
+        if (nullptr != notified_timers_.load() || !pending_timers_.empty())
         {
             continue;
         }
 
         // Allow other threads to manipulate the timer collections while we wait.
-        allow_vector_manipulation_ = true;
+        allow_timer_manipulation_ = true;
         cv_manipulation_.notify_all();
 
         // Wait for the first timer to be triggered
         std::chrono::steady_clock::time_point next_trigger =
-                active_timers_.empty() ?
+                active_timers_->empty() ?
                 current_time_ + std::chrono::seconds(1) :
-                active_timers_[0]->next_trigger_time();
+                active_timers_->next_expiry();
 
         auto current_time = std::chrono::steady_clock::now();
         if (current_time > next_trigger)
@@ -188,16 +225,11 @@ void ResourceEvent::event_service()
         cv_.wait_until(lock, next_trigger);
 
         // Don't allow other threads to manipulate the timer collections
-        allow_vector_manipulation_ = false;
+        allow_timer_manipulation_ = false;
         resize_collections();
     }
 }
 
-void ResourceEvent::sort_timers()
-{
-    std::sort(active_timers_.begin(), active_timers_.end(), event_compare);
-}
-
 void ResourceEvent::update_current_time()
 {
     current_time_ = std::chrono::steady_clock::now();
@@ -208,64 +240,38 @@ void ResourceEvent::do_timer_actions()
     std::chrono::steady_clock::time_point cancel_time =
             current_time_ + std::chrono::hours(24);
 
-    bool did_something = false;
-
-    // Process pending orders
+    // Process pending orders. The events notified from now on will be processed on the next iteration.
+    take_notified_timers();
+    for (TimedEventImpl* tp : pending_timers_)
     {
-        std::lock_guard<TimedMutex> lock(mutex_);
-        for (TimedEventImpl* tp : pending_timers_)
+        // Update timer info
+        if (tp->update(current_time_, cancel_time))
         {
-            // Remove item from active timers
-            auto current_pos = std::lower_bound(active_timers_.begin(), active_timers_.end(), tp, event_compare);
-            current_pos = std::find(current_pos, active_timers_.end(), tp);
-            if (current_pos != active_timers_.end())
-            {
-                active_timers_.erase(current_pos);
-            }
-
-            // Update timer info
-            if (tp->update(current_time_, cancel_time))
-            {
-                // Timer has to be activated: add to active timers
-                std::vector<TimedEventImpl*>::iterator low_bound;
-
-                // Insert on correct position
-                low_bound = std::lower_bound(active_timers_.begin(), active_timers_.end(), tp, event_compare);
-                active_timers_.emplace(low_bound, tp);
-            }
+            // Timer has to be activated: add to active timers, or move it if it already was
+            active_timers_->insert(tp, tp->next_trigger_time());
         }
-        pending_timers_.clear();
-    }
-
-    // Trigger active timers
-    for (TimedEventImpl* tp : active_timers_)
-    {
-        if (tp->next_trigger_time() <= current_time_)
-        {
-            did_something = true;
-            tp->trigger(current_time_, cancel_time);
-        }
-        else
+        else if (TimingWheel::contains(tp))
         {
-            break;
+            // Timer has been canceled: remove from active timers
+            active_timers_->remove(tp);
         }
     }
+    pending_timers_.clear();
 
-    // If an action was made, keep active_timers_ sorted
-    if (did_something)
+    // Trigger expired timers
+    expired_timers_.clear();
+    active_timers_->advance(current_time_, expired_timers_);
+    for (TimingWheelNode* node : expired_timers_)
     {
-        sort_timers();
-        active_timers_.erase(
-            std::lower_bound(active_timers_.begin(), active_timers_.end(), nullptr,
-            [cancel_time](
-                TimedEventImpl* a,
-                TimedEventImpl* b)
-            {
-                (void)b;
-                return a->next_trigger_time() < cancel_time;
-            }),
-            active_timers_.end()
-            );
+        TimedEventImpl* tp = static_cast<TimedEventImpl*>(node);
+        tp->trigger(current_time_, cancel_time);
+
+        // Restarted timers are kept active
+        std::chrono::steady_clock::time_point next_trigger = tp->next_trigger_time();
+        if (next_trigger < cancel_time)
+        {
+            active_timers_->insert(tp, next_trigger);
+        }
     }
 }
 
@@ -273,7 +279,7 @@ void ResourceEvent::init_thread()
 {
     std::lock_guard<TimedMutex> lock(mutex_);
 
-    allow_vector_manipulation_ = false;
+    allow_timer_manipulation_ = false;
     resize_collections();
 
     thread_ = std::thread(&ResourceEvent::event_service, this);
@@ -0,0 +1,134 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ResourceEventPool.hpp
+ */
+
+#ifndef _RTPS_RESOURCES_RESOURCEEVENTPOOL_HPP_
+#define _RTPS_RESOURCES_RESOURCEEVENTPOOL_HPP_
+
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/resources/ResourceEvent.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+//! Classes of timed events that can be run by dedicated event threads.
+enum class EventThreadClass : uint8_t
+{
+    //! Heartbeats, ACKNACK responses and NACK suppression.
+    RELIABILITY = 0,
+    //! Announcements, leases, liveliness assertions and authentication handshakes.
+    DISCOVERY,
+    //! Events with user visible callbacks, like deadline and lifespan.
+    USER_CALLBACKS
+};
+
+/**
+ * Event threads of a participant.
+ * There is always a general event thread. Each class of events may have some dedicated threads, among which its
+ * events are spread when they are created.
+ * @ingroup MANAGEMENT_MODULE
+ */
+class ResourceEventPool
+{
+public:
+
+    explicit ResourceEventPool(
+            const EventThreadAttributes& att)
+    {
+        add_threads(EventThreadClass::RELIABILITY, att.reliability_threads);
+        add_threads(EventThreadClass::DISCOVERY, att.discovery_threads);
+        add_threads(EventThreadClass::USER_CALLBACKS, att.user_callback_threads);
+    }
+
+    ResourceEventPool(
+            const ResourceEventPool&) = delete;
+
+    ResourceEventPool& operator =(
+            const ResourceEventPool&) = delete;
+
+    //! Start all the event threads.
+    void init_threads()
+    {
+        general_.init_thread();
+        for (const ThreadClass& thread_class : classes_)
+        {
+            for (const std::unique_ptr<ResourceEvent>& service : thread_class.services)
+            {
+                service->init_thread();
+            }
+        }
+    }
+
+    //! Event thread for events without a class.
+    ResourceEvent& general()
+    {
+        return general_;
+    }
+
+    /**
+     * Event thread for a new event of a class.
+     * @param event_class Class of the event.
+     * @return One of the threads dedicated to the class, or the general thread when there are none.
+     */
+    ResourceEvent& get(
+            EventThreadClass event_class)
+    {
+        ThreadClass& thread_class = classes_[static_cast<size_t>(event_class)];
+        if (thread_class.services.empty())
+        {
+            return general_;
+        }
+
+        uint32_t index = thread_class.next.fetch_add(1, std::memory_order_relaxed);
+        return *thread_class.services[index % thread_class.services.size()];
+    }
+
+private:
+
+    struct ThreadClass
+    {
+        std::vector<std::unique_ptr<ResourceEvent>> services;
+        std::atomic<uint32_t> next{0};
+    };
+
+    void add_threads(
+            EventThreadClass event_class,
+            uint32_t num_threads)
+    {
+        ThreadClass& thread_class = classes_[static_cast<size_t>(event_class)];
+        for (uint32_t i = 0; i < num_threads; ++i)
+        {
+            thread_class.services.emplace_back(new ResourceEvent());
+        }
+    }
+
+    ResourceEvent general_;
+
+    ThreadClass classes_[3];
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _RTPS_RESOURCES_RESOURCEEVENTPOOL_HPP_
@@ -33,6 +33,7 @@ TimedEventImpl::TimedEventImpl(
         Callback callback,
         std::chrono::microseconds interval)
     : interval_microsec_(interval)
+    , next_trigger_time_(std::chrono::steady_clock::time_point())
     , callback_(std::move(callback))
     , state_(StateCode::INACTIVE)
 {
@@ -73,13 +74,11 @@ bool TimedEventImpl::update(
 
     if (set_time)
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        next_trigger_time_ = current_time + interval_microsec_;
+        next_trigger_time_.store(current_time + interval_microsec_.load());
     }
     else if (expected == StateCode::INACTIVE)
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        next_trigger_time_ = cancel_time;
+        next_trigger_time_.store(cancel_time);
     }
 
     return expected != StateCode::INACTIVE;
@@ -103,31 +102,27 @@ void TimedEventImpl::trigger(
                 expected = StateCode::INACTIVE;
                 if (state_.compare_exchange_strong(expected, StateCode::WAITING))
                 {
-                    std::lock_guard<std::mutex> lock(mutex_);
-                    next_trigger_time_ = current_time + interval_microsec_;
+                    next_trigger_time_.store(current_time + interval_microsec_.load());
                     return;
                 }
             }
         }
 
-        std::lock_guard<std::mutex> lock(mutex_);
-        next_trigger_time_ = cancel_time;
+        next_trigger_time_.store(cancel_time);
     }
 }
 
 bool TimedEventImpl::update_interval(
         const eprosima::fastrtps::Duration_t& interval)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    interval_microsec_ = std::chrono::microseconds(TimeConv::Duration_t2MicroSecondsInt64(interval));
+    interval_microsec_.store(std::chrono::microseconds(TimeConv::Duration_t2MicroSecondsInt64(interval)));
     return true;
 }
 
 bool TimedEventImpl::update_interval_millisec(
         double interval)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    interval_microsec_ = std::chrono::microseconds(static_cast<int64_t>(interval * 1000));
+    interval_microsec_.store(std::chrono::microseconds(static_cast<int64_t>(interval * 1000)));
     return true;
 }
 
@@ -25,12 +25,11 @@
 #include <fastdds/rtps/common/Time_t.h>
 #include <fastdds/rtps/resources/TimedEvent.h>
 
+#include "TimingWheel.hpp"
+
 #include <atomic>
-#include <thread>
-#include <memory>
+#include <chrono>
 #include <functional>
-#include <mutex>
-#include <condition_variable>
 
 namespace eprosima {
 namespace fastrtps {
@@ -39,10 +38,13 @@ namespace rtps {
 /*!
  * This class encapsulates a timer.
  * It also manages the state of the event (INACTIVE, READY, WAITING..).
+ * It is scheduled by ResourceEvent on a TimingWheel.
  * @ingroup MANAGEMENT_MODULE
  */
-class TimedEventImpl
+class TimedEventImpl : private TimingWheelNode
 {
+    friend class ResourceEvent;
+
     using Callback = std::function<bool ()>;
 
 public:
@@ -91,8 +93,7 @@ public:
      */
     double getIntervalMsec()
     {
-        std::unique_lock<std::mutex> lock(mutex_);
-        auto total_milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(interval_microsec_);
+        auto total_milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(interval_microsec_.load());
         return static_cast<double>(total_milliseconds.count());
     }
 
@@ -102,10 +103,9 @@ public:
      */
     double getRemainingTimeMilliSec()
     {
-        std::unique_lock<std::mutex> lock(mutex_);
         return static_cast<double>(
             std::chrono::duration_cast<std::chrono::milliseconds>(
-                next_trigger_time_ - std::chrono::steady_clock::now()).
+                next_trigger_time_.load() - std::chrono::steady_clock::now()).
             count());
     }
 
@@ -115,8 +115,7 @@ public:
      */
     std::chrono::steady_clock::time_point next_trigger_time()
     {
-        std::unique_lock<std::mutex> lock(mutex_);
-        return next_trigger_time_;
+        return next_trigger_time_.load();
     }
 
     /*!
@@ -154,10 +153,10 @@ public:
 private:
 
     //! Expiration time in microseconds of the event.
-    std::chrono::microseconds interval_microsec_;
+    std::atomic<std::chrono::microseconds> interval_microsec_;
 
     //! Next time this event should be triggered
-    std::chrono::steady_clock::time_point next_trigger_time_;
+    std::atomic<std::chrono::steady_clock::time_point> next_trigger_time_;
 
     //! User function to be called when this event is triggered
     Callback callback_;
@@ -165,8 +164,11 @@ private:
     //! Current state of this event
     std::atomic<StateCode> state_;
 
-    //! Protects interval_microsec_ and next_trigger_time_
-    std::mutex mutex_;
+    //! Whether this event is on the list of events pending update action of ResourceEvent
+    std::atomic<bool> is_pending_{false};
+
+    //! Next event on the list of events pending update action of ResourceEvent
+    TimedEventImpl* next_pending_ = nullptr;
 };
 
 } // namespace rtps
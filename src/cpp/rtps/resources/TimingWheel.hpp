@@ -0,0 +1,428 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TimingWheel.hpp
+ */
+
+#ifndef _RTPS_RESOURCES_TIMINGWHEEL_HPP_
+#define _RTPS_RESOURCES_TIMINGWHEEL_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#if _MSC_VER
+#include <intrin.h>
+#endif // if _MSC_VER
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Links of an element stored on a TimingWheel.
+ * They are kept inside the element, so it can be inserted and removed without allocations.
+ */
+struct TimingWheelNode
+{
+    TimingWheelNode* wheel_next = nullptr;
+
+    //! Address of the pointer to this node, nullptr when the node is not on a wheel.
+    TimingWheelNode** wheel_pprev = nullptr;
+
+    //! Tick at which the node expires.
+    uint64_t expiry_tick = 0;
+};
+
+/**
+ * Hierarchical timing wheel.
+ *
+ * Time is divided in ticks, and each level of the wheel has 64 slots. A slot of level 0 holds the nodes expiring on
+ * one tick, and a slot of level L holds the nodes expiring on 64^L consecutive ticks, which are moved to the lower
+ * levels when the wheel reaches them. Insertion and removal are O(1), and all the nodes expiring on the same tick
+ * are given back together.
+ *
+ * Nodes are given back on the first tick not earlier than their due time, so they are never expired early. Nodes
+ * inserted with a due time that has already been reached are given back on the next call to advance.
+ *
+ * This class is not thread safe.
+ */
+class TimingWheel
+{
+public:
+
+    using clock = std::chrono::steady_clock;
+
+    static constexpr uint32_t slot_bits = 6;
+    static constexpr uint32_t num_slots = 1u << slot_bits;
+    static constexpr uint32_t num_levels = 4;
+
+    /**
+     * @param start Time of the first tick.
+     * @param tick Duration of a tick.
+     */
+    TimingWheel(
+            clock::time_point start,
+            std::chrono::microseconds tick)
+        : start_(start)
+        , tick_(tick)
+        , now_(start)
+    {
+        for (uint32_t level = 0; level < num_levels; ++level)
+        {
+            occupied_[level] = 0;
+            for (uint32_t slot = 0; slot < num_slots; ++slot)
+            {
+                slots_[level][slot] = nullptr;
+            }
+        }
+    }
+
+    TimingWheel(
+            const TimingWheel&) = delete;
+
+    TimingWheel& operator =(
+            const TimingWheel&) = delete;
+
+    bool empty() const
+    {
+        return 0 == size_;
+    }
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+    static bool contains(
+            const TimingWheelNode* node)
+    {
+        return nullptr != node->wheel_pprev;
+    }
+
+    /**
+     * Insert a node, or move it if it was already on the wheel.
+     * @param node Node to insert.
+     * @param due_time Time at which the node should expire.
+     */
+    void insert(
+            TimingWheelNode* node,
+            clock::time_point due_time)
+    {
+        if (contains(node))
+        {
+            remove(node);
+        }
+
+        ++size_;
+
+        uint64_t tick = ticks_until(due_time);
+        if (due_time <= now_ || tick < current_tick_)
+        {
+            link(node, due_now_);
+        }
+        else
+        {
+            node->expiry_tick = tick;
+            place(node);
+        }
+    }
+
+    /**
+     * Remove a node from the wheel.
+     * @param node Node to remove. It should be on the wheel.
+     */
+    void remove(
+            TimingWheelNode* node)
+    {
+        TimingWheelNode** pprev = node->wheel_pprev;
+        unlink(node);
+        --size_;
+
+        // When the slot is left empty, its bit is cleared
+        std::less<TimingWheelNode**> less;
+        TimingWheelNode** first_slot = &slots_[0][0];
+        TimingWheelNode** end_slot = first_slot + num_levels * num_slots;
+        if (nullptr == *pprev && !less(pprev, first_slot) && less(pprev, end_slot))
+        {
+            size_t index = static_cast<size_t>(pprev - first_slot);
+            occupied_[index / num_slots] &= ~(uint64_t(1) << (index % num_slots));
+        }
+    }
+
+    /**
+     * Move the wheel forward until a given time.
+     * @param now Current time.
+     * @param expired Where the expired nodes are appended. They are no longer on the wheel.
+     */
+    void advance(
+            clock::time_point now,
+            std::vector<TimingWheelNode*>& expired)
+    {
+        if (now > now_)
+        {
+            now_ = now;
+        }
+
+        take_list(due_now_, expired);
+
+        if (now_ < start_)
+        {
+            return;
+        }
+
+        uint64_t last_tick = static_cast<uint64_t>((now_ - start_) / tick_);
+        while (current_tick_ <= last_tick)
+        {
+            uint32_t slot = static_cast<uint32_t>(current_tick_ & slot_mask);
+            if (0 == slot)
+            {
+                cascade();
+            }
+
+            if (nullptr != slots_[0][slot])
+            {
+                take_list(slots_[0][slot], expired);
+                occupied_[0] &= ~(uint64_t(1) << slot);
+            }
+
+            // Go to the next occupied slot of level 0, or to the next cascade
+            uint64_t next_tick = (current_tick_ | slot_mask) + 1;
+            uint64_t pending_slots = (slot_mask == slot) ? 0 : (occupied_[0] >> (slot + 1)) << (slot + 1);
+            if (0 != pending_slots)
+            {
+                next_tick = (current_tick_ & ~uint64_t(slot_mask)) + lowest_bit(pending_slots);
+            }
+            current_tick_ = (next_tick <= last_tick) ? next_tick : last_tick + 1;
+        }
+    }
+
+    /**
+     * Time at which the wheel should be advanced next.
+     * It may be the time a group of nodes should be moved to a lower level, and not the expiration of any node.
+     * @return clock::time_point::max() when the wheel is empty.
+     */
+    clock::time_point next_expiry() const
+    {
+        if (nullptr != due_now_)
+        {
+            return now_;
+        }
+
+        if (empty())
+        {
+            return clock::time_point::max();
+        }
+
+        // Earliest slot on the current group of each level.
+        // The slot of the current tick is included when the tick has not been processed yet, as it is not cascaded.
+        clock::time_point next = clock::time_point::max();
+        for (uint32_t level = 0; level < num_levels; ++level)
+        {
+            uint32_t shift = level * slot_bits;
+            uint32_t digit = static_cast<uint32_t>((current_tick_ >> shift) & slot_mask);
+            bool pending_cascade = 0 == (current_tick_ & ((uint64_t(1) << shift) - 1));
+            uint32_t first_slot = pending_cascade ? digit : digit + 1;
+            uint64_t pending_slots = (num_slots == first_slot) ? 0 : (occupied_[level] >> first_slot) << first_slot;
+            if (0 != pending_slots)
+            {
+                uint64_t group = (current_tick_ >> (shift + slot_bits)) << (shift + slot_bits);
+                next = (std::min)(next, tick_time(group + (uint64_t(lowest_bit(pending_slots)) << shift)));
+            }
+        }
+
+        // Nodes beyond the range of the wheel are placed again when the top level wraps
+        if (nullptr != overflow_)
+        {
+            uint32_t range_bits = num_levels * slot_bits;
+            uint64_t range_mask = (uint64_t(1) << range_bits) - 1;
+            uint64_t wrap_tick = (0 == (current_tick_ & range_mask)) ?
+                    current_tick_ : ((current_tick_ >> range_bits) + 1) << range_bits;
+            next = (std::min)(next, tick_time(wrap_tick));
+        }
+
+        return next;
+    }
+
+private:
+
+    static constexpr uint64_t slot_mask = num_slots - 1;
+
+    static uint32_t lowest_bit(
+            uint64_t bits)
+    {
+#if _MSC_VER
+        unsigned long bit;
+        _BitScanForward64(&bit, bits);
+        return static_cast<uint32_t>(bit);
+#else
+        return static_cast<uint32_t>(__builtin_ctzll(bits));
+#endif // if _MSC_VER
+    }
+
+    uint64_t ticks_until(
+            clock::time_point time) const
+    {
+        if (time <= start_)
+        {
+            return 0;
+        }
+
+        // Rounded up, so nodes never expire before their due time
+        auto elapsed = time - start_;
+        uint64_t ticks = static_cast<uint64_t>(elapsed / tick_);
+        return (elapsed % tick_ == clock::duration::zero()) ? ticks : ticks + 1;
+    }
+
+    clock::time_point tick_time(
+            uint64_t tick) const
+    {
+        return start_ + tick_ * static_cast<int64_t>(tick);
+    }
+
+    static void link(
+            TimingWheelNode* node,
+            TimingWheelNode*& head)
+    {
+        node->wheel_next = head;
+        node->wheel_pprev = &head;
+        if (nullptr != head)
+        {
+            head->wheel_pprev = &node->wheel_next;
+        }
+        head = node;
+    }
+
+    static void unlink(
+            TimingWheelNode* node)
+    {
+        *node->wheel_pprev = node->wheel_next;
+        if (nullptr != node->wheel_next)
+        {
+            node->wheel_next->wheel_pprev = node->wheel_pprev;
+        }
+        node->wheel_next = nullptr;
+        node->wheel_pprev = nullptr;
+    }
+
+    //! Put a node on the lowest level whose current group contains its expiry tick.
+    void place(
+            TimingWheelNode* node)
+    {
+        for (uint32_t level = 0; level < num_levels; ++level)
+        {
+            uint32_t group_shift = (level + 1) * slot_bits;
+            if ((node->expiry_tick >> group_shift) == (current_tick_ >> group_shift))
+            {
+                uint32_t slot = static_cast<uint32_t>((node->expiry_tick >> (level * slot_bits)) & slot_mask);
+                link(node, slots_[level][slot]);
+                occupied_[level] |= uint64_t(1) << slot;
+                return;
+            }
+        }
+
+        link(node, overflow_);
+    }
+
+    //! Place again the nodes of a list, which should have expiry ticks not earlier than the current one.
+    void place_list(
+            TimingWheelNode*& head)
+    {
+        TimingWheelNode* node = head;
+        head = nullptr;
+        while (nullptr != node)
+        {
+            TimingWheelNode* next = node->wheel_next;
+            node->wheel_next = nullptr;
+            node->wheel_pprev = nullptr;
+            place(node);
+            node = next;
+        }
+    }
+
+    //! Move the nodes of the slots the current tick has reached to lower levels.
+    void cascade()
+    {
+        uint32_t range_bits = num_levels * slot_bits;
+        if (0 == (current_tick_ & ((uint64_t(1) << range_bits) - 1)))
+        {
+            place_list(overflow_);
+        }
+
+        for (uint32_t level = num_levels - 1; level > 0; --level)
+        {
+            uint32_t shift = level * slot_bits;
+            if (0 == (current_tick_ & ((uint64_t(1) << shift) - 1)))
+            {
+                uint32_t slot = static_cast<uint32_t>((current_tick_ >> shift) & slot_mask);
+                occupied_[level] &= ~(uint64_t(1) << slot);
+                place_list(slots_[level][slot]);
+            }
+        }
+    }
+
+    void take_list(
+            TimingWheelNode*& head,
+            std::vector<TimingWheelNode*>& expired)
+    {
+        TimingWheelNode* node = head;
+        head = nullptr;
+        while (nullptr != node)
+        {
+            TimingWheelNode* next = node->wheel_next;
+            node->wheel_next = nullptr;
+            node->wheel_pprev = nullptr;
+            expired.push_back(node);
+            --size_;
+            node = next;
+        }
+    }
+
+    //! Time of tick 0.
+    clock::time_point start_;
+
+    //! Duration of a tick.
+    std::chrono::microseconds tick_;
+
+    //! Latest time given to advance.
+    clock::time_point now_;
+
+    //! First tick not processed yet.
+    uint64_t current_tick_ = 0;
+
+    //! Number of nodes on the wheel.
+    size_t size_ = 0;
+
+    //! Slots of each level.
+    TimingWheelNode* slots_[num_levels][num_slots];
+
+    //! Bitmaps of non-empty slots for each level.
+    uint64_t occupied_[num_levels];
+
+    //! Nodes expiring after the range of the top level.
+    TimingWheelNode* overflow_ = nullptr;
+
+    //! Nodes inserted when they were already due.
+    TimingWheelNode* due_now_ = nullptr;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _RTPS_RESOURCES_TIMINGWHEEL_HPP_
@@ -0,0 +1,147 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*!
+ * @file CryptoWorkerPool.cpp
+ */
+
+#include <rtps/security/CryptoWorkerPool.h>
+
+#include <algorithm>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+namespace security {
+
+CryptoWorkerPool::CryptoWorkerPool(
+        uint32_t num_threads)
+    : stop_(false)
+{
+    threads_.reserve(num_threads);
+    for (uint32_t i = 0; i < num_threads; ++i)
+    {
+        threads_.emplace_back(&CryptoWorkerPool::worker, this);
+    }
+}
+
+CryptoWorkerPool::~CryptoWorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        stop_ = true;
+    }
+    work_cv_.notify_all();
+
+    for (std::thread& thread : threads_)
+    {
+        thread.join();
+    }
+}
+
+void CryptoWorkerPool::run(
+        size_t num_jobs,
+        const std::function<void(size_t)>& job)
+{
+    if (threads_.empty() || num_jobs < 2)
+    {
+        for (size_t i = 0; i < num_jobs; ++i)
+        {
+            job(i);
+        }
+        return;
+    }
+
+    std::shared_ptr<Batch> batch = std::make_shared<Batch>(num_jobs, job);
+    size_t helpers = (std::min)(num_jobs - 1, threads_.size());
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        batches_.push_back(batch);
+    }
+    if (helpers == threads_.size())
+    {
+        work_cv_.notify_all();
+    }
+    else
+    {
+        for (size_t i = 0; i < helpers; ++i)
+        {
+            work_cv_.notify_one();
+        }
+    }
+
+    take_jobs(*batch);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto it = std::find(batches_.begin(), batches_.end(), batch);
+    if (it != batches_.end())
+    {
+        batches_.erase(it);
+    }
+    done_cv_.wait(lock, [&batch]()
+            {
+                return 0u == batch->pending_jobs.load(std::memory_order_acquire);
+            });
+}
+
+void CryptoWorkerPool::take_jobs(
+        Batch& batch)
+{
+    size_t index = batch.next_job.fetch_add(1u, std::memory_order_relaxed);
+    while (index < batch.num_jobs)
+    {
+        batch.job(index);
+        if (1u == batch.pending_jobs.fetch_sub(1u, std::memory_order_acq_rel))
+        {
+            // Last job of the batch. Taking the mutex avoids the caller missing the notification.
+            std::lock_guard<std::mutex> guard(mutex_);
+            done_cv_.notify_all();
+        }
+        index = batch.next_job.fetch_add(1u, std::memory_order_relaxed);
+    }
+}
+
+void CryptoWorkerPool::worker()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+        work_cv_.wait(lock, [this]()
+                {
+                    return stop_ || !batches_.empty();
+                });
+
+        if (stop_)
+        {
+            return;
+        }
+
+        std::shared_ptr<Batch> batch = batches_.front();
+        if (batch->next_job.load(std::memory_order_relaxed) >= batch->num_jobs)
+        {
+            // All jobs taken, the threads running them will finish the batch.
+            batches_.pop_front();
+            continue;
+        }
+
+        lock.unlock();
+        take_jobs(*batch);
+        lock.lock();
+    }
+}
+
+} //namespace security
+} //namespace rtps
+} //namespace fastrtps
+} //namespace eprosima
@@ -0,0 +1,116 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*!
+ * @file CryptoWorkerPool.h
+ */
+#ifndef _RTPS_SECURITY_CRYPTOWORKERPOOL_H_
+#define _RTPS_SECURITY_CRYPTOWORKERPOOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+namespace security {
+
+/**
+ * Pool of threads used to run the cryptographic transformation of independent RTPS messages in parallel.
+ *
+ * Work is given as a batch of jobs identified by their index. The calling thread takes jobs of its own batch
+ * together with the workers, and returns when all of them have finished, so results can be consumed in
+ * the order of their indexes.
+ */
+class CryptoWorkerPool
+{
+public:
+
+    /**
+     * Construct a pool and start its threads.
+     * @param num_threads Number of worker threads, not counting the threads calling run.
+     */
+    explicit CryptoWorkerPool(
+            uint32_t num_threads);
+
+    ~CryptoWorkerPool();
+
+    CryptoWorkerPool(
+            const CryptoWorkerPool&) = delete;
+
+    CryptoWorkerPool& operator =(
+            const CryptoWorkerPool&) = delete;
+
+    /**
+     * Run a batch of jobs and wait for all of them to finish.
+     * Can be called from several threads at the same time.
+     * @param num_jobs Number of jobs in the batch.
+     * @param job Function called once for each index in [0, num_jobs).
+     */
+    void run(
+            size_t num_jobs,
+            const std::function<void(size_t)>& job);
+
+    uint32_t num_threads() const
+    {
+        return static_cast<uint32_t>(threads_.size());
+    }
+
+private:
+
+    struct Batch
+    {
+        Batch(
+                size_t jobs,
+                const std::function<void(size_t)>& function)
+            : num_jobs(jobs)
+            , job(function)
+            , next_job(0)
+            , pending_jobs(jobs)
+        {
+        }
+
+        const size_t num_jobs;
+        const std::function<void(size_t)>& job;
+        std::atomic<size_t> next_job;
+        std::atomic<size_t> pending_jobs;
+    };
+
+    //! Run jobs of a batch until there are none left to take.
+    void take_jobs(
+            Batch& batch);
+
+    void worker();
+
+    std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+    std::deque<std::shared_ptr<Batch>> batches_;
+    bool stop_;
+    std::vector<std::thread> threads_;
+};
+
+} //namespace security
+} //namespace rtps
+} //namespace fastrtps
+} //namespace eprosima
+
+#endif // _RTPS_SECURITY_CRYPTOWORKERPOOL_H_
@@ -46,9 +46,11 @@
 #include <fastdds/rtps/security/accesscontrol/EndpointSecurityAttributes.h>
 
 #include <rtps/history/TopicPayloadPoolRegistry.hpp>
+#include <rtps/security/CryptoWorkerPool.h>
 
 #include <cassert>
 #include <chrono>
+#include <cstdlib>
 #include <thread>
 #include <mutex>
 
@@ -97,6 +99,7 @@ SecurityManager::SecurityManager(
     , local_identity_handle_(nullptr)
     , local_permissions_handle_(nullptr)
     , local_participant_crypto_handle_(nullptr)
+    , crypto_users_(0)
     , auth_last_sequence_number_(1)
     , crypto_last_sequence_number_(1)
     , temp_stateless_reader_proxy_data_(
@@ -338,6 +341,17 @@ bool SecurityManager::init(
                     if (local_participant_crypto_handle_ != nullptr)
                     {
                         assert(!local_participant_crypto_handle_->nil());
+
+                        const std::string* workers_value = PropertyPolicyHelper::find_property(participant_properties,
+                                        "dds.sec.crypto.worker_threads");
+                        if (workers_value != nullptr)
+                        {
+                            unsigned long num_workers = std::strtoul(workers_value->c_str(), nullptr, 10);
+                            if (0u < num_workers)
+                            {
+                                crypto_workers_.reset(new CryptoWorkerPool(static_cast<uint32_t>(num_workers)));
+                            }
+                        }
                     }
                 }
                 else
@@ -424,6 +438,7 @@ void SecurityManager::destroy()
     if (authentication_plugin_ != nullptr)
     {
         mutex_.lock();
+        wait_for_crypto_users();
 
         for (auto& local_reader : reader_handles_)
         {
@@ -510,6 +525,8 @@ void SecurityManager::destroy()
 
         delete_entities();
 
+        crypto_workers_.reset();
+
         if (crypto_plugin_ != nullptr)
         {
             delete crypto_plugin_;
@@ -614,7 +631,8 @@ bool SecurityManager::discovered_participant(
 
         // Configure the timed event but do not start it
         const GUID_t guid = participant_data.m_guid;
-        remote_participant_info->event_.reset(new TimedEvent(participant_->getEventResource(),
+        remote_participant_info->event_.reset(new TimedEvent(
+                    participant_->getEventResource(EventThreadClass::DISCOVERY),
                 [&, guid]() -> bool
                 {
                     resend_handshake_message_token(guid);
@@ -732,6 +750,7 @@ void SecurityManager::remove_participant(
                 dp_it->second.get_participant_crypto();
         if (participant_crypto_handle != nullptr)
         {
+            wait_for_crypto_users();
             crypto_plugin_->cryptokeyfactory()->unregister_participant(participant_crypto_handle,
                     exception);
         }
@@ -1663,6 +1682,7 @@ void SecurityManager::process_participant_volatile_message_secure(
         {
             SecurityException exception;
 
+            wait_for_crypto_users();
             if (!crypto_plugin_->cryptkeyexchange()->set_remote_participant_crypto_tokens(
                         *local_participant_crypto_handle_,
                         *remote_participant_crypto,
@@ -2187,10 +2207,18 @@ bool SecurityManager::encode_rtps_message(
         }
     }
 
+    // Participant crypto handles are kept alive by crypto_users_, so the transformation is done unlocked
+    ++crypto_users_;
+    lock.unlock();
+
     SecurityException exception;
-    return crypto_plugin_->cryptotransform()->encode_rtps_message(output_message,
-                   input_message, *local_participant_crypto_handle_, receiving_crypto_list,
-                   exception);
+    bool ret = crypto_plugin_->cryptotransform()->encode_rtps_message(output_message,
+                    input_message, *local_participant_crypto_handle_, receiving_crypto_list,
+                    exception);
+
+    lock.lock();
+    release_crypto_user();
+    return ret;
 }
 
 int SecurityManager::decode_rtps_message(
@@ -2235,6 +2263,10 @@ int SecurityManager::decode_rtps_message(
 
     if (remote_participant_crypto_handle != nullptr)
     {
+        // Participant crypto handles are kept alive by crypto_users_, so the transformation is done unlocked
+        ++crypto_users_;
+        lock.unlock();
+
         SecurityException exception;
         bool ret = crypto_plugin_->cryptotransform()->decode_rtps_message(out_message,
                         message,
@@ -2242,6 +2274,9 @@ int SecurityManager::decode_rtps_message(
                         *remote_participant_crypto_handle,
                         exception);
 
+        lock.lock();
+        release_crypto_user();
+
         if (ret)
         {
             returnedValue = 0;
@@ -31,6 +31,7 @@
 #include <fastdds/rtps/attributes/HistoryAttributes.h>
 #include <fastdds/rtps/resources/TimedEvent.h>
 
+#include <condition_variable>
 #include <map>
 #include <mutex>
 #include <atomic>
@@ -55,6 +56,7 @@ namespace security {
 class Authentication;
 class AccessControl;
 class Cryptography;
+class CryptoWorkerPool;
 struct ParticipantSecurityAttributes;
 struct EndpointSecurityAttributes;
 
@@ -205,6 +207,15 @@ public:
             const GUID_t& reader_guid,
             const GUID_t& writer_guid);
 
+    /**
+     * Pool of threads where independent RTPS messages can be transformed in parallel.
+     * @return nullptr when not enabled with property dds.sec.crypto.worker_threads.
+     */
+    CryptoWorkerPool* crypto_workers()
+    {
+        return crypto_workers_.get();
+    }
+
     uint32_t calculate_extra_size_for_rtps_message();
 
     uint32_t calculate_extra_size_for_rtps_submessage(
@@ -522,6 +533,27 @@ private:
     void resend_handshake_message_token(
             const GUID_t& remote_participant_key);
 
+    /**
+     * Wait until no RTPS message is being transformed outside the mutex.
+     * Should be called with mutex_ locked before unregistering or changing a participant crypto handle.
+     */
+    void wait_for_crypto_users()
+    {
+        crypto_users_cv_.wait(mutex_, [this]()
+                {
+                    return 0u == crypto_users_;
+                });
+    }
+
+    //! Should be called with mutex_ locked when an unlocked transformation finishes.
+    void release_crypto_user()
+    {
+        if (0u == --crypto_users_)
+        {
+            crypto_users_cv_.notify_all();
+        }
+    }
+
     RTPSParticipantImpl* participant_;
     StatelessWriter* participant_stateless_message_writer_;
     WriterHistory* participant_stateless_message_writer_history_;
@@ -555,6 +587,13 @@ private:
 
     std::mutex mutex_;
 
+    //! Number of RTPS messages being transformed without holding mutex_. Protected by mutex_.
+    uint32_t crypto_users_;
+
+    std::condition_variable_any crypto_users_cv_;
+
+    std::unique_ptr<CryptoWorkerPool> crypto_workers_;
+
     std::atomic<int64_t> auth_last_sequence_number_;
 
     std::atomic<int64_t> crypto_last_sequence_number_;
@@ -14,10 +14,20 @@
 
 #include <rtps/transport/UDPChannelResource.h>
 
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
 #include <asio.hpp>
 #include <fastdds/rtps/messages/MessageReceiver.h>
 #include <rtps/transport/UDPTransportInterface.h>
 
+#if defined(__linux__)
+#include <sys/socket.h>
+#include <sys/uio.h>
+#endif // if defined(__linux__)
+
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
@@ -25,19 +35,24 @@ namespace rtps {
 using octet = fastrtps::rtps::octet;
 using Log = fastdds::dds::Log;
 
+//! Upper bound for the number of datagrams read on each receive operation (the kernel limit for recvmmsg).
+static constexpr uint32_t max_receive_batch_size = 1024u;
+
 UDPChannelResource::UDPChannelResource(
         UDPTransportInterface* transport,
         eProsimaUDPSocket& socket,
         uint32_t maxMsgSize,
         const Locator& locator,
         const std::string& sInterface,
-        TransportReceiverInterface* receiver)
+        TransportReceiverInterface* receiver,
+        uint32_t receive_batch_size)
     : ChannelResource(maxMsgSize)
     , message_receiver_(receiver)
     , socket_(moveSocket(socket))
     , only_multicast_purpose_(false)
     , interface_(sInterface)
     , transport_(transport)
+    , receive_batch_size_((std::min)((std::max)(receive_batch_size, 1u), max_receive_batch_size))
 {
     thread(std::thread(&UDPChannelResource::perform_listen_operation, this, locator));
 }
@@ -50,6 +65,15 @@ UDPChannelResource::~UDPChannelResource()
 void UDPChannelResource::perform_listen_operation(
         Locator input_locator)
 {
+#if defined(__linux__)
+    if (receive_batch_size_ > 1u)
+    {
+        perform_batch_listen_operation(input_locator);
+        message_receiver(nullptr);
+        return;
+    }
+#endif // if defined(__linux__)
+
     Locator remote_locator;
 
     while (alive())
@@ -75,6 +99,90 @@ void UDPChannelResource::perform_listen_operation(
     message_receiver(nullptr);
 }
 
+#if defined(__linux__)
+void UDPChannelResource::perform_batch_listen_operation(
+        const Locator& input_locator)
+{
+    const uint32_t batch_size = receive_batch_size_;
+    const uint32_t buffer_size = message_buffer().max_size;
+
+    // All the buffers are allocated once, and reused on each receive operation.
+    std::vector<octet> buffers(static_cast<size_t>(batch_size) * buffer_size);
+    std::vector<mmsghdr> headers(batch_size);
+    std::vector<iovec> iovecs(batch_size);
+    std::vector<sockaddr_storage> addresses(batch_size);
+    std::vector<ReceivedDatagram> datagrams;
+    datagrams.reserve(batch_size);
+
+    while (alive())
+    {
+        for (uint32_t i = 0; i < batch_size; ++i)
+        {
+            iovecs[i].iov_base = &buffers[static_cast<size_t>(i) * buffer_size];
+            iovecs[i].iov_len = buffer_size;
+            std::memset(&headers[i], 0, sizeof(mmsghdr));
+            headers[i].msg_hdr.msg_iov = &iovecs[i];
+            headers[i].msg_hdr.msg_iovlen = 1;
+            headers[i].msg_hdr.msg_name = &addresses[i];
+            headers[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+        }
+
+        // Blocks until one datagram is available, then takes the ones already queued without blocking again.
+        int received = recvmmsg(socket()->native_handle(), headers.data(), batch_size, MSG_WAITFORONE, nullptr);
+        if (received <= 0)
+        {
+            if (received < 0 && EINTR != errno && alive())
+            {
+                logWarning(RTPS_MSG_IN, "Error receiving data: " << std::strerror(errno) << " - "
+                                                                 << message_receiver() << " (" << this << ")");
+            }
+            continue;
+        }
+
+        datagrams.clear();
+        for (int i = 0; i < received; ++i)
+        {
+            const octet* data = static_cast<const octet*>(iovecs[i].iov_base);
+            uint32_t size = headers[i].msg_len;
+
+            // This is not necessary anymore but it's left here for back compatibility with versions older than 1.8.1
+            if (0u == size || (size == 13 && memcmp(data, "EPRORTPSCLOSE", 13) == 0))
+            {
+                continue;
+            }
+
+            asio::ip::udp::endpoint sender_endpoint;
+            size_t address_size = (std::min)(static_cast<size_t>(headers[i].msg_hdr.msg_namelen),
+                            sender_endpoint.capacity());
+            std::memcpy(sender_endpoint.data(), &addresses[i], address_size);
+            sender_endpoint.resize(address_size);
+
+            ReceivedDatagram datagram;
+            datagram.data = data;
+            datagram.size = size;
+            transport_->endpoint_to_locator(sender_endpoint, datagram.remote_locator);
+            datagrams.push_back(datagram);
+        }
+
+        if (datagrams.empty())
+        {
+            continue;
+        }
+
+        // Processes the whole batch through the CDR Message interface.
+        if (message_receiver() != nullptr)
+        {
+            message_receiver()->OnDataBatchReceived(datagrams.data(), datagrams.size(), input_locator);
+        }
+        else if (alive())
+        {
+            logWarning(RTPS_MSG_IN, "Received Message, but no receiver attached");
+        }
+    }
+}
+
+#endif // if defined(__linux__)
+
 bool UDPChannelResource::Receive(
         octet* receive_buffer,
         uint32_t receive_buffer_capacity,
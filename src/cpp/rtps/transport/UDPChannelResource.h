@@ -110,7 +110,8 @@ public:
             uint32_t maxMsgSize,
             const Locator& locator,
             const std::string& sInterface,
-            TransportReceiverInterface* receiver);
+            TransportReceiverInterface* receiver,
+            uint32_t receive_batch_size);
 
     virtual ~UDPChannelResource() override;
 
@@ -185,6 +186,17 @@ protected:
     void perform_listen_operation(
             Locator input_locator);
 
+#if defined(__linux__)
+    /**
+     * Listen loop used when receiving in batches.
+     * Each wake-up reads up to receive_batch_size_ datagrams with a single recvmmsg call, and gives all of them
+     * to the receiver at once.
+     * @param input_locator - Locator that triggered the creation of the resource
+     */
+    void perform_batch_listen_operation(
+            const Locator& input_locator);
+#endif // if defined(__linux__)
+
     /**
      * Blocking Receive from the specified channel.
      * @param receive_buffer vector with enough capacity (not size) to accomodate a full receive buffer. That
@@ -206,6 +218,8 @@ private:
     bool only_multicast_purpose_;
     std::string interface_;
     UDPTransportInterface* transport_;
+    //! Maximum number of datagrams read on each receive operation.
+    uint32_t receive_batch_size_;
 
     UDPChannelResource(
             const UDPChannelResource&) = delete;
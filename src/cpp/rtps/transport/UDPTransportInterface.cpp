@@ -17,8 +17,15 @@
 #include <utility>
 #include <cstring>
 #include <algorithm>
+#include <array>
+#include <cerrno>
 #include <chrono>
 
+#if defined(__linux__)
+#include <sys/socket.h>
+#include <sys/uio.h>
+#endif // if defined(__linux__)
+
 #include <fastdds/rtps/transport/TransportInterface.h>
 #include <fastdds/rtps/messages/CDRMessage.h>
 #include <fastdds/dds/log/Log.hpp>
@@ -42,6 +49,55 @@ using PortParameters = fastrtps::rtps::PortParameters;
 using SenderResource = fastrtps::rtps::SenderResource;
 using Log = fastdds::dds::Log;
 
+#if defined(__linux__) && !defined(FASTDDS_STATISTICS)
+//! Maximum number of destinations given to each sendmmsg call.
+static constexpr size_t max_send_batch_size = 64;
+
+/**
+ * Give a batch of datagrams to the kernel with as few sendmmsg calls as possible.
+ * A destination that fails is skipped, and the rest of the batch is still sent.
+ * @return false when some datagram could not be sent because of an error other than a full buffer.
+ */
+static bool send_batch(
+        int socket_handle,
+        mmsghdr* headers,
+        size_t count)
+{
+    bool ret = true;
+    size_t sent = 0;
+
+    while (sent < count)
+    {
+        int result = sendmmsg(socket_handle, headers + sent, static_cast<unsigned int>(count - sent), 0);
+        if (0 < result)
+        {
+            sent += static_cast<size_t>(result);
+            continue;
+        }
+
+        int error = errno;
+        if (0 > result && EINTR == error)
+        {
+            continue;
+        }
+
+        if (0 > result && (EAGAIN == error || EWOULDBLOCK == error))
+        {
+            logWarning(RTPS_MSG_OUT, "UDP send would have blocked. Packet is dropped.");
+        }
+        else
+        {
+            logWarning(RTPS_MSG_OUT, "UDP send failed: " << std::strerror(error));
+            ret = false;
+        }
+        ++sent;
+    }
+
+    return ret;
+}
+
+#endif // if defined(__linux__) && !defined(FASTDDS_STATISTICS)
+
 UDPTransportDescriptor::UDPTransportDescriptor()
     : SocketTransportDescriptor(s_maximumMessageSize, s_maximumInitialPeersRange)
     , m_output_udp_socket(0)
@@ -53,6 +109,8 @@ bool UDPTransportDescriptor::operator ==(
 {
     return (this->m_output_udp_socket == t.m_output_udp_socket &&
            this->non_blocking_send == t.non_blocking_send &&
+           this->receive_batch_size == t.receive_batch_size &&
+           this->receive_threads_per_port == t.receive_threads_per_port &&
            SocketTransportDescriptor::operator ==(t));
 }
 
@@ -196,14 +254,34 @@ bool UDPTransportInterface::OpenAndBindInputSockets(
 {
     std::unique_lock<std::recursive_mutex> scopedLock(mInputMapMutex);
 
+    uint32_t sockets_per_interface = 1;
+#if defined(__linux__)
+    if (!is_multicast)
+    {
+        sockets_per_interface = (std::max)(configuration()->receive_threads_per_port, 1u);
+    }
+#endif // if defined(__linux__)
+    bool reuse_port = sockets_per_interface > 1;
+
     try
     {
         std::vector<std::string> vInterfaces = get_binding_interfaces_list();
         for (std::string sInterface : vInterfaces)
         {
-            UDPChannelResource* p_channel_resource;
-            p_channel_resource = CreateInputChannelResource(sInterface, locator, is_multicast, maxMsgSize, receiver);
-            mInputSockets[IPLocator::getPhysicalPort(locator)].push_back(p_channel_resource);
+            if (reuse_port)
+            {
+                // With SO_REUSEPORT the bind would also succeed on a port owned by another participant, so an
+                // exclusive bind is tried first. It throws when the port is in use, and the socket is closed on return.
+                OpenAndBindInputSocket(sInterface, IPLocator::getPhysicalPort(locator), false, false);
+            }
+
+            for (uint32_t i = 0; i < sockets_per_interface; ++i)
+            {
+                UDPChannelResource* p_channel_resource;
+                p_channel_resource = CreateInputChannelResource(sInterface, locator, is_multicast, reuse_port,
+                                maxMsgSize, receiver);
+                mInputSockets[IPLocator::getPhysicalPort(locator)].push_back(p_channel_resource);
+            }
         }
     }
     catch (asio::system_error const& e)
@@ -222,13 +300,14 @@ UDPChannelResource* UDPTransportInterface::CreateInputChannelResource(
         const std::string& sInterface,
         const Locator& locator,
         bool is_multicast,
+        bool reuse_port,
         uint32_t maxMsgSize,
         TransportReceiverInterface* receiver)
 {
     eProsimaUDPSocket unicastSocket = OpenAndBindInputSocket(sInterface,
-                    IPLocator::getPhysicalPort(locator), is_multicast);
+                    IPLocator::getPhysicalPort(locator), is_multicast, reuse_port);
     UDPChannelResource* p_channel_resource = new UDPChannelResource(this, unicastSocket, maxMsgSize, locator,
-                    sInterface, receiver);
+                    sInterface, receiver, configuration()->receive_batch_size);
     return p_channel_resource;
 }
 
@@ -464,6 +543,65 @@ bool UDPTransportInterface::send(
     auto time_out = std::chrono::duration_cast<std::chrono::microseconds>(
         max_blocking_time_point - std::chrono::steady_clock::now());
 
+#if defined(__linux__) && !defined(FASTDDS_STATISTICS)
+    // The same datagram goes to every destination, so all of them are given to the kernel at once.
+    // Not possible with statistics, as they write per-destination data on the datagram.
+    if (send_buffer_size > configuration()->sendBufferSize)
+    {
+        return false;
+    }
+
+    int socket_handle = getSocketPtr(socket)->native_handle();
+    struct timeval timeStruct;
+    timeStruct.tv_sec = 0;
+    timeStruct.tv_usec = time_out.count() > 0 ? time_out.count() : 0;
+    setsockopt(socket_handle, SOL_SOCKET, SO_SNDTIMEO, reinterpret_cast<const char*>(&timeStruct),
+            sizeof(timeStruct));
+
+    iovec datagram;
+    datagram.iov_base = const_cast<octet*>(send_buffer);
+    datagram.iov_len = send_buffer_size;
+
+    std::array<ip::udp::endpoint, max_send_batch_size> endpoints;
+    std::array<mmsghdr, max_send_batch_size> headers;
+    size_t count = 0;
+
+    while (it != *destination_locators_end)
+    {
+        if (IsLocatorSupported(*it))
+        {
+            if (IPLocator::isMulticast(*it) || !only_multicast_purpose)
+            {
+                endpoints[count] = generate_endpoint(*it, IPLocator::getPhysicalPort(*it));
+                std::memset(&headers[count], 0, sizeof(mmsghdr));
+                headers[count].msg_hdr.msg_name = endpoints[count].data();
+                headers[count].msg_hdr.msg_namelen = static_cast<socklen_t>(endpoints[count].size());
+                headers[count].msg_hdr.msg_iov = &datagram;
+                headers[count].msg_hdr.msg_iovlen = 1;
+
+                if (max_send_batch_size == ++count)
+                {
+                    ret &= send_batch(socket_handle, headers.data(), count);
+                    count = 0;
+                }
+            }
+            else
+            {
+                ret = false;
+            }
+        }
+
+        ++it;
+    }
+
+    if (0 < count)
+    {
+        ret &= send_batch(socket_handle, headers.data(), count);
+    }
+
+    logInfo(RTPS_MSG_OUT, "UDPTransport: " << send_buffer_size << " bytes FROM "
+                                           << getSocketPtr(socket)->local_endpoint());
+#else
     while (it != *destination_locators_end)
     {
         if (IsLocatorSupported(*it))
@@ -478,6 +616,7 @@ bool UDPTransportInterface::send(
 
         ++it;
     }
+#endif // if defined(__linux__) && !defined(FASTDDS_STATISTICS)
 
     return ret;
 }
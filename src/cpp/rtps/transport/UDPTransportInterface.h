@@ -231,12 +231,14 @@ protected:
             const std::string& sInterface,
             const Locator& locator,
             bool is_multicast,
+            bool reuse_port,
             uint32_t maxMsgSize,
             TransportReceiverInterface* receiver);
     virtual eProsimaUDPSocket OpenAndBindInputSocket(
             const std::string& sIp,
             uint16_t port,
-            bool is_multicast) = 0;
+            bool is_multicast,
+            bool reuse_port) = 0;
     eProsimaUDPSocket OpenAndBindUnicastOutputSocket(
             const asio::ip::udp::endpoint& endpoint,
             uint16_t& port);
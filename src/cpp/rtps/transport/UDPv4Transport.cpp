@@ -286,7 +286,8 @@ const std::string& UDPv4Transport::localhost_name()
 eProsimaUDPSocket UDPv4Transport::OpenAndBindInputSocket(
         const std::string& sIp,
         uint16_t port,
-        bool is_multicast)
+        bool is_multicast,
+        bool reuse_port)
 {
     eProsimaUDPSocket socket = createUDPSocket(io_service_);
     getSocketPtr(socket)->open(generate_protocol());
@@ -304,6 +305,16 @@ eProsimaUDPSocket UDPv4Transport::OpenAndBindInputSocket(
 #endif // if defined(__QNX__)
     }
 
+#if defined(__linux__)
+    if (reuse_port)
+    {
+        getSocketPtr(socket)->set_option(asio::detail::socket_option::boolean<
+                    ASIO_OS_DEF(SOL_SOCKET), SO_REUSEPORT>(true));
+    }
+#else
+    static_cast<void>(reuse_port);
+#endif // if defined(__linux__)
+
     getSocketPtr(socket)->bind(generate_endpoint(sIp, port));
     return socket;
 }
@@ -355,7 +366,7 @@ bool UDPv4Transport::OpenInputChannel(
                 {
                     // Bind to multicast address
                     UDPChannelResource* p_channel_resource;
-                    p_channel_resource = CreateInputChannelResource(locatorAddressStr, locator, true, maxMsgSize,
+                    p_channel_resource = CreateInputChannelResource(locatorAddressStr, locator, true, false, maxMsgSize,
                                     receiver);
                     mInputSockets[IPLocator::getPhysicalPort(locator)].push_back(p_channel_resource);
 
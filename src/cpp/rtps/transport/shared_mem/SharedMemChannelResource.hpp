@@ -21,28 +21,35 @@
 #include <rtps/transport/shared_mem/SharedMemManager.hpp>
 #include <rtps/transport/shared_mem/SharedMemTransport.h>
 #include <rtps/transport/ChannelResource.h>
+#include <rtps/resources/BusyPoller.hpp>
 
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
 
-class SharedMemChannelResource : public ChannelResource
+class SharedMemChannelResource : public ChannelResource, private fastrtps::rtps::BusyPoller::Source
 {
 public:
 
     using Log = fastdds::dds::Log;
 
+    /**
+     * @param busy_poller When not nullptr, the channel is polled by this thread instead of having its own
+     * listening thread.
+     */
     SharedMemChannelResource(
             std::shared_ptr<SharedMemManager::Listener> listener,
             const Locator& locator,
             TransportReceiverInterface* receiver,
             const std::string& dump_file,
-            bool should_init_thread = true)
+            bool should_init_thread = true,
+            fastrtps::rtps::BusyPoller* busy_poller = nullptr)
         : ChannelResource()
         , message_receiver_(receiver)
         , listener_(listener)
         , only_multicast_purpose_(false)
         , locator_(locator)
+        , busy_poller_(busy_poller)
     {
         if (!dump_file.empty())
         {
@@ -96,6 +103,17 @@ public:
         ChannelResource::disable();
     }
 
+    virtual void clear() override
+    {
+        if (nullptr != busy_poller_)
+        {
+            busy_poller_->remove_source(this);
+            message_receiver(nullptr);
+        }
+
+        ChannelResource::clear();
+    }
+
     const Locator& locator() const
     {
         return locator_;
@@ -130,56 +148,102 @@ private:
             // Blocking receive.
             std::shared_ptr<SharedMemManager::Buffer> message;
 
-            if (!(message = Receive(remote_locator)))
+            if (!(message = Receive(remote_locator, true)))
             {
                 continue;
             }
 
-            if (packet_logger_)
-            {
-                packet_logger_->QueueLog({packet_logger_->now(), input_locator, remote_locator, message});
-            }
+            process_message(message, input_locator, remote_locator);
+        }
 
-            // Processes the data through the CDR Message interface.
-            if (message_receiver() != nullptr)
-            {
-                message_receiver()->OnDataReceived(
-                    static_cast<fastrtps::rtps::octet*>(message->data()),
-                    message->size(),
-                    input_locator, remote_locator);
-            }
-            else if (alive())
-            {
-                logWarning(RTPS_MSG_IN, "Received Message, but no receiver attached");
-            }
+        message_receiver(nullptr);
+    }
 
-            // Forces message release before waiting for the next
-            message.reset();
-            listener_->stop_processing_buffer();
+    /**
+     * Called from the busy-poll thread instead of perform_listen_operation.
+     * @return true if a message was processed.
+     */
+    bool poll() override
+    {
+        if (!alive())
+        {
+            return false;
         }
 
-        message_receiver(nullptr);
+        Locator remote_locator;
+        std::shared_ptr<SharedMemManager::Buffer> message = Receive(remote_locator, false);
+
+        if (!message)
+        {
+            return false;
+        }
+
+        process_message(message, locator_, remote_locator);
+        return true;
+    }
+
+    void process_message(
+            std::shared_ptr<SharedMemManager::Buffer>& message,
+            const Locator& input_locator,
+            const Locator& remote_locator)
+    {
+        if (packet_logger_)
+        {
+            packet_logger_->QueueLog({packet_logger_->now(), input_locator, remote_locator, message});
+        }
+
+        // Processes the data through the CDR Message interface.
+        if (message_receiver() != nullptr)
+        {
+            message_receiver()->OnDataReceived(
+                static_cast<fastrtps::rtps::octet*>(message->data()),
+                message->size(),
+                input_locator, remote_locator);
+        }
+        else if (alive())
+        {
+            logWarning(RTPS_MSG_IN, "Received Message, but no receiver attached");
+        }
+
+        // Forces message release before waiting for the next
+        message.reset();
+        listener_->stop_processing_buffer();
     }
 
 protected:
 
+    /**
+     * Start receiving, either on a listening thread or from the busy-poll thread.
+     * Derived classes call it once they are fully constructed, as from then on Receive() may be called.
+     * @param locator - Locator that triggered the creation of the resource
+     */
     void init_thread(
             const Locator& locator)
     {
-        this->thread(std::thread(&SharedMemChannelResource::perform_listen_operation, this, locator));
+        if (nullptr != busy_poller_)
+        {
+            busy_poller_->add_source(this);
+        }
+        else
+        {
+            this->thread(std::thread(&SharedMemChannelResource::perform_listen_operation, this, locator));
+        }
     }
 
     /**
-     * Blocking Receive from the specified channel.
+     * Receive from the specified channel.
+     * @param remote_locator - Filled with the locator of the sender
+     * @param wait - Whether to block until a message arrives, false when called from the busy-poll thread
      */
     virtual std::shared_ptr<SharedMemManager::Buffer> Receive(
-            Locator& remote_locator)
+            Locator& remote_locator,
+            bool wait)
     {
         remote_locator.kind = LOCATOR_KIND_SHM;
 
         try
         {
-            return listener_->pop();
+            return wait ? listener_->pop() : listener_->try_pop();
         }
         catch (const std::exception& error)
         {
@@ -206,6 +270,9 @@ private:
     bool only_multicast_purpose_;
     Locator locator_;
 
+    //! Thread polling this channel, nullptr when it has its own listening thread.
+    fastrtps::rtps::BusyPoller* busy_poller_;
+
     SharedMemChannelResource(
             const SharedMemChannelResource&) = delete;
     SharedMemChannelResource& operator =(
@@ -15,10 +15,14 @@
 #ifndef _FASTDDS_SHAREDMEM_GLOBAL_H_
 #define _FASTDDS_SHAREDMEM_GLOBAL_H_
 
+#include <algorithm>
+#include <limits>
+#include <thread>
 #include <vector>
 #include <mutex>
 #include <memory>
 
+#include <utils/shared_memory/SharedMemFutex.hpp>
 #include <utils/shared_memory/SharedMemSegment.hpp>
 #include <utils/shared_memory/RobustExclusiveLock.hpp>
 #include <utils/shared_memory/RobustSharedLock.hpp>
@@ -75,6 +79,19 @@ public:
 
     static const uint32_t CURRENT_ABI_VERSION = 5;
 
+    /**
+     * Name of the port node on the port segment.
+     * Ports notified through the futex use a different name. Processes which only signal the condition variable do
+     * not find their node, and handle them as ports of an incompatible ABI, instead of leaving the listeners blocked
+     * until the wait timeout on every notification.
+     * @param [in] is_futex_notified Whether the port is notified through the futex.
+     */
+    static std::string port_node_name(
+            bool is_futex_notified)
+    {
+        return "port_node_abi" + std::to_string(CURRENT_ABI_VERSION) + (is_futex_notified ? "_futex" : "");
+    }
+
     struct PortNode
     {
         alignas(8) std::atomic<std::chrono::high_resolution_clock::rep> last_listeners_status_check_time_ms;
@@ -93,7 +110,8 @@ public:
         uint32_t is_port_ok : 1;
         uint32_t is_opened_read_exclusive : 1;
         uint32_t is_opened_for_reading : 1;
-        uint32_t pad : 29;
+        uint32_t is_futex_notified : 1;
+        uint32_t pad : 28;
 
         UUID<8> uuid;
 
@@ -129,6 +147,32 @@ public:
         ListenerStatus listeners_status[LISTENERS_STATUS_SIZE];
 
         char domain_name[MAX_DOMAIN_NAME_LENGTH + 1];
+
+        // Futex word, increased on every notification when is_futex_notified is set.
+        // It is kept at the end so the rest of the node keeps the layout of this ABI version. Nodes created
+        // without it are only found under the name of ports without futex, so it is never accessed on them.
+        alignas(8) std::atomic<uint32_t> notification_seq;
+    };
+
+    /**
+     * How the listeners of a port are notified of new buffers.
+     */
+    struct PortNotificationSettings
+    {
+        PortNotificationSettings()
+            : use_futex(false)
+            , max_spin_us(0)
+        {
+        }
+
+        /**
+         * Use a futex on the port node instead of the interprocess condition variable (Linux only).
+         * Only taken into account by the process creating the port, the others follow the port's mode.
+         */
+        bool use_futex;
+
+        //! Maximum time, in microseconds, a listener busy-waits for a buffer before blocking on the futex.
+        uint32_t max_spin_us;
     };
 
     /**
@@ -153,18 +197,143 @@ public:
         std::unique_ptr<RobustExclusiveLock> read_exclusive_lock_;
         std::unique_ptr<RobustSharedLock> read_shared_lock_;
 
+        PortNotificationSettings notification_;
+
+        // Current busy-wait window of the listeners in this process, adapted between
+        // notification_.max_spin_us / 8 and notification_.max_spin_us
+        std::atomic<uint32_t> spin_us_;
+
         inline void notify_unicast(
                 bool was_buffer_empty_before_push)
         {
             if (was_buffer_empty_before_push)
             {
-                node_->empty_cv.notify_one();
+                if (node_->is_futex_notified)
+                {
+                    node_->notification_seq.fetch_add(1, std::memory_order_release);
+                    // Listeners register as waiting before reading the sequence, so nobody can miss this one
+                    if (node_->waiting_count > 0)
+                    {
+                        SharedMemFutex::wake(&node_->notification_seq, 1);
+                    }
+                }
+                else
+                {
+                    node_->empty_cv.notify_one();
+                }
             }
         }
 
         inline void notify_multicast()
         {
-            node_->empty_cv.notify_all();
+            if (node_->is_futex_notified)
+            {
+                node_->notification_seq.fetch_add(1, std::memory_order_release);
+                if (node_->waiting_count > 0)
+                {
+                    SharedMemFutex::wake(&node_->notification_seq, (std::numeric_limits<int>::max)());
+                }
+            }
+            else
+            {
+                node_->empty_cv.notify_all();
+            }
+        }
+
+        /**
+         * Busy-wait for a buffer before blocking.
+         * The window is doubled when a buffer arrives during it and halved otherwise,
+         * so listeners of quiet ports stop burning CPU.
+         * @return true if the listener has a buffer or has been closed.
+         */
+        bool spin_wait(
+                Listener& listener,
+                const std::atomic<bool>& is_listener_closed)
+        {
+            uint32_t spin_us = spin_us_.load(std::memory_order_relaxed);
+            if (0 == spin_us)
+            {
+                return false;
+            }
+
+            auto spin_end = std::chrono::steady_clock::now() + std::chrono::microseconds(spin_us);
+            do
+            {
+                if (is_listener_closed.load() || listener.head() != nullptr)
+                {
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    spin_us_.store((std::min)(notification_.max_spin_us, spin_us * 2), std::memory_order_relaxed);
+                    return true;
+                }
+
+                SharedMemFutex::cpu_relax();
+            } while (std::chrono::steady_clock::now() < spin_end);
+
+            uint32_t min_spin_us = (std::max)(notification_.max_spin_us / 8, 1u);
+            spin_us_.store((std::max)(min_spin_us, spin_us / 2), std::memory_order_relaxed);
+            return false;
+        }
+
+        /**
+         * wait_pop implementation for ports notified through the futex.
+         * Listeners only take the port mutex to register themselves as waiting, so pushes
+         * arriving during the spin window don't need any system call.
+         */
+        void futex_wait_pop(
+                Listener& listener,
+                const std::atomic<bool>& is_listener_closed,
+                uint32_t listener_index)
+        {
+            if (spin_wait(listener, is_listener_closed))
+            {
+                return;
+            }
+
+            auto& status = node_->listeners_status[listener_index];
+
+            {
+                std::lock_guard<SharedMemSegment::mutex> lock(node_->empty_cv_mutex);
+
+                if (!node_->is_port_ok)
+                {
+                    throw std::runtime_error("port marked as not ok");
+                }
+
+                // Update this listener status
+                status.is_waiting = 1;
+                status.counter = status.last_verified_counter + 1;
+                node_->waiting_count++;
+            }
+
+            // Writers increase the sequence after pushing, so reading it before checking the
+            // condition ensures the futex wait returns immediately if a push is missed.
+            do
+            {
+                uint32_t seq = node_->notification_seq.load(std::memory_order_acquire);
+
+                if (is_listener_closed.load() || listener.head() != nullptr)
+                {
+                    break; // Condition met, Break the while
+                }
+
+                if (!SharedMemFutex::wait(&node_->notification_seq, seq,
+                        std::chrono::milliseconds(node_->port_wait_timeout_ms)))
+                {
+                    // Timeout
+                    std::lock_guard<SharedMemSegment::mutex> lock(node_->empty_cv_mutex);
+
+                    if (!node_->is_port_ok)
+                    {
+                        throw std::runtime_error("port marked as not ok");
+                    }
+
+                    status.counter = status.last_verified_counter + 1;
+                }
+            } while (1);
+
+            std::lock_guard<SharedMemSegment::mutex> lock(node_->empty_cv_mutex);
+            node_->waiting_count--;
+            status.is_waiting = 0;
         }
 
         /**
@@ -397,13 +566,23 @@ public:
         Port(
                 std::shared_ptr<SharedMemSegment>&& port_segment,
                 PortNode* node,
-                std::unique_ptr<RobustExclusiveLock>&& read_exclusive_lock = std::unique_ptr<RobustExclusiveLock>())
+                std::unique_ptr<RobustExclusiveLock>&& read_exclusive_lock = std::unique_ptr<RobustExclusiveLock>(),
+                const PortNotificationSettings& notification = PortNotificationSettings())
             : port_segment_(std::move(port_segment))
             , node_(node)
             , overflows_count_(0)
             , read_exclusive_lock_(std::move(read_exclusive_lock))
+            , notification_(notification)
+            , spin_us_(notification.max_spin_us)
             , watch_task_(WatchTask::get())
         {
+            // With a single CPU the spinning listener would delay the writer it is waiting for
+            if (std::thread::hardware_concurrency() == 1)
+            {
+                notification_.max_spin_us = 0;
+                spin_us_ = 0;
+            }
+
             auto buffer_base = static_cast<MultiProducerConsumerRingBuffer<BufferDescriptor>::Cell*>(
                 port_segment_->get_address_from_offset(node_->buffer));
 
@@ -529,6 +708,12 @@ public:
         {
             try
             {
+                if (node_->is_futex_notified)
+                {
+                    futex_wait_pop(listener, is_listener_closed, listener_index);
+                    return;
+                }
+
                 std::unique_lock<SharedMemSegment::mutex> lock(node_->empty_cv_mutex);
 
                 if (!node_->is_port_ok)
@@ -606,6 +791,16 @@ public:
             return node_->max_buffer_descriptors;
         }
 
+        inline const PortNotificationSettings& notification_settings() const
+        {
+            return notification_;
+        }
+
+        inline bool is_futex_notified() const
+        {
+            return node_->is_futex_notified;
+        }
+
         /**
          * Set the caller's 'is_closed' flag (protecting empty_cv_mutex) and
          * forces wake-up all listeners on this port.
@@ -622,7 +817,7 @@ public:
                 is_listener_closed->exchange(true);
             }
 
-            node_->empty_cv.notify_all();
+            notify_multicast();
         }
 
         /**
@@ -891,6 +1086,8 @@ public:
      * @param [in] max_buffer_descriptors Capacity of the port (only used if the port is created)
      * @param [in] healthy_check_timeout_ms Timeout for healthy check test
      * @param [in] open_mode Can be ReadShared, ReadExclusive or Write (see Port::OpenMode enum).
+     * @param [in] notification How listeners are notified (the notification mechanism is only used if the port is
+     * created).
      *
      * @return A shared_ptr to the new port or nullptr if the open_mode is ReadExclusive and the port_id is already opened.
      * @remarks This function performs a test to validate whether the existing port is OK, if the test
@@ -900,9 +1097,11 @@ public:
             uint32_t port_id,
             uint32_t max_buffer_descriptors,
             uint32_t healthy_check_timeout_ms,
-            Port::OpenMode open_mode = Port::OpenMode::ReadShared)
+            Port::OpenMode open_mode = Port::OpenMode::ReadShared,
+            const PortNotificationSettings& notification = PortNotificationSettings())
     {
-        return open_port_internal(port_id, max_buffer_descriptors, healthy_check_timeout_ms, open_mode, nullptr);
+        return open_port_internal(port_id, max_buffer_descriptors, healthy_check_timeout_ms, open_mode, notification,
+                       nullptr);
     }
 
     /**
@@ -920,6 +1119,7 @@ public:
             port->max_buffer_descriptors(),
             port->healthy_check_timeout_ms(),
             open_mode,
+            port->notification_settings(),
             port);
     }
 
@@ -947,6 +1147,7 @@ private:
             uint32_t max_buffer_descriptors,
             uint32_t healthy_check_timeout_ms,
             Port::OpenMode open_mode,
+            const PortNotificationSettings& notification,
             std::shared_ptr<Port> regenerating_port)
     {
         std::string err_reason;
@@ -1000,12 +1201,17 @@ private:
                     throw std::runtime_error("check_sanity failed");
                 }
 
-                port_node = port_segment->get().find<PortNode>(
-                    ("port_node_abi" + std::to_string(CURRENT_ABI_VERSION)).c_str()).first;
+                // The port may have been created with any notification mechanism
+                port_node = port_segment->get().find<PortNode>(port_node_name(false).c_str()).first;
+                if (!port_node)
+                {
+                    port_node = port_segment->get().find<PortNode>(port_node_name(true).c_str()).first;
+                }
 
                 if (port_node)
                 {
-                    port = std::make_shared<Port>(std::move(port_segment), port_node);
+                    port = std::make_shared<Port>(std::move(port_segment), port_node,
+                                    std::unique_ptr<RobustExclusiveLock>(), notification);
                 }
                 else
                 {
@@ -1108,7 +1314,7 @@ private:
 
                     port =
                             init_port(port_id, port_segment, max_buffer_descriptors, open_mode,
-                                    healthy_check_timeout_ms);
+                                    healthy_check_timeout_ms, notification);
                 }
                 catch (std::exception& e)
                 {
@@ -1135,7 +1341,8 @@ private:
             std::unique_ptr<SharedMemSegment>& segment,
             uint32_t max_buffer_descriptors,
             Port::OpenMode open_mode,
-            uint32_t healthy_check_timeout_ms)
+            uint32_t healthy_check_timeout_ms,
+            const PortNotificationSettings& notification)
     {
         std::shared_ptr<Port> port;
         PortNode* port_node = nullptr;
@@ -1148,13 +1355,14 @@ private:
         }
 
         // Port node allocation
-        port_node =
-                segment->get().construct<PortNode>(("port_node_abi" +
-                        std::to_string(CURRENT_ABI_VERSION)).c_str())();
+        bool is_futex_notified = notification.use_futex && SharedMemFutex::is_supported();
+        port_node = segment->get().construct<PortNode>(port_node_name(is_futex_notified).c_str())();
         port_node->is_port_ok = false;
         port_node->port_id = port_id;
         UUID<8>::generate(port_node->uuid);
         port_node->waiting_count = 0;
+        port_node->notification_seq = 0;
+        port_node->is_futex_notified = is_futex_notified;
         port_node->is_opened_read_exclusive = (open_mode == Port::OpenMode::ReadExclusive);
         port_node->is_opened_for_reading = (open_mode != Port::OpenMode::Write);
         port_node->num_listeners = 0;
@@ -1187,7 +1395,7 @@ private:
         port_node->buffer_node = segment->get_offset_from_address(buffer_node);
 
         port_node->is_port_ok = true;
-        port = std::make_shared<Port>(std::move(segment), port_node, std::move(lock_read_exclusive));
+        port = std::make_shared<Port>(std::move(segment), port_node, std::move(lock_read_exclusive), notification);
 
         if (open_mode == Port::OpenMode::ReadShared)
         {
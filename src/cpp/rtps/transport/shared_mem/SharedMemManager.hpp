@@ -339,6 +339,8 @@ public:
         BufferNode* buffer_node_;
         void* data_;
         uint32_t original_validity_id_;
+
+        friend class SharedMemManager;
     };
 
     /**
@@ -353,7 +355,8 @@ public:
                 uint32_t size,
                 uint32_t payload_size,
                 uint32_t max_allocations,
-                const std::string& domain_name)
+                const std::string& domain_name,
+                const SharedMemSegment::MemoryPolicy& memory_policy = SharedMemSegment::MemoryPolicy())
             : segment_id_()
             , overflows_count_(0)
         {
@@ -374,6 +377,8 @@ public:
                 throw;
             }
 
+            segment_->apply_memory_policy(memory_policy);
+
             free_bytes_ = payload_size;
 
             // Alloc the buffer nodes
@@ -479,6 +484,26 @@ public:
             return new_buffer;
         }
 
+        /**
+         * Reduce the size of a buffer not yet pushed to any port, so listeners only receive its first bytes.
+         * The memory is still released with the whole buffer.
+         * @param buffer Buffer allocated on this segment.
+         * @param size New size of the buffer, not greater than the current one.
+         */
+        void shrink_buffer(
+                const std::shared_ptr<Buffer>& buffer,
+                uint32_t size)
+        {
+            std::lock_guard<std::mutex> lock(alloc_mutex_);
+
+            BufferNode* buffer_node = std::static_pointer_cast<SharedMemBuffer>(buffer)->buffer_node_;
+            if (size < buffer_node->data_size)
+            {
+                shrunk_bytes_[buffer_node] += buffer_node->data_size - size;
+                buffer_node->data_size = size;
+            }
+        }
+
         uint64_t mem_size()
         {
             return segment_->mem_size();
@@ -501,6 +526,9 @@ public:
 
         uint32_t free_bytes_;
 
+        //! Bytes allocated for shrunk buffers that are not accounted in their data_size.
+        std::unordered_map<BufferNode*, uint32_t> shrunk_bytes_;
+
         void generate_segment_id_and_name(
                 const std::string& domain_name)
         {
@@ -550,6 +578,16 @@ public:
                 segment_->get_address_from_offset(buffer_node->data_offset));
 
             free_bytes_ += buffer_node->data_size;
+
+            if (!shrunk_bytes_.empty())
+            {
+                auto shrunk = shrunk_bytes_.find(buffer_node);
+                if (shrunk != shrunk_bytes_.end())
+                {
+                    free_bytes_ += shrunk->second;
+                    shrunk_bytes_.erase(shrunk);
+                }
+            }
         }
 
         /**
@@ -677,6 +715,49 @@ public:
          * @remark Multithread not supported.
          */
         std::shared_ptr<Buffer> pop()
+        {
+            return pop_buffer(true);
+        }
+
+        /**
+         * Extract the first buffer enqueued in the port, without blocking.
+         * @return A shared_ptr to the buffer, this shared_ptr is nullptr if the
+         * queue is empty or on errors or close operations.
+         * @remark Multithread not supported.
+         */
+        std::shared_ptr<Buffer> try_pop()
+        {
+            return pop_buffer(false);
+        }
+
+        void stop_processing_buffer()
+        {
+            global_port_->listener_processing_stop(listener_index_);
+        }
+
+        void regenerate_port()
+        {
+            auto new_port = shared_mem_manager_->regenerate_port(global_port_, global_port_->open_mode());
+
+            auto new_listener = new_port->create_listener();
+
+            *this = std::move(*new_listener);
+        }
+
+        /**
+         * Unblock a thread blocked in pop() call, not allowing pop() to block again.
+         * @throw std::exception on error
+         */
+        void close()
+        {
+            // Just in case a thread is blocked in pop() function
+            global_port_->close_listener(&is_closed_);
+        }
+
+    private:
+
+        std::shared_ptr<Buffer> pop_buffer(
+                bool wait_for_data)
         {
             std::shared_ptr<Buffer> buffer_ref;
             bool is_buffer_valid = false;
@@ -692,6 +773,11 @@ public:
 
                     while ( !is_closed_.load() && nullptr == (head_cell = global_listener_->head()))
                     {
+                        if (!wait_for_data)
+                        {
+                            return nullptr;
+                        }
+
                         // Wait until there's data to pop
                         global_port_->wait_pop(*global_listener_, is_closed_, listener_index_);
                     }
@@ -764,32 +850,6 @@ public:
             return buffer_ref;
         }
 
-        void stop_processing_buffer()
-        {
-            global_port_->listener_processing_stop(listener_index_);
-        }
-
-        void regenerate_port()
-        {
-            auto new_port = shared_mem_manager_->regenerate_port(global_port_, global_port_->open_mode());
-
-            auto new_listener = new_port->create_listener();
-
-            *this = std::move(*new_listener);
-        }
-
-        /**
-         * Unblock a thread blocked in pop() call, not allowing pop() to block again.
-         * @throw std::exception on error
-         */
-        void close()
-        {
-            // Just in case a thread is blocked in pop() function
-            global_port_->close_listener(&is_closed_);
-        }
-
-    private:
-
         std::shared_ptr<SharedMemGlobal::Port> global_port_;
 
         std::unique_ptr<SharedMemGlobal::Listener> global_listener_;
@@ -933,14 +993,16 @@ public:
      * Creates a shared-memory segment
      * @param size size of the segment
      * @param max_buffers maximum, at a time, allocated buffers
+     * @param memory_policy placement of the segment memory
      * @return A shared_ptr to the segment
      */
     std::shared_ptr<Segment> create_segment(
             uint32_t size,
-            uint32_t max_allocations)
+            uint32_t max_allocations,
+            const SharedMemSegment::MemoryPolicy& memory_policy = SharedMemSegment::MemoryPolicy())
     {
         return std::make_shared<Segment>(size + segment_allocation_extra_size(max_allocations), size, max_allocations,
-                       global_segment_.domain_name());
+                       global_segment_.domain_name(), memory_policy);
     }
 
     /**
@@ -965,10 +1027,12 @@ public:
             uint32_t port_id,
             uint32_t max_descriptors,
             uint32_t healthy_check_timeout_ms,
-            SharedMemGlobal::Port::OpenMode open_mode = SharedMemGlobal::Port::OpenMode::ReadShared)
+            SharedMemGlobal::Port::OpenMode open_mode = SharedMemGlobal::Port::OpenMode::ReadShared,
+            const SharedMemGlobal::PortNotificationSettings& notification = SharedMemGlobal::PortNotificationSettings())
     {
         return std::make_shared<Port>(this,
-                       global_segment_.open_port(port_id, max_descriptors, healthy_check_timeout_ms, open_mode),
+                       global_segment_.open_port(port_id, max_descriptors, healthy_check_timeout_ms, open_mode,
+                       notification),
                        open_mode);
     }
 
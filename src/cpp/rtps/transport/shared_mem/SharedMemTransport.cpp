@@ -250,11 +250,24 @@ bool SharedMemTransport::init()
         return false;
     }
 
+    port_notification_.use_futex = configuration_.futex_notification();
+    port_notification_.max_spin_us = configuration_.notification_spin_us();
+
+    if (port_notification_.use_futex && !SharedMemFutex::is_supported())
+    {
+        logWarning(RTPS_MSG_OUT, "futex_notification is not supported on this platform. "
+                "Condition variables will be used.");
+        port_notification_.use_futex = false;
+    }
+
     try
     {
         shared_mem_manager_ = SharedMemManager::create(SHM_MANAGER_DOMAIN);
+        SharedMemSegment::MemoryPolicy memory_policy;
+        memory_policy.huge_pages = configuration_.huge_pages();
+        memory_policy.numa_node = configuration_.numa_node();
         shared_mem_segment_ = shared_mem_manager_->create_segment(configuration_.segment_size(),
-                        configuration_.port_queue_capacity());
+                        configuration_.port_queue_capacity(), memory_policy);
 
         // Memset the whole segment to zero in order to force physical map of the buffer
         auto buffer = shared_mem_segment_->alloc_buffer(configuration_.segment_size(),
@@ -315,10 +328,13 @@ SharedMemChannelResource* SharedMemTransport::CreateInputChannelResource(
             locator.port,
             configuration_.port_queue_capacity(),
             configuration_.healthy_check_timeout_ms(),
-            open_mode)->create_listener(),
+            open_mode,
+            port_notification_)->create_listener(),
         locator,
         receiver,
-        configuration_.rtps_dump_file());
+        configuration_.rtps_dump_file(),
+        true,
+        busy_poller_);
 }
 
 bool SharedMemTransport::OpenOutputChannel(
@@ -401,6 +417,73 @@ std::shared_ptr<SharedMemManager::Buffer> SharedMemTransport::copy_to_shared_buf
     return shared_buffer;
 }
 
+octet* SharedMemTransport::loan_buffer(
+        uint32_t size)
+{
+    if (0 == configuration_.zero_copy_min_size() || size < configuration_.zero_copy_min_size() ||
+            !shared_mem_segment_)
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr<SharedMemManager::Buffer> shared_buffer;
+    try
+    {
+        shared_buffer = shared_mem_segment_->alloc_buffer(size, std::chrono::steady_clock::now());
+    }
+    catch (const std::exception& e)
+    {
+        // The message will be copied to the segment when sent
+        logInfo(RTPS_TRANSPORT_SHM, "Cannot loan buffer: " << e.what());
+        (void)e;
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(loans_mutex_);
+    loans_.push_back(shared_buffer);
+    loans_count_.store(static_cast<uint32_t>(loans_.size()));
+    return static_cast<octet*>(shared_buffer->data());
+}
+
+void SharedMemTransport::return_loan(
+        const octet* data)
+{
+    std::lock_guard<std::mutex> lock(loans_mutex_);
+    auto it = std::find_if(loans_.begin(), loans_.end(),
+                    [data](const std::shared_ptr<SharedMemManager::Buffer>& buffer)
+                    {
+                        return buffer->data() == data;
+                    });
+    if (it != loans_.end())
+    {
+        loans_.erase(it);
+        loans_count_.store(static_cast<uint32_t>(loans_.size()));
+    }
+}
+
+std::shared_ptr<SharedMemManager::Buffer> SharedMemTransport::find_loan(
+        const octet* send_buffer,
+        uint32_t send_buffer_size)
+{
+    if (0 == loans_count_.load())
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(loans_mutex_);
+    for (const std::shared_ptr<SharedMemManager::Buffer>& buffer : loans_)
+    {
+        if (buffer->data() == send_buffer && send_buffer_size <= buffer->size())
+        {
+            // Listeners take the size of the buffer as the size of the message
+            shared_mem_segment_->shrink_buffer(buffer, send_buffer_size);
+            return buffer;
+        }
+    }
+
+    return nullptr;
+}
+
 bool SharedMemTransport::send(
         const octet* send_buffer,
         uint32_t send_buffer_size,
@@ -422,11 +505,16 @@ bool SharedMemTransport::send(
         {
             if (IsLocatorSupported(*it))
             {
-                // Only copy the first time
+                // Only copy the first time, and only when the message was not built on a loaned buffer
                 if (shared_buffer == nullptr)
                 {
                     remove_statistics_submessage(send_buffer, send_buffer_size);
-                    shared_buffer = copy_to_shared_buffer(send_buffer, send_buffer_size, max_blocking_time_point);
+                    shared_buffer = find_loan(send_buffer, send_buffer_size);
+                    if (shared_buffer == nullptr)
+                    {
+                        shared_buffer = copy_to_shared_buffer(send_buffer, send_buffer_size,
+                                        max_blocking_time_point);
+                    }
                 }
 
                 ret &= send(shared_buffer, *it);
@@ -474,7 +562,7 @@ std::shared_ptr<SharedMemManager::Port> SharedMemTransport::find_port(
     // The port is not opened
     std::shared_ptr<SharedMemManager::Port> port = shared_mem_manager_->
                     open_port(port_id, configuration_.port_queue_capacity(), configuration_.healthy_check_timeout_ms(),
-                    SharedMemGlobal::Port::OpenMode::Write);
+                    SharedMemGlobal::Port::OpenMode::Write, port_notification_);
 
     opened_ports_[port_id] = port;
 
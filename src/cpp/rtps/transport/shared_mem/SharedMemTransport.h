@@ -21,9 +21,20 @@
 #include <rtps/transport/shared_mem/SharedMemManager.hpp>
 #include <rtps/transport/shared_mem/SharedMemLog.hpp>
 
+#include <atomic>
 #include <map>
+#include <mutex>
+#include <vector>
 
 namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class BusyPoller;
+
+} // namespace rtps
+} // namespace fastrtps
+
 namespace fastdds {
 namespace rtps {
 
@@ -191,6 +202,40 @@ public:
         return (std::numeric_limits<uint32_t>::max)();
     }
 
+    /**
+     * Poll the input channels opened from now on with a busy-poll thread, instead of
+     * creating a listening thread for each of them.
+     * @param busy_poller Polling thread. It should outlive the transport.
+     */
+    void busy_poller(
+            fastrtps::rtps::BusyPoller* busy_poller)
+    {
+        busy_poller_ = busy_poller;
+    }
+
+    /**
+     * Allocate a buffer on the segment of this transport, where a message can be built and then sent
+     * without copying it to the segment.
+     * @param size Maximum size of the message.
+     * @return Address of the buffer, or nullptr if size is smaller than the configured zero_copy_min_size
+     * or the segment has no room. Once the message has been sent, the buffer must be given back with return_loan.
+     */
+    fastrtps::rtps::octet* loan_buffer(
+            uint32_t size);
+
+    /**
+     * Give back a buffer obtained from loan_buffer. Messages already sent from it are not affected.
+     * @param data Address returned by loan_buffer.
+     */
+    void return_loan(
+            const fastrtps::rtps::octet* data);
+
+    //! Minimum size of the buffers loaned by this transport, 0 when loans are disabled.
+    uint32_t zero_copy_min_size() const
+    {
+        return configuration_.zero_copy_min_size();
+    }
+
 private:
 
     //! Constructor with no descriptor is necessary for implementations derived from this class.
@@ -206,6 +251,12 @@ protected:
 
     std::shared_ptr<SharedMemManager> shared_mem_manager_;
 
+    //! How the ports created by this transport notify their listeners.
+    SharedMemGlobal::PortNotificationSettings port_notification_;
+
+    //! Thread polling the input channels, nullptr when each channel has its own listening thread.
+    fastrtps::rtps::BusyPoller* busy_poller_ = nullptr;
+
 private:
 
     void clean_up();
@@ -220,6 +271,15 @@ private:
 
     std::shared_ptr<PacketsLog<SHMPacketFileConsumer>> packet_logger_;
 
+    //! Protects loans_.
+    std::mutex loans_mutex_;
+
+    //! Buffers given by loan_buffer and not returned yet.
+    std::vector<std::shared_ptr<SharedMemManager::Buffer>> loans_;
+
+    //! Size of loans_, so sending a message does not take loans_mutex_ when there are no loans.
+    std::atomic<uint32_t> loans_count_{0};
+
     friend class SharedMemChannelResource;
 
 protected:
@@ -242,6 +302,14 @@ private:
             uint32_t send_buffer_size,
             const std::chrono::steady_clock::time_point& max_blocking_time_point);
 
+    /**
+     * Get the loaned buffer a message has been built on.
+     * @return nullptr if the message is not on a loaned buffer.
+     */
+    std::shared_ptr<SharedMemManager::Buffer> find_loan(
+            const fastrtps::rtps::octet* send_buffer,
+            uint32_t send_buffer_size);
+
     bool send(
             const std::shared_ptr<SharedMemManager::Buffer>& buffer,
             const Locator& remote_locator);
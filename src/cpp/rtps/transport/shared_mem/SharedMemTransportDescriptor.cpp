@@ -24,6 +24,7 @@ namespace rtps {
 static constexpr uint32_t shm_default_segment_size = 0;
 static constexpr uint32_t shm_default_port_queue_capacity = 512;
 static constexpr uint32_t shm_default_healthy_check_timeout_ms = 1000;
+static constexpr uint32_t shm_default_notification_spin_us = 50;
 
 } // rtps
 } // fastdds
@@ -38,6 +39,11 @@ SharedMemTransportDescriptor::SharedMemTransportDescriptor()
     , port_queue_capacity_(shm_default_port_queue_capacity)
     , healthy_check_timeout_ms_(shm_default_healthy_check_timeout_ms)
     , rtps_dump_file_("")
+    , futex_notification_(false)
+    , notification_spin_us_(shm_default_notification_spin_us)
+    , zero_copy_min_size_(0)
+    , huge_pages_(false)
+    , numa_node_(-1)
 {
     maxMessageSize = s_maximumMessageSize;
 }
@@ -49,6 +55,11 @@ bool SharedMemTransportDescriptor::operator ==(
            this->port_queue_capacity_ == t.port_queue_capacity() &&
            this->healthy_check_timeout_ms_ == t.healthy_check_timeout_ms() &&
            this->rtps_dump_file_ == t.rtps_dump_file() &&
+           this->futex_notification_ == t.futex_notification() &&
+           this->notification_spin_us_ == t.notification_spin_us() &&
+           this->zero_copy_min_size_ == t.zero_copy_min_size() &&
+           this->huge_pages_ == t.huge_pages() &&
+           this->numa_node_ == t.numa_node() &&
            TransportDescriptorInterface::operator ==(t));
 }
 
@@ -32,8 +32,9 @@ public:
             const Locator& locator,
             TransportReceiverInterface* receiver,
             uint32_t big_buffer_size,
-            uint32_t* big_buffer_size_count)
-        : SharedMemChannelResource(listener, locator, receiver, std::string(), false)
+            uint32_t* big_buffer_size_count,
+            fastrtps::rtps::BusyPoller* busy_poller = nullptr)
+        : SharedMemChannelResource(listener, locator, receiver, std::string(), false, busy_poller)
         , big_buffer_size_(big_buffer_size)
         , big_buffer_size_count_(big_buffer_size_count)
     {
@@ -50,16 +51,17 @@ protected:
     uint32_t* big_buffer_size_count_;
 
     /**
-     * Blocking Receive from the specified channel.
+     * Receive from the specified channel.
      */
     std::shared_ptr<SharedMemManager::Buffer> Receive(
-            Locator& remote_locator) override
+            Locator& remote_locator,
+            bool wait) override
     {
         remote_locator.kind = LOCATOR_KIND_SHM;
 
         try
         {
-            auto ret = listener_->pop();
+            auto ret = wait ? listener_->pop() : listener_->try_pop();
 
             if (ret && ret->size() >= big_buffer_size_)
             {
@@ -80,11 +80,13 @@ SharedMemChannelResource* test_SharedMemTransport::CreateInputChannelResource(
             locator.port,
             configuration()->port_queue_capacity(),
             configuration()->healthy_check_timeout_ms(),
-            open_mode)->create_listener(),
+            open_mode,
+            port_notification_)->create_listener(),
         locator,
         receiver,
         big_buffer_size_,
-        big_buffer_size_recv_count_);
+        big_buffer_size_recv_count_,
+        busy_poller_);
 }
 
 }  // namespace rtps
@@ -54,6 +54,7 @@ RTPSWriter::RTPSWriter(
     , mp_history(hist)
     , mp_listener(listen)
     , is_async_(att.mode == SYNCHRONOUS_WRITER ? false : true)
+    , async_priority_(att.async_priority)
     , locator_selector_(att.matched_readers_allocation)
     , all_remote_readers_(att.matched_readers_allocation)
     , all_remote_participants_(att.matched_readers_allocation)
@@ -95,6 +96,7 @@ RTPSWriter::RTPSWriter(
     , mp_history(hist)
     , mp_listener(listen)
     , is_async_(att.mode == SYNCHRONOUS_WRITER ? false : true)
+    , async_priority_(att.async_priority)
     , locator_selector_(att.matched_readers_allocation)
     , all_remote_readers_(att.matched_readers_allocation)
     , all_remote_participants_(att.matched_readers_allocation)
@@ -120,8 +122,14 @@ void RTPSWriter::init(
 
     if (att.endpoint.data_sharing_configuration().kind() != OFF)
     {
+        const DataSharingQosPolicy& data_sharing = att.endpoint.data_sharing_configuration();
+        WriterPool::Segment::MemoryPolicy memory_policy;
+        memory_policy.huge_pages = data_sharing.huge_pages();
+        memory_policy.numa_node = data_sharing.numa_node();
+        memory_policy.prefault = data_sharing.prefault();
+
         std::shared_ptr<WriterPool> pool = std::dynamic_pointer_cast<WriterPool>(payload_pool);
-        if (!pool || !pool->init_shared_memory(this, att.endpoint.data_sharing_configuration().shm_directory()))
+        if (!pool || !pool->init_shared_memory(this, data_sharing.shm_directory(), memory_policy))
         {
             logError(RTPS_WRITER, "Could not initialize DataSharing writer pool");
         }
@@ -222,6 +230,70 @@ bool RTPSWriter::release_change(
     return change_pool_->release_cache(change);
 }
 
+void RTPSWriter::begin_coherent_set()
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    coherent_set_open_ = true;
+    coherent_set_first_ = SequenceNumber_t::unknown();
+}
+
+void RTPSWriter::end_coherent_set()
+{
+    {
+        std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+        if (!coherent_set_open_)
+        {
+            return;
+        }
+
+        coherent_set_open_ = false;
+
+        // Changes of the set have been held, so the last one can still be marked before being sent.
+        CacheChange_t* last_change = nullptr;
+        if (coherent_set_first_ != SequenceNumber_t::unknown() &&
+                mp_history->get_max_change(&last_change) && last_change != nullptr &&
+                last_change->write_params.coherent_set() == coherent_set_first_)
+        {
+            last_change->write_params.coherent_set_end(true);
+
+            auto max_blocking_time = std::chrono::steady_clock::now() + std::chrono::hours(24);
+            for (auto it = mp_history->changesBegin(); it != mp_history->changesEnd(); ++it)
+            {
+                if ((*it)->sequenceNumber >= coherent_set_first_)
+                {
+                    release_held_change_nts(*it, max_blocking_time);
+                }
+            }
+        }
+        coherent_set_first_ = SequenceNumber_t::unknown();
+    }
+
+    if (isAsync())
+    {
+        mp_RTPSParticipant->async_thread().wake_up(this);
+    }
+    else
+    {
+        send_any_unsent_changes();
+    }
+}
+
+bool RTPSWriter::add_to_coherent_set_nts(
+        CacheChange_t* change)
+{
+    if (!coherent_set_open_)
+    {
+        return false;
+    }
+
+    if (coherent_set_first_ == SequenceNumber_t::unknown())
+    {
+        coherent_set_first_ = change->sequenceNumber;
+    }
+    change->write_params.coherent_set(coherent_set_first_);
+    return true;
+}
+
 SequenceNumber_t RTPSWriter::get_seq_num_min()
 {
     CacheChange_t* change;
@@ -248,6 +320,17 @@ SequenceNumber_t RTPSWriter::get_seq_num_max()
     }
 }
 
+SequenceNumber_t RTPSWriter::get_seq_num_max_not_held_nts()
+{
+    SequenceNumber_t last_seq = get_seq_num_max();
+    if (last_seq != c_SequenceNumber_Unknown && is_held_nts(last_seq))
+    {
+        // Announce the history as if the held changes had not been added yet
+        last_seq = coherent_set_first_ - 1;
+    }
+    return last_seq;
+}
+
 uint32_t RTPSWriter::getTypeMaxSerialized()
 {
     return mp_history->getTypeMaxSerialized();
@@ -395,6 +478,17 @@ bool RTPSWriter::is_datasharing_compatible() const
     return (m_att.data_sharing_configuration().kind() != OFF);
 }
 
+void RTPSWriter::reader_data_filter(
+        fastdds::rtps::IReaderDataFilter* reader_data_filter)
+{
+    reader_data_filter_ = reader_data_filter;
+}
+
+const fastdds::rtps::IReaderDataFilter* RTPSWriter::reader_data_filter() const
+{
+    return reader_data_filter_;
+}
+
 bool RTPSWriter::is_datasharing_compatible_with(
         const ReaderProxyData& rdata) const
 {
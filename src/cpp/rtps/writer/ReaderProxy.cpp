@@ -31,15 +31,33 @@
 
 #include "rtps/messages/RTPSGapBuilder.hpp"
 #include <rtps/DataSharing/DataSharingNotifier.hpp>
+#include <utils/collections/word_bitmap.hpp>
 
 #include <mutex>
 #include <cassert>
 #include <algorithm>
+#include <limits>
 
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+/*
+ * The state of the changes for the reader is kept on a window of consecutive sequence numbers starting at
+ * window_base_. Each position holds a pointer to the change, and one bit on the bitmap of its status.
+ * Positions without a bit set on any status bitmap are holes (removed or irrelevant changes).
+ *
+ * The window lives on a ring allocated when the proxy is created. Each sequence number has a fixed slot on the
+ * ring, so moving the window never moves its contents. The base of the window is always a multiple of 32, so the
+ * words of the bitmaps hold the same positions on the window and on the ring. The base is kept on the word of the
+ * first change, and the ring grows whenever the changes span more positions than it holds.
+ */
+
+using utilities::collections::bit_mask;
+using utilities::collections::count_bits;
+using utilities::collections::first_bit_set;
+using utilities::collections::last_bit_set;
+
 ReaderProxy::ReaderProxy(
         const WriterTimes& times,
         const RemoteLocatorsAllocationAttributes& loc_alloc,
@@ -53,14 +71,19 @@ ReaderProxy::ReaderProxy(
     , is_reliable_(false)
     , disable_positive_acks_(false)
     , writer_(writer)
-    , changes_for_reader_(resource_limits_from_history(writer->mp_history->m_att, 0))
+    , window_size_(0)
+    , partial_fragments_(ResourceLimitedContainerConfig(4u,
+            resource_limits_from_history(writer->mp_history->m_att, 0).maximum, 4u))
+    , num_changes_(0)
     , nack_supression_event_(nullptr)
     , initial_heartbeat_event_(nullptr)
     , timers_enabled_(false)
     , last_acknack_count_(0)
     , last_nackfrag_count_(0)
 {
-    nack_supression_event_ = new TimedEvent(writer_->getRTPSParticipant()->getEventResource(),
+    ResourceEvent& event_service = writer_->event_service();
+
+    nack_supression_event_ = new TimedEvent(event_service,
                     [&]() -> bool
                     {
                         writer_->perform_nack_supression(guid());
@@ -68,13 +91,20 @@ ReaderProxy::ReaderProxy(
                     },
                     TimeConv::Time_t2MilliSecondsDouble(times.nackSupressionDuration));
 
-    initial_heartbeat_event_ = new TimedEvent(writer_->getRTPSParticipant()->getEventResource(),
+    initial_heartbeat_event_ = new TimedEvent(event_service,
                     [&]() -> bool
                     {
                         writer_->intraprocess_heartbeat(this);
                         return false;
                     }, 0);
 
+    // The ring is sized for the whole writer history, plus the positions before the first change lost when aligning
+    // the base of the window. It grows when the changes kept for the reader span more sequence numbers, as happens
+    // when an old change stays unacknowledged while newer ones are removed.
+    ResourceLimitedContainerConfig history_limits = resource_limits_from_history(writer->mp_history->m_att, 0);
+    bool is_unbounded = (std::numeric_limits<size_t>::max)() == history_limits.maximum;
+    allocate_window(is_unbounded ? history_limits.initial : history_limits.maximum + 31u);
+
     stop();
 }
 
@@ -164,7 +194,7 @@ void ReaderProxy::stop()
     is_active_ = false;
     disable_timers();
 
-    changes_for_reader_.clear();
+    clear_window();
     last_acknack_count_ = 0;
     last_nackfrag_count_ = 0;
     changes_low_mark_ = SequenceNumber_t();
@@ -214,11 +244,11 @@ void ReaderProxy::add_change(
         const ChangeForReader_t& change)
 {
     assert(change.getSequenceNumber() > changes_low_mark_);
-    assert(changes_for_reader_.empty() ? true :
-            change.getSequenceNumber() > changes_for_reader_.back().getSequenceNumber());
+    assert(0u == num_changes_ ? true :
+            change.getSequenceNumber() > window_sequence(last_change_index()));
 
     // For best effort readers, changes are acked when being sent
-    if (changes_for_reader_.empty() && change.getStatus() == ACKNOWLEDGED)
+    if (0u == num_changes_ && change.getStatus() == ACKNOWLEDGED)
     {
         changes_low_mark_ = change.getSequenceNumber();
         return;
@@ -230,70 +260,63 @@ void ReaderProxy::add_change(
         return;
     }
 
-    if (changes_for_reader_.push_back(change) == nullptr)
-    {
-        // This should never happen
-        logError(RTPS_READER_PROXY, "Error adding change " << change.getSequenceNumber()
-                                                           << " to reader proxy " << guid());
-        eprosima::fastdds::dds::Log::Flush();
-        assert(false);
-    }
+    add_change_to_window(change.getSequenceNumber(), change.getChange(), change.getStatus());
 }
 
 bool ReaderProxy::has_changes() const
 {
-    return !changes_for_reader_.empty();
+    return 0u < num_changes_;
 }
 
 bool ReaderProxy::change_is_acked(
         const SequenceNumber_t& seq_num) const
 {
-    if (seq_num <= changes_low_mark_ || changes_for_reader_.empty())
+    if (seq_num <= changes_low_mark_ || 0u == num_changes_)
     {
         return true;
     }
 
-    ChangeConstIterator chit = find_change(seq_num);
-    if (chit == changes_for_reader_.end())
+    size_t index = 0;
+    if (!window_index(seq_num, index) || !is_tracked(index))
     {
-        // There is a hole in changes_for_reader_
+        // There is a hole in the window
         // This means a change was removed, or was not relevant.
         return true;
     }
 
-    return chit->getStatus() == ACKNOWLEDGED;
+    return status_at(index) == ACKNOWLEDGED;
 }
 
 SequenceNumber_t ReaderProxy::first_relevant_sequence_number() const
 {
-    if (changes_for_reader_.empty())
+    if (0u == num_changes_)
     {
         return changes_low_mark_ + 1;
     }
 
-    return changes_for_reader_.front().getSequenceNumber();
+    return window_sequence(first_change_index());
 }
 
 bool ReaderProxy::change_is_unsent(
         const SequenceNumber_t& seq_num,
         bool& is_irrelevant) const
 {
-    if (seq_num <= changes_low_mark_ || changes_for_reader_.empty())
+    if (seq_num <= changes_low_mark_ || 0u == num_changes_)
     {
         return false;
     }
 
-    ChangeConstIterator chit = find_change(seq_num);
-    if (chit == changes_for_reader_.end())
+    size_t index = 0;
+    if (!window_index(seq_num, index) || !is_tracked(index))
     {
-        // There is a hole in changes_for_reader_
+        // There is a hole in the window
         // This means a change was removed.
         return false;
     }
 
     is_irrelevant = false;
 
-    return chit->getStatus() == UNSENT;
+    return status_at(index) == UNSENT;
 }
 
 void ReaderProxy::acked_changes_set(
@@ -303,16 +326,15 @@ void ReaderProxy::acked_changes_set(
 
     if (seq_num > changes_low_mark_)
     {
-        ChangeIterator chit = find_change(seq_num, false);
+        remove_changes(changes_low_mark_ + 1, seq_num);
+
         // continue advancing until next change is not acknowledged
-        while (chit != changes_for_reader_.end()
-                && chit->getSequenceNumber() == future_low_mark
-                && chit->getStatus() == ACKNOWLEDGED)
+        size_t index = 0;
+        while (window_index(future_low_mark, index) && is_tracked(index) && status_at(index) == ACKNOWLEDGED)
         {
-            ++chit;
+            remove_change_at(index);
             ++future_low_mark;
         }
-        changes_for_reader_.erase(changes_for_reader_.begin(), chit);
     }
     else
     {
@@ -333,36 +355,21 @@ void ReaderProxy::acked_changes_set(
                 }
                 future_low_mark = current_sequence;
 
-                bool should_sort = false;
                 for (; current_sequence <= changes_low_mark_; ++current_sequence)
                 {
-                    // Skip all consecutive changes already in the collection
-                    ChangeConstIterator it = find_change(current_sequence);
-                    while ( it != changes_for_reader_.end() &&
-                            current_sequence <= changes_low_mark_ &&
-                            it->getSequenceNumber() == current_sequence)
+                    // Skip all changes already in the window
+                    size_t index = 0;
+                    if (window_index(current_sequence, index) && is_tracked(index))
                     {
-                        ++current_sequence;
-                        ++it;
+                        continue;
                     }
 
-                    if (current_sequence <= changes_low_mark_)
+                    CacheChange_t* change = nullptr;
+                    if (writer_->mp_history->get_change(current_sequence, writer_->getGuid(), &change))
                     {
-                        CacheChange_t* change = nullptr;
-                        if (writer_->mp_history->get_change(current_sequence, writer_->getGuid(), &change))
-                        {
-                            should_sort = true;
-                            ChangeForReader_t cr(change);
-                            cr.setStatus(UNACKNOWLEDGED);
-                            changes_for_reader_.push_back(cr);
-                        }
+                        add_change_to_window(current_sequence, change, UNACKNOWLEDGED);
                     }
                 }
-                // Keep changes sorted by sequence number
-                if (should_sort)
-                {
-                    std::sort(changes_for_reader_.begin(), changes_for_reader_.end(), ChangeForReaderCmp());
-                }
             }
             else if (!is_local_reader())
             {
@@ -371,6 +378,7 @@ void ReaderProxy::acked_changes_set(
         }
     }
     changes_low_mark_ = future_low_mark - 1;
+    trim_window();
 }
 
 bool ReaderProxy::requested_changes_set(
@@ -378,16 +386,32 @@ bool ReaderProxy::requested_changes_set(
 {
     bool isSomeoneWasSetRequested = false;
 
-    seq_num_set.for_each([&](SequenceNumber_t sit)
+    if (0u < num_changes_ && !seq_num_set.empty())
+    {
+        uint32_t num_bits = 0;
+        uint32_t num_longs = 0;
+        SequenceNumberSet_t::bitmap_type bitmap;
+        seq_num_set.bitmap_get(num_bits, bitmap, num_longs);
+
+        // Requested UNACKNOWLEDGED changes are found a whole word at a time
+        const std::vector<uint32_t>& unacked = status_bits_[UNACKNOWLEDGED];
+        int64_t position = static_cast<int64_t>(seq_num_set.base().to64long()) -
+                static_cast<int64_t>(window_base_.to64long());
+        for (uint32_t i = 0; i < num_longs; ++i, position += 32)
+        {
+            uint32_t requested = bitmap[i] & window_bits_at(unacked, position);
+            while (0u != requested)
             {
-                ChangeIterator chit = find_change(sit, true);
-                if (chit != changes_for_reader_.end() && UNACKNOWLEDGED == chit->getStatus())
-                {
-                    chit->setStatus(REQUESTED);
-                    chit->markAllFragmentsAsUnsent();
-                    isSomeoneWasSetRequested = true;
-                }
-            });
+                uint32_t bit = first_bit_set(requested);
+                requested &= ~(0x80000000u >> bit);
+
+                size_t index = static_cast<size_t>(position + bit);
+                set_status_at(index, REQUESTED);
+                reset_fragments(index);
+                isSomeoneWasSetRequested = true;
+            }
+        }
+    }
 
     if (isSomeoneWasSetRequested)
     {
@@ -423,7 +447,6 @@ bool ReaderProxy::set_change_to_status(
         return false;
     }
 
-    ChangeIterator it = find_change(seq_num, true);
     bool change_was_modified = false;
 
     // If the status is UNDERWAY (change was right now sent) and the reader is besteffort,
@@ -441,7 +464,7 @@ bool ReaderProxy::set_change_to_status(
     }
 
     // If the change following the low mark is acknowledged, low mark is advanced.
-    // Note that this could be the first change in the collection or a hole if the
+    // Note that this could be the first change in the window or a hole if the
     // first unacknowledged change is irrelevant.
     if (status == ACKNOWLEDGED && seq_num == changes_low_mark_ + 1)
     {
@@ -449,25 +472,30 @@ bool ReaderProxy::set_change_to_status(
         change_was_modified = true;
     }
 
-    if (it != changes_for_reader_.end())
+    size_t index = 0;
+    if (window_index(seq_num, index) && is_tracked(index))
     {
         if (status == ACKNOWLEDGED && changes_low_mark_ == seq_num)
         {
-            // Erase the first change when it is acknowledged
-            assert(it == changes_for_reader_.begin());
-            changes_for_reader_.erase(it);
+            // Remove the first change when it is acknowledged
+            remove_change_at(index);
         }
         else
         {
             // Otherwise change status
-            if (it->getStatus() != status)
+            if (status_at(index) != status)
             {
-                it->setStatus(status);
+                set_status_at(index, status);
                 change_was_modified = true;
             }
         }
     }
 
+    if (changes_low_mark_ == seq_num)
+    {
+        trim_window();
+    }
+
     return change_was_modified;
 }
 
@@ -483,17 +511,19 @@ bool ReaderProxy::mark_fragment_as_sent_for_change(
         return false;
     }
 
-    bool change_found = false;
-    ChangeIterator it = find_change(seq_num, true);
-
-    if (it != changes_for_reader_.end())
+    size_t index = 0;
+    if (!window_index(seq_num, index) || !is_tracked(index))
     {
-        change_found = true;
-        it->markFragmentsAsSent(frag_num);
-        was_last_fragment = it->getUnsentFragments().empty();
+        return false;
     }
 
-    return change_found;
+    ChangeForReader_t change = change_for_reader(index);
+    change.markFragmentsAsSent(frag_num);
+    FragmentNumberSet_t unsent_fragments = change.getUnsentFragments();
+    was_last_fragment = unsent_fragments.empty();
+    store_unsent_fragments(index, unsent_fragments);
+
+    return true;
 }
 
 bool ReaderProxy::perform_nack_supression()
@@ -516,12 +546,16 @@ uint32_t ReaderProxy::convert_status_on_all_changes(
     //       UNDERWAY=>UNACKNOWLEDGED (nack supression)
 
     uint32_t changed = 0;
-    for (ChangeForReader_t& change : changes_for_reader_)
+    std::vector<uint32_t>& previous_bits = status_bits_[previous];
+    std::vector<uint32_t>& next_bits = status_bits_[next];
+    for (size_t window_word = 0; window_word < window_words(); ++window_word)
     {
-        if (change.getStatus() == previous)
+        size_t word = ring_word(window_word);
+        if (0u != previous_bits[word])
         {
-            ++changed;
-            change.setStatus(next);
+            changed += count_bits(previous_bits[word]);
+            next_bits[word] |= previous_bits[word];
+            previous_bits[word] = 0u;
         }
     }
 
@@ -531,35 +565,29 @@ uint32_t ReaderProxy::convert_status_on_all_changes(
 void ReaderProxy::change_has_been_removed(
         const SequenceNumber_t& seq_num)
 {
-    // Check sequence number is in the container, because it was not clean up.
-    if (changes_for_reader_.empty() || seq_num < changes_for_reader_.begin()->getSequenceNumber())
-    {
-        return;
-    }
-
-    auto chit = find_change(seq_num);
-
-    if (chit == this->changes_for_reader_.end())
+    // Check sequence number is in the window, because it was not clean up.
+    size_t index = 0;
+    if (0u == num_changes_ || !window_index(seq_num, index) || !is_tracked(index))
     {
         // No change for this sequence number
         return;
     }
 
     // In intraprocess, if there is an UNACKNOWLEDGED, a GAP has to be send because there is no reliable mechanism.
-    if (is_local_reader() && ACKNOWLEDGED > chit->getStatus())
+    if (is_local_reader() && ACKNOWLEDGED > status_at(index))
     {
         writer_->intraprocess_gap(this, seq_num);
     }
 
-    // Element may not be in the container when marked as irrelevant.
-    changes_for_reader_.erase(chit);
+    remove_change_at(index);
 }
 
 bool ReaderProxy::has_unacknowledged() const
 {
-    for (const ChangeForReader_t& it : changes_for_reader_)
+    const std::vector<uint32_t>& unacked = status_bits_[UNACKNOWLEDGED];
+    for (size_t window_word = 0; window_word < window_words(); ++window_word)
     {
-        if (it.getStatus() == UNACKNOWLEDGED)
+        if (0u != unacked[ring_word(window_word)])
         {
             return true;
         }
@@ -573,18 +601,20 @@ bool ReaderProxy::requested_fragment_set(
         const FragmentNumberSet_t& frag_set)
 {
     // Locate the outbound change referenced by the NACK_FRAG
-    ChangeIterator changeIter = find_change(seq_num, true);
-    if (changeIter == changes_for_reader_.end())
+    size_t index = 0;
+    if (!window_index(seq_num, index) || !is_tracked(index))
     {
         return false;
     }
 
-    changeIter->markFragmentsAsUnsent(frag_set);
+    ChangeForReader_t change = change_for_reader(index);
+    change.markFragmentsAsUnsent(frag_set);
+    store_unsent_fragments(index, change.getUnsentFragments());
 
     // If it was UNSENT, we shouldn't switch back to REQUESTED to prevent stalling.
-    if (changeIter->getStatus() != UNSENT)
+    if (change.getStatus() != UNSENT)
     {
-        changeIter->setStatus(REQUESTED);
+        set_status_at(index, REQUESTED);
     }
 
     return true;
@@ -611,77 +641,564 @@ bool ReaderProxy::process_nack_frag(
     return false;
 }
 
-static bool change_less_than_sequence(
-        const ChangeForReader_t& change,
-        const SequenceNumber_t& seq_num)
+bool ReaderProxy::window_index(
+        const SequenceNumber_t& seq_num,
+        size_t& index) const
+{
+    if (seq_num < window_base_)
+    {
+        return false;
+    }
+
+    uint64_t diff = (seq_num - window_base_).to64long();
+    if (diff >= window_size_)
+    {
+        return false;
+    }
+
+    index = static_cast<size_t>(diff);
+    return true;
+}
+
+size_t ReaderProxy::ring_slot(
+        size_t index) const
+{
+    return static_cast<size_t>(window_base_.to64long() + index) & (window_changes_.size() - 1u);
+}
+
+size_t ReaderProxy::ring_word(
+        size_t window_word) const
+{
+    return static_cast<size_t>(window_base_.to64long() / 32u + window_word) & (fragments_sent_bits_.size() - 1u);
+}
+
+uint32_t ReaderProxy::window_bits_at(
+        const std::vector<uint32_t>& bits,
+        int64_t position) const
+{
+    // Positions outside the window read as 0
+    auto word_at = [this, &bits](
+        int64_t window_word) -> uint32_t
+            {
+                return (0 <= window_word && window_word < static_cast<int64_t>(window_words())) ?
+                       bits[ring_word(static_cast<size_t>(window_word))] : 0u;
+            };
+
+    int64_t window_word = (0 <= position) ? position / 32 : -((31 - position) / 32);
+    uint32_t shift = static_cast<uint32_t>(position - window_word * 32);
+    uint32_t result = word_at(window_word) << shift;
+    if (0u != shift)
+    {
+        result |= word_at(window_word + 1) >> (32u - shift);
+    }
+    return result;
+}
+
+bool ReaderProxy::is_tracked(
+        size_t index) const
+{
+    size_t word = ring_slot(index) / 32u;
+    uint32_t mask = bit_mask(index);
+    for (const std::vector<uint32_t>& bits : status_bits_)
+    {
+        if (0u != (bits[word] & mask))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+ChangeForReaderStatus_t ReaderProxy::status_at(
+        size_t index) const
+{
+    size_t word = ring_slot(index) / 32u;
+    uint32_t mask = bit_mask(index);
+    for (size_t status = 0; status < status_bits_.size(); ++status)
+    {
+        if (0u != (status_bits_[status][word] & mask))
+        {
+            return static_cast<ChangeForReaderStatus_t>(status);
+        }
+    }
+
+    assert(false);
+    return ACKNOWLEDGED;
+}
+
+void ReaderProxy::set_status_at(
+        size_t index,
+        ChangeForReaderStatus_t status)
+{
+    size_t word = ring_slot(index) / 32u;
+    uint32_t mask = bit_mask(index);
+    for (std::vector<uint32_t>& bits : status_bits_)
+    {
+        bits[word] &= ~mask;
+    }
+    status_bits_[status][word] |= mask;
+}
+
+size_t ReaderProxy::first_change_index() const
+{
+    assert(0u < num_changes_);
+
+    for (size_t window_word = 0; window_word < window_words(); ++window_word)
+    {
+        size_t word = ring_word(window_word);
+        uint32_t tracked = 0;
+        for (const std::vector<uint32_t>& bits : status_bits_)
+        {
+            tracked |= bits[word];
+        }
+
+        if (0u != tracked)
+        {
+            return window_word * 32u + first_bit_set(tracked);
+        }
+    }
+
+    assert(false);
+    return 0;
+}
+
+size_t ReaderProxy::last_change_index() const
+{
+    assert(0u < num_changes_);
+
+    for (size_t window_word = window_words(); 0u < window_word; --window_word)
+    {
+        size_t word = ring_word(window_word - 1);
+        uint32_t tracked = 0;
+        for (const std::vector<uint32_t>& bits : status_bits_)
+        {
+            tracked |= bits[word];
+        }
+
+        if (0u != tracked)
+        {
+            return (window_word - 1) * 32u + last_bit_set(tracked);
+        }
+    }
+
+    assert(false);
+    return 0;
+}
+
+SequenceNumber_t ReaderProxy::next_unsent_or_hole(
+        const SequenceNumber_t& from,
+        const SequenceNumber_t& end) const
+{
+    SequenceNumber_t seq = from;
+    while (seq < end)
+    {
+        size_t index = 0;
+        if (!window_index(seq, index))
+        {
+            // Outside the window everything is a hole
+            return seq;
+        }
+
+        size_t word = ring_slot(index) / 32u;
+        uint32_t tracked = 0;
+        for (const std::vector<uint32_t>& bits : status_bits_)
+        {
+            tracked |= bits[word];
+        }
+
+        uint32_t candidates = (status_bits_[UNSENT][word] | ~tracked) & (0xFFFFFFFFu >> (index & 31u));
+        if (0u != candidates)
+        {
+            return (std::min)(window_sequence((index / 32u) * 32u + first_bit_set(candidates)), end);
+        }
+
+        seq = window_sequence((index / 32u + 1) * 32u);
+    }
+
+    return end;
+}
+
+SequenceNumber_t ReaderProxy::next_hole(
+        const SequenceNumber_t& from,
+        const SequenceNumber_t& end) const
+{
+    SequenceNumber_t seq = from;
+    while (seq < end)
+    {
+        size_t index = 0;
+        if (!window_index(seq, index))
+        {
+            // Outside the window everything is a hole
+            return seq;
+        }
+
+        size_t word = ring_slot(index) / 32u;
+        uint32_t tracked = 0;
+        for (const std::vector<uint32_t>& bits : status_bits_)
+        {
+            tracked |= bits[word];
+        }
+
+        uint32_t holes = ~tracked & (0xFFFFFFFFu >> (index & 31u));
+        if (0u != holes)
+        {
+            return (std::min)(window_sequence((index / 32u) * 32u + first_bit_set(holes)), end);
+        }
+
+        seq = window_sequence((index / 32u + 1) * 32u);
+    }
+
+    return end;
+}
+
+ChangeForReader_t ReaderProxy::change_for_reader(
+        size_t index) const
 {
-    return change.getSequenceNumber() < seq_num;
+    size_t slot = ring_slot(index);
+    CacheChange_t* change = window_changes_[slot];
+    SequenceNumber_t seq_num = window_sequence(index);
+    ChangeForReader_t result = (nullptr != change) ? ChangeForReader_t(change) : ChangeForReader_t(seq_num);
+    result.setStatus(status_at(index));
+
+    if (0u != (fragments_sent_bits_[slot / 32u] & bit_mask(slot)))
+    {
+        result.setUnsentFragments(FragmentNumberSet_t());
+    }
+    else
+    {
+        const FragmentNumberSet_t* unsent_fragments = find_partial_fragments(seq_num);
+        if (nullptr != unsent_fragments)
+        {
+            result.setUnsentFragments(*unsent_fragments);
+        }
+    }
+
+    return result;
 }
 
-ReaderProxy::ChangeIterator ReaderProxy::find_change(
+void ReaderProxy::add_change_to_window(
         const SequenceNumber_t& seq_num,
-        bool exact)
+        CacheChange_t* change,
+        ChangeForReaderStatus_t status)
+{
+    // The base of the window is kept on a multiple of 32
+    SequenceNumber_t aligned_seq(seq_num.to64long() & ~static_cast<uint64_t>(31u));
+    SequenceNumber_t new_base = (0u == window_size_ || seq_num < window_base_) ? aligned_seq : window_base_;
+    SequenceNumber_t new_end = (0u == window_size_) ? seq_num + 1 : (std::max)(seq_num + 1, window_sequence(
+                        window_size_));
+    size_t new_size = static_cast<size_t>((new_end - new_base).to64long());
+
+    if (new_size > window_changes_.size())
+    {
+        grow_window(new_size);
+    }
+
+    window_base_ = new_base;
+    window_size_ = new_size;
+
+    size_t index = static_cast<size_t>((seq_num - window_base_).to64long());
+    assert(!is_tracked(index));
+    window_changes_[ring_slot(index)] = change;
+    set_status_at(index, status);
+    ++num_changes_;
+}
+
+void ReaderProxy::remove_change_at(
+        size_t index)
+{
+    assert(is_tracked(index));
+
+    size_t slot = ring_slot(index);
+    size_t word = slot / 32u;
+    uint32_t mask = bit_mask(slot);
+    for (std::vector<uint32_t>& bits : status_bits_)
+    {
+        bits[word] &= ~mask;
+    }
+    window_changes_[slot] = nullptr;
+    reset_fragments(index);
+
+    if (0u == --num_changes_)
+    {
+        clear_window();
+    }
+    else if (index < 32u)
+    {
+        skip_leading_holes();
+    }
+}
+
+void ReaderProxy::remove_changes(
+        const SequenceNumber_t& from,
+        const SequenceNumber_t& to)
 {
-    ReaderProxy::ChangeIterator it;
-    ReaderProxy::ChangeIterator end = changes_for_reader_.end();
-    it = std::lower_bound(changes_for_reader_.begin(), end, seq_num, change_less_than_sequence);
+    if (0u == num_changes_ || to <= window_base_ || to <= from)
+    {
+        return;
+    }
+
+    size_t first = 0;
+    if (window_base_ < from)
+    {
+        first = static_cast<size_t>((from - window_base_).to64long());
+    }
+    size_t last = (std::min)(window_size_, static_cast<size_t>((to - window_base_).to64long()));
+
+    // Whole words are cleared at once
+    size_t index = first;
+    while (index < last)
+    {
+        size_t word_end = (std::min)((index / 32u + 1) * 32u, last);
+        uint32_t mask = (0xFFFFFFFFu >> (index & 31u));
+        if (0u != (word_end & 31u))
+        {
+            mask &= ~(0xFFFFFFFFu >> (word_end & 31u));
+        }
 
-    return (!exact)
-           ? it
-           : it == end
-           ? it
-           : it->getSequenceNumber() == seq_num ? it : end;
+        size_t slot = ring_slot(index);
+        size_t word = slot / 32u;
+        uint32_t removed = 0;
+        for (std::vector<uint32_t>& bits : status_bits_)
+        {
+            removed |= bits[word] & mask;
+            bits[word] &= ~mask;
+        }
+        fragments_sent_bits_[word] &= ~mask;
+        num_changes_ -= count_bits(removed);
+        // The positions of a word are consecutive on the ring
+        std::fill(window_changes_.begin() + slot, window_changes_.begin() + slot + (word_end - index), nullptr);
+
+        index = word_end;
+    }
+
+    for (size_t i = partial_fragments_.size(); 0u < i; --i)
+    {
+        const SequenceNumber_t& seq_num = partial_fragments_[i - 1].first;
+        if (from <= seq_num && seq_num < to)
+        {
+            partial_fragments_.erase(partial_fragments_.begin() + (i - 1));
+        }
+    }
+
+    if (0u == num_changes_)
+    {
+        clear_window();
+    }
+    else
+    {
+        skip_leading_holes();
+    }
 }
 
-ReaderProxy::ChangeConstIterator ReaderProxy::find_change(
+const FragmentNumberSet_t* ReaderProxy::find_partial_fragments(
         const SequenceNumber_t& seq_num) const
 {
-    ReaderProxy::ChangeConstIterator it;
-    ReaderProxy::ChangeConstIterator end = changes_for_reader_.end();
-    it = std::lower_bound(changes_for_reader_.begin(), end, seq_num, change_less_than_sequence);
+    for (const std::pair<SequenceNumber_t, FragmentNumberSet_t>& entry : partial_fragments_)
+    {
+        if (entry.first == seq_num)
+        {
+            return &entry.second;
+        }
+    }
 
-    return it == end
-           ? it
-           : it->getSequenceNumber() == seq_num ? it : end;
+    return nullptr;
+}
+
+void ReaderProxy::store_unsent_fragments(
+        size_t index,
+        const FragmentNumberSet_t& unsent_fragments)
+{
+    // Only partially sent changes need an entry, the rest are represented with a bit.
+    size_t word = ring_slot(index) / 32u;
+    uint32_t mask = bit_mask(index);
+    if (unsent_fragments.empty())
+    {
+        fragments_sent_bits_[word] |= mask;
+        remove_partial_fragments(window_sequence(index));
+    }
+    else
+    {
+        fragments_sent_bits_[word] &= ~mask;
+        SequenceNumber_t seq_num = window_sequence(index);
+        for (std::pair<SequenceNumber_t, FragmentNumberSet_t>& entry : partial_fragments_)
+        {
+            if (entry.first == seq_num)
+            {
+                entry.second = unsent_fragments;
+                return;
+            }
+        }
+
+        if (nullptr == partial_fragments_.emplace_back(seq_num, unsent_fragments))
+        {
+            // Without an entry the fragments are sent again from the first one
+            logWarning(RTPS_READER_PROXY, "Too many partially sent changes for reader " << guid());
+        }
+    }
+}
+
+void ReaderProxy::remove_partial_fragments(
+        const SequenceNumber_t& seq_num)
+{
+    if (!partial_fragments_.empty())
+    {
+        partial_fragments_.remove_if([&seq_num](
+                    const std::pair<SequenceNumber_t, FragmentNumberSet_t>& entry)
+                {
+                    return entry.first == seq_num;
+                });
+    }
+}
+
+void ReaderProxy::reset_fragments(
+        size_t index)
+{
+    fragments_sent_bits_[ring_slot(index) / 32u] &= ~bit_mask(index);
+    remove_partial_fragments(window_sequence(index));
+}
+
+void ReaderProxy::trim_window()
+{
+    if (0u == window_size_ || changes_low_mark_ < window_base_)
+    {
+        return;
+    }
+
+    // Positions up to the low mark do not hold changes anymore
+    size_t num_words = static_cast<size_t>(((changes_low_mark_ + 1) - window_base_).to64long() / 32u);
+    drop_window_words((std::min)(num_words, window_words()));
+
+    if (0u < num_changes_)
+    {
+        skip_leading_holes();
+    }
+}
+
+void ReaderProxy::skip_leading_holes()
+{
+    assert(0u < num_changes_);
+
+    // The removed changes before the first tracked one would otherwise keep the window spanning them
+    drop_window_words(first_change_index() / 32u);
+}
+
+void ReaderProxy::drop_window_words(
+        size_t num_words)
+{
+    if (0u < num_words)
+    {
+        // The ring words left behind are reused by later sequence numbers
+        for (size_t window_word = 0; window_word < num_words; ++window_word)
+        {
+            size_t word = ring_word(window_word);
+            for (std::vector<uint32_t>& bits : status_bits_)
+            {
+                bits[word] = 0u;
+            }
+            fragments_sent_bits_[word] = 0u;
+        }
+
+        size_t num_positions = (std::min)(num_words * 32u, window_size_);
+        window_base_ = window_base_ + static_cast<uint32_t>(num_words * 32u);
+        window_size_ -= num_positions;
+        if (0u == window_size_)
+        {
+            window_base_ = SequenceNumber_t();
+        }
+    }
+}
+
+void ReaderProxy::clear_window()
+{
+    if (0u < num_changes_)
+    {
+        // Removed changes leave their positions clean, so this is only needed when dropping changes
+        std::fill(window_changes_.begin(), window_changes_.end(), nullptr);
+        for (std::vector<uint32_t>& bits : status_bits_)
+        {
+            std::fill(bits.begin(), bits.end(), 0u);
+        }
+        std::fill(fragments_sent_bits_.begin(), fragments_sent_bits_.end(), 0u);
+    }
+
+    window_base_ = SequenceNumber_t();
+    window_size_ = 0;
+    partial_fragments_.clear();
+    num_changes_ = 0;
+}
+
+void ReaderProxy::allocate_window(
+        size_t num_changes)
+{
+    // The ring has a power of two number of words
+    size_t num_positions = 32u;
+    while (num_positions < num_changes)
+    {
+        num_positions *= 2u;
+    }
+
+    window_changes_.assign(num_positions, nullptr);
+    for (std::vector<uint32_t>& bits : status_bits_)
+    {
+        bits.assign(num_positions / 32u, 0u);
+    }
+    fragments_sent_bits_.assign(num_positions / 32u, 0u);
+}
+
+void ReaderProxy::grow_window(
+        size_t num_positions)
+{
+    logInfo(RTPS_READER_PROXY, "Growing the window of reader " << guid() << " to " << num_positions << " positions");
+
+    std::vector<CacheChange_t*> window_changes;
+    std::array<std::vector<uint32_t>, UNDERWAY + 1> status_bits;
+    std::vector<uint32_t> fragments_sent_bits;
+    window_changes.swap(window_changes_);
+    status_bits.swap(status_bits_);
+    fragments_sent_bits.swap(fragments_sent_bits_);
+    allocate_window(num_positions);
+
+    // Slots depend on the size of the ring, so the contents are moved one word at a time
+    size_t old_words = fragments_sent_bits.size();
+    for (size_t window_word = 0; window_word < window_words(); ++window_word)
+    {
+        size_t old_word = static_cast<size_t>(window_base_.to64long() / 32u + window_word) & (old_words - 1u);
+        size_t new_word = ring_word(window_word);
+        for (size_t status = 0; status < status_bits_.size(); ++status)
+        {
+            status_bits_[status][new_word] = status_bits[status][old_word];
+        }
+        fragments_sent_bits_[new_word] = fragments_sent_bits[old_word];
+        std::copy(window_changes.begin() + old_word * 32u, window_changes.begin() + (old_word + 1) * 32u,
+                window_changes_.begin() + new_word * 32u);
+    }
 }
 
 bool ReaderProxy::are_there_gaps()
 {
-    return (0 < changes_for_reader_.size() &&
-           changes_low_mark_ + uint32_t(changes_for_reader_.size()) !=
-           changes_for_reader_.rbegin()->getSequenceNumber());
+    return (0u < num_changes_ &&
+           changes_low_mark_ + uint32_t(num_changes_) != window_sequence(last_change_index()));
 }
 
 void ReaderProxy::send_gaps(
         RTPSMessageGroup& group,
         SequenceNumber_t next_seq)
 {
-    if (is_remote_and_reliable())
+    if (is_remote_and_reliable() && 0u < num_changes_)
     {
         try
         {
-            if (are_there_gaps() ||
-                    (0 < changes_for_reader_.size() && next_seq != changes_for_reader_.rbegin()->getSequenceNumber()))
+            SequenceNumber_t last_seq = window_sequence(last_change_index());
+            if (are_there_gaps() || next_seq != last_seq)
             {
                 RTPSGapBuilder gap_builder(group);
-                SequenceNumber_t current_seq = changes_low_mark_ + 1;
-
-                for (ReaderProxy::ChangeConstIterator cit = changes_for_reader_.begin();
-                        cit != changes_for_reader_.end(); ++cit)
-                {
-                    SequenceNumber_t seq_num = cit->getSequenceNumber();
-                    while (current_seq != seq_num)
-                    {
-                        gap_builder.add(current_seq);
-                        ++current_seq;
-                    }
-                    ++current_seq;
-                }
+                SequenceNumber_t end = (std::max)(last_seq + 1, next_seq);
 
-                while (current_seq < next_seq)
+                for (SequenceNumber_t seq = next_hole(changes_low_mark_ + 1, end); seq < end;
+                        seq = next_hole(seq + 1, end))
                 {
-                    gap_builder.add(current_seq);
-                    ++current_seq;
+                    gap_builder.add(seq);
                 }
             }
         }
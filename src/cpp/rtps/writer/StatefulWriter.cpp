@@ -52,6 +52,7 @@
 
 #include "../builtin/discovery/database/DiscoveryDataBase.hpp"
 
+#include <algorithm>
 #include <mutex>
 #include <vector>
 #include <stdexcept>
@@ -169,10 +170,12 @@ StatefulWriter::StatefulWriter(
     , periodic_hb_event_(nullptr)
     , nack_response_event_(nullptr)
     , ack_event_(nullptr)
+    , event_service_(nullptr)
     , m_heartbeatCount(0)
     , m_times(att.times)
     , matched_remote_readers_(att.matched_readers_allocation)
     , matched_readers_pool_(att.matched_readers_allocation)
+    , filtered_remote_readers_(att.matched_readers_allocation)
     , next_all_acked_notify_sequence_(0, 1)
     , all_acked_(false)
     , may_remove_change_cond_()
@@ -202,10 +205,12 @@ StatefulWriter::StatefulWriter(
     , periodic_hb_event_(nullptr)
     , nack_response_event_(nullptr)
     , ack_event_(nullptr)
+    , event_service_(nullptr)
     , m_heartbeatCount(0)
     , m_times(att.times)
     , matched_remote_readers_(att.matched_readers_allocation)
     , matched_readers_pool_(att.matched_readers_allocation)
+    , filtered_remote_readers_(att.matched_readers_allocation)
     , next_all_acked_notify_sequence_(0, 1)
     , all_acked_(false)
     , may_remove_change_cond_()
@@ -236,10 +241,12 @@ StatefulWriter::StatefulWriter(
     , periodic_hb_event_(nullptr)
     , nack_response_event_(nullptr)
     , ack_event_(nullptr)
+    , event_service_(nullptr)
     , m_heartbeatCount(0)
     , m_times(att.times)
     , matched_remote_readers_(att.matched_readers_allocation)
     , matched_readers_pool_(att.matched_readers_allocation)
+    , filtered_remote_readers_(att.matched_readers_allocation)
     , next_all_acked_notify_sequence_(0, 1)
     , all_acked_(false)
     , may_remove_change_cond_()
@@ -267,8 +274,13 @@ void StatefulWriter::init(
     auto push_mode = PropertyPolicyHelper::find_property(att.endpoint.properties, "fastdds.push_mode");
     m_pushMode = !((nullptr != push_mode) && ("false" == *push_mode));
 
+    // The events of the writer and the ones of its reader proxies share one of the reliability threads.
+    // They all take the writer mutex, so they would also be safe on different threads.
+    event_service_ = &pimpl->getEventResource(EventThreadClass::RELIABILITY);
+    ResourceEvent& event_service = *event_service_;
+
     periodic_hb_event_ = new TimedEvent(
-        pimpl->getEventResource(),
+        event_service,
         [&]() -> bool
         {
             return send_periodic_heartbeat();
@@ -276,7 +288,7 @@ void StatefulWriter::init(
         TimeConv::Time_t2MilliSecondsDouble(m_times.heartbeatPeriod));
 
     nack_response_event_ = new TimedEvent(
-        pimpl->getEventResource(),
+        event_service,
         [&]() -> bool
         {
             perform_nack_response();
@@ -287,7 +299,7 @@ void StatefulWriter::init(
     if (disable_positive_acks_)
     {
         ack_event_ = new TimedEvent(
-            pimpl->getEventResource(),
+            event_service,
             [&]() -> bool
             {
                 return ack_timer_expired();
@@ -425,7 +437,11 @@ void StatefulWriter::async_delivery(
 
     if (should_wake_up)
     {
-        mp_RTPSParticipant->async_thread().wake_up(this, max_blocking_time);
+        // Synchronous writers only get here when releasing a coherent set, which is sent right afterwards
+        if (isAsync())
+        {
+            mp_RTPSParticipant->async_thread().wake_up(this, max_blocking_time);
+        }
     }
     else
     {
@@ -441,13 +457,16 @@ void StatefulWriter::sync_delivery(
     bool expectsInlineQos = false;
 
     bool should_be_sent = false;
+    bool should_send_gaps = false;
     locator_selector_.reset(false);
+    filtered_remote_readers_.clear();
 
     // First step is to add the new CacheChange_t to all reader proxies.
     // It has to be done before sending, because if a timeout is caught, we will not include the
     // CacheChange_t in some reader proxies.
     for_matched_readers(matched_local_readers_, matched_datasharing_readers_, matched_remote_readers_,
-            [this, &change, &max_blocking_time, &expectsInlineQos, &should_be_sent](ReaderProxy* reader)
+            [this, &change, &max_blocking_time, &expectsInlineQos, &should_be_sent, &should_send_gaps](
+                ReaderProxy* reader)
             {
                 ChangeForReader_t changeForReader(change);
                 bool send_to_this_reader = false;
@@ -470,9 +489,16 @@ void StatefulWriter::sync_delivery(
                     }
                 }
 
+                // The filter is evaluated once. The remote readers that filtered out the change are kept for
+                // the sending steps below.
                 changeForReader.setRelevance(reader->rtps_is_relevant(change));
                 reader->add_change(changeForReader, true, max_blocking_time);
                 expectsInlineQos |= reader->expects_inline_qos();
+                if (!changeForReader.isRelevant() && !reader->is_local_reader() &&
+                        !reader->is_datasharing_reader())
+                {
+                    filtered_remote_readers_.push_back(reader);
+                }
 
                 if (send_to_this_reader)
                 {
@@ -490,11 +516,16 @@ void StatefulWriter::sync_delivery(
                         reader->datasharing_notify();
                         reader->set_change_to_status(change->sequenceNumber, UNDERWAY, false);
                     }
-                    else
+                    else if (changeForReader.isRelevant())
                     {
                         should_be_sent = true;
                         locator_selector_.enable(reader->guid());
                     }
+                    else if (reader->is_reliable())
+                    {
+                        // Filtered out for this reader. It will be informed with a GAP.
+                        should_send_gaps = true;
+                    }
                 }
 
                 return false;
@@ -550,6 +581,12 @@ void StatefulWriter::sync_delivery(
             {
                 for (ReaderProxy* it : matched_remote_readers_)
                 {
+                    if (filtered_remote_readers_.end() !=
+                            std::find(filtered_remote_readers_.begin(), filtered_remote_readers_.end(), it))
+                    {
+                        continue;
+                    }
+
                     RTPSMessageGroup group(mp_RTPSParticipant, this, it->message_sender(),
                             max_blocking_time);
 
@@ -587,6 +624,27 @@ void StatefulWriter::sync_delivery(
         }
     }
 
+    if (should_send_gaps)
+    {
+        // Inform the reliable readers that filtered out the change, so they don't have to wait for it
+        for (ReaderProxy* it : filtered_remote_readers_)
+        {
+            if (it->is_reliable())
+            {
+                try
+                {
+                    RTPSMessageGroup group(mp_RTPSParticipant, this, it->message_sender(), max_blocking_time);
+                    group.add_gap(change->sequenceNumber, SequenceNumberSet_t(change->sequenceNumber + 1));
+                }
+                catch (const RTPSMessageGroup::timeout&)
+                {
+                    logError(RTPS_WRITER, "Max blocking time reached");
+                    break;
+                }
+            }
+        }
+    }
+
     if (!m_pushMode)
     {
         NetworkFactory& network = mp_RTPSParticipant->network_factory();
@@ -615,51 +673,80 @@ void StatefulWriter::unsent_change_added_to_history(
                 liveliness_lease_duration_);
         }
 
-        // Prepare the metadata for datasharing
-        if (is_datasharing_compatible())
+        // Changes of a coherent set are held until the set ends.
+        // They are not added to the reader proxies, so no path can send them before release_held_change_nts.
+        if (!add_to_coherent_set_nts(change))
         {
-            prepare_datasharing_delivery(change);
+            should_notify_data_sent = deliver_nts(change, max_blocking_time, !isAsync());
         }
+    }
 
-        // Now for the rest of readers
-        if (!matched_remote_readers_.empty() || !matched_datasharing_readers_.empty() ||
-                !matched_local_readers_.empty())
-        {
-            if (!isAsync())
-            {
-                sync_delivery(change, max_blocking_time);
-                should_notify_data_sent = true;
-            }
-            else
-            {
-                async_delivery(change, max_blocking_time);
-            }
+    if (should_notify_data_sent)
+    {
+        on_data_sent();
+    }
 
-            if (disable_positive_acks_)
-            {
-                auto source_timestamp = system_clock::time_point() + nanoseconds(change->sourceTimestamp.to_ns());
-                auto now = system_clock::now();
-                auto interval = source_timestamp - now + keep_duration_us_;
-                assert(interval.count() >= 0);
+    // Throughput should be notified even if no matches are available
+    on_publish_throughput(change->serializedPayload.length);
+}
 
-                ack_event_->update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
-                ack_event_->restart_timer(max_blocking_time);
-            }
+void StatefulWriter::release_held_change_nts(
+        CacheChange_t* change,
+        const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+{
+    // The changes of the set are sent together by RTPSWriter::end_coherent_set
+    deliver_nts(change, max_blocking_time, false);
+}
+
+bool StatefulWriter::deliver_nts(
+        CacheChange_t* change,
+        const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time,
+        bool synchronous)
+{
+    bool delivered = false;
+
+    // Prepare the metadata for datasharing
+    if (is_datasharing_compatible())
+    {
+        prepare_datasharing_delivery(change);
+    }
+
+    // Now for the rest of readers
+    if (!matched_remote_readers_.empty() || !matched_datasharing_readers_.empty() ||
+            !matched_local_readers_.empty())
+    {
+        if (synchronous)
+        {
+            sync_delivery(change, max_blocking_time);
+            delivered = true;
         }
         else
         {
-            logInfo(RTPS_WRITER, "No reader proxy to add change.");
-            check_acked_status();
+            async_delivery(change, max_blocking_time);
         }
-    }
 
-    if (should_notify_data_sent)
+        if (disable_positive_acks_)
+        {
+            auto source_timestamp = system_clock::time_point() + nanoseconds(change->sourceTimestamp.to_ns());
+            auto now = system_clock::now();
+            auto interval = source_timestamp - now + keep_duration_us_;
+            if (interval.count() < 0)
+            {
+                // Only changes held by a coherent set for longer than the keep duration get here
+                interval = decltype(interval)::zero();
+            }
+
+            ack_event_->update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
+            ack_event_->restart_timer(max_blocking_time);
+        }
+    }
+    else
     {
-        on_data_sent();
+        logInfo(RTPS_WRITER, "No reader proxy to add change.");
+        check_acked_status();
     }
 
-    // Throughput should be notified even if no matches are available
-    on_publish_throughput(change->serializedPayload.length);
+    return delivered;
 }
 
 bool StatefulWriter::intraprocess_delivery(
@@ -703,7 +790,7 @@ bool StatefulWriter::intraprocess_heartbeat(
     if (reader)
     {
         SequenceNumber_t first_seq = get_seq_num_min();
-        SequenceNumber_t last_seq = get_seq_num_max();
+        SequenceNumber_t last_seq = get_seq_num_max_not_held_nts();
 
         if (first_seq == c_SequenceNumber_Unknown || last_seq == c_SequenceNumber_Unknown)
         {
@@ -1298,13 +1385,13 @@ void StatefulWriter::send_unsent_changes_with_flow_control(
     // Clear all relevant changes through the local controllers first
     for (std::unique_ptr<FlowController>& controller : m_controllers)
     {
-        (*controller)(relevantChanges);
+        (*controller)(relevantChanges, this);
     }
 
     // Clear all relevant changes through the parent controllers
     for (std::unique_ptr<FlowController>& controller : mp_RTPSParticipant->getFlowControllers())
     {
-        (*controller)(relevantChanges);
+        (*controller)(relevantChanges, this);
     }
 
     try
@@ -1550,6 +1637,11 @@ bool StatefulWriter::matched_reader_add(
                 if (reader->guid() == rdata.guid())
                 {
                     logInfo(RTPS_WRITER, "Attempting to add existing reader, updating information.");
+                    if (nullptr != mp_listener)
+                    {
+                        mp_listener->on_reader_discovery(this, ReaderDiscoveryInfo::CHANGED_QOS_READER, rdata.guid(),
+                                &rdata);
+                    }
                     if (reader->update(rdata))
                     {
                         update_reader_info(true);
@@ -1585,6 +1677,12 @@ bool StatefulWriter::matched_reader_add(
         matched_readers_pool_.pop_back();
     }
 
+    // Let the listener prepare the per-reader information (i.e. content filters) before evaluating relevance
+    if (nullptr != mp_listener)
+    {
+        mp_listener->on_reader_discovery(this, ReaderDiscoveryInfo::DISCOVERED_READER, rdata.guid(), &rdata);
+    }
+
     // Add info of new datareader.
     rp->start(rdata, is_datasharing_compatible_with(rdata));
     locator_selector_.add_entry(rp->locator_selector_entry());
@@ -1642,8 +1740,16 @@ bool StatefulWriter::matched_reader_add(
         RTPSGapBuilder gap_builder(group);
         bool is_reliable = rp->is_reliable();
 
+        // Changes held by a coherent set will be added when the set is released
+        SequenceNumber_t end_seq = next_sequence_number();
         for (History::iterator cit = mp_history->changesBegin(); cit != mp_history->changesEnd(); ++cit)
         {
+            if (is_held_nts((*cit)->sequenceNumber))
+            {
+                end_seq = (*cit)->sequenceNumber;
+                break;
+            }
+
             // This is to cover the case when there are holes in the history
             if (is_reliable)
             {
@@ -1709,7 +1815,7 @@ bool StatefulWriter::matched_reader_add(
         // This is to cover the case where the last changes have been removed from the history
         if (is_reliable)
         {
-            while (current_seq < next_sequence_number())
+            while (current_seq < end_seq)
             {
                 if (rp->is_local_reader())
                 {
@@ -1834,6 +1940,11 @@ bool StatefulWriter::matched_reader_remove(
         rproxy->stop();
         matched_readers_pool_.push_back(rproxy);
 
+        if (nullptr != mp_listener)
+        {
+            mp_listener->on_reader_discovery(this, ReaderDiscoveryInfo::REMOVED_READER, reader_guid, nullptr);
+        }
+
         lock.unlock();
         check_acked_status();
 
@@ -1892,6 +2003,12 @@ bool StatefulWriter::is_acked_by_all(
         const SequenceNumber_t seq) const
 {
     assert(mp_history->next_sequence_number() > seq);
+    if (is_held_nts(seq))
+    {
+        // Held changes are not on the reader proxies yet
+        return false;
+    }
+
     return (seq < next_all_acked_notify_sequence_) ||
            !for_matched_readers(matched_local_readers_, matched_remote_readers_,
                    [seq](const ReaderProxy* reader)
@@ -2316,7 +2433,7 @@ void StatefulWriter::send_heartbeat_nts_(
     }
 
     SequenceNumber_t firstSeq = get_seq_num_min();
-    SequenceNumber_t lastSeq = get_seq_num_max();
+    SequenceNumber_t lastSeq = get_seq_num_max_not_held_nts();
 
     if (firstSeq == c_SequenceNumber_Unknown || lastSeq == c_SequenceNumber_Unknown)
     {
@@ -2334,7 +2451,8 @@ void StatefulWriter::send_heartbeat_nts_(
     }
     else
     {
-        assert(firstSeq <= lastSeq);
+        // lastSeq is firstSeq - 1 when all the changes are held by a coherent set
+        assert(firstSeq <= lastSeq + 1);
     }
 
     incrementHBCount();
@@ -2614,17 +2732,6 @@ void StatefulWriter::print_inconsistent_acknack(
     static_cast<void>(next_sequence_number);
 }
 
-void StatefulWriter::reader_data_filter(
-        fastdds::rtps::IReaderDataFilter* reader_data_filter)
-{
-    reader_data_filter_ = reader_data_filter;
-}
-
-const fastdds::rtps::IReaderDataFilter* StatefulWriter::reader_data_filter() const
-{
-    return reader_data_filter_;
-}
-
 }  // namespace rtps
 }  // namespace fastrtps
 }  // namespace eprosima
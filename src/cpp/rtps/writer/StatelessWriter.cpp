@@ -326,6 +326,17 @@ bool StatelessWriter::datasharing_delivery(
     return true;
 }
 
+void StatelessWriter::release_held_change_nts(
+        CacheChange_t* change,
+        const std::chrono::time_point<std::chrono::steady_clock>& /*max_blocking_time*/)
+{
+    // The rest of the readers get the held changes from unsent_changes_, which stops at the first held change
+    if (is_datasharing_compatible())
+    {
+        datasharing_delivery(change);
+    }
+}
+
 // TODO(Ricardo) This function only can be used by history. Private it and frined History.
 // TODO(Ricardo) Look for other functions
 void StatelessWriter::unsent_change_added_to_history(
@@ -345,9 +356,12 @@ void StatelessWriter::unsent_change_added_to_history(
                 liveliness_lease_duration_);
         }
 
+        // Changes of a coherent set are held until the set ends
+        bool hold_delivery = add_to_coherent_set_nts(change);
+
         // Notify the datasharing readers
         // This also prepares the metadata for late-joiners
-        if (is_datasharing_compatible())
+        if (is_datasharing_compatible() && !hold_delivery)
         {
             datasharing_delivery(change);
         }
@@ -355,7 +369,7 @@ void StatelessWriter::unsent_change_added_to_history(
         // Now for the rest of readers
         if (!fixed_locators_.empty() || getMatchedReadersSize() > 0)
         {
-            if (!isAsync())
+            if (!isAsync() && !hold_delivery)
             {
                 try
                 {
@@ -364,10 +378,18 @@ void StatelessWriter::unsent_change_added_to_history(
                         std::vector<GUID_t> guids(1);
                         for (std::unique_ptr<ReaderLocator>& it : matched_local_readers_)
                         {
-                            intraprocess_delivery(change, *it);
+                            if (is_relevant(*change, *it))
+                            {
+                                intraprocess_delivery(change, *it);
+                            }
                         }
                         for (std::unique_ptr<ReaderLocator>& it : matched_remote_readers_)
                         {
+                            if (!is_relevant(*change, *it))
+                            {
+                                continue;
+                            }
+
                             RTPSMessageGroup group(mp_RTPSParticipant, this, *it, max_blocking_time);
                             size_t num_locators = it->locators_size();
                             send_data_or_fragments(group, change, is_inline_qos_expected_,
@@ -383,20 +405,30 @@ void StatelessWriter::unsent_change_added_to_history(
                     {
                         for (std::unique_ptr<ReaderLocator>& it : matched_local_readers_)
                         {
-                            intraprocess_delivery(change, *it);
+                            if (is_relevant(*change, *it))
+                            {
+                                intraprocess_delivery(change, *it);
+                            }
                         }
 
                         if (there_are_remote_readers_ || !fixed_locators_.empty())
                         {
-                            RTPSMessageGroup group(mp_RTPSParticipant, this, *this, max_blocking_time);
-                            size_t num_locators = locator_selector_.selected_size() + fixed_locators_.size();
-                            send_data_or_fragments(group, change, is_inline_qos_expected_,
-                                    [this, num_locators](
-                                        CacheChange_t* change,
-                                        FragmentNumber_t /*frag*/)
-                                    {
-                                        add_statistics_sent_submessage(change, num_locators);
-                                    });
+                            bool filtered = select_relevant_remote_readers(*change);
+                            {
+                                RTPSMessageGroup group(mp_RTPSParticipant, this, *this, max_blocking_time);
+                                size_t num_locators = locator_selector_.selected_size() + fixed_locators_.size();
+                                send_data_or_fragments(group, change, is_inline_qos_expected_,
+                                        [this, num_locators](
+                                            CacheChange_t* change,
+                                            FragmentNumber_t /*frag*/)
+                                        {
+                                            add_statistics_sent_submessage(change, num_locators);
+                                        });
+                            }
+                            if (filtered)
+                            {
+                                restore_remote_readers_selection();
+                            }
                         }
                     }
 
@@ -415,7 +447,10 @@ void StatelessWriter::unsent_change_added_to_history(
             else
             {
                 unsent_changes_.push_back(ChangeForReader_t(change));
-                mp_RTPSParticipant->async_thread().wake_up(this, max_blocking_time);
+                if (!hold_delivery)
+                {
+                    mp_RTPSParticipant->async_thread().wake_up(this, max_blocking_time);
+                }
             }
         }
         else
@@ -455,6 +490,65 @@ bool StatelessWriter::intraprocess_delivery(
     return false;
 }
 
+bool StatelessWriter::is_relevant(
+        const CacheChange_t& change,
+        const ReaderLocator& reader_locator) const
+{
+    return (nullptr == reader_data_filter_) || reader_data_filter_->is_relevant(change, reader_locator.remote_guid());
+}
+
+bool StatelessWriter::select_relevant_remote_readers(
+        const CacheChange_t& change)
+{
+    if (nullptr == reader_data_filter_)
+    {
+        return false;
+    }
+
+    bool filtered = false;
+    for (std::unique_ptr<ReaderLocator>& it : matched_remote_readers_)
+    {
+        if (it->locator_selector_entry()->enabled && !is_relevant(change, *it))
+        {
+            it->locator_selector_entry()->enabled = false;
+            filtered = true;
+        }
+    }
+
+    if (filtered)
+    {
+        mp_RTPSParticipant->network_factory().select_locators(locator_selector_);
+        if (!has_builtin_guid())
+        {
+            compute_selected_guids();
+        }
+    }
+
+    return filtered;
+}
+
+void StatelessWriter::restore_remote_readers_selection()
+{
+    if (ignore_fixed_locators_)
+    {
+        // Still sending history to late-joiners only
+        locator_selector_.reset(false);
+        for (const GUID_t& guid : late_joiner_guids_)
+        {
+            locator_selector_.enable(guid);
+        }
+    }
+    else
+    {
+        locator_selector_.reset(true);
+    }
+    mp_RTPSParticipant->network_factory().select_locators(locator_selector_);
+    if (!has_builtin_guid())
+    {
+        compute_selected_guids();
+    }
+}
+
 bool StatelessWriter::change_removed_by_history(
         CacheChange_t* change)
 {
@@ -620,6 +714,12 @@ void StatelessWriter::send_all_unsent_changes()
         ChangeForReader_t& unsentChange = unsent_changes_.front();
         CacheChange_t* cache_change = unsentChange.getChange();
 
+        // The rest of the changes belong to the coherent set being written
+        if (is_held_nts(cache_change->sequenceNumber))
+        {
+            break;
+        }
+
         total_sent_size += cache_change->serializedPayload.length;
 
         // Check if we finished with late-joiners only
@@ -644,13 +744,24 @@ void StatelessWriter::send_all_unsent_changes()
             last_intraprocess_sequence_number_ = sequence_number;
             for (std::unique_ptr<ReaderLocator>& it : matched_local_readers_)
             {
-                intraprocess_delivery(cache_change, *it);
+                if (is_relevant(*cache_change, *it))
+                {
+                    intraprocess_delivery(cache_change, *it);
+                }
             }
         }
 
         if (num_locators > 0)
         {
             auto change = unsentChange.getChange();
+
+            // Changes filtered out for some readers are sent on their own message
+            bool filtered = select_relevant_remote_readers(*change);
+            if (filtered)
+            {
+                group.flush_and_reset();
+            }
+
             bool sent = send_data_or_fragments(group, change, is_inline_qos_expected_,
                             [this, num_locators](
                                 CacheChange_t* change,
@@ -658,6 +769,13 @@ void StatelessWriter::send_all_unsent_changes()
                             {
                                 add_statistics_sent_submessage(change, num_locators);
                             });
+
+            if (filtered)
+            {
+                group.flush_and_reset();
+                restore_remote_readers_selection();
+            }
+
             on_sample_datas(change->write_params.sample_identity(), change->num_sent_submessages);
             if (!sent)
             {
@@ -681,7 +799,7 @@ void StatelessWriter::send_all_unsent_changes()
         compute_selected_guids();
     }
 
-    if (!unsent_changes_.empty())
+    if (!unsent_changes_.empty() && !is_held_nts(unsent_changes_.front().getChange()->sequenceNumber))
     {
         mp_RTPSParticipant->async_thread().wake_up(this);
     }
@@ -696,13 +814,20 @@ void StatelessWriter::send_unsent_changes_with_flow_control()
 
     NetworkFactory& network = mp_RTPSParticipant->network_factory();
     bool flow_controllers_limited = false;
-    while (!unsent_changes_.empty() && !flow_controllers_limited)
+    while (!unsent_changes_.empty() && !flow_controllers_limited &&
+            !is_held_nts(unsent_changes_.front().getChange()->sequenceNumber))
     {
         RTPSWriterCollector<ReaderLocator*> changesToSend;
 
         for (const ChangeForReader_t& unsentChange : unsent_changes_)
         {
             CacheChange_t* cache_change = unsentChange.getChange();
+
+            // The rest of the changes belong to the coherent set being written
+            if (is_held_nts(cache_change->sequenceNumber))
+            {
+                break;
+            }
             changesToSend.add_change(cache_change, nullptr, unsentChange.getUnsentFragments());
 
             uint64_t sequence_number = cache_change->sequenceNumber.to64long();
@@ -712,7 +837,10 @@ void StatelessWriter::send_unsent_changes_with_flow_control()
                 last_intraprocess_sequence_number_ = sequence_number;
                 for (std::unique_ptr<ReaderLocator>& it : matched_local_readers_)
                 {
-                    intraprocess_delivery(cache_change, *it);
+                    if (is_relevant(*cache_change, *it))
+                    {
+                        intraprocess_delivery(cache_change, *it);
+                    }
                 }
             }
         }
@@ -723,13 +851,13 @@ void StatelessWriter::send_unsent_changes_with_flow_control()
         // Clear through local controllers
         for (auto& controller : flow_controllers_)
         {
-            (*controller)(changesToSend);
+            (*controller)(changesToSend, this);
         }
 
         // Clear through parent controllers
         for (auto& controller : mp_RTPSParticipant->getFlowControllers())
         {
-            (*controller)(changesToSend);
+            (*controller)(changesToSend, this);
         }
 
         flow_controllers_limited = n_items != changesToSend.size();
@@ -850,6 +978,11 @@ bool StatelessWriter::matched_reader_add(
                 if (reader.remote_guid() == data.guid())
                 {
                     logWarning(RTPS_WRITER, "Attempting to add existing reader, updating information.");
+                    if (nullptr != mp_listener)
+                    {
+                        mp_listener->on_reader_discovery(this, ReaderDiscoveryInfo::CHANGED_QOS_READER, data.guid(),
+                        &data);
+                    }
                     if (reader.update(data.remote_locators().unicast,
                     data.remote_locators().multicast,
                     data.m_expectsInlineQos))
@@ -892,6 +1025,12 @@ bool StatelessWriter::matched_reader_add(
         matched_readers_pool_.pop_back();
     }
 
+    // Let the listener prepare the per-reader information (i.e. content filters) before evaluating relevance
+    if (nullptr != mp_listener)
+    {
+        mp_listener->on_reader_discovery(this, ReaderDiscoveryInfo::DISCOVERED_READER, data.guid(), &data);
+    }
+
     // Add info of new datareader.
     new_reader->start(data.guid(),
             data.remote_locators().unicast,
@@ -1014,6 +1153,10 @@ bool StatelessWriter::matched_reader_remove(
         late_joiner_guids_.remove(reader_guid);
         matched_readers_pool_.push_back(std::move(reader));
         update_reader_info(false);
+        if (nullptr != mp_listener)
+        {
+            mp_listener->on_reader_discovery(this, ReaderDiscoveryInfo::REMOVED_READER, reader_guid, nullptr);
+        }
         logInfo(RTPS_WRITER, "Reader Proxy removed: " << reader_guid);
         return true;
     }
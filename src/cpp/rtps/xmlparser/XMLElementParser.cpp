@@ -1853,6 +1853,9 @@ XMLP_ret XMLParser::getXMLDataSharingQos(
                 <xs:element name="shared_dir" type="stringType" minOccurs="0"/>
                 <xs:element name="domain_ids" type="domainIdVectorType" minOccurs="0"/>
                 <xs:element name="max_domains" type="uint32Type" minOccurs="0"/>
+                <xs:element name="huge_pages" type="boolType" minOccurs="0"/>
+                <xs:element name="numa_node" type="int32Type" minOccurs="0"/>
+                <xs:element name="prefault" type="boolType" minOccurs="0"/>
             </xs:all>
         </xs:complexType>
      */
@@ -1861,6 +1864,9 @@ XMLP_ret XMLParser::getXMLDataSharingQos(
     std::string shm_directory = "";
     int32_t max_domains = 0;
     std::vector<uint16_t> domain_ids;
+    bool huge_pages = false;
+    int32_t numa_node = -1;
+    bool prefault = false;
 
     tinyxml2::XMLElement* p_aux0 = nullptr;
     const char* name = nullptr;
@@ -1923,6 +1929,27 @@ XMLP_ret XMLParser::getXMLDataSharingQos(
             }
 
         }
+        else if (strcmp(name, HUGE_PAGES) == 0)
+        {
+            if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &huge_pages, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, NUMA_NODE) == 0)
+        {
+            if (XMLP_ret::XML_OK != getXMLInt(p_aux0, &numa_node, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, PREFAULT) == 0)
+        {
+            if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &prefault, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
         else if (strcmp(name, DOMAIN_IDS) == 0)
         {
             /*
@@ -2004,6 +2031,10 @@ XMLP_ret XMLParser::getXMLDataSharingQos(
             break;
     }
 
+    data_sharing.huge_pages(huge_pages);
+    data_sharing.numa_node(numa_node);
+    data_sharing.prefault(prefault);
+
     return XMLP_ret::XML_OK;
 }
 
@@ -2382,12 +2413,13 @@ XMLP_ret XMLParser::getXMLPartitionQos(
 XMLP_ret XMLParser::getXMLPublishModeQos(
         tinyxml2::XMLElement* elem,
         PublishModeQosPolicy& publishMode,
-        uint8_t /*ident*/)
+        uint8_t ident)
 {
     /*
         <xs:complexType name="publishModeQosPolicyType">
             <xs:all>
                 <xs:element name="kind" type="publishModeQosKindType"/>
+                <xs:element name="priority" type="int32Type" minOccurs="0"/>
             </xs:all>
         </xs:complexType>
      */
@@ -2428,6 +2460,16 @@ XMLP_ret XMLParser::getXMLPublishModeQos(
                 return XMLP_ret::XML_ERROR;
             }
         }
+        else if (strcmp(name, PRIORITY) == 0)
+        {
+            // priority - int32Type
+            int priority = 0;
+            if (XMLP_ret::XML_OK != getXMLInt(p_aux0, &priority, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+            publishMode.priority = static_cast<int32_t>(priority);
+        }
         else
         {
             logError(XMLPARSER, "Invalid element found into 'publishModeQosPolicyType'. Name: " << name);
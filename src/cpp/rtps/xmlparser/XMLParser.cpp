@@ -224,6 +224,8 @@ XMLP_ret XMLParser::parseXMLTransportData(
                 <xs:element name="receiveBufferSize" type="int32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="TTL" type="uint8Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="non_blocking_send" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="receive_batch_size" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="receive_threads_per_port" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="maxMessageSize" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="maxInitialPeersRange" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="interfaceWhiteList" type="stringListType" minOccurs="0" maxOccurs="1"/>
@@ -318,6 +320,22 @@ XMLP_ret XMLParser::parseXMLTransportData(
                     return XMLP_ret::XML_ERROR;
                 }
             }
+            // Receive batch size
+            if (nullptr != (p_aux0 = p_root->FirstChildElement(RECEIVE_BATCH_SIZE)))
+            {
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &pUDPDesc->receive_batch_size, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
+            // Receive threads per port
+            if (nullptr != (p_aux0 = p_root->FirstChildElement(RECEIVE_THREADS_PER_PORT)))
+            {
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &pUDPDesc->receive_threads_per_port, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
         }
         else if (sType == TCPv4)
         {
@@ -499,10 +517,12 @@ XMLP_ret XMLParser::parseXMLCommonTransportData(
                 strcmp(name, CALCULATE_CRC) == 0 || strcmp(name, CHECK_CRC) == 0 ||
                 strcmp(name, ENABLE_TCP_NODELAY) == 0 || strcmp(name, TLS) == 0 ||
                 strcmp(name, NON_BLOCKING_SEND) == 0  ||
+                strcmp(name, RECEIVE_BATCH_SIZE) == 0 || strcmp(name, RECEIVE_THREADS_PER_PORT) == 0 ||
                 strcmp(name, SEGMENT_SIZE) == 0 || strcmp(name, PORT_QUEUE_CAPACITY) == 0 ||
                 strcmp(name, PORT_OVERFLOW_POLICY) == 0 || strcmp(name, SEGMENT_OVERFLOW_POLICY) == 0 ||
                 strcmp(name, HEALTHY_CHECK_TIMEOUT_MS) == 0 || strcmp(name, HEALTHY_CHECK_TIMEOUT_MS) == 0 ||
-                strcmp(name, RTPS_DUMP_FILE) == 0)
+                strcmp(name, RTPS_DUMP_FILE) == 0 || strcmp(name, FUTEX_NOTIFICATION) == 0 ||
+                strcmp(name, NOTIFICATION_SPIN_US) == 0)
         {
             // Parsed outside of this method
         }
@@ -682,6 +702,11 @@ XMLP_ret XMLParser::parseXMLCommonSharedMemTransportData(
                 <xs:element name="port_queue_capacity" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="healthy_check_timeout_ms" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="rtps_dump_file" type="stringType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="futex_notification" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="notification_spin_us" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="zero_copy_min_size" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="huge_pages" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="numa_node" type="int32Type" minOccurs="0" maxOccurs="1"/>
                 </xs:all>
         </xs:complexType>
      */
@@ -730,6 +755,49 @@ XMLP_ret XMLParser::parseXMLCommonSharedMemTransportData(
                 }
                 transport_descriptor->rtps_dump_file(str);
             }
+            else if (strcmp(name, FUTEX_NOTIFICATION) == 0)
+            {
+                bool futex_notification = false;
+                if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &futex_notification, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->futex_notification(futex_notification);
+            }
+            else if (strcmp(name, NOTIFICATION_SPIN_US) == 0)
+            {
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &aux, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->notification_spin_us(static_cast<uint32_t>(aux));
+            }
+            else if (strcmp(name, ZERO_COPY_MIN_SIZE) == 0)
+            {
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &aux, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->zero_copy_min_size(static_cast<uint32_t>(aux));
+            }
+            else if (strcmp(name, HUGE_PAGES) == 0)
+            {
+                bool huge_pages = false;
+                if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &huge_pages, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->huge_pages(huge_pages);
+            }
+            else if (strcmp(name, NUMA_NODE) == 0)
+            {
+                int numa_node = -1;
+                if (XMLP_ret::XML_OK != getXMLInt(p_aux0, &numa_node, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->numa_node(static_cast<int32_t>(numa_node));
+            }
             else if (strcmp(name, MAX_MESSAGE_SIZE) == 0)
             {
                 // maxMessageSize - uint32Type
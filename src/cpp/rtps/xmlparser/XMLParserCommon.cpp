@@ -44,6 +44,8 @@ const char* RECEIVE_BUFFER_SIZE = "receiveBufferSize";
 const char* SEND_BUFFER_SIZE = "sendBufferSize";
 const char* TTL = "TTL";
 const char* NON_BLOCKING_SEND = "non_blocking_send";
+const char* RECEIVE_BATCH_SIZE = "receive_batch_size";
+const char* RECEIVE_THREADS_PER_PORT = "receive_threads_per_port";
 const char* WHITE_LIST = "interfaceWhiteList";
 const char* MAX_MESSAGE_SIZE = "maxMessageSize";
 const char* MAX_INITIAL_PEERS_RANGE = "maxInitialPeersRange";
@@ -65,6 +67,12 @@ const char* HEALTHY_CHECK_TIMEOUT_MS = "healthy_check_timeout_ms";
 const char* DISCARD = "DISCARD";
 const char* FAIL = "FAIL";
 const char* RTPS_DUMP_FILE = "rtps_dump_file";
+const char* FUTEX_NOTIFICATION = "futex_notification";
+const char* NOTIFICATION_SPIN_US = "notification_spin_us";
+const char* ZERO_COPY_MIN_SIZE = "zero_copy_min_size";
+const char* HUGE_PAGES = "huge_pages";
+const char* NUMA_NODE = "numa_node";
+const char* PREFAULT = "prefault";
 const char* ON = "ON";
 
 const char* OFF = "OFF";
@@ -195,6 +203,7 @@ const char* DATA_SHARING = "data_sharing";
 
 const char* SYNCHRONOUS = "SYNCHRONOUS";
 const char* ASYNCHRONOUS = "ASYNCHRONOUS";
+const char* PRIORITY = "priority";
 const char* NAMES = "names";
 const char* INSTANCE = "INSTANCE";
 const char* GROUP = "GROUP";
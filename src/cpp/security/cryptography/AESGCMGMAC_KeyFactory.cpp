@@ -33,6 +33,7 @@
 #include <string.h>
 
 #include <security/cryptography/AESGCMGMAC_KeyFactory.h>
+#include <security/cryptography/AESGCMGMAC_Transform.h>
 
 // Solve error with Win32 macro
 #ifdef WIN32
@@ -748,6 +749,9 @@ bool AESGCMGMAC_KeyFactory::unregister_participant(
 
     delete &local_participant;
 
+    // Do not keep keys derived from the removed material
+    AESGCMGMAC_Transform::clear_thread_caches();
+
     return true;
 
 }
@@ -793,6 +797,7 @@ bool AESGCMGMAC_KeyFactory::unregister_datawriter(
             parent_participant->Writers.erase(it);
             AESGCMGMAC_WriterCryptoHandle* me = (AESGCMGMAC_WriterCryptoHandle*)datawriter_crypto_handle;
             delete me;
+            AESGCMGMAC_Transform::clear_thread_caches();
             return true;
         }
     }
@@ -841,6 +846,7 @@ bool AESGCMGMAC_KeyFactory::unregister_datareader(
             parent_participant->Readers.erase(it);
             AESGCMGMAC_ReaderCryptoHandle* parent = (AESGCMGMAC_ReaderCryptoHandle*)datareader_crypto_handle;
             delete parent;
+            AESGCMGMAC_Transform::clear_thread_caches();
             return true;
         }
     }
@@ -24,7 +24,13 @@
 #include <openssl/aes.h>
 #include <openssl/evp.h>
 #include <openssl/rand.h>
+#include <openssl/crypto.h>
+#include <algorithm>
+#include <array>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #if OPENSSL_VERSION_NUMBER >= 0x10100000L
 #define IS_OPENSSL_1_1 1
@@ -61,6 +67,219 @@ static KeyMaterial_AES_GCM_GMAC* find_key(
     return nullptr;
 }
 
+namespace {
+
+/*
+ * Creating an OpenSSL cipher context and setting a key on it (which expands the AES key schedule) costs more than
+ * ciphering a small submessage, and each session key derivation builds a new HMAC key.
+ * Decoding is done without locking the crypto handles, so each thread keeps its own contexts and derived session
+ * keys. While a session key does not change, its context is only given the initialization vector of the message.
+ * The caches of all threads are registered, so the key factory can cleanse them when keys are unregistered or
+ * replaced. Each cache has a mutex for that, which is only contended while cleansing.
+ */
+
+//! Number of keys with a cipher context ready on each thread.
+constexpr size_t max_cached_cipher_contexts = 16;
+//! Number of derived session keys kept on each thread.
+constexpr size_t max_cached_session_keys = 16;
+
+class CachedCipherContext
+{
+public:
+
+    CachedCipherContext()
+        : ctx_(EVP_CIPHER_CTX_new())
+        , cipher_(nullptr)
+        , encrypt_(false)
+    {
+        key_.fill(0);
+    }
+
+    ~CachedCipherContext()
+    {
+        OPENSSL_cleanse(key_.data(), key_.size());
+        EVP_CIPHER_CTX_free(ctx_);
+    }
+
+    CachedCipherContext(
+            const CachedCipherContext&) = delete;
+
+    CachedCipherContext& operator =(
+            const CachedCipherContext&) = delete;
+
+    bool has_key(
+            bool encrypt,
+            const EVP_CIPHER* cipher,
+            const std::array<uint8_t, 32>& key) const
+    {
+        return cipher_ == cipher && encrypt_ == encrypt && key_ == key;
+    }
+
+    /**
+     * Prepare the context to process a new message.
+     * The key is only set when it is not the one of the previous message.
+     * @return The context, or nullptr on error.
+     */
+    EVP_CIPHER_CTX* start(
+            bool encrypt,
+            const EVP_CIPHER* cipher,
+            const std::array<uint8_t, 32>& key,
+            const std::array<uint8_t, 12>& initialization_vector)
+    {
+        if (nullptr == ctx_)
+        {
+            return nullptr;
+        }
+
+        bool rekey = !has_key(encrypt, cipher, key);
+        const EVP_CIPHER* init_cipher = rekey ? cipher : nullptr;
+        const unsigned char* init_key = rekey ? key.data() : nullptr;
+        int ret = encrypt ?
+                EVP_EncryptInit_ex(ctx_, init_cipher, nullptr, init_key, initialization_vector.data()) :
+                EVP_DecryptInit_ex(ctx_, init_cipher, nullptr, init_key, initialization_vector.data());
+        if (!ret)
+        {
+            // Force setting the key on next use
+            cipher_ = nullptr;
+            return nullptr;
+        }
+
+        if (rekey)
+        {
+            cipher_ = cipher;
+            encrypt_ = encrypt;
+            key_ = key;
+        }
+        return ctx_;
+    }
+
+private:
+
+    EVP_CIPHER_CTX* ctx_;
+    const EVP_CIPHER* cipher_;
+    bool encrypt_;
+    std::array<uint8_t, 32> key_;
+};
+
+struct CachedSessionKey
+{
+    bool receiver_specific = false;
+    int key_len = 0;
+    uint32_t session_id = 0;
+    std::array<uint8_t, 32> master_key = c_empty_key_material;
+    std::array<uint8_t, 32> master_salt = c_empty_key_material;
+    std::array<uint8_t, 32> session_key = c_empty_key_material;
+};
+
+struct ThreadCryptoContexts;
+
+//! Caches of all the threads.
+struct ThreadCryptoContextsRegistry
+{
+    std::mutex mutex;
+    std::vector<ThreadCryptoContexts*> contexts;
+};
+
+ThreadCryptoContextsRegistry& thread_crypto_contexts_registry()
+{
+    static ThreadCryptoContextsRegistry registry;
+    return registry;
+}
+
+struct ThreadCryptoContexts
+{
+    ThreadCryptoContexts()
+        : next_cipher(0)
+        , next_session_key(0)
+#if IS_OPENSSL_1_1
+        , md_ctx(EVP_MD_CTX_new())
+#else
+        , md_ctx(EVP_MD_CTX_create())
+#endif // if IS_OPENSSL_1_1
+    {
+        ThreadCryptoContextsRegistry& registry = thread_crypto_contexts_registry();
+        std::lock_guard<std::mutex> guard(registry.mutex);
+        registry.contexts.push_back(this);
+    }
+
+    ~ThreadCryptoContexts()
+    {
+        {
+            ThreadCryptoContextsRegistry& registry = thread_crypto_contexts_registry();
+            std::lock_guard<std::mutex> guard(registry.mutex);
+            registry.contexts.erase(std::find(registry.contexts.begin(), registry.contexts.end(), this));
+        }
+
+        OPENSSL_cleanse(session_keys.data(), sizeof(CachedSessionKey) * session_keys.size());
+#if IS_OPENSSL_1_1
+        EVP_MD_CTX_free(md_ctx);
+#else
+        EVP_MD_CTX_destroy(md_ctx);
+#endif // if IS_OPENSSL_1_1
+    }
+
+    //! Cleanse all the cached keys. Should be called with the mutex taken.
+    void clear()
+    {
+        // Freeing the cipher contexts also cleanses their key schedules
+        ciphers.clear();
+        next_cipher = 0;
+        OPENSSL_cleanse(session_keys.data(), sizeof(CachedSessionKey) * session_keys.size());
+        session_keys.fill(CachedSessionKey());
+        next_session_key = 0;
+    }
+
+    //! Get a context ready to process a message, reusing the one that last used the same key.
+    EVP_CIPHER_CTX* cipher_context(
+            bool encrypt,
+            const EVP_CIPHER* cipher,
+            const std::array<uint8_t, 32>& key,
+            const std::array<uint8_t, 12>& initialization_vector)
+    {
+        for (std::unique_ptr<CachedCipherContext>& ctx : ciphers)
+        {
+            if (ctx->has_key(encrypt, cipher, key))
+            {
+                return ctx->start(encrypt, cipher, key, initialization_vector);
+            }
+        }
+
+        if (ciphers.size() < max_cached_cipher_contexts)
+        {
+            ciphers.emplace_back(new CachedCipherContext());
+            return ciphers.back()->start(encrypt, cipher, key, initialization_vector);
+        }
+
+        // All contexts in use, replace them in round robin
+        CachedCipherContext& ctx = *ciphers[next_cipher];
+        next_cipher = (next_cipher + 1) % max_cached_cipher_contexts;
+        return ctx.start(encrypt, cipher, key, initialization_vector);
+    }
+
+    //! Taken while using the cache, so other threads can cleanse it.
+    std::mutex mutex;
+    std::vector<std::unique_ptr<CachedCipherContext>> ciphers;
+    size_t next_cipher;
+    std::array<CachedSessionKey, max_cached_session_keys> session_keys;
+    size_t next_session_key;
+    EVP_MD_CTX* md_ctx;
+};
+
+thread_local ThreadCryptoContexts thread_crypto_contexts;
+
+} // namespace
+
+void AESGCMGMAC_Transform::clear_thread_caches()
+{
+    ThreadCryptoContextsRegistry& registry = thread_crypto_contexts_registry();
+    std::lock_guard<std::mutex> guard(registry.mutex);
+    for (ThreadCryptoContexts* contexts : registry.contexts)
+    {
+        std::lock_guard<std::mutex> contexts_guard(contexts->mutex);
+        contexts->clear();
+    }
+}
+
 AESGCMGMAC_Transform::AESGCMGMAC_Transform()
 {
 }
@@ -1471,6 +1690,19 @@ void AESGCMGMAC_Transform::compute_sessionkey(
         const uint32_t session_id,
         int key_len)
 {
+    ThreadCryptoContexts& contexts = thread_crypto_contexts;
+    std::lock_guard<std::mutex> contexts_guard(contexts.mutex);
+    for (const CachedSessionKey& entry : contexts.session_keys)
+    {
+        if (entry.key_len == key_len && entry.session_id == session_id &&
+                entry.receiver_specific == receiver_specific &&
+                entry.master_key == master_key && entry.master_salt == master_salt)
+        {
+            session_key = entry.session_key;
+            return;
+        }
+    }
+
     session_key.fill(0);
 
     int sourceLen = 0;
@@ -1493,27 +1725,32 @@ void AESGCMGMAC_Transform::compute_sessionkey(
     sourceLen += 4;
 
     EVP_PKEY* key = EVP_PKEY_new_mac_key(EVP_PKEY_HMAC, NULL, master_key.data(), key_len);
-    EVP_MD_CTX* ctx =
+    EVP_MD_CTX* ctx = contexts.md_ctx;
 #if IS_OPENSSL_1_1
-            EVP_MD_CTX_new();
+    EVP_MD_CTX_reset(ctx);
 #else
-            (EVP_MD_CTX*)malloc(sizeof(EVP_MD_CTX));
-#endif // if IS_OPENSSL_1_1
+    EVP_MD_CTX_cleanup(ctx);
     EVP_MD_CTX_init(ctx);
+#endif // if IS_OPENSSL_1_1
     EVP_DigestSignInit(ctx, NULL, EVP_sha256(), NULL, key);
     EVP_DigestSignUpdate(ctx, source, sourceLen);
 
-    size_t finalLen;
-    EVP_DigestSignFinal(ctx, NULL, &finalLen);
-    EVP_DigestSignFinal(ctx, session_key.data(), &finalLen);
+    size_t finalLen = session_key.size();
+    bool derived = (1 == EVP_DigestSignFinal(ctx, session_key.data(), &finalLen));
 
     EVP_PKEY_free(key);
-#if IS_OPENSSL_1_1
-    EVP_MD_CTX_free(ctx);
-#else
-    EVP_MD_CTX_cleanup(ctx);
-    free(ctx);
-#endif // if IS_OPENSSL_1_1
+
+    if (derived)
+    {
+        CachedSessionKey& entry = contexts.session_keys[contexts.next_session_key];
+        contexts.next_session_key = (contexts.next_session_key + 1) % max_cached_session_keys;
+        entry.receiver_specific = receiver_specific;
+        entry.key_len = key_len;
+        entry.session_id = session_id;
+        entry.master_key = master_key;
+        entry.master_salt = master_salt;
+        entry.session_key = session_key;
+    }
 }
 
 void AESGCMGMAC_Transform::serialize_SecureDataHeader(
@@ -1544,32 +1781,17 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
 
     // AES_BLOCK_SIZE = 16
     int cipher_block_size = 0, actual_size = 0, final_size = 0;
-    EVP_CIPHER_CTX* e_ctx = EVP_CIPHER_CTX_new();
-
-    if (!use_256_bits)
+    const EVP_CIPHER* e_cipher = use_256_bits ? EVP_aes_256_gcm() : EVP_aes_128_gcm();
+    std::lock_guard<std::mutex> contexts_guard(thread_crypto_contexts.mutex);
+    EVP_CIPHER_CTX* e_ctx =
+            thread_crypto_contexts.cipher_context(true, e_cipher, session_key, initialization_vector);
+    if (nullptr == e_ctx)
     {
-        if (!EVP_EncryptInit(e_ctx, EVP_aes_128_gcm(), (const unsigned char*)(session_key.data()),
-                initialization_vector.data()))
-        {
-            logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
-            return false;
-        }
-
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_128_gcm());
+        logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
+        return false;
     }
-    else
-    {
-        if (!EVP_EncryptInit(e_ctx, EVP_aes_256_gcm(), (const unsigned char*)(session_key.data()),
-                initialization_vector.data()))
-        {
-            logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
-            return false;
-        }
 
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_256_gcm());
-    }
+    cipher_block_size = EVP_CIPHER_block_size(e_cipher);
 
     if (!do_encryption)
     {
@@ -1578,7 +1800,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
                 plain_buffer_len)
         {
             logError(SECURITY_CRYPTO, "Not enough memory to copy payload");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
         memcpy(serializer.getCurrentPosition(), plain_buffer, plain_buffer_len);
@@ -1587,14 +1808,12 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
         if (!EVP_EncryptUpdate(e_ctx, nullptr, &actual_size, plain_buffer, static_cast<int>(plain_buffer_len)))
         {
             logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
 
         if (!EVP_EncryptFinal(e_ctx, nullptr, &final_size))
         {
             logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
     }
@@ -1638,7 +1857,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
                 (plain_buffer_len + (2 * cipher_block_size) - 1))
         {
             logError(SECURITY_CRYPTO, "Not enough memory to cipher payload");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
 
@@ -1646,14 +1864,12 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
                 static_cast<int>(plain_buffer_len)))
         {
             logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
 
         if (!EVP_EncryptFinal(e_ctx, &output_buffer_raw[actual_size], &final_size))
         {
             logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
 
@@ -1679,7 +1895,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
 
     // Get commmon_mac
     EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_GET_TAG, AES_BLOCK_SIZE, tag.common_mac.data());
-    EVP_CIPHER_CTX_free(e_ctx);
 
     if (submessage)
     {
@@ -1761,49 +1976,30 @@ bool AESGCMGMAC_Transform::serialize_SecureDataTag(
 
         //Obtain MAC using ReceiverSpecificKey and the same Initialization Vector as before
         int actual_size = 0, final_size = 0;
-        EVP_CIPHER_CTX* e_ctx = EVP_CIPHER_CTX_new();
-        if (transformation_kind == c_transfrom_kind_aes128_gcm ||
-                transformation_kind == c_transfrom_kind_aes128_gmac)
+        std::lock_guard<std::mutex> contexts_guard(thread_crypto_contexts.mutex);
+        EVP_CIPHER_CTX* e_ctx = thread_crypto_contexts.cipher_context(true,
+                        use_256_bits ? EVP_aes_256_gcm() : EVP_aes_128_gcm(),
+                        remote_entity->Sessions[sessionIndex].SessionKey, initialization_vector);
+        if (nullptr == e_ctx)
         {
-            if (!EVP_EncryptInit(e_ctx, EVP_aes_128_gcm(),
-                    (const unsigned char*)(remote_entity->Sessions[sessionIndex].SessionKey.data()),
-                    initialization_vector.data()))
-            {
-                logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
-        }
-        else if (transformation_kind == c_transfrom_kind_aes256_gcm ||
-                transformation_kind == c_transfrom_kind_aes256_gmac)
-        {
-            if (!EVP_EncryptInit(e_ctx, EVP_aes_256_gcm(),
-                    (const unsigned char*)(remote_entity->Sessions[sessionIndex].SessionKey.data()),
-                    initialization_vector.data()))
-            {
-                logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
+            logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
+            continue;
         }
         if (!EVP_EncryptUpdate(e_ctx, NULL, &actual_size, tag.common_mac.data(), 16))
         {
             logError(SECURITY_CRYPTO,
                     "Unable to create authentication for the datawriter submessage. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             continue;
         }
         if (!EVP_EncryptFinal(e_ctx, NULL, &final_size))
         {
             logError(SECURITY_CRYPTO,
                     "Unable to create authentication for the datawriter submessage. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             continue;
         }
         serializer << remote_entity->Remote2EntityKeyMaterial.at(0).receiver_specific_key_id;
         EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_GET_TAG, AES_BLOCK_SIZE, serializer.getCurrentPosition());
         serializer.jump(16);
-        EVP_CIPHER_CTX_free(e_ctx);
 
         ++length;
     }
@@ -1872,50 +2068,30 @@ bool AESGCMGMAC_Transform::serialize_SecureDataTag(
 
         //Obtain MAC using ReceiverSpecificKey and the same Initialization Vector as before
         int actual_size = 0, final_size = 0;
-        EVP_CIPHER_CTX* e_ctx = EVP_CIPHER_CTX_new();
-        auto& trans_kind = remote_participant->Participant2ParticipantKeyMaterial.at(0).transformation_kind;
-        if (trans_kind == c_transfrom_kind_aes128_gcm ||
-                trans_kind == c_transfrom_kind_aes128_gmac)
-        {
-            if (!EVP_EncryptInit(e_ctx, EVP_aes_128_gcm(),
-                    (const unsigned char*)(remote_participant->Session.SessionKey.data()),
-                    initialization_vector.data()))
-            {
-                logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
-        }
-        else if (trans_kind == c_transfrom_kind_aes256_gcm ||
-                trans_kind == c_transfrom_kind_aes256_gmac)
+        std::lock_guard<std::mutex> contexts_guard(thread_crypto_contexts.mutex);
+        EVP_CIPHER_CTX* e_ctx = thread_crypto_contexts.cipher_context(true,
+                        use_256_bits ? EVP_aes_256_gcm() : EVP_aes_128_gcm(),
+                        remote_participant->Session.SessionKey, initialization_vector);
+        if (nullptr == e_ctx)
         {
-            if (!EVP_EncryptInit(e_ctx, EVP_aes_256_gcm(),
-                    (const unsigned char*)(remote_participant->Session.SessionKey.data()),
-                    initialization_vector.data()))
-            {
-                logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
+            logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
+            continue;
         }
         if (!EVP_EncryptUpdate(e_ctx, NULL, &actual_size, tag.common_mac.data(), 16))
         {
             logError(SECURITY_CRYPTO,
                     "Unable to create authentication for the datawriter submessage. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             continue;
         }
         if (!EVP_EncryptFinal(e_ctx, NULL, &final_size))
         {
             logError(SECURITY_CRYPTO,
                     "Unable to create authentication for the datawriter submessage. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             continue;
         }
         serializer << remote_participant->Participant2ParticipantKeyMaterial.at(0).receiver_specific_key_id;
         EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_GET_TAG, AES_BLOCK_SIZE, serializer.getCurrentPosition());
         serializer.jump(16);
-        EVP_CIPHER_CTX_free(e_ctx);
 
         ++length;
     }
@@ -1957,33 +2133,18 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataBody(
     bool use_256_bits = (transformation_kind == c_transfrom_kind_aes256_gcm ||
             transformation_kind == c_transfrom_kind_aes256_gmac);
 
-    EVP_CIPHER_CTX* d_ctx = EVP_CIPHER_CTX_new();
     int cipher_block_size = 0, actual_size = 0, final_size = 0;
-
-    if (!use_256_bits)
+    const EVP_CIPHER* d_cipher = use_256_bits ? EVP_aes_256_gcm() : EVP_aes_128_gcm();
+    std::lock_guard<std::mutex> contexts_guard(thread_crypto_contexts.mutex);
+    EVP_CIPHER_CTX* d_ctx =
+            thread_crypto_contexts.cipher_context(false, d_cipher, session_key, initialization_vector);
+    if (nullptr == d_ctx)
     {
-        if (!EVP_DecryptInit(d_ctx, EVP_aes_128_gcm(), (const unsigned char*)session_key.data(),
-                initialization_vector.data()))
-        {
-            logError(SECURITY_CRYPTO, "Unable to decode the payload. EVP_DecryptInit function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
-            return false;
-        }
-
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_128_gcm());
+        logError(SECURITY_CRYPTO, "Unable to decode the payload. EVP_DecryptInit function returns an error");
+        return false;
     }
-    else
-    {
-        if (!EVP_DecryptInit(d_ctx, EVP_aes_256_gcm(), (const unsigned char*)session_key.data(),
-                initialization_vector.data()))
-        {
-            logError(SECURITY_CRYPTO, "Unable to decode the payload. EVP_DecryptInit function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
-            return false;
-        }
 
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_256_gcm());
-    }
+    cipher_block_size = EVP_CIPHER_block_size(d_cipher);
 
     uint32_t protected_len = body_length;
     if (do_encryption)
@@ -1995,7 +2156,6 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataBody(
         if (plain_buffer_len < (protected_len + cipher_block_size))
         {
             logWarning(SECURITY_CRYPTO, "Not enough memory to decode payload");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
     }
@@ -2005,7 +2165,6 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataBody(
     if (!EVP_DecryptUpdate(d_ctx, output_buffer, &actual_size, input_buffer, protected_len))
     {
         logWarning(SECURITY_CRYPTO, "Unable to decode the payload. EVP_DecryptUpdate function returns an error");
-        EVP_CIPHER_CTX_free(d_ctx);
         return false;
     }
 
@@ -2014,10 +2173,8 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataBody(
     if (!EVP_DecryptFinal(d_ctx, output_buffer ? &output_buffer[actual_size] : NULL, &final_size))
     {
         logWarning(SECURITY_CRYPTO, "Unable to decode the payload. EVP_DecryptFinal function returns an error");
-        EVP_CIPHER_CTX_free(d_ctx);
         return false;
     }
-    EVP_CIPHER_CTX_free(d_ctx);
 
     uint32_t cnt_len = do_encryption ? static_cast<uint32_t>(actual_size + final_size) : body_length;
     if (plain_buffer_len < cnt_len)
@@ -2119,7 +2276,6 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         }
 
         //Auth message - The point is that we cannot verify the authorship of the message with our receiver_specific_key the message could be crafted
-        EVP_CIPHER_CTX* d_ctx = EVP_CIPHER_CTX_new();
         const EVP_CIPHER* d_cipher = nullptr;
 
         int actual_size = 0, final_size = 0;
@@ -2143,15 +2299,15 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         else
         {
             logError(SECURITY_CRYPTO, "Invalid transformation kind)");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
-        if (!EVP_DecryptInit(d_ctx, d_cipher, (const unsigned char*)specific_session_key.data(),
-                initialization_vector.data()))
+        std::lock_guard<std::mutex> contexts_guard(thread_crypto_contexts.mutex);
+        EVP_CIPHER_CTX* d_ctx =
+                thread_crypto_contexts.cipher_context(false, d_cipher, specific_session_key, initialization_vector);
+        if (nullptr == d_ctx)
         {
             logError(SECURITY_CRYPTO, "Unable to authenticate the message. EVP_DecryptInit function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
@@ -2159,7 +2315,6 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         {
             logError(SECURITY_CRYPTO,
                     "Unable to authenticate the message. EVP_DecryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
@@ -2167,7 +2322,6 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         {
             logError(SECURITY_CRYPTO,
                     "Unable to authenticate the message. EVP_CIPHER_CTX_ctrl function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
@@ -2175,11 +2329,9 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         {
             logError(SECURITY_CRYPTO,
                     "Unable to authenticate the message. EVP_DecryptFinal_ex function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
-        EVP_CIPHER_CTX_free(d_ctx);
     }
 
     return true;
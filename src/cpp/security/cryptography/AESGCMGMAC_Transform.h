@@ -104,6 +104,12 @@ public:
             DatawriterCryptoHandle& sending_datawriter_crypto,
             SecurityException& exception) override;
 
+    /**
+     * Cleanse the cipher contexts and session keys cached by every thread.
+     * Called when key material is unregistered or replaced, so it does not outlive its crypto handle.
+     */
+    static void clear_thread_caches();
+
     //Aux functions to compute session key from the master material
     void compute_sessionkey(
             std::array<uint8_t, 32>& session_key,
@@ -67,12 +67,18 @@ constexpr const char* EDP_PACKETS_TOPIC_ALIAS = "EDP_PACKETS_TOPIC";
 constexpr const char* DISCOVERY_TOPIC_ALIAS = "DISCOVERY_TOPIC";
 constexpr const char* SAMPLE_DATAS_TOPIC_ALIAS = "SAMPLE_DATAS_TOPIC";
 constexpr const char* PHYSICAL_DATA_TOPIC_ALIAS = "PHYSICAL_DATA_TOPIC";
+constexpr const char* HISTORY_LATENCY_SUMMARY_TOPIC_ALIAS = "HISTORY_LATENCY_SUMMARY_TOPIC";
+constexpr const char* NETWORK_LATENCY_SUMMARY_TOPIC_ALIAS = "NETWORK_LATENCY_SUMMARY_TOPIC";
 
 static constexpr uint32_t participant_statistics_mask =
         EventKind::RTPS_SENT | EventKind::RTPS_LOST | EventKind::NETWORK_LATENCY |
         EventKind::EDP_PACKETS | EventKind::PDP_PACKETS |
         EventKind::PHYSICAL_DATA | EventKind::DISCOVERED_ENTITY;
 
+// The latency summaries are only requested while their DataWriters are enabled, as they require aggregating latencies
+static constexpr uint32_t latency_summaries_mask =
+        EventKind::HISTORY2HISTORY_LATENCY_SUMMARY | EventKind::NETWORK_LATENCY_SUMMARY;
+
 struct ValidEntry
 {
     const char* alias;
@@ -98,7 +104,9 @@ static const ValidEntry valid_entries[] =
     {EDP_PACKETS_TOPIC_ALIAS,             EDP_PACKETS_TOPIC,             EDP_PACKETS},
     {DISCOVERY_TOPIC_ALIAS,               DISCOVERY_TOPIC,               DISCOVERED_ENTITY},
     {SAMPLE_DATAS_TOPIC_ALIAS,            SAMPLE_DATAS_TOPIC,            SAMPLE_DATAS},
-    {PHYSICAL_DATA_TOPIC_ALIAS,           PHYSICAL_DATA_TOPIC,           PHYSICAL_DATA}
+    {PHYSICAL_DATA_TOPIC_ALIAS,           PHYSICAL_DATA_TOPIC,           PHYSICAL_DATA},
+    {HISTORY_LATENCY_SUMMARY_TOPIC_ALIAS, HISTORY_LATENCY_SUMMARY_TOPIC, HISTORY2HISTORY_LATENCY_SUMMARY},
+    {NETWORK_LATENCY_SUMMARY_TOPIC_ALIAS, NETWORK_LATENCY_SUMMARY_TOPIC, NETWORK_LATENCY_SUMMARY}
 };
 
 ReturnCode_t DomainParticipantImpl::enable_statistics_datawriter(
@@ -157,6 +165,11 @@ ReturnCode_t DomainParticipantImpl::enable_statistics_datawriter(
             else
             {
                 statistics_listener_->set_datawriter(event_kind, data_writer);
+
+                if (latency_summaries_mask & event_kind)
+                {
+                    rtps_participant_->add_statistics_listener(statistics_listener_, event_kind);
+                }
             }
         }
         return ReturnCode_t::RETCODE_OK;
@@ -180,6 +193,12 @@ ReturnCode_t DomainParticipantImpl::disable_statistics_datawriter(
     efd::DataWriter* writer = builtin_publisher_->lookup_datawriter(use_topic_name);
     if (nullptr != writer)
     {
+        // Stop publishing the latency summaries, waiting for an ongoing publication
+        if (latency_summaries_mask & event_kind)
+        {
+            rtps_participant_->remove_statistics_listener(statistics_listener_, event_kind);
+        }
+
         // Avoid calling DataWriter from listener callback
         statistics_listener_->set_datawriter(event_kind, nullptr);
 
@@ -217,7 +236,8 @@ void DomainParticipantImpl::disable()
 {
     if (nullptr != rtps_participant_)
     {
-        rtps_participant_->remove_statistics_listener(statistics_listener_, participant_statistics_mask);
+        rtps_participant_->remove_statistics_listener(statistics_listener_,
+                participant_statistics_mask | latency_summaries_mask);
     }
     efd::DomainParticipantImpl::disable();
 }
@@ -390,6 +410,16 @@ bool DomainParticipantImpl::register_statistics_type_and_topic(
         efd::TypeSupport physical_data_type(new PhysicalDataPubSubType);
         return_code = find_or_create_topic_and_type(topic, topic_name, physical_data_type);
     }
+    else if (HISTORY_LATENCY_SUMMARY_TOPIC == topic_name)
+    {
+        efd::TypeSupport history_latency_summary_type(new WriterReaderLatencySummaryPubSubType);
+        return_code = find_or_create_topic_and_type(topic, topic_name, history_latency_summary_type);
+    }
+    else if (NETWORK_LATENCY_SUMMARY_TOPIC == topic_name)
+    {
+        efd::TypeSupport network_latency_summary_type(new Locator2LocatorLatencySummaryPubSubType);
+        return_code = find_or_create_topic_and_type(topic, topic_name, network_latency_summary_type);
+    }
     return return_code;
 }
 
@@ -411,8 +441,13 @@ bool DomainParticipantImpl::find_or_create_topic_and_type(
         else
         {
             // TODO(jlbueno) This casting should be checked after other TopicDescription implementations are
-            // included: ContentFilteredTopic, MultiTopic.
+            // included: MultiTopic.
             *topic = dynamic_cast<efd::Topic*>(topic_desc);
+            if (nullptr == *topic)
+            {
+                logError(STATISTICS_DOMAIN_PARTICIPANT, topic_name << " is already used by a ContentFilteredTopic");
+                return false;
+            }
         }
     }
     else
@@ -98,6 +98,14 @@ void DomainParticipantStatisticsListener::on_statistics_data(
             case EventKind::PHYSICAL_DATA:
                 data_sample = &statistics_data.physical_data();
                 break;
+
+            case EventKind::HISTORY2HISTORY_LATENCY_SUMMARY:
+                data_sample = &statistics_data.writer_reader_latency_summary();
+                break;
+
+            case EventKind::NETWORK_LATENCY_SUMMARY:
+                data_sample = &statistics_data.locator2locator_latency_summary();
+                break;
         }
 
         writer->write(const_cast<void*>(data_sample));
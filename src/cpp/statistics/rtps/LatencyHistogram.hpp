@@ -0,0 +1,174 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LatencyHistogram.hpp
+ */
+
+#ifndef _STATISTICS_RTPS_LATENCYHISTOGRAM_HPP_
+#define _STATISTICS_RTPS_LATENCYHISTOGRAM_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <statistics/types/types.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace statistics {
+
+/**
+ * Histogram of latencies in nanoseconds, with a bounded relative error.
+ *
+ * Buckets follow a log-linear layout like the one of HDR histograms: values below 2 * sub_buckets get a bucket each,
+ * and every further power of two is split on sub_buckets buckets of the same width. Recording a value is a single
+ * relaxed atomic increment, so it can be done from any thread without locking. Values over max_value are counted on
+ * the last bucket, but the maximum is always exact.
+ */
+class LatencyHistogram
+{
+public:
+
+    //! Number of buckets each power of two is split on. The relative error of the percentiles is below 1/sub_buckets.
+    static constexpr uint32_t sub_buckets_bits = 5;
+    static constexpr uint32_t sub_buckets = 1u << sub_buckets_bits;
+
+    //! Highest value with a bucket of its own: about 68 seconds.
+    static constexpr uint64_t max_value = (1ull << 36) - 1;
+
+    static constexpr size_t num_buckets =
+            static_cast<size_t>(36 - sub_buckets_bits) * sub_buckets + sub_buckets;
+
+    LatencyHistogram()
+    {
+        for (std::atomic<uint64_t>& bucket : buckets_)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    LatencyHistogram(
+            const LatencyHistogram&) = delete;
+
+    LatencyHistogram& operator =(
+            const LatencyHistogram&) = delete;
+
+    /**
+     * Add a value to the histogram.
+     * @param value Latency in nanoseconds.
+     */
+    void record(
+            uint64_t value)
+    {
+        buckets_[bucket_index(value < max_value ? value : max_value)].fetch_add(1, std::memory_order_relaxed);
+
+        uint64_t maximum = maximum_.load(std::memory_order_relaxed);
+        while (value > maximum &&
+                !maximum_.compare_exchange_weak(maximum, value, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    /**
+     * Compute the percentiles of the values recorded since the previous call, and empty the histogram.
+     * Values recorded while computing them may be accounted for on this call or on the next one.
+     * @param [out] percentiles Count, percentiles and maximum of the recorded values, in nanoseconds.
+     * @return false when no value was recorded since the previous call.
+     */
+    bool take(
+            detail::LatencyPercentiles_s& percentiles)
+    {
+        uint64_t counts[num_buckets];
+        uint64_t total = 0;
+        for (size_t i = 0; i < num_buckets; ++i)
+        {
+            counts[i] = buckets_[i].exchange(0, std::memory_order_relaxed);
+            total += counts[i];
+        }
+        uint64_t maximum = maximum_.exchange(0, std::memory_order_relaxed);
+
+        if (0 == total)
+        {
+            return false;
+        }
+
+        percentiles.count(total);
+        percentiles.p50(value_at(counts, total, 0.5, maximum));
+        percentiles.p99(value_at(counts, total, 0.99, maximum));
+        percentiles.p999(value_at(counts, total, 0.999, maximum));
+        percentiles.maximum(static_cast<float>(maximum));
+        return true;
+    }
+
+    //! Index of the bucket holding a value.
+    static size_t bucket_index(
+            uint64_t value)
+    {
+        uint32_t shift = 0;
+        while ((value >> shift) >= 2 * sub_buckets)
+        {
+            ++shift;
+        }
+        return static_cast<size_t>(shift) * sub_buckets + static_cast<size_t>(value >> shift);
+    }
+
+    //! Highest value held by a bucket.
+    static uint64_t highest_value(
+            size_t index)
+    {
+        uint32_t shift = index < 2 * sub_buckets ? 0 : static_cast<uint32_t>(index / sub_buckets) - 1;
+        uint64_t lowest = static_cast<uint64_t>(index - static_cast<size_t>(shift) * sub_buckets) << shift;
+        return lowest + (1ull << shift) - 1;
+    }
+
+private:
+
+    static float value_at(
+            const uint64_t* counts,
+            uint64_t total,
+            double percentile,
+            uint64_t maximum)
+    {
+        // Rank of the value, rounding up so the percentile of a single value is the value itself
+        uint64_t rank = static_cast<uint64_t>(percentile * static_cast<double>(total));
+        if (static_cast<double>(rank) < percentile * static_cast<double>(total) || 0 == rank)
+        {
+            ++rank;
+        }
+
+        uint64_t accumulated = 0;
+        for (size_t i = 0; i < num_buckets; ++i)
+        {
+            accumulated += counts[i];
+            if (accumulated >= rank)
+            {
+                return static_cast<float>(std::min(highest_value(i), maximum));
+            }
+        }
+
+        return static_cast<float>(maximum);
+    }
+
+    std::atomic<uint64_t> buckets_[num_buckets];
+
+    std::atomic<uint64_t> maximum_{0};
+};
+
+} // namespace statistics
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _STATISTICS_RTPS_LATENCYHISTOGRAM_HPP_
@@ -0,0 +1,208 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LatencySummaries.cpp
+ */
+
+#include <statistics/rtps/LatencySummaries.hpp>
+
+#include <limits>
+#include <thread>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <statistics/rtps/StatisticsTypeUtils.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace statistics {
+
+using fastrtps::rtps::GUID_t;
+using fastrtps::rtps::Locator_t;
+
+constexpr size_t LatencySummaries::max_pairs;
+
+size_t LatencySummaries::PairHash::operator ()(
+        const GUIDPair& key) const
+{
+    size_t hash = hash_offset_basis;
+    hash = hash_bytes(hash, key.first.guidPrefix.value, sizeof(key.first.guidPrefix.value));
+    hash = hash_bytes(hash, key.first.entityId.value, sizeof(key.first.entityId.value));
+    hash = hash_bytes(hash, key.second.guidPrefix.value, sizeof(key.second.guidPrefix.value));
+    return hash_bytes(hash, key.second.entityId.value, sizeof(key.second.entityId.value));
+}
+
+size_t LatencySummaries::PairHash::operator ()(
+        const LocatorPair& key) const
+{
+    size_t hash = hash_locator(hash_offset_basis, key.first);
+    return hash_locator(hash, key.second);
+}
+
+LatencySummaries::PairTables::~PairTables()
+{
+    history_latencies.for_each([](const GUIDPair&, std::atomic<LatencyHistogram*>& histogram)
+            {
+                delete histogram.load();
+            });
+
+    network_latencies.for_each([](const LocatorPair&, std::atomic<LatencyHistogram*>& histogram)
+            {
+                delete histogram.load();
+            });
+}
+
+template<typename Key>
+void LatencySummaries::keep(
+        HistogramMap<Key>& table,
+        const Key& key,
+        std::atomic<LatencyHistogram*>& histogram)
+{
+    std::atomic<LatencyHistogram*>* kept = table.find_or_insert(key);
+    LatencyHistogram* expected = nullptr;
+    if (nullptr != kept && kept->compare_exchange_strong(expected, histogram.load(), std::memory_order_acq_rel))
+    {
+        histogram.store(nullptr);
+    }
+}
+
+void LatencySummaries::record(
+        std::atomic<LatencyHistogram*>* histogram,
+        float latency)
+{
+    if (nullptr == histogram)
+    {
+        // No room for more pairs
+        if (!max_pairs_reached_.exchange(true, std::memory_order_relaxed))
+        {
+            logWarning(RTPS_PARTICIPANT, "More than " << max_pairs << " pairs of entities or locators with latencies "
+                    "on a latency summary period. The latencies of further pairs are not summarized.");
+        }
+        return;
+    }
+
+    LatencyHistogram* current = histogram->load(std::memory_order_acquire);
+    if (nullptr == current)
+    {
+        LatencyHistogram* created = new LatencyHistogram();
+        if (histogram->compare_exchange_strong(current, created, std::memory_order_acq_rel))
+        {
+            current = created;
+        }
+        else
+        {
+            // Other thread created it first
+            delete created;
+        }
+    }
+
+    uint64_t ns = 0;
+    if (latency >= static_cast<float>(std::numeric_limits<uint64_t>::max()))
+    {
+        ns = std::numeric_limits<uint64_t>::max();
+    }
+    else if (latency > 0)
+    {
+        // Latencies between participants with unsynchronized clocks may be negative, and are counted as zero
+        ns = static_cast<uint64_t>(latency);
+    }
+
+    current->record(ns);
+}
+
+void LatencySummaries::on_statistics_data(
+        const Data& statistics_data)
+{
+    switch (statistics_data._d())
+    {
+        case EventKind::HISTORY2HISTORY_LATENCY:
+        {
+            const WriterReaderData& data = statistics_data.writer_reader_data();
+            GUIDPair key(from_statistics_type(data.writer_guid()), from_statistics_type(data.reader_guid()));
+            std::shared_ptr<PairTables> tables = std::atomic_load(&tables_);
+            record(tables->history_latencies.find_or_insert(key), data.data());
+            break;
+        }
+
+        case EventKind::NETWORK_LATENCY:
+        {
+            const Locator2LocatorData& data = statistics_data.locator2locator_data();
+            LocatorPair key(from_statistics_type(data.src_locator()), from_statistics_type(data.dst_locator()));
+            std::shared_ptr<PairTables> tables = std::atomic_load(&tables_);
+            record(tables->network_latencies.find_or_insert(key), data.data());
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+void LatencySummaries::take(
+        const std::function<void(const Data&)>& f)
+{
+    std::shared_ptr<PairTables> tables = std::make_shared<PairTables>();
+    std::shared_ptr<PairTables> previous = std::atomic_exchange(&tables_, tables);
+
+    // Wait for the events being recorded on the previous tables, so none is lost nor recorded after moving their
+    // histograms to the current ones
+    while (previous.use_count() > 1)
+    {
+        std::this_thread::yield();
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    // Pairs with some latency keep their histograms on the current tables. The rest are released with the previous
+    // tables.
+    previous->history_latencies.for_each([&f, &tables](const GUIDPair& key, std::atomic<LatencyHistogram*>& histogram)
+            {
+                WriterReaderLatencySummary notification;
+                LatencyHistogram* current = histogram.load(std::memory_order_acquire);
+                if (nullptr != current && current->take(notification.data()))
+                {
+                    notification.writer_guid(as_statistics_type(key.first));
+                    notification.reader_guid(as_statistics_type(key.second));
+
+                    Data data;
+                    // note that the setter sets HISTORY2HISTORY_LATENCY_SUMMARY by default
+                    data.writer_reader_latency_summary(notification);
+                    f(data);
+
+                    keep(tables->history_latencies, key, histogram);
+                }
+            });
+
+    previous->network_latencies.for_each([&f, &tables](const LocatorPair& key,
+            std::atomic<LatencyHistogram*>& histogram)
+            {
+                Locator2LocatorLatencySummary notification;
+                LatencyHistogram* current = histogram.load(std::memory_order_acquire);
+                if (nullptr != current && current->take(notification.data()))
+                {
+                    notification.src_locator(as_statistics_type(key.first));
+                    notification.dst_locator(as_statistics_type(key.second));
+
+                    Data data;
+                    // note that the setter sets NETWORK_LATENCY_SUMMARY by default
+                    data.locator2locator_latency_summary(notification);
+                    f(data);
+
+                    keep(tables->network_latencies, key, histogram);
+                }
+            });
+}
+
+} // namespace statistics
+} // namespace fastdds
+} // namespace eprosima
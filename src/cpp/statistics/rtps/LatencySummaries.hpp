@@ -0,0 +1,135 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LatencySummaries.hpp
+ */
+
+#ifndef _STATISTICS_RTPS_LATENCYSUMMARIES_HPP_
+#define _STATISTICS_RTPS_LATENCYSUMMARIES_HPP_
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/Locator.h>
+#include <fastdds/statistics/IListeners.hpp>
+
+#include <statistics/rtps/LatencyHistogram.hpp>
+#include <statistics/types/types.h>
+#include <utils/collections/ConcurrentFlatMap.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace statistics {
+
+/**
+ * Listener aggregating the HISTORY2HISTORY_LATENCY and NETWORK_LATENCY events on a histogram per writer-reader and
+ * per locator pair.
+ * The histograms are periodically turned into HISTORY2HISTORY_LATENCY_SUMMARY and NETWORK_LATENCY_SUMMARY events by
+ * calling take(), so the cost of publishing them does not depend on the rate of the aggregated events.
+ * Each call to take() rebuilds the tables of pairs, keeping only the pairs with some latency aggregated since the
+ * previous call, so the histograms of the pairs no longer communicating are released.
+ */
+class LatencySummaries : public IListener
+{
+public:
+
+    //! Maximum number of pairs of each kind on a period. Events of further pairs are not aggregated.
+    static constexpr size_t max_pairs = 256;
+
+    LatencySummaries() = default;
+
+    LatencySummaries(
+            const LatencySummaries&) = delete;
+
+    LatencySummaries& operator =(
+            const LatencySummaries&) = delete;
+
+    void on_statistics_data(
+            const Data& statistics_data) override;
+
+    /**
+     * Compute the summaries of the latencies aggregated since the previous call, and reset the histograms.
+     * @param f Functor called with the summary of each pair with some latency aggregated.
+     */
+    void take(
+            const std::function<void(const Data&)>& f);
+
+private:
+
+    using GUIDPair = std::pair<fastrtps::rtps::GUID_t, fastrtps::rtps::GUID_t>;
+    using LocatorPair = std::pair<fastrtps::rtps::Locator_t, fastrtps::rtps::Locator_t>;
+
+    struct PairHash
+    {
+        size_t operator ()(
+                const GUIDPair& key) const;
+
+        size_t operator ()(
+                const LocatorPair& key) const;
+    };
+
+    // Histograms are only allocated when the first event of their pair arrives
+    template<typename Key>
+    using HistogramMap = fastrtps::ConcurrentFlatMap<Key, std::atomic<LatencyHistogram*>, PairHash>;
+
+    //! Pairs aggregated on a period. Owns the histograms of its pairs.
+    struct PairTables
+    {
+        PairTables() = default;
+
+        ~PairTables();
+
+        PairTables(
+                const PairTables&) = delete;
+
+        PairTables& operator =(
+                const PairTables&) = delete;
+
+        HistogramMap<GUIDPair> history_latencies{max_pairs};
+
+        HistogramMap<LocatorPair> network_latencies{max_pairs};
+    };
+
+    void record(
+            std::atomic<LatencyHistogram*>* histogram,
+            float latency);
+
+    /**
+     * Move a histogram to the table of the current period, unless the table already has one for its pair or is full.
+     * @param table Table of the current period.
+     * @param key Pair of the histogram.
+     * @param histogram Histogram to move. Set to nullptr when moved.
+     */
+    template<typename Key>
+    static void keep(
+            HistogramMap<Key>& table,
+            const Key& key,
+            std::atomic<LatencyHistogram*>& histogram);
+
+    //! Tables of the current period, replaced on each call to take()
+    std::shared_ptr<PairTables> tables_ = std::make_shared<PairTables>();
+
+    //! Whether the warning about reaching max_pairs has already been logged
+    std::atomic<bool> max_pairs_reached_{false};
+};
+
+} // namespace statistics
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _STATISTICS_RTPS_LATENCYSUMMARIES_HPP_
@@ -19,10 +19,13 @@
 #include <statistics/rtps/StatisticsBase.hpp>
 
 #include <cmath>
+#include <thread>
 
 #include <rtps/participant/RTPSParticipantImpl.h>
+#include <statistics/rtps/StatisticsTypeUtils.hpp>
 
 #include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
 
 using namespace eprosima::fastdds::statistics;
 using eprosima::fastrtps::rtps::RTPSParticipantImpl;
@@ -31,6 +34,38 @@ namespace eprosima {
 namespace fastdds {
 namespace statistics {
 
+// Period of the latency summaries, when not set on the participant properties
+static constexpr uint32_t default_latency_summary_period_ms = 1000;
+
+static double get_latency_summary_period(
+        const fastrtps::rtps::RTPSParticipantAttributes& part_att)
+{
+    using fastrtps::rtps::PropertyPolicyHelper;
+
+    const char* property_name = "fastdds.statistics.latency_summary_period";
+    const std::string* value = PropertyPolicyHelper::find_property(part_att.properties, property_name);
+
+    if (nullptr != value)
+    {
+        try
+        {
+            unsigned long period_ms = std::stoul(*value);
+            if (0 < period_ms)
+            {
+                return static_cast<double>(period_ms);
+            }
+        }
+        catch (const std::exception&)
+        {
+        }
+
+        logWarning(RTPS_PARTICIPANT, "Invalid value '" << *value << "' for property " << property_name << ". "
+                "Using " << default_latency_summary_period_ms << " ms");
+    }
+
+    return static_cast<double>(default_latency_summary_period_ms);
+}
+
 static void add_bytes(
         Entity2LocatorTraffic& traffic,
         const rtps::StatisticsSubmessageData::Sequence& distance)
@@ -69,22 +104,35 @@ static void sub_bytes(
     }
 }
 
+size_t StatisticsParticipantImpl::LocatorHash::operator ()(
+        const fastrtps::rtps::Locator_t& locator) const
+{
+    return hash_locator(hash_offset_basis, locator);
+}
+
+size_t StatisticsParticipantImpl::LocatorHash::operator ()(
+        const std::pair<fastrtps::rtps::GuidPrefix_t, fastrtps::rtps::Locator_t>& key) const
+{
+    size_t hash = hash_bytes(hash_offset_basis, key.first.value, sizeof(key.first.value));
+    return hash_locator(hash, key.second);
+}
+
 detail::Locator_s to_statistics_type(
         fastrtps::rtps::Locator_t locator)
 {
-    return *reinterpret_cast<detail::Locator_s*>(&locator);
+    return as_statistics_type(locator);
 }
 
 detail::GUID_s to_statistics_type(
         fastrtps::rtps::GUID_t guid)
 {
-    return *reinterpret_cast<detail::GUID_s*>(&guid);
+    return as_statistics_type(guid);
 }
 
 detail::SampleIdentity_s to_statistics_type(
         fastrtps::rtps::SampleIdentity sample_id)
 {
-    return *reinterpret_cast<detail::SampleIdentity_s*>(&sample_id);
+    return as_statistics_type(sample_id);
 }
 
 } // statistics
@@ -141,6 +189,11 @@ std::recursive_mutex& StatisticsParticipantImpl::get_statistics_mutex()
     return statistics_mutex_;
 }
 
+void StatisticsParticipantImpl::update_listeners_snapshot()
+{
+    std::atomic_store(&listeners_snapshot_, std::make_shared<const ProxyCollection>(listeners_));
+}
+
 void StatisticsParticipantImpl::ListenerProxy::on_statistics_data(
         const Data& data)
 {
@@ -196,6 +249,74 @@ bool StatisticsParticipantImpl::are_readers_involved(
     return readers_maks & mask;
 }
 
+bool StatisticsParticipantImpl::are_latency_summaries_involved(
+        const uint32_t mask) const
+{
+    using namespace fastdds::statistics;
+
+    constexpr uint32_t summaries_mask = HISTORY2HISTORY_LATENCY_SUMMARY \
+            | NETWORK_LATENCY_SUMMARY;
+
+    return summaries_mask & mask;
+}
+
+void StatisticsParticipantImpl::update_latency_summaries()
+{
+    std::unique_lock<std::mutex> guard(latency_summaries_mutex_);
+
+    bool requested = false;
+    {
+        std::lock_guard<std::recursive_mutex> lock(get_statistics_mutex());
+        for (const Key& listener : listeners_)
+        {
+            requested = requested || are_latency_summaries_involved(listener->mask());
+        }
+    }
+
+    if (!requested)
+    {
+        guard.unlock();
+        stop_latency_summaries();
+    }
+    else if (!latency_summaries_)
+    {
+        // The histograms are fed with the events being summarized. The summaries listener does not request
+        // summaries itself, so this call does not get here again.
+        latency_summaries_ = std::make_shared<LatencySummaries>();
+        add_statistics_listener(latency_summaries_, HISTORY2HISTORY_LATENCY | NETWORK_LATENCY);
+
+        RTPSParticipantImpl* participant = static_cast<RTPSParticipantImpl*>(this);
+        std::shared_ptr<LatencySummaries> summaries = latency_summaries_;
+        latency_summaries_event_.reset(new fastrtps::rtps::TimedEvent(participant->getEventResource(),
+                [this, summaries]() -> bool
+                {
+                    summaries->take([this](const Data& data)
+                    {
+                        for_each_listener([&data](const Key& listener)
+                        {
+                            listener->on_statistics_data(data);
+                        });
+                    });
+                    return true;
+                },
+                get_latency_summary_period(participant->getRTPSParticipantAttributes())));
+        latency_summaries_event_->restart_timer();
+    }
+}
+
+void StatisticsParticipantImpl::stop_latency_summaries()
+{
+    std::lock_guard<std::mutex> guard(latency_summaries_mutex_);
+
+    if (latency_summaries_)
+    {
+        // Waits for an ongoing publication of the summaries
+        latency_summaries_event_.reset();
+        remove_statistics_listener(latency_summaries_, HISTORY2HISTORY_LATENCY | NETWORK_LATENCY);
+        latency_summaries_.reset();
+    }
+}
+
 bool StatisticsParticipantImpl::add_statistics_listener(
         std::shared_ptr<fastdds::statistics::IListener> listener,
         uint32_t kind)
@@ -235,6 +356,8 @@ bool StatisticsParticipantImpl::add_statistics_listener(
         proxy.mask(new_mask);
     }
 
+    update_listeners_snapshot();
+
     // no other mutex should be taken in order to prevent ABBA deadlocks
     lock.unlock();
 
@@ -254,6 +377,13 @@ bool StatisticsParticipantImpl::add_statistics_listener(
         readers_res = register_in_reader(proxy.get_shared_ptr());
     }
 
+    // Check if the latencies should start being aggregated
+    if (are_latency_summaries_involved(new_mask)
+            && !are_latency_summaries_involved(old_mask))
+    {
+        update_latency_summaries();
+    }
+
     return writers_res && readers_res;
 }
 
@@ -303,6 +433,7 @@ bool StatisticsParticipantImpl::remove_statistics_listener(
     {
         // remove
         listeners_.erase(it);
+        update_listeners_snapshot();
     }
 
     // no other mutex should be taken in order to prevent ABBA deadlocks
@@ -322,6 +453,12 @@ bool StatisticsParticipantImpl::remove_statistics_listener(
         readers_res = unregister_in_reader(proxy->get_shared_ptr());
     }
 
+    if (!are_latency_summaries_involved(new_mask)
+            && are_latency_summaries_involved(old_mask))
+    {
+        update_latency_summaries();
+    }
+
     return writers_res && readers_res
            && ((old_mask & mask) == mask); // return false if there were unregistered entities
 }
@@ -383,47 +520,63 @@ void StatisticsParticipantImpl::process_network_sequence(
     bool should_notify = false;
     Entity2LocatorTraffic notification;
 
-    {
-        std::lock_guard<std::recursive_mutex> lock(get_statistics_mutex());
-        lost_traffic_value& value = lost_traffic_[key];
-
-        if (value.first_sequence > seq.sequence)
-        {
-            // Datagrams before the first received one are ignored
-            return;
-        }
-
-        if (value.first_sequence == 0)
-        {
-            // This is the first time we receive a statistics sequence from source_participant on reception_locator
-            GUID_t guid(source_participant, ENTITYID_RTPSParticipant);
-            value.data.src_guid(to_statistics_type(guid));
-            value.data.dst_locator(to_statistics_type(reception_locator));
-            value.first_sequence = seq.sequence;
-        }
-        else if (seq.sequence != value.seq_data.sequence)
-        {
-            // Detect discontinuity. We will only notify in that case
-            should_notify = seq.sequence != (value.seq_data.sequence + 1);
-            if (should_notify)
+    auto update = [&](lost_traffic_value& value)
             {
-                if (seq.sequence > value.seq_data.sequence)
+                if (value.first_sequence > seq.sequence)
                 {
-                    // Received sequence is higher, data has been lost
-                    add_bytes(value.data, rtps::StatisticsSubmessageData::Sequence::distance(value.seq_data, seq));
+                    // Datagrams before the first received one are ignored
+                    return;
                 }
 
-                // We should never count the current received datagram
-                sub_bytes(value.data, datagram_size);
+                if (value.first_sequence == 0)
+                {
+                    // This is the first time we receive a statistics sequence from source_participant on
+                    // reception_locator
+                    GUID_t guid(source_participant, ENTITYID_RTPSParticipant);
+                    value.data.src_guid(to_statistics_type(guid));
+                    value.data.dst_locator(to_statistics_type(reception_locator));
+                    value.first_sequence = seq.sequence;
+                }
+                else if (seq.sequence != value.seq_data.sequence)
+                {
+                    // Detect discontinuity. We will only notify in that case
+                    should_notify = seq.sequence != (value.seq_data.sequence + 1);
+                    if (should_notify)
+                    {
+                        if (seq.sequence > value.seq_data.sequence)
+                        {
+                            // Received sequence is higher, data has been lost
+                            add_bytes(value.data,
+                                    rtps::StatisticsSubmessageData::Sequence::distance(value.seq_data, seq));
+                        }
+
+                        // We should never count the current received datagram
+                        sub_bytes(value.data, datagram_size);
+
+                        notification = value.data;
+                    }
+                }
 
-                notification = value.data;
-            }
-        }
+                if (seq.sequence > value.seq_data.sequence)
+                {
+                    value.seq_data = seq;
+                }
+            };
 
-        if (seq.sequence > value.seq_data.sequence)
+    lost_traffic_value* value = lost_traffic_.find_or_insert(key);
+    if (nullptr != value)
+    {
+        while (value->updating.test_and_set(std::memory_order_acquire))
         {
-            value.seq_data = seq;
+            std::this_thread::yield();
         }
+        update(*value);
+        value->updating.clear(std::memory_order_release);
+    }
+    else
+    {
+        std::lock_guard<std::recursive_mutex> lock(get_statistics_mutex());
+        update(lost_traffic_overflow_[key]);
     }
 
     if (should_notify)
@@ -448,20 +601,39 @@ void StatisticsParticipantImpl::on_rtps_sent(
     using namespace std;
     using eprosima::fastrtps::rtps::RTPSParticipantImpl;
 
-    // Compose callback and update the inner state
-    Entity2LocatorTraffic notification;
-    notification.src_guid(to_statistics_type(get_guid()));
-    notification.dst_locator(to_statistics_type(loc));
+    // Update the inner state
+    unsigned long long packet_count = 0;
+    unsigned long long byte_count = 0;
 
+    rtps_sent_data* val = traffic_.find_or_insert(loc);
+    if (nullptr != val)
+    {
+        // Each counter is monotonic on its own, see rtps_sent_data
+        packet_count = val->packet_count.fetch_add(1, std::memory_order_relaxed) + 1;
+        byte_count = val->byte_count.fetch_add(payload_size, std::memory_order_relaxed) + payload_size;
+    }
+    else
     {
         std::lock_guard<std::recursive_mutex> lock(get_statistics_mutex());
 
-        auto& val = traffic_[loc];
-        notification.packet_count(++val.packet_count);
-        notification.byte_count(val.byte_count += payload_size);
-        notification.byte_magnitude_order((int16_t)floor(log10(float(val.byte_count))));
+        auto& overflow_val = traffic_overflow_[loc];
+        packet_count = ++overflow_val.packet_count;
+        byte_count = overflow_val.byte_count += payload_size;
     }
 
+    if (!has_listeners())
+    {
+        return;
+    }
+
+    // Compose callback
+    Entity2LocatorTraffic notification;
+    notification.src_guid(to_statistics_type(get_guid()));
+    notification.dst_locator(to_statistics_type(loc));
+    notification.packet_count(packet_count);
+    notification.byte_count(byte_count);
+    notification.byte_magnitude_order((int16_t)floor(log10(float(byte_count))));
+
     // Perform the callbacks
     Data data;
     // note that the setter sets RTPS_SENT by default
@@ -507,11 +679,7 @@ void StatisticsParticipantImpl::on_pdp_packet(
     EntityCount notification;
     notification.guid(to_statistics_type(get_guid()));
 
-    {
-        std::lock_guard<std::recursive_mutex> lock(get_statistics_mutex());
-        pdp_counter_ += packages;
-        notification.count(pdp_counter_);
-    }
+    notification.count(pdp_counter_.fetch_add(packages, std::memory_order_relaxed) + packages);
 
     // Perform the callbacks
     Data data;
@@ -531,11 +699,7 @@ void StatisticsParticipantImpl::on_edp_packet(
     EntityCount notification;
     notification.guid(to_statistics_type(get_guid()));
 
-    {
-        std::lock_guard<std::recursive_mutex> lock(get_statistics_mutex());
-        edp_counter_ += packages;
-        notification.count(edp_counter_);
-    }
+    notification.count(edp_counter_.fetch_add(packages, std::memory_order_relaxed) + packages);
 
     // Perform the callbacks
     Data data;
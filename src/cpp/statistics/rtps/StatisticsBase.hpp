@@ -19,6 +19,9 @@
 #ifndef _STATISTICS_RTPS_STATISTICSBASE_HPP_
 #define _STATISTICS_RTPS_STATISTICSBASE_HPP_
 
+#include <atomic>
+#include <map>
+#include <memory>
 #include <mutex>
 #include <set>
 
@@ -27,12 +30,15 @@
 #include <fastdds/rtps/common/Guid.h>
 #include <fastdds/rtps/common/Locator.h>
 #include <fastdds/rtps/common/SampleIdentity.h>
+#include <fastdds/rtps/resources/TimedEvent.h>
 
 #include <fastdds/statistics/rtps/StatisticsCommon.hpp>
 
 #include <statistics/rtps/GuidUtils.hpp>
+#include <statistics/rtps/LatencySummaries.hpp>
 #include <statistics/rtps/messages/RTPSStatisticsMessages.hpp>
 #include <statistics/types/types.h>
+#include <utils/collections/ConcurrentFlatMap.hpp>
 
 
 namespace eprosima {
@@ -106,29 +112,60 @@ public:
 
 private:
 
+    // Hash of the locators used as keys of the traffic tables
+    struct LocatorHash
+    {
+        size_t operator ()(
+                const fastrtps::rtps::Locator_t& locator) const;
+
+        size_t operator ()(
+                const std::pair<fastrtps::rtps::GuidPrefix_t, fastrtps::rtps::Locator_t>& key) const;
+    };
+
+    // Maximum number of keys on each traffic table. Keys beyond it are kept on a map protected by the mutex
+    static constexpr size_t max_traffic_entries = 256;
+
     // RTPS_SENT ancillary
+    // Both counters are updated independently, so each of them is monotonic but a notification may report a
+    // packet count and a byte count which include different sets of concurrent sends
     struct rtps_sent_data
     {
-        unsigned long long packet_count = {};
-        unsigned long long byte_count = {};
+        std::atomic<unsigned long long> packet_count{0};
+        std::atomic<unsigned long long> byte_count{0};
     };
 
-    std::map<fastrtps::rtps::Locator_t, rtps_sent_data> traffic_;
+    fastrtps::ConcurrentFlatMap<fastrtps::rtps::Locator_t, rtps_sent_data, LocatorHash> traffic_{
+        max_traffic_entries};
+    std::map<fastrtps::rtps::Locator_t, rtps_sent_data> traffic_overflow_;
 
     // RTPS_LOST ancillary
     using lost_traffic_key = std::pair<fastrtps::rtps::GuidPrefix_t, fastrtps::rtps::Locator_t>;
     struct lost_traffic_value
     {
+        // Each key is updated from the thread receiving on its locator, so this flag is not contended
+        std::atomic_flag updating = ATOMIC_FLAG_INIT;
         uint64_t first_sequence = 0;
         Entity2LocatorTraffic data{};
         rtps::StatisticsSubmessageData::Sequence seq_data{};
     };
-    std::map<lost_traffic_key, lost_traffic_value> lost_traffic_;
+    fastrtps::ConcurrentFlatMap<lost_traffic_key, lost_traffic_value, LocatorHash> lost_traffic_{
+        max_traffic_entries};
+    std::map<lost_traffic_key, lost_traffic_value> lost_traffic_overflow_;
 
     // PDP_PACKETS ancillary
-    unsigned long long pdp_counter_ = {};
+    std::atomic<unsigned long long> pdp_counter_{0};
     // EDP_PACKETS ancillary
-    unsigned long long edp_counter_ = {};
+    std::atomic<unsigned long long> edp_counter_{0};
+
+    // HISTORY2HISTORY_LATENCY_SUMMARY and NETWORK_LATENCY_SUMMARY ancillary
+    std::mutex latency_summaries_mutex_;
+    std::shared_ptr<LatencySummaries> latency_summaries_;
+    std::unique_ptr<fastrtps::rtps::TimedEvent> latency_summaries_event_;
+
+    /*
+     * Start aggregating latencies when some listener requests the latency summaries, and stop it when none does.
+     */
+    void update_latency_summaries();
 
     /*
      * Retrieve the GUID_t from derived class
@@ -190,6 +227,9 @@ protected:
     using ProxyCollection = std::set<Key, CompareProxies>;
     ProxyCollection listeners_;
 
+    // copy of listeners_ traversed by the callbacks, replaced under the mutex on every change
+    std::shared_ptr<const ProxyCollection> listeners_snapshot_ = std::make_shared<const ProxyCollection>();
+
     // retrieve the participant mutex
     std::recursive_mutex& get_statistics_mutex();
 
@@ -233,11 +273,9 @@ protected:
     Function for_each_listener(
             Function f)
     {
-        std::unique_lock<std::recursive_mutex> lock(get_statistics_mutex());
-        auto temp_listeners = listeners_;
-        lock.unlock();
+        std::shared_ptr<const ProxyCollection> temp_listeners = std::atomic_load(&listeners_snapshot_);
 
-        for (auto& listener : temp_listeners)
+        for (auto& listener : *temp_listeners)
         {
             f(listener);
         }
@@ -245,6 +283,17 @@ protected:
         return f;
     }
 
+    /** Checks if there is any listener registered, so callbacks can be skipped
+     * @return true if some listener is registered
+     */
+    bool has_listeners() const
+    {
+        return !std::atomic_load(&listeners_snapshot_)->empty();
+    }
+
+    // Publish the current listeners_ to the callbacks. Should be called with the mutex taken.
+    void update_listeners_snapshot();
+
     /** Checks if callback events require writer specific callbacks
      * @param mask callback events to be queried
      * @return if a mask statistics::EventKind may require participant writers update
@@ -259,6 +308,18 @@ protected:
     bool are_readers_involved(
             const uint32_t mask) const;
 
+    /** Checks if callback events require the latency histograms
+     * @param mask callback events to be queried
+     * @return if a mask statistics::EventKind requires aggregating the latencies
+     */
+    bool are_latency_summaries_involved(
+            const uint32_t mask) const;
+
+    /*
+     * Stop aggregating latencies. Should be called before destroying the participant event resources.
+     */
+    void stop_latency_summaries();
+
     /*
      * Process a received statistics submessage.
      * @param [in] source_participant GUID prefix of the participant sending the message.
@@ -0,0 +1,109 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StatisticsTypeUtils.hpp
+ */
+
+#ifndef _STATISTICS_RTPS_STATISTICSTYPEUTILS_HPP_
+#define _STATISTICS_RTPS_STATISTICSTYPEUTILS_HPP_
+
+#include <cstddef>
+
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/Locator.h>
+#include <fastdds/rtps/common/SampleIdentity.h>
+
+#include <statistics/types/types.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace statistics {
+
+//! Initial value of the hashes computed with hash_bytes.
+constexpr size_t hash_offset_basis = static_cast<size_t>(14695981039346656037ull);
+
+/**
+ * Accumulates a sequence of bytes on a FNV-1a hash.
+ * @param [in] hash Hash computed so far, hash_offset_basis for the first sequence.
+ * @param [in] data Bytes to accumulate.
+ * @param [in] size Number of bytes to accumulate.
+ * @return The updated hash.
+ */
+inline size_t hash_bytes(
+        size_t hash,
+        const void* data,
+        size_t size)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= static_cast<size_t>(1099511628211ull);
+    }
+    return hash;
+}
+
+/**
+ * Accumulates the kind, port and address of a locator on a FNV-1a hash.
+ * @param [in] hash Hash computed so far, hash_offset_basis for the first locator.
+ * @param [in] locator Locator to accumulate.
+ * @return The updated hash.
+ */
+inline size_t hash_locator(
+        size_t hash,
+        const fastrtps::rtps::Locator_t& locator)
+{
+    hash = hash_bytes(hash, &locator.kind, sizeof(locator.kind));
+    hash = hash_bytes(hash, &locator.port, sizeof(locator.port));
+    return hash_bytes(hash, locator.address, sizeof(locator.address));
+}
+
+// The statistics types share the memory layout of the RTPS ones, so they are converted without copies
+
+inline const fastrtps::rtps::GUID_t& from_statistics_type(
+        const detail::GUID_s& guid)
+{
+    return *reinterpret_cast<const fastrtps::rtps::GUID_t*>(&guid);
+}
+
+inline const fastrtps::rtps::Locator_t& from_statistics_type(
+        const detail::Locator_s& locator)
+{
+    return *reinterpret_cast<const fastrtps::rtps::Locator_t*>(&locator);
+}
+
+inline const detail::GUID_s& as_statistics_type(
+        const fastrtps::rtps::GUID_t& guid)
+{
+    return *reinterpret_cast<const detail::GUID_s*>(&guid);
+}
+
+inline const detail::Locator_s& as_statistics_type(
+        const fastrtps::rtps::Locator_t& locator)
+{
+    return *reinterpret_cast<const detail::Locator_s*>(&locator);
+}
+
+inline const detail::SampleIdentity_s& as_statistics_type(
+        const fastrtps::rtps::SampleIdentity& sample_id)
+{
+    return *reinterpret_cast<const detail::SampleIdentity_s*>(&sample_id);
+}
+
+} // namespace statistics
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _STATISTICS_RTPS_STATISTICSTYPEUTILS_HPP_
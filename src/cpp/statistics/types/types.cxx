@@ -1128,6 +1128,313 @@ void eprosima::fastdds::statistics::detail::Locator_s::serializeKey(
 }
 
 
+eprosima::fastdds::statistics::detail::LatencyPercentiles_s::LatencyPercentiles_s()
+{
+    // m_count com.eprosima.idl.parser.typecode.PrimitiveTypeCode@1b2c6ec2
+    m_count = 0;
+    // m_p50 com.eprosima.idl.parser.typecode.PrimitiveTypeCode@4edde6e5
+    m_p50 = 0.0;
+    // m_p99 com.eprosima.idl.parser.typecode.PrimitiveTypeCode@70177ecd
+    m_p99 = 0.0;
+    // m_p999 com.eprosima.idl.parser.typecode.PrimitiveTypeCode@1e80bfe8
+    m_p999 = 0.0;
+    // m_maximum com.eprosima.idl.parser.typecode.PrimitiveTypeCode@66a29884
+    m_maximum = 0.0;
+
+}
+
+eprosima::fastdds::statistics::detail::LatencyPercentiles_s::~LatencyPercentiles_s()
+{
+
+
+}
+
+eprosima::fastdds::statistics::detail::LatencyPercentiles_s::LatencyPercentiles_s(
+        const LatencyPercentiles_s& x)
+{
+    m_count = x.m_count;
+    m_p50 = x.m_p50;
+    m_p99 = x.m_p99;
+    m_p999 = x.m_p999;
+    m_maximum = x.m_maximum;
+}
+
+eprosima::fastdds::statistics::detail::LatencyPercentiles_s::LatencyPercentiles_s(
+        LatencyPercentiles_s&& x)
+{
+    m_count = x.m_count;
+    m_p50 = x.m_p50;
+    m_p99 = x.m_p99;
+    m_p999 = x.m_p999;
+    m_maximum = x.m_maximum;
+}
+
+eprosima::fastdds::statistics::detail::LatencyPercentiles_s& eprosima::fastdds::statistics::detail::LatencyPercentiles_s::operator =(
+        const LatencyPercentiles_s& x)
+{
+
+    m_count = x.m_count;
+    m_p50 = x.m_p50;
+    m_p99 = x.m_p99;
+    m_p999 = x.m_p999;
+    m_maximum = x.m_maximum;
+
+    return *this;
+}
+
+eprosima::fastdds::statistics::detail::LatencyPercentiles_s& eprosima::fastdds::statistics::detail::LatencyPercentiles_s::operator =(
+        LatencyPercentiles_s&& x)
+{
+
+    m_count = x.m_count;
+    m_p50 = x.m_p50;
+    m_p99 = x.m_p99;
+    m_p999 = x.m_p999;
+    m_maximum = x.m_maximum;
+
+    return *this;
+}
+
+size_t eprosima::fastdds::statistics::detail::LatencyPercentiles_s::getMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t initial_alignment = current_alignment;
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+
+    return current_alignment - initial_alignment;
+}
+
+size_t eprosima::fastdds::statistics::detail::LatencyPercentiles_s::getCdrSerializedSize(
+        const eprosima::fastdds::statistics::detail::LatencyPercentiles_s& data,
+        size_t current_alignment)
+{
+    (void)data;
+    size_t initial_alignment = current_alignment;
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+
+    return current_alignment - initial_alignment;
+}
+
+void eprosima::fastdds::statistics::detail::LatencyPercentiles_s::serialize(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+
+    scdr << m_count;
+    scdr << m_p50;
+    scdr << m_p99;
+    scdr << m_p999;
+    scdr << m_maximum;
+
+}
+
+void eprosima::fastdds::statistics::detail::LatencyPercentiles_s::deserialize(
+        eprosima::fastcdr::Cdr& dcdr)
+{
+
+    dcdr >> m_count;
+    dcdr >> m_p50;
+    dcdr >> m_p99;
+    dcdr >> m_p999;
+    dcdr >> m_maximum;
+}
+
+/*!
+ * @brief This function sets a value in member count
+ * @param _count New value for member count
+ */
+void eprosima::fastdds::statistics::detail::LatencyPercentiles_s::count(
+        uint64_t _count)
+{
+    m_count = _count;
+}
+
+/*!
+ * @brief This function returns the value of member count
+ * @return Value of member count
+ */
+uint64_t eprosima::fastdds::statistics::detail::LatencyPercentiles_s::count() const
+{
+    return m_count;
+}
+
+/*!
+ * @brief This function returns a reference to member count
+ * @return Reference to member count
+ */
+uint64_t& eprosima::fastdds::statistics::detail::LatencyPercentiles_s::count()
+{
+    return m_count;
+}
+
+/*!
+ * @brief This function sets a value in member p50
+ * @param _p50 New value for member p50
+ */
+void eprosima::fastdds::statistics::detail::LatencyPercentiles_s::p50(
+        float _p50)
+{
+    m_p50 = _p50;
+}
+
+/*!
+ * @brief This function returns the value of member p50
+ * @return Value of member p50
+ */
+float eprosima::fastdds::statistics::detail::LatencyPercentiles_s::p50() const
+{
+    return m_p50;
+}
+
+/*!
+ * @brief This function returns a reference to member p50
+ * @return Reference to member p50
+ */
+float& eprosima::fastdds::statistics::detail::LatencyPercentiles_s::p50()
+{
+    return m_p50;
+}
+
+/*!
+ * @brief This function sets a value in member p99
+ * @param _p99 New value for member p99
+ */
+void eprosima::fastdds::statistics::detail::LatencyPercentiles_s::p99(
+        float _p99)
+{
+    m_p99 = _p99;
+}
+
+/*!
+ * @brief This function returns the value of member p99
+ * @return Value of member p99
+ */
+float eprosima::fastdds::statistics::detail::LatencyPercentiles_s::p99() const
+{
+    return m_p99;
+}
+
+/*!
+ * @brief This function returns a reference to member p99
+ * @return Reference to member p99
+ */
+float& eprosima::fastdds::statistics::detail::LatencyPercentiles_s::p99()
+{
+    return m_p99;
+}
+
+/*!
+ * @brief This function sets a value in member p999
+ * @param _p999 New value for member p999
+ */
+void eprosima::fastdds::statistics::detail::LatencyPercentiles_s::p999(
+        float _p999)
+{
+    m_p999 = _p999;
+}
+
+/*!
+ * @brief This function returns the value of member p999
+ * @return Value of member p999
+ */
+float eprosima::fastdds::statistics::detail::LatencyPercentiles_s::p999() const
+{
+    return m_p999;
+}
+
+/*!
+ * @brief This function returns a reference to member p999
+ * @return Reference to member p999
+ */
+float& eprosima::fastdds::statistics::detail::LatencyPercentiles_s::p999()
+{
+    return m_p999;
+}
+
+/*!
+ * @brief This function sets a value in member maximum
+ * @param _maximum New value for member maximum
+ */
+void eprosima::fastdds::statistics::detail::LatencyPercentiles_s::maximum(
+        float _maximum)
+{
+    m_maximum = _maximum;
+}
+
+/*!
+ * @brief This function returns the value of member maximum
+ * @return Value of member maximum
+ */
+float eprosima::fastdds::statistics::detail::LatencyPercentiles_s::maximum() const
+{
+    return m_maximum;
+}
+
+/*!
+ * @brief This function returns a reference to member maximum
+ * @return Reference to member maximum
+ */
+float& eprosima::fastdds::statistics::detail::LatencyPercentiles_s::maximum()
+{
+    return m_maximum;
+}
+
+
+size_t eprosima::fastdds::statistics::detail::LatencyPercentiles_s::getKeyMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t current_align = current_alignment;
+
+
+
+
+
+    return current_align;
+}
+
+bool eprosima::fastdds::statistics::detail::LatencyPercentiles_s::isKeyDefined()
+{
+    return false;
+}
+
+void eprosima::fastdds::statistics::detail::LatencyPercentiles_s::serializeKey(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+    (void) scdr;
+      
+}
+
 eprosima::fastdds::statistics::DiscoveryTime::DiscoveryTime()
 {
     // m_local_participant_guid com.eprosima.fastdds.idl.parser.typecode.StructTypeCode@b7f23d9
@@ -3022,71 +3329,575 @@ void eprosima::fastdds::statistics::PhysicalData::serializeKey(
 }
 
 
-eprosima::fastdds::statistics::Data::Data()
+eprosima::fastdds::statistics::WriterReaderLatencySummary::WriterReaderLatencySummary()
 {
-    m__d = HISTORY2HISTORY_LATENCY;
-    // m_writer_reader_data com.eprosima.fastdds.idl.parser.typecode.StructTypeCode@22555ebf
+    // m_writer_guid com.eprosima.fastdds.idl.parser.typecode.StructTypeCode@b7f23d9
 
-    // m_locator2locator_data com.eprosima.fastdds.idl.parser.typecode.StructTypeCode@36ebc363
+    // m_reader_guid com.eprosima.fastdds.idl.parser.typecode.StructTypeCode@b7f23d9
 
-    // m_entity_data com.eprosima.fastdds.idl.parser.typecode.StructTypeCode@45752059
+    // m_data com.eprosima.fastdds.idl.parser.typecode.StructTypeCode@3d8314f0
 
-    // m_entity2locator_traffic com.eprosima.fastdds.idl.parser.typecode.StructTypeCode@34e9fd99
 
-    // m_entity_count com.eprosima.fastdds.idl.parser.typecode.StructTypeCode@3c41ed1d
+}
 
-    // m_discovery_time com.eprosima.fastdds.idl.parser.typecode.StructTypeCode@54d9d12d
+eprosima::fastdds::statistics::WriterReaderLatencySummary::~WriterReaderLatencySummary()
+{
 
-    // m_sample_identity_count com.eprosima.fastdds.idl.parser.typecode.StructTypeCode@38425407
 
-    // m_physical_data com.eprosima.fastdds.idl.parser.typecode.StructTypeCode@43bc63a3
 
 }
 
-eprosima::fastdds::statistics::Data::~Data()
+eprosima::fastdds::statistics::WriterReaderLatencySummary::WriterReaderLatencySummary(
+        const WriterReaderLatencySummary& x)
 {
+    m_writer_guid = x.m_writer_guid;
+    m_reader_guid = x.m_reader_guid;
+    m_data = x.m_data;
 }
 
-eprosima::fastdds::statistics::Data::Data(
-        const Data& x)
+eprosima::fastdds::statistics::WriterReaderLatencySummary::WriterReaderLatencySummary(
+        WriterReaderLatencySummary&& x)
 {
-    m__d = x.m__d;
+    m_writer_guid = std::move(x.m_writer_guid);
+    m_reader_guid = std::move(x.m_reader_guid);
+    m_data = std::move(x.m_data);
+}
 
-    switch(m__d)
-    {
-        case HISTORY2HISTORY_LATENCY:
-        m_writer_reader_data = x.m_writer_reader_data;
-        break;
-        case NETWORK_LATENCY:
-        m_locator2locator_data = x.m_locator2locator_data;
-        break;
-        case PUBLICATION_THROUGHPUT:
-        case SUBSCRIPTION_THROUGHPUT:
-        m_entity_data = x.m_entity_data;
-        break;
-        case RTPS_SENT:
-        case RTPS_LOST:
-        m_entity2locator_traffic = x.m_entity2locator_traffic;
-        break;
-        case RESENT_DATAS:
-        case HEARTBEAT_COUNT:
-        case ACKNACK_COUNT:
-        case NACKFRAG_COUNT:
-        case GAP_COUNT:
-        case DATA_COUNT:
-        case PDP_PACKETS:
-        case EDP_PACKETS:
-        m_entity_count = x.m_entity_count;
-        break;
-        case DISCOVERED_ENTITY:
-        m_discovery_time = x.m_discovery_time;
-        break;
-        case SAMPLE_DATAS:
-        m_sample_identity_count = x.m_sample_identity_count;
+eprosima::fastdds::statistics::WriterReaderLatencySummary& eprosima::fastdds::statistics::WriterReaderLatencySummary::operator =(
+        const WriterReaderLatencySummary& x)
+{
+
+    m_writer_guid = x.m_writer_guid;
+    m_reader_guid = x.m_reader_guid;
+    m_data = x.m_data;
+
+    return *this;
+}
+
+eprosima::fastdds::statistics::WriterReaderLatencySummary& eprosima::fastdds::statistics::WriterReaderLatencySummary::operator =(
+        WriterReaderLatencySummary&& x)
+{
+
+    m_writer_guid = std::move(x.m_writer_guid);
+    m_reader_guid = std::move(x.m_reader_guid);
+    m_data = std::move(x.m_data);
+
+    return *this;
+}
+
+size_t eprosima::fastdds::statistics::WriterReaderLatencySummary::getMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t initial_alignment = current_alignment;
+
+
+    current_alignment += eprosima::fastdds::statistics::detail::GUID_s::getMaxCdrSerializedSize(current_alignment);
+    current_alignment += eprosima::fastdds::statistics::detail::GUID_s::getMaxCdrSerializedSize(current_alignment);
+    current_alignment += eprosima::fastdds::statistics::detail::LatencyPercentiles_s::getMaxCdrSerializedSize(current_alignment);
+
+
+
+    return current_alignment - initial_alignment;
+}
+
+size_t eprosima::fastdds::statistics::WriterReaderLatencySummary::getCdrSerializedSize(
+        const eprosima::fastdds::statistics::WriterReaderLatencySummary& data,
+        size_t current_alignment)
+{
+    (void)data;
+    size_t initial_alignment = current_alignment;
+
+
+    current_alignment += eprosima::fastdds::statistics::detail::GUID_s::getCdrSerializedSize(data.writer_guid(), current_alignment);
+    current_alignment += eprosima::fastdds::statistics::detail::GUID_s::getCdrSerializedSize(data.reader_guid(), current_alignment);
+    current_alignment += eprosima::fastdds::statistics::detail::LatencyPercentiles_s::getCdrSerializedSize(data.data(), current_alignment);
+
+
+
+    return current_alignment - initial_alignment;
+}
+
+void eprosima::fastdds::statistics::WriterReaderLatencySummary::serialize(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+
+    scdr << m_writer_guid;
+    scdr << m_reader_guid;
+    scdr << m_data;
+
+}
+
+void eprosima::fastdds::statistics::WriterReaderLatencySummary::deserialize(
+        eprosima::fastcdr::Cdr& dcdr)
+{
+
+    dcdr >> m_writer_guid;
+    dcdr >> m_reader_guid;
+    dcdr >> m_data;
+}
+
+/*!
+ * @brief This function copies the value in member writer_guid
+ * @param _writer_guid New value to be copied in member writer_guid
+ */
+void eprosima::fastdds::statistics::WriterReaderLatencySummary::writer_guid(
+        const eprosima::fastdds::statistics::detail::GUID_s& _writer_guid)
+{
+    m_writer_guid = _writer_guid;
+}
+
+/*!
+ * @brief This function moves the value in member writer_guid
+ * @param _writer_guid New value to be moved in member writer_guid
+ */
+void eprosima::fastdds::statistics::WriterReaderLatencySummary::writer_guid(
+        eprosima::fastdds::statistics::detail::GUID_s&& _writer_guid)
+{
+    m_writer_guid = std::move(_writer_guid);
+}
+
+/*!
+ * @brief This function returns a constant reference to member writer_guid
+ * @return Constant reference to member writer_guid
+ */
+const eprosima::fastdds::statistics::detail::GUID_s& eprosima::fastdds::statistics::WriterReaderLatencySummary::writer_guid() const
+{
+    return m_writer_guid;
+}
+
+/*!
+ * @brief This function returns a reference to member writer_guid
+ * @return Reference to member writer_guid
+ */
+eprosima::fastdds::statistics::detail::GUID_s& eprosima::fastdds::statistics::WriterReaderLatencySummary::writer_guid()
+{
+    return m_writer_guid;
+}
+/*!
+ * @brief This function copies the value in member reader_guid
+ * @param _reader_guid New value to be copied in member reader_guid
+ */
+void eprosima::fastdds::statistics::WriterReaderLatencySummary::reader_guid(
+        const eprosima::fastdds::statistics::detail::GUID_s& _reader_guid)
+{
+    m_reader_guid = _reader_guid;
+}
+
+/*!
+ * @brief This function moves the value in member reader_guid
+ * @param _reader_guid New value to be moved in member reader_guid
+ */
+void eprosima::fastdds::statistics::WriterReaderLatencySummary::reader_guid(
+        eprosima::fastdds::statistics::detail::GUID_s&& _reader_guid)
+{
+    m_reader_guid = std::move(_reader_guid);
+}
+
+/*!
+ * @brief This function returns a constant reference to member reader_guid
+ * @return Constant reference to member reader_guid
+ */
+const eprosima::fastdds::statistics::detail::GUID_s& eprosima::fastdds::statistics::WriterReaderLatencySummary::reader_guid() const
+{
+    return m_reader_guid;
+}
+
+/*!
+ * @brief This function returns a reference to member reader_guid
+ * @return Reference to member reader_guid
+ */
+eprosima::fastdds::statistics::detail::GUID_s& eprosima::fastdds::statistics::WriterReaderLatencySummary::reader_guid()
+{
+    return m_reader_guid;
+}
+/*!
+ * @brief This function copies the value in member data
+ * @param _data New value to be copied in member data
+ */
+void eprosima::fastdds::statistics::WriterReaderLatencySummary::data(
+        const eprosima::fastdds::statistics::detail::LatencyPercentiles_s& _data)
+{
+    m_data = _data;
+}
+
+/*!
+ * @brief This function moves the value in member data
+ * @param _data New value to be moved in member data
+ */
+void eprosima::fastdds::statistics::WriterReaderLatencySummary::data(
+        eprosima::fastdds::statistics::detail::LatencyPercentiles_s&& _data)
+{
+    m_data = std::move(_data);
+}
+
+/*!
+ * @brief This function returns a constant reference to member data
+ * @return Constant reference to member data
+ */
+const eprosima::fastdds::statistics::detail::LatencyPercentiles_s& eprosima::fastdds::statistics::WriterReaderLatencySummary::data() const
+{
+    return m_data;
+}
+
+/*!
+ * @brief This function returns a reference to member data
+ * @return Reference to member data
+ */
+eprosima::fastdds::statistics::detail::LatencyPercentiles_s& eprosima::fastdds::statistics::WriterReaderLatencySummary::data()
+{
+    return m_data;
+}
+
+
+size_t eprosima::fastdds::statistics::WriterReaderLatencySummary::getKeyMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t current_align = current_alignment;
+
+
+     current_align += eprosima::fastdds::statistics::detail::GUID_s::getMaxCdrSerializedSize(current_align); 
+     current_align += eprosima::fastdds::statistics::detail::GUID_s::getMaxCdrSerializedSize(current_align); 
+
+
+    return current_align;
+}
+
+bool eprosima::fastdds::statistics::WriterReaderLatencySummary::isKeyDefined()
+{
+    return true;
+}
+
+void eprosima::fastdds::statistics::WriterReaderLatencySummary::serializeKey(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+    (void) scdr;
+     scdr << m_writer_guid;
+       scdr << m_reader_guid;
+       
+}
+
+eprosima::fastdds::statistics::Locator2LocatorLatencySummary::Locator2LocatorLatencySummary()
+{
+    // m_src_locator com.eprosima.fastdds.idl.parser.typecode.StructTypeCode@2a65fe7c
+
+    // m_dst_locator com.eprosima.fastdds.idl.parser.typecode.StructTypeCode@2a65fe7c
+
+    // m_data com.eprosima.fastdds.idl.parser.typecode.StructTypeCode@2df32bf7
+
+
+}
+
+eprosima::fastdds::statistics::Locator2LocatorLatencySummary::~Locator2LocatorLatencySummary()
+{
+
+
+
+}
+
+eprosima::fastdds::statistics::Locator2LocatorLatencySummary::Locator2LocatorLatencySummary(
+        const Locator2LocatorLatencySummary& x)
+{
+    m_src_locator = x.m_src_locator;
+    m_dst_locator = x.m_dst_locator;
+    m_data = x.m_data;
+}
+
+eprosima::fastdds::statistics::Locator2LocatorLatencySummary::Locator2LocatorLatencySummary(
+        Locator2LocatorLatencySummary&& x)
+{
+    m_src_locator = std::move(x.m_src_locator);
+    m_dst_locator = std::move(x.m_dst_locator);
+    m_data = std::move(x.m_data);
+}
+
+eprosima::fastdds::statistics::Locator2LocatorLatencySummary& eprosima::fastdds::statistics::Locator2LocatorLatencySummary::operator =(
+        const Locator2LocatorLatencySummary& x)
+{
+
+    m_src_locator = x.m_src_locator;
+    m_dst_locator = x.m_dst_locator;
+    m_data = x.m_data;
+
+    return *this;
+}
+
+eprosima::fastdds::statistics::Locator2LocatorLatencySummary& eprosima::fastdds::statistics::Locator2LocatorLatencySummary::operator =(
+        Locator2LocatorLatencySummary&& x)
+{
+
+    m_src_locator = std::move(x.m_src_locator);
+    m_dst_locator = std::move(x.m_dst_locator);
+    m_data = std::move(x.m_data);
+
+    return *this;
+}
+
+size_t eprosima::fastdds::statistics::Locator2LocatorLatencySummary::getMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t initial_alignment = current_alignment;
+
+
+    current_alignment += eprosima::fastdds::statistics::detail::Locator_s::getMaxCdrSerializedSize(current_alignment);
+    current_alignment += eprosima::fastdds::statistics::detail::Locator_s::getMaxCdrSerializedSize(current_alignment);
+    current_alignment += eprosima::fastdds::statistics::detail::LatencyPercentiles_s::getMaxCdrSerializedSize(current_alignment);
+
+
+
+    return current_alignment - initial_alignment;
+}
+
+size_t eprosima::fastdds::statistics::Locator2LocatorLatencySummary::getCdrSerializedSize(
+        const eprosima::fastdds::statistics::Locator2LocatorLatencySummary& data,
+        size_t current_alignment)
+{
+    (void)data;
+    size_t initial_alignment = current_alignment;
+
+
+    current_alignment += eprosima::fastdds::statistics::detail::Locator_s::getCdrSerializedSize(data.src_locator(), current_alignment);
+    current_alignment += eprosima::fastdds::statistics::detail::Locator_s::getCdrSerializedSize(data.dst_locator(), current_alignment);
+    current_alignment += eprosima::fastdds::statistics::detail::LatencyPercentiles_s::getCdrSerializedSize(data.data(), current_alignment);
+
+
+
+    return current_alignment - initial_alignment;
+}
+
+void eprosima::fastdds::statistics::Locator2LocatorLatencySummary::serialize(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+
+    scdr << m_src_locator;
+    scdr << m_dst_locator;
+    scdr << m_data;
+
+}
+
+void eprosima::fastdds::statistics::Locator2LocatorLatencySummary::deserialize(
+        eprosima::fastcdr::Cdr& dcdr)
+{
+
+    dcdr >> m_src_locator;
+    dcdr >> m_dst_locator;
+    dcdr >> m_data;
+}
+
+/*!
+ * @brief This function copies the value in member src_locator
+ * @param _src_locator New value to be copied in member src_locator
+ */
+void eprosima::fastdds::statistics::Locator2LocatorLatencySummary::src_locator(
+        const eprosima::fastdds::statistics::detail::Locator_s& _src_locator)
+{
+    m_src_locator = _src_locator;
+}
+
+/*!
+ * @brief This function moves the value in member src_locator
+ * @param _src_locator New value to be moved in member src_locator
+ */
+void eprosima::fastdds::statistics::Locator2LocatorLatencySummary::src_locator(
+        eprosima::fastdds::statistics::detail::Locator_s&& _src_locator)
+{
+    m_src_locator = std::move(_src_locator);
+}
+
+/*!
+ * @brief This function returns a constant reference to member src_locator
+ * @return Constant reference to member src_locator
+ */
+const eprosima::fastdds::statistics::detail::Locator_s& eprosima::fastdds::statistics::Locator2LocatorLatencySummary::src_locator() const
+{
+    return m_src_locator;
+}
+
+/*!
+ * @brief This function returns a reference to member src_locator
+ * @return Reference to member src_locator
+ */
+eprosima::fastdds::statistics::detail::Locator_s& eprosima::fastdds::statistics::Locator2LocatorLatencySummary::src_locator()
+{
+    return m_src_locator;
+}
+/*!
+ * @brief This function copies the value in member dst_locator
+ * @param _dst_locator New value to be copied in member dst_locator
+ */
+void eprosima::fastdds::statistics::Locator2LocatorLatencySummary::dst_locator(
+        const eprosima::fastdds::statistics::detail::Locator_s& _dst_locator)
+{
+    m_dst_locator = _dst_locator;
+}
+
+/*!
+ * @brief This function moves the value in member dst_locator
+ * @param _dst_locator New value to be moved in member dst_locator
+ */
+void eprosima::fastdds::statistics::Locator2LocatorLatencySummary::dst_locator(
+        eprosima::fastdds::statistics::detail::Locator_s&& _dst_locator)
+{
+    m_dst_locator = std::move(_dst_locator);
+}
+
+/*!
+ * @brief This function returns a constant reference to member dst_locator
+ * @return Constant reference to member dst_locator
+ */
+const eprosima::fastdds::statistics::detail::Locator_s& eprosima::fastdds::statistics::Locator2LocatorLatencySummary::dst_locator() const
+{
+    return m_dst_locator;
+}
+
+/*!
+ * @brief This function returns a reference to member dst_locator
+ * @return Reference to member dst_locator
+ */
+eprosima::fastdds::statistics::detail::Locator_s& eprosima::fastdds::statistics::Locator2LocatorLatencySummary::dst_locator()
+{
+    return m_dst_locator;
+}
+/*!
+ * @brief This function copies the value in member data
+ * @param _data New value to be copied in member data
+ */
+void eprosima::fastdds::statistics::Locator2LocatorLatencySummary::data(
+        const eprosima::fastdds::statistics::detail::LatencyPercentiles_s& _data)
+{
+    m_data = _data;
+}
+
+/*!
+ * @brief This function moves the value in member data
+ * @param _data New value to be moved in member data
+ */
+void eprosima::fastdds::statistics::Locator2LocatorLatencySummary::data(
+        eprosima::fastdds::statistics::detail::LatencyPercentiles_s&& _data)
+{
+    m_data = std::move(_data);
+}
+
+/*!
+ * @brief This function returns a constant reference to member data
+ * @return Constant reference to member data
+ */
+const eprosima::fastdds::statistics::detail::LatencyPercentiles_s& eprosima::fastdds::statistics::Locator2LocatorLatencySummary::data() const
+{
+    return m_data;
+}
+
+/*!
+ * @brief This function returns a reference to member data
+ * @return Reference to member data
+ */
+eprosima::fastdds::statistics::detail::LatencyPercentiles_s& eprosima::fastdds::statistics::Locator2LocatorLatencySummary::data()
+{
+    return m_data;
+}
+
+
+size_t eprosima::fastdds::statistics::Locator2LocatorLatencySummary::getKeyMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t current_align = current_alignment;
+
+
+     current_align += eprosima::fastdds::statistics::detail::Locator_s::getMaxCdrSerializedSize(current_align); 
+     current_align += eprosima::fastdds::statistics::detail::Locator_s::getMaxCdrSerializedSize(current_align); 
+
+
+    return current_align;
+}
+
+bool eprosima::fastdds::statistics::Locator2LocatorLatencySummary::isKeyDefined()
+{
+    return true;
+}
+
+void eprosima::fastdds::statistics::Locator2LocatorLatencySummary::serializeKey(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+    (void) scdr;
+     scdr << m_src_locator;
+       scdr << m_dst_locator;
+       
+}
+
+eprosima::fastdds::statistics::Data::Data()
+{
+    m__d = HISTORY2HISTORY_LATENCY;
+    // m_writer_reader_data com.eprosima.fastdds.idl.parser.typecode.StructTypeCode@22555ebf
+
+    // m_locator2locator_data com.eprosima.fastdds.idl.parser.typecode.StructTypeCode@36ebc363
+
+    // m_entity_data com.eprosima.fastdds.idl.parser.typecode.StructTypeCode@45752059
+
+    // m_entity2locator_traffic com.eprosima.fastdds.idl.parser.typecode.StructTypeCode@34e9fd99
+
+    // m_entity_count com.eprosima.fastdds.idl.parser.typecode.StructTypeCode@3c41ed1d
+
+    // m_discovery_time com.eprosima.fastdds.idl.parser.typecode.StructTypeCode@54d9d12d
+
+    // m_sample_identity_count com.eprosima.fastdds.idl.parser.typecode.StructTypeCode@38425407
+
+    // m_physical_data com.eprosima.fastdds.idl.parser.typecode.StructTypeCode@43bc63a3
+
+    // m_writer_reader_latency_summary com.eprosima.fastdds.idl.parser.typecode.StructTypeCode@530612ba
+
+    // m_locator2locator_latency_summary com.eprosima.fastdds.idl.parser.typecode.StructTypeCode@2a40cd94
+
+}
+
+eprosima::fastdds::statistics::Data::~Data()
+{
+}
+
+eprosima::fastdds::statistics::Data::Data(
+        const Data& x)
+{
+    m__d = x.m__d;
+
+    switch(m__d)
+    {
+        case HISTORY2HISTORY_LATENCY:
+        m_writer_reader_data = x.m_writer_reader_data;
+        break;
+        case NETWORK_LATENCY:
+        m_locator2locator_data = x.m_locator2locator_data;
+        break;
+        case PUBLICATION_THROUGHPUT:
+        case SUBSCRIPTION_THROUGHPUT:
+        m_entity_data = x.m_entity_data;
+        break;
+        case RTPS_SENT:
+        case RTPS_LOST:
+        m_entity2locator_traffic = x.m_entity2locator_traffic;
+        break;
+        case RESENT_DATAS:
+        case HEARTBEAT_COUNT:
+        case ACKNACK_COUNT:
+        case NACKFRAG_COUNT:
+        case GAP_COUNT:
+        case DATA_COUNT:
+        case PDP_PACKETS:
+        case EDP_PACKETS:
+        m_entity_count = x.m_entity_count;
+        break;
+        case DISCOVERED_ENTITY:
+        m_discovery_time = x.m_discovery_time;
+        break;
+        case SAMPLE_DATAS:
+        m_sample_identity_count = x.m_sample_identity_count;
         break;
         case PHYSICAL_DATA:
         m_physical_data = x.m_physical_data;
         break;
+        case HISTORY2HISTORY_LATENCY_SUMMARY:
+        m_writer_reader_latency_summary = x.m_writer_reader_latency_summary;
+        break;
+        case NETWORK_LATENCY_SUMMARY:
+        m_locator2locator_latency_summary = x.m_locator2locator_latency_summary;
+        break;
         default:
         break;
     }
@@ -3132,6 +3943,12 @@ eprosima::fastdds::statistics::Data::Data(
         case PHYSICAL_DATA:
         m_physical_data = std::move(x.m_physical_data);
         break;
+        case HISTORY2HISTORY_LATENCY_SUMMARY:
+        m_writer_reader_latency_summary = std::move(x.m_writer_reader_latency_summary);
+        break;
+        case NETWORK_LATENCY_SUMMARY:
+        m_locator2locator_latency_summary = std::move(x.m_locator2locator_latency_summary);
+        break;
         default:
         break;
     }
@@ -3177,6 +3994,12 @@ eprosima::fastdds::statistics::Data& eprosima::fastdds::statistics::Data::operat
         case PHYSICAL_DATA:
         m_physical_data = x.m_physical_data;
         break;
+        case HISTORY2HISTORY_LATENCY_SUMMARY:
+        m_writer_reader_latency_summary = x.m_writer_reader_latency_summary;
+        break;
+        case NETWORK_LATENCY_SUMMARY:
+        m_locator2locator_latency_summary = x.m_locator2locator_latency_summary;
+        break;
         default:
         break;
     }
@@ -3224,6 +4047,12 @@ eprosima::fastdds::statistics::Data& eprosima::fastdds::statistics::Data::operat
         case PHYSICAL_DATA:
         m_physical_data = std::move(x.m_physical_data);
         break;
+        case HISTORY2HISTORY_LATENCY_SUMMARY:
+        m_writer_reader_latency_summary = std::move(x.m_writer_reader_latency_summary);
+        break;
+        case NETWORK_LATENCY_SUMMARY:
+        m_locator2locator_latency_summary = std::move(x.m_locator2locator_latency_summary);
+        break;
         default:
         break;
     }
@@ -3336,6 +4165,26 @@ void eprosima::fastdds::statistics::Data::_d(
             break;
         }
         break;
+        case HISTORY2HISTORY_LATENCY_SUMMARY:
+        switch(__d)
+        {
+            case HISTORY2HISTORY_LATENCY_SUMMARY:
+            b = true;
+            break;
+            default:
+            break;
+        }
+        break;
+        case NETWORK_LATENCY_SUMMARY:
+        switch(__d)
+        {
+            case NETWORK_LATENCY_SUMMARY:
+            b = true;
+            break;
+            default:
+            break;
+        }
+        break;
     }
 
     if(!b)
@@ -3798,6 +4647,112 @@ eprosima::fastdds::statistics::PhysicalData& eprosima::fastdds::statistics::Data
 
     return m_physical_data;
 }
+void eprosima::fastdds::statistics::Data::writer_reader_latency_summary(
+        const eprosima::fastdds::statistics::WriterReaderLatencySummary& _writer_reader_latency_summary)
+{
+    m_writer_reader_latency_summary = _writer_reader_latency_summary;
+    m__d = HISTORY2HISTORY_LATENCY_SUMMARY;
+}
+
+void eprosima::fastdds::statistics::Data::writer_reader_latency_summary(
+        eprosima::fastdds::statistics::WriterReaderLatencySummary&& _writer_reader_latency_summary)
+{
+    m_writer_reader_latency_summary = std::move(_writer_reader_latency_summary);
+    m__d = HISTORY2HISTORY_LATENCY_SUMMARY;
+}
+
+const eprosima::fastdds::statistics::WriterReaderLatencySummary& eprosima::fastdds::statistics::Data::writer_reader_latency_summary() const
+{
+    bool b = false;
+
+    switch(m__d)
+    {
+        case HISTORY2HISTORY_LATENCY_SUMMARY:
+        b = true;
+        break;
+        default:
+        break;
+    }
+    if(!b)
+    {
+        throw BadParamException("This member is not been selected");
+    }
+
+    return m_writer_reader_latency_summary;
+}
+
+eprosima::fastdds::statistics::WriterReaderLatencySummary& eprosima::fastdds::statistics::Data::writer_reader_latency_summary()
+{
+    bool b = false;
+
+    switch(m__d)
+    {
+        case HISTORY2HISTORY_LATENCY_SUMMARY:
+        b = true;
+        break;
+        default:
+        break;
+    }
+    if(!b)
+    {
+        throw BadParamException("This member is not been selected");
+    }
+
+    return m_writer_reader_latency_summary;
+}
+void eprosima::fastdds::statistics::Data::locator2locator_latency_summary(
+        const eprosima::fastdds::statistics::Locator2LocatorLatencySummary& _locator2locator_latency_summary)
+{
+    m_locator2locator_latency_summary = _locator2locator_latency_summary;
+    m__d = NETWORK_LATENCY_SUMMARY;
+}
+
+void eprosima::fastdds::statistics::Data::locator2locator_latency_summary(
+        eprosima::fastdds::statistics::Locator2LocatorLatencySummary&& _locator2locator_latency_summary)
+{
+    m_locator2locator_latency_summary = std::move(_locator2locator_latency_summary);
+    m__d = NETWORK_LATENCY_SUMMARY;
+}
+
+const eprosima::fastdds::statistics::Locator2LocatorLatencySummary& eprosima::fastdds::statistics::Data::locator2locator_latency_summary() const
+{
+    bool b = false;
+
+    switch(m__d)
+    {
+        case NETWORK_LATENCY_SUMMARY:
+        b = true;
+        break;
+        default:
+        break;
+    }
+    if(!b)
+    {
+        throw BadParamException("This member is not been selected");
+    }
+
+    return m_locator2locator_latency_summary;
+}
+
+eprosima::fastdds::statistics::Locator2LocatorLatencySummary& eprosima::fastdds::statistics::Data::locator2locator_latency_summary()
+{
+    bool b = false;
+
+    switch(m__d)
+    {
+        case NETWORK_LATENCY_SUMMARY:
+        b = true;
+        break;
+        default:
+        break;
+    }
+    if(!b)
+    {
+        throw BadParamException("This member is not been selected");
+    }
+
+    return m_locator2locator_latency_summary;
+}
 
 size_t eprosima::fastdds::statistics::Data::getMaxCdrSerializedSize(
         size_t current_alignment)
@@ -3873,6 +4828,22 @@ size_t eprosima::fastdds::statistics::Data::getMaxCdrSerializedSize(
             union_max_size_serialized = reset_alignment;
 
         
+        reset_alignment = current_alignment;
+
+        reset_alignment += eprosima::fastdds::statistics::WriterReaderLatencySummary::getMaxCdrSerializedSize(reset_alignment);
+
+        if(union_max_size_serialized < reset_alignment)
+            union_max_size_serialized = reset_alignment;
+
+        
+        reset_alignment = current_alignment;
+
+        reset_alignment += eprosima::fastdds::statistics::Locator2LocatorLatencySummary::getMaxCdrSerializedSize(reset_alignment);
+
+        if(union_max_size_serialized < reset_alignment)
+            union_max_size_serialized = reset_alignment;
+
+        
 
     return union_max_size_serialized - initial_alignment;
 }
@@ -3922,6 +4893,12 @@ size_t eprosima::fastdds::statistics::Data::getCdrSerializedSize(
         case PHYSICAL_DATA:
         current_alignment += eprosima::fastdds::statistics::PhysicalData::getCdrSerializedSize(data.physical_data(), current_alignment);
         break;
+        case HISTORY2HISTORY_LATENCY_SUMMARY:
+        current_alignment += eprosima::fastdds::statistics::WriterReaderLatencySummary::getCdrSerializedSize(data.writer_reader_latency_summary(), current_alignment);
+        break;
+        case NETWORK_LATENCY_SUMMARY:
+        current_alignment += eprosima::fastdds::statistics::Locator2LocatorLatencySummary::getCdrSerializedSize(data.locator2locator_latency_summary(), current_alignment);
+        break;
         default:
         break;
     }
@@ -3976,6 +4953,14 @@ void eprosima::fastdds::statistics::Data::serialize(
         case PHYSICAL_DATA:
         scdr << m_physical_data;
 
+        break;
+        case HISTORY2HISTORY_LATENCY_SUMMARY:
+        scdr << m_writer_reader_latency_summary;
+
+        break;
+        case NETWORK_LATENCY_SUMMARY:
+        scdr << m_locator2locator_latency_summary;
+
         break;
         default:
         break;
@@ -4027,6 +5012,12 @@ void eprosima::fastdds::statistics::Data::deserialize(
         case PHYSICAL_DATA:
         dcdr >> m_physical_data;
         break;
+        case HISTORY2HISTORY_LATENCY_SUMMARY:
+        dcdr >> m_writer_reader_latency_summary;
+        break;
+        case NETWORK_LATENCY_SUMMARY:
+        dcdr >> m_locator2locator_latency_summary;
+        break;
         default:
         break;
     }
@@ -971,6 +971,213 @@ namespace eprosima {
                     uint32_t m_port;
                     std::array<uint8_t, 16> m_address;
                 };
+                /*!
+                 * @brief This class represents the structure LatencyPercentiles_s defined by the user in the IDL file.
+                 * @ingroup TYPES
+                 */
+                class LatencyPercentiles_s
+                {
+                public:
+
+                    /*!
+                     * @brief Default constructor.
+                     */
+                    eProsima_user_DllExport LatencyPercentiles_s();
+
+                    /*!
+                     * @brief Default destructor.
+                     */
+                    eProsima_user_DllExport ~LatencyPercentiles_s();
+
+                    /*!
+                     * @brief Copy constructor.
+                     * @param x Reference to the object eprosima::fastdds::statistics::detail::LatencyPercentiles_s that will be copied.
+                     */
+                    eProsima_user_DllExport LatencyPercentiles_s(
+                            const LatencyPercentiles_s& x);
+
+                    /*!
+                     * @brief Move constructor.
+                     * @param x Reference to the object eprosima::fastdds::statistics::detail::LatencyPercentiles_s that will be copied.
+                     */
+                    eProsima_user_DllExport LatencyPercentiles_s(
+                            LatencyPercentiles_s&& x);
+
+                    /*!
+                     * @brief Copy assignment.
+                     * @param x Reference to the object eprosima::fastdds::statistics::detail::LatencyPercentiles_s that will be copied.
+                     */
+                    eProsima_user_DllExport LatencyPercentiles_s& operator =(
+                            const LatencyPercentiles_s& x);
+
+                    /*!
+                     * @brief Move assignment.
+                     * @param x Reference to the object eprosima::fastdds::statistics::detail::LatencyPercentiles_s that will be copied.
+                     */
+                    eProsima_user_DllExport LatencyPercentiles_s& operator =(
+                            LatencyPercentiles_s&& x);
+
+                    /*!
+                     * @brief This function sets a value in member count
+                     * @param _count New value for member count
+                     */
+                    eProsima_user_DllExport void count(
+                            uint64_t _count);
+
+                    /*!
+                     * @brief This function returns the value of member count
+                     * @return Value of member count
+                     */
+                    eProsima_user_DllExport uint64_t count() const;
+
+                    /*!
+                     * @brief This function returns a reference to member count
+                     * @return Reference to member count
+                     */
+                    eProsima_user_DllExport uint64_t& count();
+
+                    /*!
+                     * @brief This function sets a value in member p50
+                     * @param _p50 New value for member p50
+                     */
+                    eProsima_user_DllExport void p50(
+                            float _p50);
+
+                    /*!
+                     * @brief This function returns the value of member p50
+                     * @return Value of member p50
+                     */
+                    eProsima_user_DllExport float p50() const;
+
+                    /*!
+                     * @brief This function returns a reference to member p50
+                     * @return Reference to member p50
+                     */
+                    eProsima_user_DllExport float& p50();
+
+                    /*!
+                     * @brief This function sets a value in member p99
+                     * @param _p99 New value for member p99
+                     */
+                    eProsima_user_DllExport void p99(
+                            float _p99);
+
+                    /*!
+                     * @brief This function returns the value of member p99
+                     * @return Value of member p99
+                     */
+                    eProsima_user_DllExport float p99() const;
+
+                    /*!
+                     * @brief This function returns a reference to member p99
+                     * @return Reference to member p99
+                     */
+                    eProsima_user_DllExport float& p99();
+
+                    /*!
+                     * @brief This function sets a value in member p999
+                     * @param _p999 New value for member p999
+                     */
+                    eProsima_user_DllExport void p999(
+                            float _p999);
+
+                    /*!
+                     * @brief This function returns the value of member p999
+                     * @return Value of member p999
+                     */
+                    eProsima_user_DllExport float p999() const;
+
+                    /*!
+                     * @brief This function returns a reference to member p999
+                     * @return Reference to member p999
+                     */
+                    eProsima_user_DllExport float& p999();
+
+                    /*!
+                     * @brief This function sets a value in member maximum
+                     * @param _maximum New value for member maximum
+                     */
+                    eProsima_user_DllExport void maximum(
+                            float _maximum);
+
+                    /*!
+                     * @brief This function returns the value of member maximum
+                     * @return Value of member maximum
+                     */
+                    eProsima_user_DllExport float maximum() const;
+
+                    /*!
+                     * @brief This function returns a reference to member maximum
+                     * @return Reference to member maximum
+                     */
+                    eProsima_user_DllExport float& maximum();
+
+
+                    /*!
+                     * @brief This function returns the maximum serialized size of an object
+                     * depending on the buffer alignment.
+                     * @param current_alignment Buffer alignment.
+                     * @return Maximum serialized size.
+                     */
+                    eProsima_user_DllExport static size_t getMaxCdrSerializedSize(
+                            size_t current_alignment = 0);
+
+                    /*!
+                     * @brief This function returns the serialized size of a data depending on the buffer alignment.
+                     * @param data Data which is calculated its serialized size.
+                     * @param current_alignment Buffer alignment.
+                     * @return Serialized size.
+                     */
+                    eProsima_user_DllExport static size_t getCdrSerializedSize(
+                            const eprosima::fastdds::statistics::detail::LatencyPercentiles_s& data,
+                            size_t current_alignment = 0);
+
+
+                    /*!
+                     * @brief This function serializes an object using CDR serialization.
+                     * @param cdr CDR serialization object.
+                     */
+                    eProsima_user_DllExport void serialize(
+                            eprosima::fastcdr::Cdr& cdr) const;
+
+                    /*!
+                     * @brief This function deserializes an object using CDR serialization.
+                     * @param cdr CDR serialization object.
+                     */
+                    eProsima_user_DllExport void deserialize(
+                            eprosima::fastcdr::Cdr& cdr);
+
+
+
+                    /*!
+                     * @brief This function returns the maximum serialized size of the Key of an object
+                     * depending on the buffer alignment.
+                     * @param current_alignment Buffer alignment.
+                     * @return Maximum serialized size.
+                     */
+                    eProsima_user_DllExport static size_t getKeyMaxCdrSerializedSize(
+                            size_t current_alignment = 0);
+
+                    /*!
+                     * @brief This function tells you if the Key has been defined for this type
+                     */
+                    eProsima_user_DllExport static bool isKeyDefined();
+
+                    /*!
+                     * @brief This function serializes the key members of an object using CDR serialization.
+                     * @param cdr CDR serialization object.
+                     */
+                    eProsima_user_DllExport void serializeKey(
+                            eprosima::fastcdr::Cdr& cdr) const;
+
+                private:
+
+                    uint64_t m_count;
+                    float m_p50;
+                    float m_p99;
+                    float m_p999;
+                    float m_maximum;
+                };
             } // namespace detail
             /*!
              * @brief This class represents the structure DiscoveryTime defined by the user in the IDL file.
@@ -2398,6 +2605,378 @@ namespace eprosima {
                 std::string m_user;
                 std::string m_process;
             };
+            /*!
+             * @brief This class represents the structure WriterReaderLatencySummary defined by the user in the IDL file.
+             * @ingroup TYPES
+             */
+            class WriterReaderLatencySummary
+            {
+            public:
+
+                /*!
+                 * @brief Default constructor.
+                 */
+                eProsima_user_DllExport WriterReaderLatencySummary();
+
+                /*!
+                 * @brief Default destructor.
+                 */
+                eProsima_user_DllExport ~WriterReaderLatencySummary();
+
+                /*!
+                 * @brief Copy constructor.
+                 * @param x Reference to the object eprosima::fastdds::statistics::WriterReaderLatencySummary that will be copied.
+                 */
+                eProsima_user_DllExport WriterReaderLatencySummary(
+                        const WriterReaderLatencySummary& x);
+
+                /*!
+                 * @brief Move constructor.
+                 * @param x Reference to the object eprosima::fastdds::statistics::WriterReaderLatencySummary that will be copied.
+                 */
+                eProsima_user_DllExport WriterReaderLatencySummary(
+                        WriterReaderLatencySummary&& x);
+
+                /*!
+                 * @brief Copy assignment.
+                 * @param x Reference to the object eprosima::fastdds::statistics::WriterReaderLatencySummary that will be copied.
+                 */
+                eProsima_user_DllExport WriterReaderLatencySummary& operator =(
+                        const WriterReaderLatencySummary& x);
+
+                /*!
+                 * @brief Move assignment.
+                 * @param x Reference to the object eprosima::fastdds::statistics::WriterReaderLatencySummary that will be copied.
+                 */
+                eProsima_user_DllExport WriterReaderLatencySummary& operator =(
+                        WriterReaderLatencySummary&& x);
+
+                /*!
+                 * @brief This function copies the value in member writer_guid
+                 * @param _writer_guid New value to be copied in member writer_guid
+                 */
+                eProsima_user_DllExport void writer_guid(
+                        const eprosima::fastdds::statistics::detail::GUID_s& _writer_guid);
+
+                /*!
+                 * @brief This function moves the value in member writer_guid
+                 * @param _writer_guid New value to be moved in member writer_guid
+                 */
+                eProsima_user_DllExport void writer_guid(
+                        eprosima::fastdds::statistics::detail::GUID_s&& _writer_guid);
+
+                /*!
+                 * @brief This function returns a constant reference to member writer_guid
+                 * @return Constant reference to member writer_guid
+                 */
+                eProsima_user_DllExport const eprosima::fastdds::statistics::detail::GUID_s& writer_guid() const;
+
+                /*!
+                 * @brief This function returns a reference to member writer_guid
+                 * @return Reference to member writer_guid
+                 */
+                eProsima_user_DllExport eprosima::fastdds::statistics::detail::GUID_s& writer_guid();
+                /*!
+                 * @brief This function copies the value in member reader_guid
+                 * @param _reader_guid New value to be copied in member reader_guid
+                 */
+                eProsima_user_DllExport void reader_guid(
+                        const eprosima::fastdds::statistics::detail::GUID_s& _reader_guid);
+
+                /*!
+                 * @brief This function moves the value in member reader_guid
+                 * @param _reader_guid New value to be moved in member reader_guid
+                 */
+                eProsima_user_DllExport void reader_guid(
+                        eprosima::fastdds::statistics::detail::GUID_s&& _reader_guid);
+
+                /*!
+                 * @brief This function returns a constant reference to member reader_guid
+                 * @return Constant reference to member reader_guid
+                 */
+                eProsima_user_DllExport const eprosima::fastdds::statistics::detail::GUID_s& reader_guid() const;
+
+                /*!
+                 * @brief This function returns a reference to member reader_guid
+                 * @return Reference to member reader_guid
+                 */
+                eProsima_user_DllExport eprosima::fastdds::statistics::detail::GUID_s& reader_guid();
+                /*!
+                 * @brief This function copies the value in member data
+                 * @param _data New value to be copied in member data
+                 */
+                eProsima_user_DllExport void data(
+                        const eprosima::fastdds::statistics::detail::LatencyPercentiles_s& _data);
+
+                /*!
+                 * @brief This function moves the value in member data
+                 * @param _data New value to be moved in member data
+                 */
+                eProsima_user_DllExport void data(
+                        eprosima::fastdds::statistics::detail::LatencyPercentiles_s&& _data);
+
+                /*!
+                 * @brief This function returns a constant reference to member data
+                 * @return Constant reference to member data
+                 */
+                eProsima_user_DllExport const eprosima::fastdds::statistics::detail::LatencyPercentiles_s& data() const;
+
+                /*!
+                 * @brief This function returns a reference to member data
+                 * @return Reference to member data
+                 */
+                eProsima_user_DllExport eprosima::fastdds::statistics::detail::LatencyPercentiles_s& data();
+
+
+                /*!
+                 * @brief This function returns the maximum serialized size of an object
+                 * depending on the buffer alignment.
+                 * @param current_alignment Buffer alignment.
+                 * @return Maximum serialized size.
+                 */
+                eProsima_user_DllExport static size_t getMaxCdrSerializedSize(
+                        size_t current_alignment = 0);
+
+                /*!
+                 * @brief This function returns the serialized size of a data depending on the buffer alignment.
+                 * @param data Data which is calculated its serialized size.
+                 * @param current_alignment Buffer alignment.
+                 * @return Serialized size.
+                 */
+                eProsima_user_DllExport static size_t getCdrSerializedSize(
+                        const eprosima::fastdds::statistics::WriterReaderLatencySummary& data,
+                        size_t current_alignment = 0);
+
+
+                /*!
+                 * @brief This function serializes an object using CDR serialization.
+                 * @param cdr CDR serialization object.
+                 */
+                eProsima_user_DllExport void serialize(
+                        eprosima::fastcdr::Cdr& cdr) const;
+
+                /*!
+                 * @brief This function deserializes an object using CDR serialization.
+                 * @param cdr CDR serialization object.
+                 */
+                eProsima_user_DllExport void deserialize(
+                        eprosima::fastcdr::Cdr& cdr);
+
+
+
+                /*!
+                 * @brief This function returns the maximum serialized size of the Key of an object
+                 * depending on the buffer alignment.
+                 * @param current_alignment Buffer alignment.
+                 * @return Maximum serialized size.
+                 */
+                eProsima_user_DllExport static size_t getKeyMaxCdrSerializedSize(
+                        size_t current_alignment = 0);
+
+                /*!
+                 * @brief This function tells you if the Key has been defined for this type
+                 */
+                eProsima_user_DllExport static bool isKeyDefined();
+
+                /*!
+                 * @brief This function serializes the key members of an object using CDR serialization.
+                 * @param cdr CDR serialization object.
+                 */
+                eProsima_user_DllExport void serializeKey(
+                        eprosima::fastcdr::Cdr& cdr) const;
+
+            private:
+
+                eprosima::fastdds::statistics::detail::GUID_s m_writer_guid;
+                eprosima::fastdds::statistics::detail::GUID_s m_reader_guid;
+                eprosima::fastdds::statistics::detail::LatencyPercentiles_s m_data;
+            };
+            /*!
+             * @brief This class represents the structure Locator2LocatorLatencySummary defined by the user in the IDL file.
+             * @ingroup TYPES
+             */
+            class Locator2LocatorLatencySummary
+            {
+            public:
+
+                /*!
+                 * @brief Default constructor.
+                 */
+                eProsima_user_DllExport Locator2LocatorLatencySummary();
+
+                /*!
+                 * @brief Default destructor.
+                 */
+                eProsima_user_DllExport ~Locator2LocatorLatencySummary();
+
+                /*!
+                 * @brief Copy constructor.
+                 * @param x Reference to the object eprosima::fastdds::statistics::Locator2LocatorLatencySummary that will be copied.
+                 */
+                eProsima_user_DllExport Locator2LocatorLatencySummary(
+                        const Locator2LocatorLatencySummary& x);
+
+                /*!
+                 * @brief Move constructor.
+                 * @param x Reference to the object eprosima::fastdds::statistics::Locator2LocatorLatencySummary that will be copied.
+                 */
+                eProsima_user_DllExport Locator2LocatorLatencySummary(
+                        Locator2LocatorLatencySummary&& x);
+
+                /*!
+                 * @brief Copy assignment.
+                 * @param x Reference to the object eprosima::fastdds::statistics::Locator2LocatorLatencySummary that will be copied.
+                 */
+                eProsima_user_DllExport Locator2LocatorLatencySummary& operator =(
+                        const Locator2LocatorLatencySummary& x);
+
+                /*!
+                 * @brief Move assignment.
+                 * @param x Reference to the object eprosima::fastdds::statistics::Locator2LocatorLatencySummary that will be copied.
+                 */
+                eProsima_user_DllExport Locator2LocatorLatencySummary& operator =(
+                        Locator2LocatorLatencySummary&& x);
+
+                /*!
+                 * @brief This function copies the value in member src_locator
+                 * @param _src_locator New value to be copied in member src_locator
+                 */
+                eProsima_user_DllExport void src_locator(
+                        const eprosima::fastdds::statistics::detail::Locator_s& _src_locator);
+
+                /*!
+                 * @brief This function moves the value in member src_locator
+                 * @param _src_locator New value to be moved in member src_locator
+                 */
+                eProsima_user_DllExport void src_locator(
+                        eprosima::fastdds::statistics::detail::Locator_s&& _src_locator);
+
+                /*!
+                 * @brief This function returns a constant reference to member src_locator
+                 * @return Constant reference to member src_locator
+                 */
+                eProsima_user_DllExport const eprosima::fastdds::statistics::detail::Locator_s& src_locator() const;
+
+                /*!
+                 * @brief This function returns a reference to member src_locator
+                 * @return Reference to member src_locator
+                 */
+                eProsima_user_DllExport eprosima::fastdds::statistics::detail::Locator_s& src_locator();
+                /*!
+                 * @brief This function copies the value in member dst_locator
+                 * @param _dst_locator New value to be copied in member dst_locator
+                 */
+                eProsima_user_DllExport void dst_locator(
+                        const eprosima::fastdds::statistics::detail::Locator_s& _dst_locator);
+
+                /*!
+                 * @brief This function moves the value in member dst_locator
+                 * @param _dst_locator New value to be moved in member dst_locator
+                 */
+                eProsima_user_DllExport void dst_locator(
+                        eprosima::fastdds::statistics::detail::Locator_s&& _dst_locator);
+
+                /*!
+                 * @brief This function returns a constant reference to member dst_locator
+                 * @return Constant reference to member dst_locator
+                 */
+                eProsima_user_DllExport const eprosima::fastdds::statistics::detail::Locator_s& dst_locator() const;
+
+                /*!
+                 * @brief This function returns a reference to member dst_locator
+                 * @return Reference to member dst_locator
+                 */
+                eProsima_user_DllExport eprosima::fastdds::statistics::detail::Locator_s& dst_locator();
+                /*!
+                 * @brief This function copies the value in member data
+                 * @param _data New value to be copied in member data
+                 */
+                eProsima_user_DllExport void data(
+                        const eprosima::fastdds::statistics::detail::LatencyPercentiles_s& _data);
+
+                /*!
+                 * @brief This function moves the value in member data
+                 * @param _data New value to be moved in member data
+                 */
+                eProsima_user_DllExport void data(
+                        eprosima::fastdds::statistics::detail::LatencyPercentiles_s&& _data);
+
+                /*!
+                 * @brief This function returns a constant reference to member data
+                 * @return Constant reference to member data
+                 */
+                eProsima_user_DllExport const eprosima::fastdds::statistics::detail::LatencyPercentiles_s& data() const;
+
+                /*!
+                 * @brief This function returns a reference to member data
+                 * @return Reference to member data
+                 */
+                eProsima_user_DllExport eprosima::fastdds::statistics::detail::LatencyPercentiles_s& data();
+
+
+                /*!
+                 * @brief This function returns the maximum serialized size of an object
+                 * depending on the buffer alignment.
+                 * @param current_alignment Buffer alignment.
+                 * @return Maximum serialized size.
+                 */
+                eProsima_user_DllExport static size_t getMaxCdrSerializedSize(
+                        size_t current_alignment = 0);
+
+                /*!
+                 * @brief This function returns the serialized size of a data depending on the buffer alignment.
+                 * @param data Data which is calculated its serialized size.
+                 * @param current_alignment Buffer alignment.
+                 * @return Serialized size.
+                 */
+                eProsima_user_DllExport static size_t getCdrSerializedSize(
+                        const eprosima::fastdds::statistics::Locator2LocatorLatencySummary& data,
+                        size_t current_alignment = 0);
+
+
+                /*!
+                 * @brief This function serializes an object using CDR serialization.
+                 * @param cdr CDR serialization object.
+                 */
+                eProsima_user_DllExport void serialize(
+                        eprosima::fastcdr::Cdr& cdr) const;
+
+                /*!
+                 * @brief This function deserializes an object using CDR serialization.
+                 * @param cdr CDR serialization object.
+                 */
+                eProsima_user_DllExport void deserialize(
+                        eprosima::fastcdr::Cdr& cdr);
+
+
+
+                /*!
+                 * @brief This function returns the maximum serialized size of the Key of an object
+                 * depending on the buffer alignment.
+                 * @param current_alignment Buffer alignment.
+                 * @return Maximum serialized size.
+                 */
+                eProsima_user_DllExport static size_t getKeyMaxCdrSerializedSize(
+                        size_t current_alignment = 0);
+
+                /*!
+                 * @brief This function tells you if the Key has been defined for this type
+                 */
+                eProsima_user_DllExport static bool isKeyDefined();
+
+                /*!
+                 * @brief This function serializes the key members of an object using CDR serialization.
+                 * @param cdr CDR serialization object.
+                 */
+                eProsima_user_DllExport void serializeKey(
+                        eprosima::fastcdr::Cdr& cdr) const;
+
+            private:
+
+                eprosima::fastdds::statistics::detail::Locator_s m_src_locator;
+                eprosima::fastdds::statistics::detail::Locator_s m_dst_locator;
+                eprosima::fastdds::statistics::detail::LatencyPercentiles_s m_data;
+            };
             /*!
              * @brief This class represents the bitmask EventKind defined by the user in the IDL file.
              * @ingroup TYPES
@@ -2420,7 +2999,9 @@ namespace eprosima {
                 EDP_PACKETS = 0x01 << 13,
                 DISCOVERED_ENTITY = 0x01 << 14,
                 SAMPLE_DATAS = 0x01 << 15,
-                PHYSICAL_DATA = 0x01 << 16
+                PHYSICAL_DATA = 0x01 << 16,
+                HISTORY2HISTORY_LATENCY_SUMMARY = 0x01 << 17,
+                NETWORK_LATENCY_SUMMARY = 0x01 << 18
             };
             /*!
              * @brief This class represents the union Data defined by the user in the IDL file.
@@ -2704,6 +3285,60 @@ namespace eprosima {
                  * @exception eprosima::fastcdr::BadParamException This exception is thrown if the requested union member is not the current selection.
                  */
                 eProsima_user_DllExport eprosima::fastdds::statistics::PhysicalData& physical_data();
+                /*!
+                 * @brief This function copies the value in member writer_reader_latency_summary
+                 * @param _writer_reader_latency_summary New value to be copied in member writer_reader_latency_summary
+                 */
+                eProsima_user_DllExport void writer_reader_latency_summary(
+                        const eprosima::fastdds::statistics::WriterReaderLatencySummary& _writer_reader_latency_summary);
+
+                /*!
+                 * @brief This function moves the value in member writer_reader_latency_summary
+                 * @param _writer_reader_latency_summary New value to be moved in member writer_reader_latency_summary
+                 */
+                eProsima_user_DllExport void writer_reader_latency_summary(
+                        eprosima::fastdds::statistics::WriterReaderLatencySummary&& _writer_reader_latency_summary);
+
+                /*!
+                 * @brief This function returns a constant reference to member writer_reader_latency_summary
+                 * @return Constant reference to member writer_reader_latency_summary
+                 * @exception eprosima::fastcdr::BadParamException This exception is thrown if the requested union member is not the current selection.
+                 */
+                eProsima_user_DllExport const eprosima::fastdds::statistics::WriterReaderLatencySummary& writer_reader_latency_summary() const;
+
+                /*!
+                 * @brief This function returns a reference to member writer_reader_latency_summary
+                 * @return Reference to member writer_reader_latency_summary
+                 * @exception eprosima::fastcdr::BadParamException This exception is thrown if the requested union member is not the current selection.
+                 */
+                eProsima_user_DllExport eprosima::fastdds::statistics::WriterReaderLatencySummary& writer_reader_latency_summary();
+                /*!
+                 * @brief This function copies the value in member locator2locator_latency_summary
+                 * @param _locator2locator_latency_summary New value to be copied in member locator2locator_latency_summary
+                 */
+                eProsima_user_DllExport void locator2locator_latency_summary(
+                        const eprosima::fastdds::statistics::Locator2LocatorLatencySummary& _locator2locator_latency_summary);
+
+                /*!
+                 * @brief This function moves the value in member locator2locator_latency_summary
+                 * @param _locator2locator_latency_summary New value to be moved in member locator2locator_latency_summary
+                 */
+                eProsima_user_DllExport void locator2locator_latency_summary(
+                        eprosima::fastdds::statistics::Locator2LocatorLatencySummary&& _locator2locator_latency_summary);
+
+                /*!
+                 * @brief This function returns a constant reference to member locator2locator_latency_summary
+                 * @return Constant reference to member locator2locator_latency_summary
+                 * @exception eprosima::fastcdr::BadParamException This exception is thrown if the requested union member is not the current selection.
+                 */
+                eProsima_user_DllExport const eprosima::fastdds::statistics::Locator2LocatorLatencySummary& locator2locator_latency_summary() const;
+
+                /*!
+                 * @brief This function returns a reference to member locator2locator_latency_summary
+                 * @return Reference to member locator2locator_latency_summary
+                 * @exception eprosima::fastcdr::BadParamException This exception is thrown if the requested union member is not the current selection.
+                 */
+                eProsima_user_DllExport eprosima::fastdds::statistics::Locator2LocatorLatencySummary& locator2locator_latency_summary();
 
                 /*!
                  * @brief This function returns the maximum serialized size of an object
@@ -2754,6 +3389,8 @@ namespace eprosima {
                 eprosima::fastdds::statistics::DiscoveryTime m_discovery_time;
                 eprosima::fastdds::statistics::SampleIdentityCount m_sample_identity_count;
                 eprosima::fastdds::statistics::PhysicalData m_physical_data;
+                eprosima::fastdds::statistics::WriterReaderLatencySummary m_writer_reader_latency_summary;
+                eprosima::fastdds::statistics::Locator2LocatorLatencySummary m_locator2locator_latency_summary;
             };
         } // namespace statistics
     } // namespace fastdds
@@ -860,6 +860,144 @@ namespace eprosima {
                     return true;
                 }
 
+                LatencyPercentiles_sPubSubType::LatencyPercentiles_sPubSubType()
+                {
+                    setName("eprosima::fastdds::statistics::detail::LatencyPercentiles_s");
+                    m_typeSize = static_cast<uint32_t>(LatencyPercentiles_s::getMaxCdrSerializedSize()) + 4 /*encapsulation*/;
+                    m_isGetKeyDefined = LatencyPercentiles_s::isKeyDefined();
+                    size_t keyLength = LatencyPercentiles_s::getKeyMaxCdrSerializedSize() > 16 ?
+                            LatencyPercentiles_s::getKeyMaxCdrSerializedSize() : 16;
+                    m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
+                    memset(m_keyBuffer, 0, keyLength);
+                }
+
+                LatencyPercentiles_sPubSubType::~LatencyPercentiles_sPubSubType()
+                {
+                    if (m_keyBuffer != nullptr)
+                    {
+                        free(m_keyBuffer);
+                    }
+                }
+
+                bool LatencyPercentiles_sPubSubType::serialize(
+                        void* data,
+                        SerializedPayload_t* payload)
+                {
+                    LatencyPercentiles_s* p_type = static_cast<LatencyPercentiles_s*>(data);
+
+                    // Object that manages the raw buffer.
+                    eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
+                    // Object that serializes the data.
+                    eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+                    payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+                    // Serialize encapsulation
+                    ser.serialize_encapsulation();
+
+                    try
+                    {
+                        // Serialize the object.
+                        p_type->serialize(ser);
+                    }
+                    catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+                    {
+                        return false;
+                    }
+
+                    // Get the serialized length
+                    payload->length = static_cast<uint32_t>(ser.getSerializedDataLength());
+                    return true;
+                }
+
+                bool LatencyPercentiles_sPubSubType::deserialize(
+                        SerializedPayload_t* payload,
+                        void* data)
+                {
+                    //Convert DATA to pointer of your type
+                    LatencyPercentiles_s* p_type = static_cast<LatencyPercentiles_s*>(data);
+
+                    // Object that manages the raw buffer.
+                    eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
+
+                    // Object that deserializes the data.
+                    eprosima::fastcdr::Cdr deser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+
+                    // Deserialize encapsulation.
+                    deser.read_encapsulation();
+                    payload->encapsulation = deser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+                    try
+                    {
+                        // Deserialize the object.
+                        p_type->deserialize(deser);
+                    }
+                    catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+                    {
+                        return false;
+                    }
+
+                    return true;
+                }
+
+                std::function<uint32_t()> LatencyPercentiles_sPubSubType::getSerializedSizeProvider(
+                        void* data)
+                {
+                    return [data]() -> uint32_t
+                           {
+                               return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<LatencyPercentiles_s*>(data))) +
+                                      4u /*encapsulation*/;
+                           };
+                }
+
+                void* LatencyPercentiles_sPubSubType::createData()
+                {
+                    return reinterpret_cast<void*>(new LatencyPercentiles_s());
+                }
+
+                void LatencyPercentiles_sPubSubType::deleteData(
+                        void* data)
+                {
+                    delete(reinterpret_cast<LatencyPercentiles_s*>(data));
+                }
+
+                bool LatencyPercentiles_sPubSubType::getKey(
+                        void* data,
+                        InstanceHandle_t* handle,
+                        bool force_md5)
+                {
+                    if (!m_isGetKeyDefined)
+                    {
+                        return false;
+                    }
+
+                    LatencyPercentiles_s* p_type = static_cast<LatencyPercentiles_s*>(data);
+
+                    // Object that manages the raw buffer.
+                    eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
+                            LatencyPercentiles_s::getKeyMaxCdrSerializedSize());
+
+                    // Object that serializes the data.
+                    eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
+                    p_type->serializeKey(ser);
+                    if (force_md5 || LatencyPercentiles_s::getKeyMaxCdrSerializedSize() > 16)
+                    {
+                        m_md5.init();
+                        m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.getSerializedDataLength()));
+                        m_md5.finalize();
+                        for (uint8_t i = 0; i < 16; ++i)
+                        {
+                            handle->value[i] = m_md5.digest[i];
+                        }
+                    }
+                    else
+                    {
+                        for (uint8_t i = 0; i < 16; ++i)
+                        {
+                            handle->value[i] = m_keyBuffer[i];
+                        }
+                    }
+                    return true;
+                }
+
 
             } //End of namespace detail
             DiscoveryTimePubSubType::DiscoveryTimePubSubType()
@@ -1968,6 +2106,282 @@ namespace eprosima {
                 return true;
             }
 
+            WriterReaderLatencySummaryPubSubType::WriterReaderLatencySummaryPubSubType()
+            {
+                setName("eprosima::fastdds::statistics::WriterReaderLatencySummary");
+                m_typeSize = static_cast<uint32_t>(WriterReaderLatencySummary::getMaxCdrSerializedSize()) + 4 /*encapsulation*/;
+                m_isGetKeyDefined = WriterReaderLatencySummary::isKeyDefined();
+                size_t keyLength = WriterReaderLatencySummary::getKeyMaxCdrSerializedSize() > 16 ?
+                        WriterReaderLatencySummary::getKeyMaxCdrSerializedSize() : 16;
+                m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
+                memset(m_keyBuffer, 0, keyLength);
+            }
+
+            WriterReaderLatencySummaryPubSubType::~WriterReaderLatencySummaryPubSubType()
+            {
+                if (m_keyBuffer != nullptr)
+                {
+                    free(m_keyBuffer);
+                }
+            }
+
+            bool WriterReaderLatencySummaryPubSubType::serialize(
+                    void* data,
+                    SerializedPayload_t* payload)
+            {
+                WriterReaderLatencySummary* p_type = static_cast<WriterReaderLatencySummary*>(data);
+
+                // Object that manages the raw buffer.
+                eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
+                // Object that serializes the data.
+                eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+                payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+                // Serialize encapsulation
+                ser.serialize_encapsulation();
+
+                try
+                {
+                    // Serialize the object.
+                    p_type->serialize(ser);
+                }
+                catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+                {
+                    return false;
+                }
+
+                // Get the serialized length
+                payload->length = static_cast<uint32_t>(ser.getSerializedDataLength());
+                return true;
+            }
+
+            bool WriterReaderLatencySummaryPubSubType::deserialize(
+                    SerializedPayload_t* payload,
+                    void* data)
+            {
+                //Convert DATA to pointer of your type
+                WriterReaderLatencySummary* p_type = static_cast<WriterReaderLatencySummary*>(data);
+
+                // Object that manages the raw buffer.
+                eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
+
+                // Object that deserializes the data.
+                eprosima::fastcdr::Cdr deser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+
+                // Deserialize encapsulation.
+                deser.read_encapsulation();
+                payload->encapsulation = deser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+                try
+                {
+                    // Deserialize the object.
+                    p_type->deserialize(deser);
+                }
+                catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+                {
+                    return false;
+                }
+
+                return true;
+            }
+
+            std::function<uint32_t()> WriterReaderLatencySummaryPubSubType::getSerializedSizeProvider(
+                    void* data)
+            {
+                return [data]() -> uint32_t
+                       {
+                           return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<WriterReaderLatencySummary*>(data))) +
+                                  4u /*encapsulation*/;
+                       };
+            }
+
+            void* WriterReaderLatencySummaryPubSubType::createData()
+            {
+                return reinterpret_cast<void*>(new WriterReaderLatencySummary());
+            }
+
+            void WriterReaderLatencySummaryPubSubType::deleteData(
+                    void* data)
+            {
+                delete(reinterpret_cast<WriterReaderLatencySummary*>(data));
+            }
+
+            bool WriterReaderLatencySummaryPubSubType::getKey(
+                    void* data,
+                    InstanceHandle_t* handle,
+                    bool force_md5)
+            {
+                if (!m_isGetKeyDefined)
+                {
+                    return false;
+                }
+
+                WriterReaderLatencySummary* p_type = static_cast<WriterReaderLatencySummary*>(data);
+
+                // Object that manages the raw buffer.
+                eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
+                        WriterReaderLatencySummary::getKeyMaxCdrSerializedSize());
+
+                // Object that serializes the data.
+                eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
+                p_type->serializeKey(ser);
+                if (force_md5 || WriterReaderLatencySummary::getKeyMaxCdrSerializedSize() > 16)
+                {
+                    m_md5.init();
+                    m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.getSerializedDataLength()));
+                    m_md5.finalize();
+                    for (uint8_t i = 0; i < 16; ++i)
+                    {
+                        handle->value[i] = m_md5.digest[i];
+                    }
+                }
+                else
+                {
+                    for (uint8_t i = 0; i < 16; ++i)
+                    {
+                        handle->value[i] = m_keyBuffer[i];
+                    }
+                }
+                return true;
+            }
+
+            Locator2LocatorLatencySummaryPubSubType::Locator2LocatorLatencySummaryPubSubType()
+            {
+                setName("eprosima::fastdds::statistics::Locator2LocatorLatencySummary");
+                m_typeSize = static_cast<uint32_t>(Locator2LocatorLatencySummary::getMaxCdrSerializedSize()) + 4 /*encapsulation*/;
+                m_isGetKeyDefined = Locator2LocatorLatencySummary::isKeyDefined();
+                size_t keyLength = Locator2LocatorLatencySummary::getKeyMaxCdrSerializedSize() > 16 ?
+                        Locator2LocatorLatencySummary::getKeyMaxCdrSerializedSize() : 16;
+                m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
+                memset(m_keyBuffer, 0, keyLength);
+            }
+
+            Locator2LocatorLatencySummaryPubSubType::~Locator2LocatorLatencySummaryPubSubType()
+            {
+                if (m_keyBuffer != nullptr)
+                {
+                    free(m_keyBuffer);
+                }
+            }
+
+            bool Locator2LocatorLatencySummaryPubSubType::serialize(
+                    void* data,
+                    SerializedPayload_t* payload)
+            {
+                Locator2LocatorLatencySummary* p_type = static_cast<Locator2LocatorLatencySummary*>(data);
+
+                // Object that manages the raw buffer.
+                eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
+                // Object that serializes the data.
+                eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+                payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+                // Serialize encapsulation
+                ser.serialize_encapsulation();
+
+                try
+                {
+                    // Serialize the object.
+                    p_type->serialize(ser);
+                }
+                catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+                {
+                    return false;
+                }
+
+                // Get the serialized length
+                payload->length = static_cast<uint32_t>(ser.getSerializedDataLength());
+                return true;
+            }
+
+            bool Locator2LocatorLatencySummaryPubSubType::deserialize(
+                    SerializedPayload_t* payload,
+                    void* data)
+            {
+                //Convert DATA to pointer of your type
+                Locator2LocatorLatencySummary* p_type = static_cast<Locator2LocatorLatencySummary*>(data);
+
+                // Object that manages the raw buffer.
+                eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
+
+                // Object that deserializes the data.
+                eprosima::fastcdr::Cdr deser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+
+                // Deserialize encapsulation.
+                deser.read_encapsulation();
+                payload->encapsulation = deser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+                try
+                {
+                    // Deserialize the object.
+                    p_type->deserialize(deser);
+                }
+                catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+                {
+                    return false;
+                }
+
+                return true;
+            }
+
+            std::function<uint32_t()> Locator2LocatorLatencySummaryPubSubType::getSerializedSizeProvider(
+                    void* data)
+            {
+                return [data]() -> uint32_t
+                       {
+                           return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<Locator2LocatorLatencySummary*>(data))) +
+                                  4u /*encapsulation*/;
+                       };
+            }
+
+            void* Locator2LocatorLatencySummaryPubSubType::createData()
+            {
+                return reinterpret_cast<void*>(new Locator2LocatorLatencySummary());
+            }
+
+            void Locator2LocatorLatencySummaryPubSubType::deleteData(
+                    void* data)
+            {
+                delete(reinterpret_cast<Locator2LocatorLatencySummary*>(data));
+            }
+
+            bool Locator2LocatorLatencySummaryPubSubType::getKey(
+                    void* data,
+                    InstanceHandle_t* handle,
+                    bool force_md5)
+            {
+                if (!m_isGetKeyDefined)
+                {
+                    return false;
+                }
+
+                Locator2LocatorLatencySummary* p_type = static_cast<Locator2LocatorLatencySummary*>(data);
+
+                // Object that manages the raw buffer.
+                eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
+                        Locator2LocatorLatencySummary::getKeyMaxCdrSerializedSize());
+
+                // Object that serializes the data.
+                eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
+                p_type->serializeKey(ser);
+                if (force_md5 || Locator2LocatorLatencySummary::getKeyMaxCdrSerializedSize() > 16)
+                {
+                    m_md5.init();
+                    m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.getSerializedDataLength()));
+                    m_md5.finalize();
+                    for (uint8_t i = 0; i < 16; ++i)
+                    {
+                        handle->value[i] = m_md5.digest[i];
+                    }
+                }
+                else
+                {
+                    for (uint8_t i = 0; i < 16; ++i)
+                    {
+                        handle->value[i] = m_keyBuffer[i];
+                    }
+                }
+                return true;
+            }
+
 
 
 
@@ -426,6 +426,70 @@ namespace eprosima
                     MD5 m_md5;
                     unsigned char* m_keyBuffer;
                 };
+                /*!
+                 * @brief This class represents the TopicDataType of the type LatencyPercentiles_s defined by the user in the IDL file.
+                 * @ingroup TYPES
+                 */
+                class LatencyPercentiles_sPubSubType : public eprosima::fastdds::dds::TopicDataType
+                {
+                public:
+
+                    typedef LatencyPercentiles_s type;
+
+                    eProsima_user_DllExport LatencyPercentiles_sPubSubType();
+
+                    eProsima_user_DllExport virtual ~LatencyPercentiles_sPubSubType();
+
+                    eProsima_user_DllExport virtual bool serialize(
+                            void* data,
+                            eprosima::fastrtps::rtps::SerializedPayload_t* payload) override;
+
+                    eProsima_user_DllExport virtual bool deserialize(
+                            eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                            void* data) override;
+
+                    eProsima_user_DllExport virtual std::function<uint32_t()> getSerializedSizeProvider(
+                            void* data) override;
+
+                    eProsima_user_DllExport virtual bool getKey(
+                            void* data,
+                            eprosima::fastrtps::rtps::InstanceHandle_t* ihandle,
+                            bool force_md5 = false) override;
+
+                    eProsima_user_DllExport virtual void* createData() override;
+
+                    eProsima_user_DllExport virtual void deleteData(
+                            void* data) override;
+
+                #ifdef TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+                    eProsima_user_DllExport inline bool is_bounded() const override
+                    {
+                        return true;
+                    }
+
+                #endif  // TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+
+                #ifdef TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+                    eProsima_user_DllExport inline bool is_plain() const override
+                    {
+                        return true;
+                    }
+
+                #endif  // TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+
+                #ifdef TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+                    eProsima_user_DllExport inline bool construct_sample(
+                            void* memory) const override
+                    {
+                        new (memory) LatencyPercentiles_s();
+                        return true;
+                    }
+
+                #endif  // TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+
+                    MD5 m_md5;
+                    unsigned char* m_keyBuffer;
+                };
             }
             /*!
              * @brief This class represents the TopicDataType of the type DiscoveryTime defined by the user in the IDL file.
@@ -939,6 +1003,134 @@ namespace eprosima
                 MD5 m_md5;
                 unsigned char* m_keyBuffer;
             };
+            /*!
+             * @brief This class represents the TopicDataType of the type WriterReaderLatencySummary defined by the user in the IDL file.
+             * @ingroup TYPES
+             */
+            class WriterReaderLatencySummaryPubSubType : public eprosima::fastdds::dds::TopicDataType
+            {
+            public:
+
+                typedef WriterReaderLatencySummary type;
+
+                eProsima_user_DllExport WriterReaderLatencySummaryPubSubType();
+
+                eProsima_user_DllExport virtual ~WriterReaderLatencySummaryPubSubType();
+
+                eProsima_user_DllExport virtual bool serialize(
+                        void* data,
+                        eprosima::fastrtps::rtps::SerializedPayload_t* payload) override;
+
+                eProsima_user_DllExport virtual bool deserialize(
+                        eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                        void* data) override;
+
+                eProsima_user_DllExport virtual std::function<uint32_t()> getSerializedSizeProvider(
+                        void* data) override;
+
+                eProsima_user_DllExport virtual bool getKey(
+                        void* data,
+                        eprosima::fastrtps::rtps::InstanceHandle_t* ihandle,
+                        bool force_md5 = false) override;
+
+                eProsima_user_DllExport virtual void* createData() override;
+
+                eProsima_user_DllExport virtual void deleteData(
+                        void* data) override;
+
+            #ifdef TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+                eProsima_user_DllExport inline bool is_bounded() const override
+                {
+                    return true;
+                }
+
+            #endif  // TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+
+            #ifdef TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+                eProsima_user_DllExport inline bool is_plain() const override
+                {
+                    return true;
+                }
+
+            #endif  // TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+
+            #ifdef TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+                eProsima_user_DllExport inline bool construct_sample(
+                        void* memory) const override
+                {
+                    new (memory) WriterReaderLatencySummary();
+                    return true;
+                }
+
+            #endif  // TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+
+                MD5 m_md5;
+                unsigned char* m_keyBuffer;
+            };
+            /*!
+             * @brief This class represents the TopicDataType of the type Locator2LocatorLatencySummary defined by the user in the IDL file.
+             * @ingroup TYPES
+             */
+            class Locator2LocatorLatencySummaryPubSubType : public eprosima::fastdds::dds::TopicDataType
+            {
+            public:
+
+                typedef Locator2LocatorLatencySummary type;
+
+                eProsima_user_DllExport Locator2LocatorLatencySummaryPubSubType();
+
+                eProsima_user_DllExport virtual ~Locator2LocatorLatencySummaryPubSubType();
+
+                eProsima_user_DllExport virtual bool serialize(
+                        void* data,
+                        eprosima::fastrtps::rtps::SerializedPayload_t* payload) override;
+
+                eProsima_user_DllExport virtual bool deserialize(
+                        eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                        void* data) override;
+
+                eProsima_user_DllExport virtual std::function<uint32_t()> getSerializedSizeProvider(
+                        void* data) override;
+
+                eProsima_user_DllExport virtual bool getKey(
+                        void* data,
+                        eprosima::fastrtps::rtps::InstanceHandle_t* ihandle,
+                        bool force_md5 = false) override;
+
+                eProsima_user_DllExport virtual void* createData() override;
+
+                eProsima_user_DllExport virtual void deleteData(
+                        void* data) override;
+
+            #ifdef TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+                eProsima_user_DllExport inline bool is_bounded() const override
+                {
+                    return true;
+                }
+
+            #endif  // TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+
+            #ifdef TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+                eProsima_user_DllExport inline bool is_plain() const override
+                {
+                    return true;
+                }
+
+            #endif  // TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+
+            #ifdef TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+                eProsima_user_DllExport inline bool construct_sample(
+                        void* memory) const override
+                {
+                    new (memory) Locator2LocatorLatencySummary();
+                    return true;
+                }
+
+            #endif  // TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+
+                MD5 m_md5;
+                unsigned char* m_keyBuffer;
+            };
 
 
         }
@@ -0,0 +1,266 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PartitionMatcher.cpp
+ */
+
+#include <utils/PartitionMatcher.hpp>
+
+#include <fastrtps/utils/StringMatching.h>
+
+#include <cstring>
+#include <tuple>
+#include <utility>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+namespace {
+
+PartitionMatcher::Kind expression_kind(
+        const std::string& expression)
+{
+#if defined(_WIN32)
+    // PathMatchSpec has its own rules (i.e. it is case insensitive), so it is always used
+    static_cast<void>(expression);
+    return PartitionMatcher::Kind::GLOB;
+#else
+    // Bracket expressions and backslashes are left to StringMatching, so they follow its escaping rules
+    if (std::string::npos != expression.find_first_of("[\\"))
+    {
+        return PartitionMatcher::Kind::GLOB;
+    }
+
+    size_t first_wildcard = expression.find_first_of("*?");
+    if (std::string::npos == first_wildcard)
+    {
+        return PartitionMatcher::Kind::LITERAL;
+    }
+
+    if (first_wildcard + 1 == expression.size() && '*' == expression[first_wildcard])
+    {
+        return PartitionMatcher::Kind::PREFIX;
+    }
+
+    return PartitionMatcher::Kind::WILDCARD;
+#endif // if defined(_WIN32)
+}
+
+/*
+ * fnmatch without flags on a pattern with only '*' and '?'.
+ * On a mismatch, only the last '*' needs to be retried, as it can take over any text the previous ones took.
+ */
+bool wildcard_match(
+        const char* pattern,
+        const char* name)
+{
+    const char* star = nullptr;
+    const char* star_name = nullptr;
+
+    while ('\0' != *name)
+    {
+        if ('*' == *pattern)
+        {
+            star = pattern++;
+            star_name = name;
+        }
+        else if ('?' == *pattern || *pattern == *name)
+        {
+            ++pattern;
+            ++name;
+        }
+        else if (nullptr != star)
+        {
+            pattern = star + 1;
+            name = ++star_name;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    while ('*' == *pattern)
+    {
+        ++pattern;
+    }
+
+    return '\0' == *pattern;
+}
+
+bool is_string_comparison(
+        PartitionMatcher::Kind kind)
+{
+    return PartitionMatcher::Kind::LITERAL == kind || PartitionMatcher::Kind::PREFIX == kind;
+}
+
+bool has_empty_name(
+        const fastdds::dds::PartitionQosPolicy& partitions)
+{
+    for (auto it = partitions.begin(); it != partitions.end(); ++it)
+    {
+        if (it->size() == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+PartitionMatcher::PartitionMatcher(
+        const char* expression)
+    : expression_(expression)
+{
+    kind_ = expression_kind(expression_);
+}
+
+bool PartitionMatcher::matches_name(
+        const char* name) const
+{
+    switch (kind_)
+    {
+        case Kind::LITERAL:
+            return 0 == expression_.compare(name);
+
+        case Kind::PREFIX:
+            return 0 == strncmp(expression_.c_str(), name, expression_.size() - 1);
+
+        case Kind::WILDCARD:
+            return wildcard_match(expression_.c_str(), name);
+
+        default:
+            return StringMatching::matchPattern(expression_.c_str(), name);
+    }
+}
+
+PartitionMatcherCache::PartitionMatcherCache(
+        size_t max_memoized_pairs,
+        size_t max_compiled_expressions)
+    : max_memoized_pairs_(max_memoized_pairs)
+    , max_compiled_expressions_(max_compiled_expressions)
+{
+}
+
+bool PartitionMatcherCache::match(
+        const fastdds::dds::PartitionQosPolicy& writer_partitions,
+        const fastdds::dds::PartitionQosPolicy& reader_partitions)
+{
+    if (writer_partitions.empty() && reader_partitions.empty())
+    {
+        return true;
+    }
+    if (writer_partitions.empty())
+    {
+        return has_empty_name(reader_partitions);
+    }
+    if (reader_partitions.empty())
+    {
+        return has_empty_name(writer_partitions);
+    }
+
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    // Expressions are only discarded here, as the compiled ones are used until the end of the call.
+    // The memoized results go with them, as their ids will be reused.
+    if (expressions_.size() + writer_partitions.size() + reader_partitions.size() > max_compiled_expressions_)
+    {
+        expressions_.clear();
+        memoized_pairs_.clear();
+    }
+
+    compile(writer_partitions, writer_expressions_);
+    compile(reader_partitions, reader_expressions_);
+
+    for (const CompiledExpression* writer_expression : writer_expressions_)
+    {
+        for (const CompiledExpression* reader_expression : reader_expressions_)
+        {
+            if (match(*writer_expression, *reader_expression))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+size_t PartitionMatcherCache::compiled_expressions()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return expressions_.size();
+}
+
+const PartitionMatcherCache::CompiledExpression* PartitionMatcherCache::compile(
+        const char* expression)
+{
+    auto it = expressions_.find(expression);
+    if (it == expressions_.end())
+    {
+        uint32_t id = static_cast<uint32_t>(expressions_.size());
+        it = expressions_.emplace(std::piecewise_construct, std::forward_as_tuple(expression),
+                        std::forward_as_tuple(expression, id)).first;
+    }
+    return &it->second;
+}
+
+void PartitionMatcherCache::compile(
+        const fastdds::dds::PartitionQosPolicy& partitions,
+        std::vector<const CompiledExpression*>& compiled)
+{
+    compiled.clear();
+    for (auto it = partitions.begin(); it != partitions.end(); ++it)
+    {
+        compiled.push_back(compile(it->name()));
+    }
+}
+
+bool PartitionMatcherCache::match(
+        const CompiledExpression& lhs,
+        const CompiledExpression& rhs)
+{
+    // Literal and prefix comparisons are cheaper than a lookup on the memoized results
+    if (is_string_comparison(lhs.matcher.kind()) && is_string_comparison(rhs.matcher.kind()))
+    {
+        return lhs.matcher.matches(rhs.matcher);
+    }
+
+    // The result is symmetric, so the pair is keyed with the lowest id first
+    uint64_t key = (lhs.id < rhs.id) ?
+            ((static_cast<uint64_t>(lhs.id) << 32) | rhs.id) :
+            ((static_cast<uint64_t>(rhs.id) << 32) | lhs.id);
+
+    auto it = memoized_pairs_.find(key);
+    if (it != memoized_pairs_.end())
+    {
+        return it->second;
+    }
+
+    if (memoized_pairs_.size() >= max_memoized_pairs_)
+    {
+        memoized_pairs_.clear();
+    }
+
+    bool ret = lhs.matcher.matches(rhs.matcher);
+    memoized_pairs_[key] = ret;
+    return ret;
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
@@ -0,0 +1,173 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PartitionMatcher.hpp
+ */
+
+#ifndef UTILS_PARTITIONMATCHER_HPP_
+#define UTILS_PARTITIONMATCHER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fastdds/dds/core/policy/QosPolicies.hpp>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Partition expression compiled for repeated matching.
+ * It gives the same results as StringMatching, which is only used for expressions with bracket expressions
+ * (and for every expression on Windows).
+ */
+class PartitionMatcher
+{
+public:
+
+    enum class Kind : uint8_t
+    {
+        //! No wildcards. Matched with a string comparison.
+        LITERAL,
+        //! A literal followed by a single trailing '*'. Matched with a prefix comparison.
+        PREFIX,
+        //! Only '*' and '?' wildcards. Matched with a wildcard scan that only retries the last '*'.
+        WILDCARD,
+        //! Any other pattern. Matched with StringMatching.
+        GLOB
+    };
+
+    explicit PartitionMatcher(
+            const char* expression);
+
+    Kind kind() const
+    {
+        return kind_;
+    }
+
+    const std::string& expression() const
+    {
+        return expression_;
+    }
+
+    /**
+     * Check whether a name matches this expression, as StringMatching::matchPattern would do.
+     * @param name Name to check.
+     * @return true when the name matches the expression.
+     */
+    bool matches_name(
+            const char* name) const;
+
+    /**
+     * Check whether two expressions match each other, as StringMatching::matchString would do.
+     * @param other Expression to check against.
+     * @return true when any of the expressions matches the other one.
+     */
+    bool matches(
+            const PartitionMatcher& other) const
+    {
+        return matches_name(other.expression_.c_str()) || other.matches_name(expression_.c_str());
+    }
+
+private:
+
+    Kind kind_;
+    std::string expression_;
+};
+
+/**
+ * Discovery-wide cache of compiled partition expressions.
+ * Every expression is compiled once, and the results of the expensive pairs of expressions are memoized.
+ * Both collections are bounded, so names that keep changing do not make the cache grow forever.
+ */
+class PartitionMatcherCache
+{
+public:
+
+    /**
+     * @param max_memoized_pairs Number of pair results after which the memoized results are discarded.
+     * @param max_compiled_expressions Number of expressions after which the compiled expressions are discarded.
+     */
+    explicit PartitionMatcherCache(
+            size_t max_memoized_pairs = 4096,
+            size_t max_compiled_expressions = 4096);
+
+    /**
+     * Check whether the Partition QoS of a writer and a reader are compatible.
+     * Empty sets are compatible with each other and with sets containing an empty name.
+     * @param writer_partitions Partition QoS of the writer.
+     * @param reader_partitions Partition QoS of the reader.
+     * @return true when the two sets are compatible.
+     */
+    bool match(
+            const fastdds::dds::PartitionQosPolicy& writer_partitions,
+            const fastdds::dds::PartitionQosPolicy& reader_partitions);
+
+    //! Number of different expressions compiled so far.
+    size_t compiled_expressions();
+
+private:
+
+    struct CompiledExpression
+    {
+        CompiledExpression(
+                const char* expression,
+                uint32_t expression_id)
+            : matcher(expression)
+            , id(expression_id)
+        {
+        }
+
+        PartitionMatcher matcher;
+        uint32_t id;
+    };
+
+    const CompiledExpression* compile(
+            const char* expression);
+
+    void compile(
+            const fastdds::dds::PartitionQosPolicy& partitions,
+            std::vector<const CompiledExpression*>& compiled);
+
+    bool match(
+            const CompiledExpression& lhs,
+            const CompiledExpression& rhs);
+
+    std::mutex mutex_;
+
+    size_t max_memoized_pairs_;
+
+    size_t max_compiled_expressions_;
+
+    //! Compiled expressions, keyed by their text. Their ids are always lower than its size.
+    std::unordered_map<std::string, CompiledExpression> expressions_;
+
+    //! Results of pairs of non-literal expressions, keyed by their ids
+    std::unordered_map<uint64_t, bool> memoized_pairs_;
+
+    std::vector<const CompiledExpression*> writer_expressions_;
+
+    std::vector<const CompiledExpression*> reader_expressions_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif /* UTILS_PARTITIONMATCHER_HPP_ */
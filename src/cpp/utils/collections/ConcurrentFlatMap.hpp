@@ -0,0 +1,251 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ConcurrentFlatMap.hpp
+ *
+ */
+
+#ifndef FASTRTPS_UTILS_COLLECTIONS_CONCURRENTFLATMAP_HPP_
+#define FASTRTPS_UTILS_COLLECTIONS_CONCURRENTFLATMAP_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+
+namespace eprosima {
+namespace fastrtps {
+
+/**
+ * Insert-only flat hash table that can be looked up and extended concurrently without locks.
+ *
+ * This template class holds its elements on a single contiguous array allocated on construction, using open
+ * addressing with linear probing. Elements are never removed nor moved, so pointers to values remain valid for the
+ * whole life of the table. Values are default constructed when their key is inserted, and it is up to the caller to
+ * synchronize the accesses to them, usually by using atomic members.
+ *
+ * @tparam _Key    Key type. Should be default constructible, copyable and equality comparable.
+ * @tparam _Value  Value type. Should be default constructible.
+ * @tparam _Hash   Hash function for the keys, defaults to std::hash<_Key>.
+ *
+ * @ingroup UTILITIES_MODULE
+ */
+template <
+    typename _Key,
+    typename _Value,
+    typename _Hash = std::hash<_Key>>
+class ConcurrentFlatMap
+{
+public:
+
+    using key_type = _Key;
+    using mapped_type = _Value;
+    using hasher = _Hash;
+    using size_type = std::size_t;
+
+    /**
+     * Construct a ConcurrentFlatMap.
+     *
+     * @param max_size  Maximum number of elements the table can hold.
+     */
+    explicit ConcurrentFlatMap(
+            size_type max_size)
+        : max_size_(max_size)
+        , capacity_(16)
+    {
+        while (capacity_ < 2 * max_size)
+        {
+            capacity_ <<= 1;
+        }
+        slots_.reset(new Slot[capacity_]);
+    }
+
+    ConcurrentFlatMap(
+            const ConcurrentFlatMap&) = delete;
+
+    ConcurrentFlatMap& operator =(
+            const ConcurrentFlatMap&) = delete;
+
+    /**
+     * Look for a key in the table, adding it if not present.
+     *
+     * @param key  The key to look for.
+     *
+     * @return Pointer to the value associated to the key, or nullptr if the key is not in the table and the table
+     *         is full.
+     */
+    mapped_type* find_or_insert(
+            const key_type& key)
+    {
+        size_type mask = capacity_ - 1;
+        size_type pos = hasher()(key) & mask;
+        for (size_type probes = 0; probes < capacity_; ++probes, pos = (pos + 1) & mask)
+        {
+            Slot& slot = slots_[pos];
+            uint8_t state = slot.state.load(std::memory_order_acquire);
+
+            if (EMPTY == state)
+            {
+                if (!reserve())
+                {
+                    return find_ready(key, pos, probes);
+                }
+
+                if (slot.state.compare_exchange_strong(state, INSERTING, std::memory_order_acquire))
+                {
+                    slot.key = key;
+                    slot.state.store(READY, std::memory_order_release);
+                    return &slot.value;
+                }
+
+                // Other thread took the slot
+                size_.fetch_sub(1, std::memory_order_relaxed);
+            }
+
+            state = wait_ready(slot, state);
+            if (slot.key == key)
+            {
+                return &slot.value;
+            }
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * Look for a key in the table.
+     *
+     * @param key  The key to look for.
+     *
+     * @return Pointer to the value associated to the key, or nullptr if the key is not in the table.
+     */
+    mapped_type* find(
+            const key_type& key)
+    {
+        size_type pos = hasher()(key) & (capacity_ - 1);
+        return find_ready(key, pos, 0);
+    }
+
+    /**
+     * Call a functor on every element of the table.
+     * Elements inserted while traversing the table may be skipped.
+     *
+     * @param f  Functor called with the key and a reference to the value of each element.
+     */
+    template<class Function>
+    void for_each(
+            Function f)
+    {
+        for (size_type pos = 0; pos < capacity_; ++pos)
+        {
+            Slot& slot = slots_[pos];
+            if (READY == slot.state.load(std::memory_order_acquire))
+            {
+                f(static_cast<const key_type&>(slot.key), slot.value);
+            }
+        }
+    }
+
+    size_type size() const
+    {
+        return size_.load(std::memory_order_relaxed);
+    }
+
+    size_type max_size() const
+    {
+        return max_size_;
+    }
+
+private:
+
+    enum SlotState : uint8_t
+    {
+        EMPTY,
+        INSERTING,
+        READY
+    };
+
+    struct Slot
+    {
+        std::atomic<uint8_t> state{EMPTY};
+        key_type key{};
+        mapped_type value{};
+    };
+
+    //! Count a new element, if there is room for it.
+    bool reserve()
+    {
+        if (size_.fetch_add(1, std::memory_order_relaxed) < max_size_)
+        {
+            return true;
+        }
+
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    //! Wait until the key of a slot being inserted is written.
+    uint8_t wait_ready(
+            Slot& slot,
+            uint8_t state)
+    {
+        while (READY != state)
+        {
+            std::this_thread::yield();
+            state = slot.state.load(std::memory_order_acquire);
+        }
+        return state;
+    }
+
+    mapped_type* find_ready(
+            const key_type& key,
+            size_type pos,
+            size_type probes)
+    {
+        size_type mask = capacity_ - 1;
+        for (; probes < capacity_; ++probes, pos = (pos + 1) & mask)
+        {
+            Slot& slot = slots_[pos];
+            uint8_t state = slot.state.load(std::memory_order_acquire);
+            if (EMPTY == state)
+            {
+                return nullptr;
+            }
+
+            wait_ready(slot, state);
+            if (slot.key == key)
+            {
+                return &slot.value;
+            }
+        }
+
+        return nullptr;
+    }
+
+    size_type max_size_;
+
+    size_type capacity_;
+
+    std::atomic<size_type> size_{0};
+
+    std::unique_ptr<Slot[]> slots_;
+};
+
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif /* FASTRTPS_UTILS_COLLECTIONS_CONCURRENTFLATMAP_HPP_ */
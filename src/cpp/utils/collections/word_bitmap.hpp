@@ -0,0 +1,108 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file word_bitmap.hpp
+ */
+
+#ifndef SRC_CPP_UTILS_COLLECTIONS_WORD_BITMAP_HPP_
+#define SRC_CPP_UTILS_COLLECTIONS_WORD_BITMAP_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if _MSC_VER
+#include <intrin.h>
+#endif // if _MSC_VER
+
+namespace eprosima {
+namespace utilities {
+namespace collections {
+
+/*
+ * Helpers for bitmaps stored on a vector of 32-bit words.
+ * They follow the layout of the RTPS bitmaps (see BitmapRange), with the first position of each word on its most
+ * significant bit.
+ */
+
+inline uint32_t bit_mask(
+        size_t index)
+{
+    return 0x80000000u >> (index & 31u);
+}
+
+//! Offset from the most significant bit of the first bit set. bits should not be 0.
+inline uint32_t first_bit_set(
+        uint32_t bits)
+{
+#if _MSC_VER
+    unsigned long bit;
+    _BitScanReverse(&bit, bits);
+    return 31u ^ bit;
+#else
+    return static_cast<uint32_t>(__builtin_clz(bits));
+#endif // if _MSC_VER
+}
+
+//! Offset from the most significant bit of the last bit set. bits should not be 0.
+inline uint32_t last_bit_set(
+        uint32_t bits)
+{
+#if _MSC_VER
+    unsigned long bit;
+    _BitScanForward(&bit, bits);
+    return 31u ^ bit;
+#else
+    return 31u ^ static_cast<uint32_t>(__builtin_ctz(bits));
+#endif // if _MSC_VER
+}
+
+inline uint32_t count_bits(
+        uint32_t bits)
+{
+    bits = bits - ((bits >> 1) & 0x55555555u);
+    bits = (bits & 0x33333333u) + ((bits >> 2) & 0x33333333u);
+    return (((bits + (bits >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24;
+}
+
+//! 32 bits of a bitmap starting at any position. Positions outside the bitmap read as 0.
+inline uint32_t bits_at(
+        const std::vector<uint32_t>& bitmap,
+        int64_t position)
+{
+    if (position < 0)
+    {
+        return (position <= -32) ? 0u : bits_at(bitmap, 0) >> static_cast<uint32_t>(-position);
+    }
+
+    size_t word = static_cast<size_t>(position / 32);
+    uint32_t shift = static_cast<uint32_t>(position % 32);
+    uint32_t bits = 0;
+    if (word < bitmap.size())
+    {
+        bits = bitmap[word] << shift;
+        if (0u != shift && word + 1 < bitmap.size())
+        {
+            bits |= bitmap[word + 1] >> (32u - shift);
+        }
+    }
+    return bits;
+}
+
+} // namespace collections
+} // namespace utilities
+} // namespace eprosima
+
+#endif /* SRC_CPP_UTILS_COLLECTIONS_WORD_BITMAP_HPP_ */
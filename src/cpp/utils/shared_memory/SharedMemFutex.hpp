@@ -0,0 +1,124 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTDDS_SHAREDMEM_FUTEX_H_
+#define _FASTDDS_SHAREDMEM_FUTEX_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#ifdef __linux__
+#include <cerrno>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // ifdef __linux__
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif // if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Wait / wake operations on a 32 bits word placed in shared-memory.
+ * Futexes are not private to the process, so the word can be shared with other processes mapping the same segment.
+ * Only Linux supports them, on other platforms is_supported() returns false and the operations do nothing.
+ */
+class SharedMemFutex
+{
+public:
+
+    static constexpr bool is_supported()
+    {
+#ifdef __linux__
+        return true;
+#else
+        return false;
+#endif // ifdef __linux__
+    }
+
+    /**
+     * Block the calling thread while the word holds the expected value.
+     * It may return spuriously, so the caller should check its condition again.
+     * @param word Futex word.
+     * @param expected Value read from the word after which the caller decided to block.
+     * @param timeout Maximum time to block.
+     * @return false if the timeout expired, true otherwise.
+     */
+    static bool wait(
+            std::atomic<uint32_t>* word,
+            uint32_t expected,
+            std::chrono::milliseconds timeout)
+    {
+#ifdef __linux__
+        struct timespec ts;
+        ts.tv_sec = static_cast<time_t>(timeout.count() / 1000);
+        ts.tv_nsec = static_cast<long>((timeout.count() % 1000) * 1000000);
+
+        if (syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAIT, expected, &ts, nullptr, 0) != 0)
+        {
+            return errno != ETIMEDOUT;
+        }
+        return true;
+#else
+        (void)word;
+        (void)expected;
+        (void)timeout;
+        return true;
+#endif // ifdef __linux__
+    }
+
+    /**
+     * Wake up threads blocked on the word.
+     * @param word Futex word.
+     * @param count Maximum number of threads to wake up.
+     */
+    static void wake(
+            std::atomic<uint32_t>* word,
+            int count)
+    {
+#ifdef __linux__
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAKE, count, nullptr, nullptr, 0);
+#else
+        (void)word;
+        (void)count;
+#endif // ifdef __linux__
+    }
+
+    //! Hint the CPU that the calling thread is busy-waiting.
+    static inline void cpu_relax()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        asm volatile ("yield");
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        _mm_pause();
+#else
+        std::this_thread::yield();
+#endif // if defined(__x86_64__) || defined(__i386__)
+    }
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_SHAREDMEM_FUTEX_H_
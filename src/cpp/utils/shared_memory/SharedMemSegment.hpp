@@ -42,6 +42,16 @@
 #include "RobustInterprocessCondition.hpp"
 #include "SharedMemUUID.hpp"
 
+#include <cstring>
+#include <vector>
+
+#ifdef __linux__
+#include <cerrno>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // ifdef __linux__
+
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
@@ -78,6 +88,29 @@ public:
     static constexpr boost::interprocess::create_only_t create_only = boost::interprocess::create_only_t();
     static constexpr boost::interprocess::open_or_create_t open_or_create = boost::interprocess::open_or_create_t();
 
+    /**
+     * Placement of the memory of a segment. It is applied by the process creating the segment,
+     * and every process opening it gets the same pages.
+     */
+    struct MemoryPolicy
+    {
+        MemoryPolicy()
+            : huge_pages(false)
+            , numa_node(-1)
+            , prefault(false)
+        {
+        }
+
+        //! Ask the kernel to back the segment with transparent huge pages.
+        bool huge_pages;
+
+        //! NUMA node the memory of the segment is bound to, -1 to keep the default policy.
+        int32_t numa_node;
+
+        //! Fault in every page of the segment at creation, so the first writes do not pay for it.
+        bool prefault;
+    };
+
     // Boost memory manager needs extra memory to maintain its structures,
     // as these structures are shared they are stored in the segment.
     // TODO(Adolfo): Further analysis to determine the perfect value for this extra segment size
@@ -264,6 +297,89 @@ public:
         return segment_->check_sanity();
     }
 
+    /**
+     * Apply a memory policy to the whole segment.
+     * Failures are only logged, as the segment can be used anyway.
+     * @pre No other process is using the segment yet.
+     */
+    void apply_memory_policy(
+            const MemoryPolicy& policy)
+    {
+        if (!policy.huge_pages && policy.numa_node < 0 && !policy.prefault)
+        {
+            return;
+        }
+
+#ifdef __linux__
+        uintptr_t page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+        uintptr_t address = reinterpret_cast<uintptr_t>(segment_->get_address());
+        uintptr_t begin = (address + page_size - 1) & ~(page_size - 1);
+        uintptr_t end = (address + segment_->get_size()) & ~(page_size - 1);
+        if (end <= begin)
+        {
+            return;
+        }
+
+        void* region = reinterpret_cast<void*>(begin);
+        size_t length = static_cast<size_t>(end - begin);
+
+        if (policy.huge_pages)
+        {
+#ifdef MADV_HUGEPAGE
+            // Only effective when /sys/kernel/mm/transparent_hugepage/shmem_enabled is 'advise' or 'always'
+            if (0 != madvise(region, length, MADV_HUGEPAGE))
+            {
+                logWarning(RTPS_TRANSPORT_SHM, "Segment " << name_ << " cannot use huge pages: " << strerror(errno));
+            }
+#else
+            logWarning(RTPS_TRANSPORT_SHM, "Huge pages are not supported on this platform");
+#endif // ifdef MADV_HUGEPAGE
+        }
+
+        if (policy.numa_node >= 0)
+        {
+#ifdef SYS_mbind
+            constexpr int mpol_bind = 2;
+            constexpr unsigned long mpol_mf_move = 1UL << 1;
+            constexpr size_t bits_per_word = sizeof(unsigned long) * 8;
+
+            size_t node = static_cast<size_t>(policy.numa_node);
+            std::vector<unsigned long> node_mask(node / bits_per_word + 1, 0UL);
+            node_mask[node / bits_per_word] = 1UL << (node % bits_per_word);
+
+            // Pages already in use by the segment structures are moved to the node
+            if (0 != syscall(SYS_mbind, region, length, mpol_bind, node_mask.data(),
+                    node_mask.size() * bits_per_word + 1, mpol_mf_move))
+            {
+                logWarning(RTPS_TRANSPORT_SHM, "Segment " << name_ << " cannot be bound to NUMA node "
+                                                          << policy.numa_node << ": " << strerror(errno));
+            }
+#else
+            logWarning(RTPS_TRANSPORT_SHM, "NUMA binding is not supported on this platform");
+#endif // ifdef SYS_mbind
+        }
+
+        if (policy.prefault)
+        {
+            bool populated = false;
+#ifdef MADV_POPULATE_WRITE
+            populated = (0 == madvise(region, length, MADV_POPULATE_WRITE));
+#endif // ifdef MADV_POPULATE_WRITE
+            if (!populated)
+            {
+                // Writing back each page first byte keeps the allocator structures intact
+                for (uintptr_t page = begin; page < end; page += page_size)
+                {
+                    volatile char* byte = reinterpret_cast<volatile char*>(page);
+                    *byte = *byte;
+                }
+            }
+        }
+#else
+        logWarning(RTPS_TRANSPORT_SHM, "Segment memory policies are only supported on Linux");
+#endif // ifdef __linux__
+    }
+
     /**
      * @return The segment's size in bytes, including internal structures overhead.
      */
@@ -554,6 +554,27 @@ public:
         return *this;
     }
 
+    PubSubParticipant& pub_asynchronously(
+            const eprosima::fastrtps::PublishModeQosPolicyKind kind)
+    {
+        datawriter_qos_.publish_mode().kind = kind;
+        return *this;
+    }
+
+    PubSubParticipant& pub_asynchronous_priority(
+            int32_t priority)
+    {
+        datawriter_qos_.publish_mode().priority = priority;
+        return *this;
+    }
+
+    PubSubParticipant& pub_entity_id(
+            uint8_t entity_id)
+    {
+        datawriter_qos_.endpoint().entity_id = entity_id;
+        return *this;
+    }
+
     PubSubParticipant& pub_liveliness_kind(
             const eprosima::fastdds::dds::LivelinessQosPolicyKind kind)
     {
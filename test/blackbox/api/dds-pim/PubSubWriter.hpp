@@ -831,6 +831,13 @@ public:
         return *this;
     }
 
+    PubSubWriter& asynchronous_priority(
+            int32_t priority)
+    {
+        datawriter_qos_.publish_mode().priority = priority;
+        return *this;
+    }
+
     PubSubWriter& history_kind(
             const eprosima::fastrtps::HistoryQosPolicyKind kind)
     {
@@ -465,6 +465,27 @@ public:
         return *this;
     }
 
+    PubSubParticipant& pub_asynchronously(
+            const eprosima::fastrtps::PublishModeQosPolicyKind kind)
+    {
+        publisher_attr_.qos.m_publishMode.kind = kind;
+        return *this;
+    }
+
+    PubSubParticipant& pub_asynchronous_priority(
+            int32_t priority)
+    {
+        publisher_attr_.qos.m_publishMode.priority = priority;
+        return *this;
+    }
+
+    PubSubParticipant& pub_entity_id(
+            uint8_t entity_id)
+    {
+        publisher_attr_.setEntityID(entity_id);
+        return *this;
+    }
+
     PubSubParticipant& pub_liveliness_kind(
             const LivelinessQosPolicyKind kind)
     {
@@ -433,7 +433,8 @@ public:
     }
 
     void wait_discovery(
-            std::chrono::seconds timeout = std::chrono::seconds::zero())
+            std::chrono::seconds timeout = std::chrono::seconds::zero(),
+            unsigned int min_writers = 1)
     {
         std::unique_lock<std::mutex> lock(mutexDiscovery_);
 
@@ -443,14 +444,14 @@ public:
         {
             cvDiscovery_.wait(lock, [&]()
                     {
-                        return matched_ != 0;
+                        return matched_ >= min_writers;
                     });
         }
         else
         {
             cvDiscovery_.wait_for(lock, timeout, [&]()
                     {
-                        return matched_ != 0;
+                        return matched_ >= min_writers;
                     });
         }
 
@@ -698,6 +698,13 @@ public:
         return *this;
     }
 
+    PubSubWriter& asynchronous_priority(
+            int32_t priority)
+    {
+        publisher_attr_.qos.m_publishMode.priority = priority;
+        return *this;
+    }
+
     PubSubWriter& history_kind(
             const eprosima::fastrtps::HistoryQosPolicyKind kind)
     {
@@ -20,10 +20,17 @@
 #include "ReqRepAsReliableHelloWorldRequester.hpp"
 #include "ReqRepAsReliableHelloWorldReplier.hpp"
 #include <fastrtps/xmlparser/XMLProfileManager.h>
+#include <fastrtps/transport/test_UDPv4TransportDescriptor.h>
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
@@ -208,6 +215,130 @@ TEST_P(PubSubBasic, AsyncPubSubAsReliableHelloworld)
     reader.block_for_all();
 }
 
+TEST_P(PubSubBasic, AsyncPubSubAsReliableHelloworldSeveralSendingThreads)
+{
+    // The sending threads are observed on the transport
+    if (TRANSPORT != std::get<0>(GetParam()) || use_pull_mode)
+    {
+        return;
+    }
+
+    // Writers are assigned to the sending threads by their entity id, so with two threads the writers with even keys
+    // share one of them
+    const uint8_t busy_key = 2;
+    const uint8_t low_priority_key = 4;
+    const uint8_t high_priority_key = 6;
+    const uint8_t other_thread_key = 3;
+
+    // Record the thread sending the first DATA of each user writer, in sending order
+    using SentData = std::pair<uint8_t, std::thread::id>;
+    std::mutex sent_mutex;
+    std::condition_variable sent_cv;
+    std::vector<SentData> sent;
+    bool released = false;
+    auto testTransport = std::make_shared<test_UDPv4TransportDescriptor>();
+    testTransport->drop_data_messages_filter_ = [&](CDRMessage_t& msg)
+            {
+                uint32_t old_pos = msg.pos;
+                EntityId_t writer_id;
+                msg.pos += 8;
+                CDRMessage::readEntityId(&msg, &writer_id);
+                msg.pos = old_pos;
+
+                if (0xC0 != (writer_id.value[3] & 0xC0))
+                {
+                    uint8_t key = writer_id.value[2];
+                    std::unique_lock<std::mutex> lock(sent_mutex);
+                    if (std::none_of(sent.begin(), sent.end(), [key](const SentData& data)
+                            {
+                                return data.first == key;
+                            }))
+                    {
+                        sent.emplace_back(key, std::this_thread::get_id());
+                        sent_cv.notify_all();
+                    }
+
+                    // Keep the thread busy until the writers sharing it have queued their samples
+                    if (busy_key == key)
+                    {
+                        sent_cv.wait_for(lock, std::chrono::seconds(5), [&released]()
+                                {
+                                    return released;
+                                });
+                    }
+                }
+                return false;
+            };
+
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubParticipant<HelloWorldType> writers(4u, 0u, 4u, 0u);
+
+    reader.history_depth(10).
+            reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    PropertyPolicy properties;
+    properties.properties().emplace_back("fastdds.async_writer_threads", "2");
+
+    ASSERT_TRUE(writers.property_policy(properties).disable_builtin_transport().
+                    add_user_transport_to_pparams(testTransport).init_participant());
+    writers.pub_topic_name(TEST_TOPIC_NAME).reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).
+            pub_asynchronously(eprosima::fastrtps::ASYNCHRONOUS_PUBLISH_MODE);
+    ASSERT_TRUE(writers.pub_entity_id(busy_key).init_publisher(0));
+    ASSERT_TRUE(writers.pub_entity_id(low_priority_key).init_publisher(1));
+    ASSERT_TRUE(writers.pub_entity_id(high_priority_key).pub_asynchronous_priority(10).init_publisher(2));
+    ASSERT_TRUE(writers.pub_entity_id(other_thread_key).pub_asynchronous_priority(0).init_publisher(3));
+
+    // Wait for discovery.
+    writers.pub_wait_discovery();
+    reader.wait_discovery(std::chrono::seconds::zero(), 4);
+
+    auto data = default_helloworld_data_generator(4);
+    std::vector<HelloWorld> samples(data.begin(), data.end());
+    reader.startReception(data);
+
+    // The first writer keeps its thread busy while the other two writers on it queue their samples
+    ASSERT_TRUE(writers.send_sample(samples[0], 0));
+    {
+        std::unique_lock<std::mutex> lock(sent_mutex);
+        ASSERT_TRUE(sent_cv.wait_for(lock, std::chrono::seconds(5), [&sent]()
+                {
+                    return !sent.empty();
+                }));
+    }
+    ASSERT_TRUE(writers.send_sample(samples[1], 1));
+    ASSERT_TRUE(writers.send_sample(samples[2], 2));
+    {
+        std::lock_guard<std::mutex> guard(sent_mutex);
+        released = true;
+        sent_cv.notify_all();
+    }
+    ASSERT_TRUE(writers.send_sample(samples[3], 3));
+
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+
+    std::lock_guard<std::mutex> guard(sent_mutex);
+    ASSERT_EQ(4u, sent.size());
+    auto sent_data = [&sent](uint8_t key)
+            {
+                return std::find_if(sent.begin(), sent.end(), [key](const SentData& data)
+                               {
+                                   return data.first == key;
+                               });
+            };
+    ASSERT_EQ(busy_key, sent.front().first);
+
+    // Samples queued on a busy thread are sent in priority order
+    EXPECT_LT(sent_data(high_priority_key), sent_data(low_priority_key));
+
+    // Writers are spread among the sending threads
+    EXPECT_EQ(sent_data(busy_key)->second, sent_data(low_priority_key)->second);
+    EXPECT_EQ(sent_data(busy_key)->second, sent_data(high_priority_key)->second);
+    EXPECT_NE(sent_data(busy_key)->second, sent_data(other_thread_key)->second);
+}
+
 TEST_P(PubSubBasic, ReqRepAsReliableHelloworld)
 {
     ReqRepAsReliableHelloWorldRequester requester;
@@ -180,6 +180,61 @@ TEST(SHM, Test300KNoFragmentation)
     reader.wait_participant_undiscovery();
 }
 
+TEST(SHM, Test300KZeroCopy)
+{
+    PubSubReader<Data1mbType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<Data1mbType> writer(TEST_TOPIC_NAME);
+
+    auto data = default_data300kb_data_generator(5);
+    auto data_size = data.front().data().size();
+
+    auto shm_transport = std::make_shared<test_SharedMemTransportDescriptor>();
+    const uint32_t segment_size = 4 * 1024 * 1024;
+    shm_transport->segment_size(segment_size);
+    shm_transport->max_message_size(1024 * 1024);
+    // Samples are built directly on the segment
+    shm_transport->zero_copy_min_size(64 * 1024);
+
+    uint32_t big_buffers_send_count = 0;
+    uint32_t big_buffers_recv_count = 0;
+    shm_transport->big_buffer_size_ = static_cast<uint32_t>(data_size);
+    shm_transport->big_buffer_size_send_count_ = &big_buffers_send_count;
+    shm_transport->big_buffer_size_recv_count_ = &big_buffers_recv_count;
+
+    writer
+            .asynchronously(eprosima::fastrtps::SYNCHRONOUS_PUBLISH_MODE)
+            .reliability(eprosima::fastrtps::BEST_EFFORT_RELIABILITY_QOS)
+            .disable_builtin_transport()
+            .add_user_transport_to_pparams(shm_transport)
+            .init();
+
+    reader
+            .reliability(eprosima::fastrtps::BEST_EFFORT_RELIABILITY_QOS)
+            .history_depth(5)
+            .disable_builtin_transport()
+            .add_user_transport_to_pparams(shm_transport)
+            .init();
+
+    ASSERT_TRUE(reader.isInitialized());
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    reader.startReception(data);
+    // Send data with some interval, to let the reader process each sample
+    writer.send(data, 50);
+
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+
+    EXPECT_EQ(big_buffers_send_count, 5u);
+    EXPECT_EQ(big_buffers_recv_count, 5u);
+}
+
 TEST(SHM, SHM_UDP_300KFragmentation)
 {
     PubSubReader<Data1mbType> reader(TEST_TOPIC_NAME);
@@ -489,3 +489,44 @@ TEST(DDSDataSharing, DataSharingPoolError)
     ASSERT_TRUE(data.empty());
     reader.block_for_all();
 }
+
+
+TEST(DDSDataSharing, DispatcherThreads)
+{
+    PubSubReader<FixedSizedType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<FixedSizedType> writer(TEST_TOPIC_NAME);
+
+    // Disable transports to ensure we are using datasharing
+    auto testTransport = std::make_shared<test_UDPv4TransportDescriptor>();
+    testTransport->dropDataMessagesPercentage = 100;
+
+    // The reader is listened by a dispatcher thread of its participant
+    PropertyPolicy properties;
+    properties.properties().emplace_back("fastdds.datasharing.dispatcher_threads", "1");
+
+    reader.history_depth(100)
+            .add_user_transport_to_pparams(testTransport)
+            .property_policy(properties)
+            .datasharing_on("Unused. change when ready")
+            .reliability(RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.history_depth(100)
+            .add_user_transport_to_pparams(testTransport)
+            .datasharing_on("Unused. change when ready")
+            .reliability(RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_fixed_sized_data_generator();
+
+    reader.startReception(data);
+
+    writer.send(data);
+    ASSERT_TRUE(data.empty());
+    reader.block_for_all();
+}
@@ -167,6 +167,7 @@ TEST(DDSStatistics, simple_statistics_datareaders)
         {"DATA_COUNT_TOPIC",                statistics::DATA_COUNT_TOPIC,               num_samples},
         {"RTPS_SENT_TOPIC",                 statistics::RTPS_SENT_TOPIC,                num_samples},
         {"NETWORK_LATENCY_TOPIC",           statistics::NETWORK_LATENCY_TOPIC,          num_samples},
+        {"NETWORK_LATENCY_SUMMARY_TOPIC",   statistics::NETWORK_LATENCY_SUMMARY_TOPIC,  1},
         {"PUBLICATION_THROUGHPUT_TOPIC",    statistics::PUBLICATION_THROUGHPUT_TOPIC,   num_samples},
         {"HEARTBEAT_COUNT_TOPIC",           statistics::HEARTBEAT_COUNT_TOPIC,          num_samples},
         {"SAMPLE_DATAS_TOPIC",              statistics::SAMPLE_DATAS_TOPIC,             num_samples},
@@ -178,6 +179,7 @@ TEST(DDSStatistics, simple_statistics_datareaders)
 
     std::vector<std::tuple<std::string, std::string, std::size_t>> reader_statistics_kinds = {
         {"HISTORY_LATENCY_TOPIC",           statistics::HISTORY_LATENCY_TOPIC,          num_samples},
+        {"HISTORY_LATENCY_SUMMARY_TOPIC",   statistics::HISTORY_LATENCY_SUMMARY_TOPIC,  1},
         {"SUBSCRIPTION_THROUGHPUT_TOPIC",   statistics::SUBSCRIPTION_THROUGHPUT_TOPIC,  num_samples},
         {"ACKNACK_COUNT_TOPIC",             statistics::ACKNACK_COUNT_TOPIC,            1},
         // {"PHYSICAL_DATA_TOPIC",             statistics::PHYSICAL_DATA_TOPIC,            1}
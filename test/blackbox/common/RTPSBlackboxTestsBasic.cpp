@@ -24,6 +24,9 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <mutex>
+#include <set>
 #include <thread>
 
 using namespace eprosima::fastrtps;
@@ -463,6 +466,150 @@ TEST_P(RTPS, RTPSAsReliableWithRegistrationAndHolesInHistory)
 }
 
 
+/**
+ * Only lets through the changes with an even sequence number, and counts its evaluations.
+ */
+class EvenSequenceNumberFilter : public eprosima::fastdds::rtps::IReaderDataFilter
+{
+public:
+
+    bool is_relevant(
+            const CacheChange_t& change,
+            const GUID_t& /*reader_guid*/) const override
+    {
+        ++evaluations;
+        return 0 == (change.sequenceNumber.low % 2);
+    }
+
+    mutable std::atomic<uint32_t> evaluations{0};
+};
+
+static std::list<HelloWorld> even_helloworld_data(
+        const std::list<HelloWorld>& data)
+{
+    std::list<HelloWorld> even_data;
+    for (const HelloWorld& sample : data)
+    {
+        if (0 == (sample.index() % 2))
+        {
+            even_data.push_back(sample);
+        }
+    }
+    return even_data;
+}
+
+TEST_P(RTPS, RTPSAsReliableWithRegistrationAndReaderDataFilter)
+{
+    RTPSWithRegistrationReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    RTPSWithRegistrationWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+    EvenSequenceNumberFilter filter;
+
+    // Record the GAPs sent by user writers
+    std::mutex gaps_mutex;
+    std::set<SequenceNumber_t> gaps;
+    auto testTransport = std::make_shared<rtps::test_UDPv4TransportDescriptor>();
+    testTransport->drop_gap_messages_filter_ = [&gaps_mutex, &gaps](rtps::CDRMessage_t& msg)
+            {
+                uint32_t old_pos = msg.pos;
+                EntityId_t writer_id;
+                SequenceNumber_t gap_start;
+                msg.pos += 4;
+                CDRMessage::readEntityId(&msg, &writer_id);
+                CDRMessage::readInt32(&msg, &gap_start.high);
+                CDRMessage::readUInt32(&msg, &gap_start.low);
+                msg.pos = old_pos;
+
+                if (0xC0 != (writer_id.value[3] & 0xC0))
+                {
+                    std::lock_guard<std::mutex> guard(gaps_mutex);
+                    gaps.insert(gap_start);
+                }
+                return false;
+            };
+
+    reader.reliability(eprosima::fastrtps::rtps::ReliabilityKind_t::RELIABLE).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.reliability(eprosima::fastrtps::rtps::ReliabilityKind_t::RELIABLE).
+            reader_data_filter(&filter).
+            disable_builtin_transport().
+            add_user_transport_to_pparams(testTransport).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+    size_t num_samples = data.size();
+
+    reader.expected_data(even_helloworld_data(data));
+    reader.startReception();
+
+    // Send data
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+
+    // The reader is told about the filtered changes, so it acknowledges all of them
+    EXPECT_TRUE(writer.waitForAllAcked(std::chrono::seconds(10)));
+
+    // The filter is evaluated once for each change
+    EXPECT_EQ(num_samples, filter.evaluations.load());
+
+    // Each filtered change is announced with a GAP
+    if (TRANSPORT == GetParam())
+    {
+        std::lock_guard<std::mutex> guard(gaps_mutex);
+        for (uint32_t seq = 1; seq < num_samples; seq += 2)
+        {
+            EXPECT_EQ(1u, gaps.count(SequenceNumber_t(0, seq))) << "No GAP for filtered change " << seq;
+        }
+    }
+}
+
+TEST_P(RTPS, RTPSAsNonReliableWithRegistrationAndReaderDataFilter)
+{
+    RTPSWithRegistrationReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    RTPSWithRegistrationWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+    EvenSequenceNumberFilter filter;
+
+    reader.reliability(eprosima::fastrtps::rtps::ReliabilityKind_t::BEST_EFFORT).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    // A best effort writer is stateless
+    writer.reliability(eprosima::fastrtps::rtps::ReliabilityKind_t::BEST_EFFORT).
+            reader_data_filter(&filter).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+    size_t num_samples = data.size();
+
+    // Receiving a filtered sample fails the test
+    reader.expected_data(even_helloworld_data(data));
+    reader.startReception();
+
+    // Send data
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+
+    // The filter is evaluated once for each change
+    EXPECT_EQ(num_samples, filter.evaluations.load());
+}
+
 TEST_P(RTPS, RTPSAsReliableVolatileTwoWritersConsecutives)
 {
     RTPSWithRegistrationReader<HelloWorldType> reader(TEST_TOPIC_NAME);
@@ -159,6 +159,8 @@ public:
             return;
         }
 
+        writer_->reader_data_filter(reader_data_filter_);
+
         ASSERT_EQ(participant_->registerWriter(writer_, topic_attr_, writer_qos_), true);
 
         initialized_ = true;
@@ -387,6 +389,13 @@ public:
         return *this;
     }
 
+    RTPSWithRegistrationWriter& reader_data_filter(
+            eprosima::fastdds::rtps::IReaderDataFilter* filter)
+    {
+        reader_data_filter_ = filter;
+        return *this;
+    }
+
     RTPSWithRegistrationWriter& disable_builtin_transport()
     {
         participant_attr_.useBuiltinTransports = false;
@@ -420,6 +429,7 @@ private:
     type_support type_;
     std::shared_ptr<eprosima::fastrtps::rtps::IPayloadPool> payload_pool_;
     bool has_payload_pool_ = false;
+    eprosima::fastdds::rtps::IReaderDataFilter* reader_data_filter_ = nullptr;
 };
 
 #endif // _TEST_BLACKBOX_RTPSWITHREGISTRATIONWRITER_HPP_
@@ -51,6 +51,7 @@ namespace eprosima {
 namespace fastdds {
 namespace dds {
 
+class ContentFilteredTopic;
 class DomainParticipant;
 class DomainParticipantListener;
 class PublisherListener;
@@ -296,6 +297,25 @@ public:
         return ReturnCode_t::RETCODE_ERROR;
     }
 
+    ContentFilteredTopic* create_contentfilteredtopic(
+            const std::string& /*name*/,
+            const Topic* /*related_topic*/,
+            const std::string& /*filter_expression*/,
+            const std::vector<std::string>& /*expression_parameters*/)
+    {
+        return nullptr;
+    }
+
+    ReturnCode_t delete_contentfilteredtopic(
+            const ContentFilteredTopic* topic)
+    {
+        if (topic == nullptr)
+        {
+            return ReturnCode_t::RETCODE_BAD_PARAMETER;
+        }
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
     TopicDescription* lookup_topicdescription(
             const std::string& topic_name) const
     {
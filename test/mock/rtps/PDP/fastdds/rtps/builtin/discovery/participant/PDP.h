@@ -76,6 +76,12 @@ public:
             const GUID_t& writer,
             WriterProxyData& wdata));
 
+    MOCK_CONST_METHOD1(reader_proxies_on_topic, const std::vector<ReaderProxyData*>& (
+            const string_255& topic_name));
+
+    MOCK_CONST_METHOD1(writer_proxies_on_topic, const std::vector<WriterProxyData*>& (
+            const string_255& topic_name));
+
     MOCK_METHOD0(ParticipantProxiesBegin, ResourceLimitedVector<ParticipantProxyData*>::const_iterator());
 
     MOCK_METHOD0(ParticipantProxiesEnd, ResourceLimitedVector<ParticipantProxyData*>::const_iterator());
@@ -31,6 +31,13 @@
 namespace eprosima {
 
 namespace fastdds {
+
+namespace rtps {
+
+struct ContentFilterProperty;
+
+} // namespace rtps
+
 namespace dds {
 namespace builtin {
 
@@ -148,15 +155,17 @@ public:
                 const TopicAttributes& topicAtt,
                 const WriterQos& wqos));
 
-    MOCK_METHOD3(registerReader, bool(
+    MOCK_METHOD4(registerReader, bool(
                 RTPSReader * Reader,
                 const TopicAttributes& topicAtt,
-                const ReaderQos& rqos));
+                const ReaderQos& rqos,
+                const fastdds::rtps::ContentFilterProperty* content_filter));
 
-    MOCK_METHOD3(updateReader, bool(
+    MOCK_METHOD4(updateReader, bool(
                 RTPSReader * Reader,
                 const TopicAttributes& topicAtt,
-                const ReaderQos& rqos));
+                const ReaderQos& rqos,
+                const fastdds::rtps::ContentFilterProperty* content_filter));
 
     const RTPSParticipantAttributes& getRTPSParticipantAttributes()
     {
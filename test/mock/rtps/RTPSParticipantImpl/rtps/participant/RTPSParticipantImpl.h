@@ -32,6 +32,7 @@
 #include <fastrtps/rtps/resources/ResourceEvent.h>
 #include <fastrtps/rtps/network/NetworkFactory.h>
 #include <fastrtps/rtps/resources/AsyncWriterThread.h>
+#include <rtps/resources/ResourceEventPool.hpp>
 
 #if HAVE_SECURITY
 #include <fastrtps/rtps/security/accesscontrol/ParticipantSecurityAttributes.h>
@@ -224,6 +225,12 @@ public:
         return events_;
     }
 
+    ResourceEvent& getEventResource(
+            EventThreadClass)
+    {
+        return events_;
+    }
+
     void set_endpoint_rtps_protection_supports(
             Endpoint* /*endpoint*/,
             bool /*support*/)
@@ -24,6 +24,7 @@
 #include <fastrtps/rtps/Endpoint.h>
 #include <fastrtps/rtps/common/CacheChange.h>
 #include <fastdds/rtps/messages/RTPSMessageGroup.h>
+#include <fastdds/rtps/writer/IReaderDataFilter.hpp>
 
 #include <condition_variable>
 #include <gmock/gmock.h>
@@ -122,6 +123,19 @@ public:
     {
     }
 
+    void begin_coherent_set()
+    {
+    }
+
+    void end_coherent_set()
+    {
+    }
+
+    bool is_coherent_set_open() const
+    {
+        return false;
+    }
+
     virtual bool try_remove_change(
             const std::chrono::steady_clock::time_point&,
             std::unique_lock<RecursiveTimedMutex>&)
@@ -189,6 +203,17 @@ public:
         return writer_guid == m_guid;
     }
 
+    void reader_data_filter(
+            fastdds::rtps::IReaderDataFilter* reader_data_filter)
+    {
+        reader_data_filter_ = reader_data_filter;
+    }
+
+    const fastdds::rtps::IReaderDataFilter* reader_data_filter() const
+    {
+        return reader_data_filter_;
+    }
+
     WriterHistory* history_;
 
     WriterListener* listener_;
@@ -197,6 +222,8 @@ public:
 
     LivelinessLostStatus liveliness_lost_status_;
 
+    fastdds::rtps::IReaderDataFilter* reader_data_filter_ = nullptr;
+
 };
 
 } // namespace rtps
@@ -19,6 +19,7 @@
 #ifndef _FASTDDS_RTPS_BUILTIN_DATA_READERPROXYDATA_H_
 #define _FASTDDS_RTPS_BUILTIN_DATA_READERPROXYDATA_H_
 
+#include <fastdds/rtps/builtin/data/ContentFilterProperty.hpp>
 #include <fastrtps/rtps/common/Guid.h>
 #include <fastrtps/rtps/common/RemoteLocators.hpp>
 #include <fastrtps/qos/ReaderQos.h>
@@ -338,6 +339,22 @@ public:
         return m_userDefinedId;
     }
 
+    void content_filter(
+            const fastdds::rtps::ContentFilterProperty& filter)
+    {
+        content_filter_ = filter;
+    }
+
+    const fastdds::rtps::ContentFilterProperty& content_filter() const
+    {
+        return content_filter_;
+    }
+
+    bool has_content_filter() const
+    {
+        return content_filter_.filter_class_name.size() > 0 && !content_filter_.filter_expression.empty();
+    }
+
 #if HAVE_SECURITY
     security::EndpointSecurityAttributesMask security_attributes_ = 0UL;
     security::PluginEndpointSecurityAttributesMask plugin_security_attributes_ = 0UL;
@@ -360,6 +377,7 @@ private:
     InstanceHandle_t m_key;
     InstanceHandle_t m_RTPSParticipantKey;
     uint16_t m_userDefinedId;
+    fastdds::rtps::ContentFilterProperty content_filter_;
 
 };
 
@@ -20,7 +20,6 @@
 #define _FASTDDS_RTPS_STATEFULWRITER_H_
 
 #include <fastrtps/rtps/writer/RTPSWriter.h>
-#include <fastdds/rtps/writer/IReaderDataFilter.hpp>
 #include <fastrtps/rtps/history/WriterHistory.h>
 
 namespace eprosima {
@@ -28,6 +27,7 @@ namespace fastrtps {
 namespace rtps {
 
 class RTPSParticipantImpl;
+class ResourceEvent;
 class ReaderProxy;
 
 class StatefulWriter : public RTPSWriter
@@ -38,12 +38,14 @@ public:
             RTPSParticipantImpl* participant)
         : participant_(participant)
         , mp_history(new WriterHistory())
+        , event_service_(nullptr)
     {
     }
 
     StatefulWriter()
         : participant_(nullptr)
         , mp_history(new WriterHistory())
+        , event_service_(nullptr)
     {
     }
 
@@ -83,25 +85,24 @@ public:
         return participant_;
     }
 
-    SequenceNumber_t get_seq_num_min()
+    WriterHistory* history()
     {
-        return SequenceNumber_t(0, 0);
+        return mp_history;
     }
 
-    SequenceNumber_t next_sequence_number() const
+    ResourceEvent& event_service()
     {
-        return mp_history->next_sequence_number();
+        return *event_service_;
     }
 
-    void reader_data_filter(
-            fastdds::rtps::IReaderDataFilter* reader_data_filter)
+    SequenceNumber_t get_seq_num_min()
     {
-        reader_data_filter_ = reader_data_filter;
+        return SequenceNumber_t(0, 0);
     }
 
-    const fastdds::rtps::IReaderDataFilter* reader_data_filter() const
+    SequenceNumber_t next_sequence_number() const
     {
-        return reader_data_filter_;
+        return mp_history->next_sequence_number();
     }
 
 private:
@@ -112,7 +113,7 @@ private:
 
     WriterHistory* mp_history;
 
-    fastdds::rtps::IReaderDataFilter* reader_data_filter_;
+    ResourceEvent* event_service_;
 
 };
 
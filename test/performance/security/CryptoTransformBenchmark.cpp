@@ -0,0 +1,346 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file CryptoTransformBenchmark.cpp
+ *
+ * Measures the time taken by the builtin AES-GCM-GMAC crypto transform to encode and decode serialized payloads
+ * and RTPS messages.
+ *
+ * Usage: CryptoTransformBenchmark [iterations] [receivers]
+ */
+
+#include <security/cryptography/AESGCMGMAC.h>
+#include <security/authentication/PKIIdentityHandle.h>
+#include <security/accesscontrol/AccessPermissionsHandle.h>
+#include <fastdds/rtps/common/CDRMessage_t.h>
+#include <fastdds/rtps/common/SerializedPayload.h>
+
+#include <openssl/rand.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastrtps::rtps::security;
+
+namespace {
+
+const uint32_t payload_sizes[] = { 64, 1024, 16384, 60000 };
+
+struct BenchmarkEntities
+{
+    PKIIdentityHandle* i_handle = nullptr;
+    AccessPermissionsHandle* perm_handle = nullptr;
+    SharedSecretHandle* shared_secret = nullptr;
+
+    ParticipantCryptoHandle* participant_A = nullptr;
+    ParticipantCryptoHandle* participant_B = nullptr;
+    ParticipantCryptoHandle* participant_A_remote = nullptr;
+    ParticipantCryptoHandle* participant_B_remote = nullptr;
+    std::vector<ParticipantCryptoHandle*> extra_receivers;
+
+    DatareaderCryptoHandle* reader = nullptr;
+    DatawriterCryptoHandle* writer = nullptr;
+    DatareaderCryptoHandle* remote_reader = nullptr;
+    DatawriterCryptoHandle* remote_writer = nullptr;
+};
+
+void fill_shared_secret(
+        SharedSecretHandle& shared_secret)
+{
+    const char* names[] = { "Challenge1", "Challenge2", "SharedSecret" };
+    for (const char* name : names)
+    {
+        SharedSecret::BinaryData binary_data;
+        std::vector<uint8_t> value(32);
+        RAND_bytes(value.data(), 32);
+        binary_data.name(name);
+        binary_data.value(value);
+        shared_secret->data_.push_back(binary_data);
+    }
+}
+
+/**
+ * Participant A owns the reader, participant B owns the writer.
+ * Tokens are exchanged as done by the security manager after authentication.
+ */
+bool create_entities(
+        AESGCMGMAC& plugin,
+        size_t num_receivers,
+        BenchmarkEntities& entities)
+{
+    SecurityException exception;
+    PropertySeq prop_handle;
+    ParticipantSecurityAttributes part_sec_attr;
+    EndpointSecurityAttributes sec_attrs;
+
+    part_sec_attr.is_rtps_protected = true;
+    part_sec_attr.plugin_participant_attributes = PLUGIN_PARTICIPANT_SECURITY_ATTRIBUTES_FLAG_IS_RTPS_ENCRYPTED |
+            PLUGIN_PARTICIPANT_SECURITY_ATTRIBUTES_FLAG_IS_RTPS_ORIGIN_AUTHENTICATED;
+
+    sec_attrs.is_submessage_protected = true;
+    sec_attrs.is_payload_protected = true;
+    sec_attrs.is_key_protected = true;
+    sec_attrs.plugin_endpoint_attributes = PLUGIN_ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_SUBMESSAGE_ENCRYPTED |
+            PLUGIN_ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_SUBMESSAGE_ORIGIN_AUTHENTICATED |
+            PLUGIN_ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_PAYLOAD_ENCRYPTED;
+
+    entities.i_handle = new PKIIdentityHandle();
+    entities.perm_handle = new AccessPermissionsHandle();
+    entities.shared_secret = new SharedSecretHandle();
+    fill_shared_secret(*entities.shared_secret);
+
+    CryptoKeyFactory* factory = plugin.keyfactory();
+    CryptoKeyExchange* exchange = plugin.keyexchange();
+
+    entities.participant_A = factory->register_local_participant(*entities.i_handle, *entities.perm_handle,
+                    prop_handle, part_sec_attr, exception);
+    entities.participant_B = factory->register_local_participant(*entities.i_handle, *entities.perm_handle,
+                    prop_handle, part_sec_attr, exception);
+    if (nullptr == entities.participant_A || nullptr == entities.participant_B)
+    {
+        return false;
+    }
+
+    entities.reader = factory->register_local_datareader(*entities.participant_A, prop_handle, sec_attrs, exception);
+    entities.writer = factory->register_local_datawriter(*entities.participant_B, prop_handle, sec_attrs, exception);
+
+    entities.participant_A_remote = factory->register_matched_remote_participant(*entities.participant_A,
+                    *entities.i_handle, *entities.perm_handle, *entities.shared_secret, exception);
+    entities.participant_B_remote = factory->register_matched_remote_participant(*entities.participant_B,
+                    *entities.i_handle, *entities.perm_handle, *entities.shared_secret, exception);
+    for (size_t i = 1; i < num_receivers; ++i)
+    {
+        entities.extra_receivers.push_back(factory->register_matched_remote_participant(*entities.participant_A,
+                *entities.i_handle, *entities.perm_handle, *entities.shared_secret, exception));
+    }
+
+    entities.remote_reader = factory->register_matched_remote_datareader(*entities.writer,
+                    *entities.participant_B_remote, *entities.shared_secret, false, exception);
+    entities.remote_writer = factory->register_matched_remote_datawriter(*entities.reader,
+                    *entities.participant_A_remote, *entities.shared_secret, exception);
+
+    ParticipantCryptoTokenSeq participant_A_tokens, participant_B_tokens;
+    exchange->create_local_participant_crypto_tokens(participant_A_tokens, *entities.participant_A,
+            *entities.participant_A_remote, exception);
+    exchange->create_local_participant_crypto_tokens(participant_B_tokens, *entities.participant_B,
+            *entities.participant_B_remote, exception);
+    exchange->set_remote_participant_crypto_tokens(*entities.participant_A, *entities.participant_A_remote,
+            participant_B_tokens, exception);
+    exchange->set_remote_participant_crypto_tokens(*entities.participant_B, *entities.participant_B_remote,
+            participant_A_tokens, exception);
+
+    DatawriterCryptoTokenSeq writer_tokens, reader_tokens;
+    exchange->create_local_datawriter_crypto_tokens(writer_tokens, *entities.writer, *entities.remote_reader,
+            exception);
+    exchange->create_local_datareader_crypto_tokens(reader_tokens, *entities.reader, *entities.remote_writer,
+            exception);
+    exchange->set_remote_datareader_crypto_tokens(*entities.writer, *entities.remote_reader, reader_tokens,
+            exception);
+    exchange->set_remote_datawriter_crypto_tokens(*entities.reader, *entities.remote_writer, writer_tokens,
+            exception);
+
+    return nullptr != entities.reader && nullptr != entities.writer &&
+           nullptr != entities.remote_reader && nullptr != entities.remote_writer;
+}
+
+void destroy_entities(
+        AESGCMGMAC& plugin,
+        BenchmarkEntities& entities)
+{
+    SecurityException exception;
+    CryptoKeyFactory* factory = plugin.keyfactory();
+
+    factory->unregister_datawriter(entities.writer, exception);
+    factory->unregister_datawriter(entities.remote_writer, exception);
+    factory->unregister_datareader(entities.reader, exception);
+    factory->unregister_datareader(entities.remote_reader, exception);
+    for (ParticipantCryptoHandle* receiver : entities.extra_receivers)
+    {
+        factory->unregister_participant(receiver, exception);
+    }
+    factory->unregister_participant(entities.participant_A_remote, exception);
+    factory->unregister_participant(entities.participant_B_remote, exception);
+    factory->unregister_participant(entities.participant_A, exception);
+    factory->unregister_participant(entities.participant_B, exception);
+
+    delete entities.i_handle;
+    delete entities.perm_handle;
+    delete entities.shared_secret;
+}
+
+void print_result(
+        const char* operation,
+        uint32_t size,
+        uint32_t iterations,
+        std::chrono::steady_clock::duration elapsed)
+{
+    double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    double ns_per_op = ns / iterations;
+    double mb_per_s = (static_cast<double>(size) * iterations) / (ns / 1e3);
+    std::cout << operation << "\t" << size << "\t" << ns_per_op << " ns/op\t" << mb_per_s << " MB/s" << std::endl;
+}
+
+bool benchmark_payload(
+        AESGCMGMAC& plugin,
+        BenchmarkEntities& entities,
+        uint32_t size,
+        uint32_t iterations)
+{
+    SecurityException exception;
+    CryptoTransform* transform = plugin.cryptotransform();
+
+    SerializedPayload_t plain_payload(size);
+    SerializedPayload_t encoded_payload(size + 128);
+    SerializedPayload_t decoded_payload(size + 32);
+    std::vector<uint8_t> inline_qos;
+    RAND_bytes(plain_payload.data, static_cast<int>(size));
+    plain_payload.length = size;
+
+    std::chrono::steady_clock::duration encode_time = std::chrono::steady_clock::duration::zero();
+    std::chrono::steady_clock::duration decode_time = std::chrono::steady_clock::duration::zero();
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        encoded_payload.length = 0;
+        encoded_payload.pos = 0;
+        decoded_payload.length = 0;
+        decoded_payload.pos = 0;
+
+        auto t0 = std::chrono::steady_clock::now();
+        bool encoded = transform->encode_serialized_payload(encoded_payload, inline_qos, plain_payload,
+                        *entities.writer, exception);
+        auto t1 = std::chrono::steady_clock::now();
+        encoded_payload.pos = 0;
+        bool decoded = encoded && transform->decode_serialized_payload(decoded_payload, encoded_payload, inline_qos,
+                        *entities.reader, *entities.remote_writer, exception);
+        auto t2 = std::chrono::steady_clock::now();
+
+        if (!decoded || decoded_payload.length != size || 0 != memcmp(plain_payload.data, decoded_payload.data, size))
+        {
+            std::cerr << "Payload of size " << size << " could not be transformed" << std::endl;
+            return false;
+        }
+
+        encode_time += t1 - t0;
+        decode_time += t2 - t1;
+    }
+
+    print_result("encode_serialized_payload", size, iterations, encode_time);
+    print_result("decode_serialized_payload", size, iterations, decode_time);
+    return true;
+}
+
+bool benchmark_rtps_message(
+        AESGCMGMAC& plugin,
+        BenchmarkEntities& entities,
+        uint32_t size,
+        uint32_t iterations)
+{
+    SecurityException exception;
+    CryptoTransform* transform = plugin.cryptotransform();
+
+    CDRMessage_t plain_message(size);
+    CDRMessage_t encoded_message(size + 128 + 40 * static_cast<uint32_t>(entities.extra_receivers.size() + 1));
+    CDRMessage_t decoded_message(size + 32);
+    RAND_bytes(plain_message.buffer, static_cast<int>(size));
+    plain_message.length = size;
+
+    std::vector<ParticipantCryptoHandle*> receivers;
+    receivers.push_back(entities.participant_A_remote);
+    receivers.insert(receivers.end(), entities.extra_receivers.begin(), entities.extra_receivers.end());
+
+    std::chrono::steady_clock::duration encode_time = std::chrono::steady_clock::duration::zero();
+    std::chrono::steady_clock::duration decode_time = std::chrono::steady_clock::duration::zero();
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        plain_message.pos = 0;
+        encoded_message.length = 0;
+        encoded_message.pos = 0;
+        decoded_message.length = 0;
+        decoded_message.pos = 0;
+
+        auto t0 = std::chrono::steady_clock::now();
+        bool encoded = transform->encode_rtps_message(encoded_message, plain_message, *entities.participant_A,
+                        receivers, exception);
+        auto t1 = std::chrono::steady_clock::now();
+        encoded_message.pos = 0;
+        bool decoded = encoded && transform->decode_rtps_message(decoded_message, encoded_message,
+                        *entities.participant_B, *entities.participant_B_remote, exception);
+        auto t2 = std::chrono::steady_clock::now();
+
+        if (!decoded || decoded_message.length != size ||
+                0 != memcmp(plain_message.buffer, decoded_message.buffer, size))
+        {
+            std::cerr << "RTPS message of size " << size << " could not be transformed" << std::endl;
+            return false;
+        }
+
+        encode_time += t1 - t0;
+        decode_time += t2 - t1;
+    }
+
+    print_result("encode_rtps_message", size, iterations, encode_time);
+    print_result("decode_rtps_message", size, iterations, decode_time);
+    return true;
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t iterations = 10000;
+    size_t num_receivers = 1;
+    if (argc > 1)
+    {
+        iterations = static_cast<uint32_t>(strtoul(argv[1], nullptr, 10));
+    }
+    if (argc > 2)
+    {
+        num_receivers = static_cast<size_t>(strtoul(argv[2], nullptr, 10));
+    }
+    if (0 == iterations || 0 == num_receivers)
+    {
+        std::cerr << "Usage: " << argv[0] << " [iterations] [receivers]" << std::endl;
+        return 1;
+    }
+
+    AESGCMGMAC plugin;
+    BenchmarkEntities entities;
+    if (!create_entities(plugin, num_receivers, entities))
+    {
+        std::cerr << "Error creating crypto handles" << std::endl;
+        destroy_entities(plugin, entities);
+        return 1;
+    }
+
+    std::cout << "Iterations: " << iterations << ", receivers: " << num_receivers << std::endl;
+    bool ok = true;
+    for (uint32_t size : payload_sizes)
+    {
+        ok = ok && benchmark_payload(plugin, entities, size, iterations);
+    }
+    for (uint32_t size : payload_sizes)
+    {
+        ok = ok && benchmark_rtps_message(plugin, entities, size, iterations);
+    }
+
+    destroy_entities(plugin, entities);
+    return ok ? 0 : 1;
+}
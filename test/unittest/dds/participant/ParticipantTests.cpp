@@ -34,6 +34,7 @@
 #include <fastdds/dds/subscriber/DataReader.hpp>
 #include <fastdds/dds/subscriber/qos/SubscriberQos.hpp>
 #include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/ContentFilteredTopic.hpp>
 #include <fastdds/dds/topic/qos/TopicQos.hpp>
 #include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
 #include <fastrtps/attributes/PublisherAttributes.h>
@@ -2030,10 +2031,87 @@ TEST(ParticipantTests, RegisterRemoteTypePreconditionNotMet)
 }
 
 
+/*
+ * This test checks the creation and deletion of ContentFilteredTopic objects
+ */
+TEST(ParticipantTests, CreateContentFilteredTopic)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+
+    // A type without type information cannot be filtered
+    TypeSupport mock_type(new TopicDataTypeMock());
+    ASSERT_EQ(mock_type.register_type(participant), ReturnCode_t::RETCODE_OK);
+    Topic* mock_topic = participant->create_topic("mock_topic", mock_type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(mock_topic, nullptr);
+    ASSERT_EQ(participant->create_contentfilteredtopic("mock_filtered", mock_topic, "index > 5", {}), nullptr);
+
+    // Create a dynamic type with some fields
+    DynamicTypeBuilder_ptr builder = DynamicTypeBuilderFactory::get_instance()->create_struct_builder();
+    builder->add_member(0, "index", DynamicTypeBuilderFactory::get_instance()->create_uint32_type());
+    builder->add_member(1, "message", DynamicTypeBuilderFactory::get_instance()->create_string_type());
+    builder->set_name("FilteredType");
+    DynamicType_ptr dyn_type = builder->build();
+    TypeSupport type(new eprosima::fastrtps::types::DynamicPubSubType(dyn_type));
+    ASSERT_EQ(type.register_type(participant), ReturnCode_t::RETCODE_OK);
+    Topic* topic = participant->create_topic("topic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+
+    // Wrong input
+    ASSERT_EQ(participant->create_contentfilteredtopic("filtered", nullptr, "index > 5", {}), nullptr);
+    ASSERT_EQ(participant->create_contentfilteredtopic("topic", topic, "index > 5", {}), nullptr);
+    ASSERT_EQ(participant->create_contentfilteredtopic("filtered", topic, "unknown > 5", {}), nullptr);
+    ASSERT_EQ(participant->create_contentfilteredtopic("filtered", topic, "index > 'a'", {}), nullptr);
+    ASSERT_EQ(participant->create_contentfilteredtopic("filtered", topic, "index > %0", {}), nullptr);
+    ASSERT_EQ(participant->create_contentfilteredtopic("filtered", topic, "index > %0", {"'a'"}), nullptr);
+    ASSERT_EQ(participant->create_contentfilteredtopic("filtered", topic, "", {"5"}), nullptr);
+
+    // Correct creation
+    ContentFilteredTopic* filtered_topic = participant->create_contentfilteredtopic("filtered", topic,
+                    "index > %0 AND message LIKE 'Hello%'", {"5"});
+    ASSERT_NE(filtered_topic, nullptr);
+    EXPECT_EQ(filtered_topic->get_name(), "filtered");
+    EXPECT_EQ(filtered_topic->get_type_name(), type.get_type_name());
+    EXPECT_EQ(filtered_topic->get_related_topic(), topic);
+    EXPECT_EQ(filtered_topic->get_participant(), participant);
+    EXPECT_EQ(filtered_topic->get_filter_expression(), "index > %0 AND message LIKE 'Hello%'");
+    EXPECT_EQ(participant->lookup_topicdescription("filtered"), filtered_topic);
+
+    // Names are shared with topics
+    ASSERT_EQ(participant->create_contentfilteredtopic("filtered", topic, "index > 5", {}), nullptr);
+    ASSERT_EQ(participant->create_topic("filtered", type.get_type_name(), TOPIC_QOS_DEFAULT), nullptr);
+
+    // Expression parameters
+    std::vector<std::string> parameters;
+    ASSERT_EQ(filtered_topic->get_expression_parameters(parameters), ReturnCode_t::RETCODE_OK);
+    EXPECT_EQ(parameters, std::vector<std::string>({"5"}));
+    ASSERT_EQ(filtered_topic->set_expression_parameters({"'a'"}), ReturnCode_t::RETCODE_BAD_PARAMETER);
+    ASSERT_EQ(filtered_topic->set_expression_parameters({}), ReturnCode_t::RETCODE_BAD_PARAMETER);
+    ASSERT_EQ(filtered_topic->set_expression_parameters({"10"}), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(filtered_topic->get_expression_parameters(parameters), ReturnCode_t::RETCODE_OK);
+    EXPECT_EQ(parameters, std::vector<std::string>({"10"}));
+
+    // Empty filter expression
+    ContentFilteredTopic* unfiltered_topic = participant->create_contentfilteredtopic("unfiltered", topic, "", {});
+    ASSERT_NE(unfiltered_topic, nullptr);
+
+    // The related topic cannot be deleted while referenced
+    ASSERT_EQ(participant->delete_topic(topic), ReturnCode_t::RETCODE_PRECONDITION_NOT_MET);
+
+    // Deletion
+    ASSERT_EQ(participant->delete_contentfilteredtopic(nullptr), ReturnCode_t::RETCODE_BAD_PARAMETER);
+    ASSERT_EQ(participant->delete_contentfilteredtopic(filtered_topic), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(participant->delete_contentfilteredtopic(unfiltered_topic), ReturnCode_t::RETCODE_OK);
+    EXPECT_EQ(participant->lookup_topicdescription("filtered"), nullptr);
+    ASSERT_EQ(participant->delete_topic(topic), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(participant->delete_topic(mock_topic), ReturnCode_t::RETCODE_OK);
+
+    ASSERT_EQ(DomainParticipantFactory::get_instance()->delete_participant(participant), ReturnCode_t::RETCODE_OK);
+}
+
 /*
  * This test checks that the following methods are not implemented and returns an error
- *  create_contentfilteredtopic
- *  delete_contentfilteredtopic
  *  create_multitopic
  *  delete_multitopic
  *  find_topic
@@ -2063,17 +2141,6 @@ TEST(ParticipantTests, UnsupportedMethods)
     Topic* topic = participant->create_topic("topic", type.get_type_name(), TOPIC_QOS_DEFAULT);
     ASSERT_NE(topic, nullptr);
 
-    ASSERT_EQ(
-        participant->create_contentfilteredtopic(
-            "contentfilteredtopic",
-            topic,
-            "filter_expression",
-            std::vector<std::string>({"a", "b"})),
-        nullptr);
-
-    // nullptr use as there are not such a class
-    ASSERT_EQ(participant->delete_contentfilteredtopic(nullptr), ReturnCode_t::RETCODE_UNSUPPORTED);
-
     ASSERT_EQ(
         participant->create_multitopic(
             "multitopic",
@@ -418,6 +418,28 @@ TEST(PublisherTests, SetListener)
     ASSERT_EQ(DomainParticipantFactory::get_instance()->delete_participant(participant), ReturnCode_t::RETCODE_OK);
 }
 
+/*
+ * This test checks that calls to begin_coherent_changes and end_coherent_changes should be paired.
+ */
+TEST(PublisherTests, BeginEndCoherentChanges)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(publisher, nullptr);
+
+    EXPECT_EQ(ReturnCode_t::RETCODE_PRECONDITION_NOT_MET, publisher->end_coherent_changes());
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, publisher->begin_coherent_changes());
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, publisher->begin_coherent_changes());
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, publisher->end_coherent_changes());
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, publisher->end_coherent_changes());
+    EXPECT_EQ(ReturnCode_t::RETCODE_PRECONDITION_NOT_MET, publisher->end_coherent_changes());
+
+    ASSERT_EQ(participant->delete_publisher(publisher), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(DomainParticipantFactory::get_instance()->delete_participant(participant), ReturnCode_t::RETCODE_OK);
+}
+
 /*
  * This test checks that the Publisher methods defined in the standard not yet implemented in FastDDS return
  * ReturnCode_t::RETCODE_UNSUPPORTED. The following methods are checked:
@@ -425,8 +447,6 @@ TEST(PublisherTests, SetListener)
  * 2. delete_contained_entities
  * 3. suspend_publications
  * 4. resume_publications
- * 5. begin_coherent_changes
- * 6. end_coherent_changes
  */
 TEST(PublisherTests, UnsupportedPublisherMethods)
 {
@@ -442,8 +462,6 @@ TEST(PublisherTests, UnsupportedPublisherMethods)
     EXPECT_EQ(ReturnCode_t::RETCODE_UNSUPPORTED, publisher->delete_contained_entities());
     EXPECT_EQ(ReturnCode_t::RETCODE_UNSUPPORTED, publisher->suspend_publications());
     EXPECT_EQ(ReturnCode_t::RETCODE_UNSUPPORTED, publisher->resume_publications());
-    EXPECT_EQ(ReturnCode_t::RETCODE_UNSUPPORTED, publisher->begin_coherent_changes());
-    EXPECT_EQ(ReturnCode_t::RETCODE_UNSUPPORTED, publisher->end_coherent_changes());
 
     ASSERT_EQ(participant->delete_publisher(publisher), ReturnCode_t::RETCODE_OK);
     ASSERT_EQ(DomainParticipantFactory::get_instance()->delete_participant(participant), ReturnCode_t::RETCODE_OK);
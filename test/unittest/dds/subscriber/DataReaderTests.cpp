@@ -13,6 +13,8 @@
 // limitations under the License.
 
 #include <cassert>
+#include <condition_variable>
+#include <mutex>
 #include <thread>
 
 #include <gmock/gmock.h>
@@ -41,12 +43,20 @@
 
 #include <fastdds/dds/subscriber/DataReader.hpp>
 #include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/QueryCondition.hpp>
+#include <fastdds/dds/subscriber/ReadCondition.hpp>
 #include <fastdds/dds/subscriber/Subscriber.hpp>
 #include <fastdds/dds/subscriber/SampleInfo.hpp>
 #include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
 #include <fastdds/dds/subscriber/qos/SubscriberQos.hpp>
 
+#include <fastdds/dds/topic/ContentFilteredTopic.hpp>
+
 #include <fastdds/rtps/common/Locator.h>
+#include <fastrtps/types/DynamicDataFactory.h>
+#include <fastrtps/types/DynamicPubSubType.h>
+#include <fastrtps/types/DynamicTypeBuilderFactory.h>
+#include <fastrtps/types/DynamicTypeBuilderPtr.h>
 #include <fastrtps/utils/IPLocator.h>
 
 #include "FooBoundedType.hpp"
@@ -1644,6 +1654,125 @@ TEST_F(DataReaderTests, Deserialization_errors)
 
 }
 
+TEST_F(DataReaderTests, read_conditions)
+{
+    static const Duration_t time_to_wait(0, 100 * 1000 * 1000);
+    static constexpr int32_t num_samples = 4;
+
+    const ReturnCode_t& ok_code = ReturnCode_t::RETCODE_OK;
+    const ReturnCode_t& no_data_code = ReturnCode_t::RETCODE_NO_DATA;
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    writer_qos.publish_mode().kind = SYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+
+    create_instance_handles();
+    create_entities(nullptr, reader_qos, SUBSCRIBER_QOS_DEFAULT, writer_qos);
+
+    ReadCondition* not_read_condition = data_reader_->create_readcondition(
+        {NOT_READ_SAMPLE_STATE}, {}, {});
+    ASSERT_NE(nullptr, not_read_condition);
+    EXPECT_EQ(data_reader_, not_read_condition->get_datareader());
+    EXPECT_EQ(NOT_READ_SAMPLE_STATE, not_read_condition->get_sample_state_mask());
+    EXPECT_EQ(ANY_VIEW_STATE, not_read_condition->get_view_state_mask());
+    EXPECT_EQ(ANY_INSTANCE_STATE, not_read_condition->get_instance_state_mask());
+
+    ReadCondition* read_condition = data_reader_->create_readcondition({READ_SAMPLE_STATE}, {}, {});
+    ASSERT_NE(nullptr, read_condition);
+
+    // FooType has no type information, so queries cannot be compiled for it
+    EXPECT_EQ(nullptr, data_reader_->create_querycondition({}, {}, {}, "index = 1", {}));
+
+    // Empty reader
+    EXPECT_FALSE(not_read_condition->get_trigger_value());
+    EXPECT_FALSE(read_condition->get_trigger_value());
+    {
+        FooSeq data_seq;
+        SampleInfoSeq info_seq;
+        EXPECT_EQ(no_data_code,
+                data_reader_->read_w_condition(data_seq, info_seq, LENGTH_UNLIMITED, not_read_condition));
+        EXPECT_EQ(no_data_code,
+                data_reader_->take_w_condition(data_seq, info_seq, LENGTH_UNLIMITED, not_read_condition));
+        EXPECT_EQ(no_data_code,
+                data_reader_->read_next_instance_w_condition(data_seq, info_seq, LENGTH_UNLIMITED, HANDLE_NIL,
+                not_read_condition));
+        EXPECT_EQ(no_data_code,
+                data_reader_->take_next_instance_w_condition(data_seq, info_seq, LENGTH_UNLIMITED, HANDLE_NIL,
+                not_read_condition));
+    }
+
+    FooType data;
+    data.index(1);
+    data.message()[1] = '\0';
+    for (char i = 0; i < num_samples; ++i)
+    {
+        data.message()[0] = i + '0';
+        EXPECT_EQ(ok_code, data_writer_->write(&data, handle_ok_));
+    }
+    EXPECT_TRUE(data_reader_->wait_for_unread_message(time_to_wait));
+
+    EXPECT_TRUE(not_read_condition->get_trigger_value());
+    EXPECT_FALSE(read_condition->get_trigger_value());
+
+    {
+        FooSeq data_seq;
+        SampleInfoSeq info_seq;
+
+        EXPECT_EQ(no_data_code, data_reader_->read_w_condition(data_seq, info_seq, LENGTH_UNLIMITED, read_condition));
+
+        // Read the first two samples
+        EXPECT_EQ(ok_code, data_reader_->read_w_condition(data_seq, info_seq, 2, not_read_condition));
+        check_sample_values(data_seq, "01");
+        EXPECT_EQ(ok_code, data_reader_->return_loan(data_seq, info_seq));
+
+        EXPECT_TRUE(not_read_condition->get_trigger_value());
+        EXPECT_TRUE(read_condition->get_trigger_value());
+
+        // Only the samples not read yet should be returned
+        EXPECT_EQ(ok_code, data_reader_->read_w_condition(data_seq, info_seq, LENGTH_UNLIMITED, not_read_condition));
+        check_sample_values(data_seq, "23");
+        EXPECT_EQ(ok_code, data_reader_->return_loan(data_seq, info_seq));
+
+        EXPECT_FALSE(not_read_condition->get_trigger_value());
+        EXPECT_TRUE(read_condition->get_trigger_value());
+
+        EXPECT_EQ(ok_code,
+                data_reader_->take_next_instance_w_condition(data_seq, info_seq, LENGTH_UNLIMITED, HANDLE_NIL,
+                read_condition));
+        check_sample_values(data_seq, "0123");
+        EXPECT_EQ(ok_code, data_reader_->return_loan(data_seq, info_seq));
+
+        EXPECT_FALSE(not_read_condition->get_trigger_value());
+        EXPECT_FALSE(read_condition->get_trigger_value());
+    }
+
+    // Conditions should be handled by the reader that created them
+    DataReader* other_reader = subscriber_->create_datareader(topic_, reader_qos);
+    ASSERT_NE(nullptr, other_reader);
+    {
+        FooSeq data_seq;
+        SampleInfoSeq info_seq;
+        EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER,
+                other_reader->read_w_condition(data_seq, info_seq, LENGTH_UNLIMITED, nullptr));
+        EXPECT_EQ(ReturnCode_t::RETCODE_PRECONDITION_NOT_MET,
+                other_reader->read_w_condition(data_seq, info_seq, LENGTH_UNLIMITED, read_condition));
+    }
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, other_reader->delete_readcondition(nullptr));
+    EXPECT_EQ(ReturnCode_t::RETCODE_PRECONDITION_NOT_MET, other_reader->delete_readcondition(read_condition));
+    EXPECT_EQ(ok_code, subscriber_->delete_datareader(other_reader));
+
+    // A reader with conditions cannot be deleted
+    EXPECT_EQ(ReturnCode_t::RETCODE_PRECONDITION_NOT_MET, subscriber_->delete_datareader(data_reader_));
+
+    EXPECT_EQ(ok_code, data_reader_->delete_readcondition(read_condition));
+    EXPECT_EQ(ok_code, data_reader_->delete_contained_entities());
+}
+
 TEST_F(DataReaderTests, TerminateWithoutDestroyingReader)
 {
     destroy_entities_ = false;
@@ -1866,14 +1995,10 @@ public:
  * 3. get_subscription_matched_status
  * 4. get_subscription_matched_status
  * 5. get_matched_publication_data
- * 6. create_readcondition
- * 7. create_querycondition
- * 8. delete_readcondition
- * 9. delete_contained_entities
- * 10. get_matched_publications
- * 11. get_key_value
- * 12. lookup_instance
- * 13. wait_for_historical_data
+ * 6. get_matched_publications
+ * 7. get_key_value
+ * 8. lookup_instance
+ * 9. wait_for_historical_data
  */
 TEST_F(DataReaderUnsupportedTests, UnsupportedDataReaderMethods)
 {
@@ -1919,87 +2044,6 @@ TEST_F(DataReaderUnsupportedTests, UnsupportedDataReaderMethods)
         ReturnCode_t::RETCODE_UNSUPPORTED,
         data_reader->get_matched_publication_data(publication_data, publication_handle));
 
-    {
-        std::vector<SampleStateKind> sample_states;
-        std::vector<ViewStateKind> view_states;
-        std::vector<InstanceStateKind> instance_states;
-        EXPECT_EQ(
-            nullptr,
-            data_reader->create_readcondition(sample_states, view_states, instance_states));
-    }
-
-    {
-        std::vector<SampleStateKind> sample_states;
-        std::vector<ViewStateKind> view_states;
-        std::vector<InstanceStateKind> instance_states;
-        std::string query_expression;
-        std::vector<std::string> query_parameters;
-        EXPECT_EQ(
-            nullptr,
-            data_reader->create_querycondition(
-                sample_states,
-                view_states,
-                instance_states,
-                query_expression,
-                query_parameters));
-    }
-
-    {
-        EXPECT_EQ(
-            ReturnCode_t::RETCODE_UNSUPPORTED,
-            data_reader->delete_readcondition(nullptr));
-    }
-
-    {
-        FooBoundedSeq data_values;
-        SampleInfoSeq sample_infos;
-        int32_t max_samples = LENGTH_UNLIMITED;
-        EXPECT_EQ(ReturnCode_t::RETCODE_UNSUPPORTED, data_reader->read_w_condition(
-                    data_values,
-                    sample_infos,
-                    max_samples,
-                    nullptr));
-    }
-
-    {
-        FooBoundedSeq data_values;
-        SampleInfoSeq sample_infos;
-        int32_t max_samples = LENGTH_UNLIMITED;
-        fastrtps::rtps::InstanceHandle_t previous_handle;
-        EXPECT_EQ(ReturnCode_t::RETCODE_UNSUPPORTED, data_reader->read_next_instance_w_condition(
-                    data_values,
-                    sample_infos,
-                    max_samples,
-                    previous_handle,
-                    nullptr));
-    }
-
-    {
-        FooBoundedSeq data_values;
-        SampleInfoSeq sample_infos;
-        int32_t max_samples = LENGTH_UNLIMITED;
-        EXPECT_EQ(ReturnCode_t::RETCODE_UNSUPPORTED, data_reader->take_w_condition(
-                    data_values,
-                    sample_infos,
-                    max_samples,
-                    nullptr));
-    }
-
-    {
-        FooBoundedSeq data_values;
-        SampleInfoSeq sample_infos;
-        int32_t max_samples = LENGTH_UNLIMITED;
-        fastrtps::rtps::InstanceHandle_t previous_handle;
-        EXPECT_EQ(ReturnCode_t::RETCODE_UNSUPPORTED, data_reader->take_next_instance_w_condition(
-                    data_values,
-                    sample_infos,
-                    max_samples,
-                    previous_handle,
-                    nullptr));
-    }
-
-    EXPECT_EQ(ReturnCode_t::RETCODE_UNSUPPORTED, data_reader->delete_contained_entities());
-
     std::vector<fastrtps::rtps::InstanceHandle_t> publication_handles;
     EXPECT_EQ(ReturnCode_t::RETCODE_UNSUPPORTED, data_reader->get_matched_publications(publication_handles));
 
@@ -2010,8 +2054,8 @@ TEST_F(DataReaderUnsupportedTests, UnsupportedDataReaderMethods)
 
     EXPECT_EQ(ReturnCode_t::RETCODE_UNSUPPORTED, data_reader->wait_for_historical_data({0, 1}));
 
-    // Expected logWarnings: create_querycondition, create_readcondition, lookup_instance
-    HELPER_WaitForEntries(3);
+    // Expected logWarnings: lookup_instance
+    HELPER_WaitForEntries(1);
 
     ASSERT_EQ(subscriber->delete_datareader(data_reader), ReturnCode_t::RETCODE_OK);
     ASSERT_EQ(participant->delete_subscriber(subscriber), ReturnCode_t::RETCODE_OK);
@@ -2108,6 +2152,212 @@ TEST_F(DataReaderTests, read_samples_with_future_changes)
     ASSERT_EQ(publisher_->delete_datawriter(data_writer2), ReturnCode_t::RETCODE_OK);
 }
 
+class DataAvailableCounter : public DataReaderListener
+{
+public:
+
+    void on_data_available(
+            DataReader* /*reader*/) override
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        ++count_;
+        cv_.notify_all();
+    }
+
+    uint32_t wait(
+            uint32_t expected)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait_for(lock, std::chrono::seconds(5), [&]()
+                {
+                    return count_ >= expected;
+                });
+        return count_;
+    }
+
+private:
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    uint32_t count_ = 0;
+};
+
+/*
+ * This test checks that the data_available callback is called once for a coherent set whose last change is
+ * discarded by the content filter of the reader.
+ */
+TEST(DataReaderCoherentSetTests, filtered_end_of_set)
+{
+    using namespace fastrtps::types;
+
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+
+    DynamicTypeBuilder_ptr builder = DynamicTypeBuilderFactory::get_instance()->create_struct_builder();
+    builder->add_member(0, "index", DynamicTypeBuilderFactory::get_instance()->create_uint32_type());
+    builder->set_name("CoherentFilteredType");
+    DynamicType_ptr dyn_type = builder->build();
+    TypeSupport type(new DynamicPubSubType(dyn_type));
+    ASSERT_EQ(type.register_type(participant), ReturnCode_t::RETCODE_OK);
+
+    Topic* topic = participant->create_topic("coherent_topic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+    ContentFilteredTopic* filtered_topic =
+            participant->create_contentfilteredtopic("coherent_filtered", topic, "index < 3", {});
+    ASSERT_NE(filtered_topic, nullptr);
+
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(publisher, nullptr);
+    Subscriber* subscriber = participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+    ASSERT_NE(subscriber, nullptr);
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    DataWriter* writer = publisher->create_datawriter(topic, writer_qos);
+    ASSERT_NE(writer, nullptr);
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    DataAvailableCounter listener;
+    DataReader* reader = subscriber->create_datareader(filtered_topic, reader_qos, &listener);
+    ASSERT_NE(reader, nullptr);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100)); // Wait discovery
+
+    // The last change of the set does not pass the filter
+    DynamicData* data = DynamicDataFactory::get_instance()->create_data(dyn_type);
+    ASSERT_EQ(publisher->begin_coherent_changes(), ReturnCode_t::RETCODE_OK);
+    for (uint32_t index = 1; index <= 3; ++index)
+    {
+        data->set_uint32_value(index, 0);
+        ASSERT_TRUE(writer->write(data));
+    }
+    ASSERT_EQ(publisher->end_coherent_changes(), ReturnCode_t::RETCODE_OK);
+
+    EXPECT_EQ(1u, listener.wait(1u));
+    // The set is notified only once
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_EQ(1u, listener.wait(1u));
+
+    SampleInfo info;
+    uint32_t num_samples = 0;
+    while (ReturnCode_t::RETCODE_OK == reader->take_next_sample(data, &info))
+    {
+        uint32_t index = 0;
+        data->get_uint32_value(index, 0);
+        EXPECT_LT(index, 3u);
+        ++num_samples;
+    }
+    EXPECT_EQ(2u, num_samples);
+    DynamicDataFactory::get_instance()->delete_data(data);
+
+    ASSERT_EQ(subscriber->delete_datareader(reader), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(publisher->delete_datawriter(writer), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(participant->delete_subscriber(subscriber), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(participant->delete_publisher(publisher), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(participant->delete_contentfilteredtopic(filtered_topic), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(participant->delete_topic(topic), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(DomainParticipantFactory::get_instance()->delete_participant(participant), ReturnCode_t::RETCODE_OK);
+}
+
+/*
+ * This test checks that a reader on a content filtered topic discards the samples coming from a writer that cannot
+ * evaluate its filter.
+ */
+TEST(DataReaderContentFilterTests, filter_on_reader_side)
+{
+    using namespace fastrtps::types;
+
+    const std::string type_name = "reader_side_filter_type";
+
+    // The writer has no type information, so it sends all the samples
+    DomainParticipant* writer_participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(writer_participant, nullptr);
+    TypeSupport writer_type(new FooBoundedTypeSupport());
+    writer_type->setName(type_name.c_str());
+    ASSERT_EQ(writer_type.register_type(writer_participant), ReturnCode_t::RETCODE_OK);
+    Topic* writer_topic = writer_participant->create_topic("reader_side_filter", type_name, TOPIC_QOS_DEFAULT);
+    ASSERT_NE(writer_topic, nullptr);
+    Publisher* publisher = writer_participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(publisher, nullptr);
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    DataWriter* writer = publisher->create_datawriter(writer_topic, writer_qos);
+    ASSERT_NE(writer, nullptr);
+
+    // The reader builds the filter from a dynamic type equivalent to FooBoundedType.
+    // It is not registered on the type factories, so the writer cannot find it.
+    DomainParticipant* reader_participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(reader_participant, nullptr);
+    DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+    DynamicTypeBuilder_ptr builder = factory->create_struct_builder();
+    builder->add_member(0, "index", factory->create_uint32_type());
+    DynamicTypeBuilder_ptr message_builder = factory->create_sequence_builder(factory->create_char8_type(), 256);
+    builder->add_member(1, "message", message_builder.get());
+    builder->set_name(type_name);
+    DynamicType_ptr dyn_type = builder->build();
+    TypeSupport reader_type(new DynamicPubSubType(dyn_type));
+    reader_type->auto_fill_type_object(false);
+    reader_type->auto_fill_type_information(false);
+    ASSERT_EQ(reader_type.register_type(reader_participant), ReturnCode_t::RETCODE_OK);
+    Topic* reader_topic = reader_participant->create_topic("reader_side_filter", type_name, TOPIC_QOS_DEFAULT);
+    ASSERT_NE(reader_topic, nullptr);
+    ContentFilteredTopic* filtered_topic =
+            reader_participant->create_contentfilteredtopic("reader_side_filtered", reader_topic, "index < 3", {});
+    ASSERT_NE(filtered_topic, nullptr);
+    Subscriber* subscriber = reader_participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+    ASSERT_NE(subscriber, nullptr);
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    DataAvailableCounter listener;
+    DataReader* reader = subscriber->create_datareader(filtered_topic, reader_qos, &listener);
+    ASSERT_NE(reader, nullptr);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100)); // Wait discovery
+
+    FooBoundedType sample;
+    sample.message({'a'});
+    for (uint32_t index = 1; index <= 5; ++index)
+    {
+        sample.index(index);
+        ASSERT_TRUE(writer->write(&sample));
+    }
+    ASSERT_EQ(writer->wait_for_acknowledgments(Duration_t(5, 0)), ReturnCode_t::RETCODE_OK);
+    EXPECT_LE(2u, listener.wait(2u));
+
+    // Only the samples passing the filter are on the reader
+    DynamicData* data = DynamicDataFactory::get_instance()->create_data(dyn_type);
+    SampleInfo info;
+    uint32_t num_samples = 0;
+    while (ReturnCode_t::RETCODE_OK == reader->take_next_sample(data, &info))
+    {
+        uint32_t index = 0;
+        data->get_uint32_value(index, 0);
+        EXPECT_LT(index, 3u);
+        ++num_samples;
+    }
+    EXPECT_EQ(2u, num_samples);
+    DynamicDataFactory::get_instance()->delete_data(data);
+
+    ASSERT_EQ(subscriber->delete_datareader(reader), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(reader_participant->delete_subscriber(subscriber), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(reader_participant->delete_contentfilteredtopic(filtered_topic), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(reader_participant->delete_topic(reader_topic), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(DomainParticipantFactory::get_instance()->delete_participant(reader_participant),
+            ReturnCode_t::RETCODE_OK);
+
+    ASSERT_EQ(publisher->delete_datawriter(writer), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(writer_participant->delete_publisher(publisher), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(writer_participant->delete_topic(writer_topic), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(DomainParticipantFactory::get_instance()->delete_participant(writer_participant),
+            ReturnCode_t::RETCODE_OK);
+}
+
 } // namespace dds
 } // namespace fastdds
 } // namespace eprosima
@@ -484,14 +484,34 @@ TEST(SubscriberTests, SetListener)
     ASSERT_EQ(DomainParticipantFactory::get_instance()->delete_participant(participant), ReturnCode_t::RETCODE_OK);
 }
 
+/*
+ * This test checks that calls to begin_access and end_access should be paired.
+ */
+TEST(SubscriberTests, BeginEndAccess)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+    Subscriber* subscriber = participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+    ASSERT_NE(subscriber, nullptr);
+
+    EXPECT_EQ(ReturnCode_t::RETCODE_PRECONDITION_NOT_MET, subscriber->end_access());
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, subscriber->begin_access());
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, subscriber->begin_access());
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, subscriber->end_access());
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, subscriber->end_access());
+    EXPECT_EQ(ReturnCode_t::RETCODE_PRECONDITION_NOT_MET, subscriber->end_access());
+
+    ASSERT_EQ(participant->delete_subscriber(subscriber), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(DomainParticipantFactory::get_instance()->delete_participant(participant), ReturnCode_t::RETCODE_OK);
+}
+
 /*
  * This test checks that the Subscriber methods defined in the standard not yet implemented in FastDDS return
  * ReturnCode_t::RETCODE_UNSUPPORTED. The following methods are checked:
  * 1. copy_from_topic_qos
  * 2. delete_contained_entities
- * 3. begin_access
- * 3. end_access
- * 4. get_datareaders (all parameters)
+ * 3. get_datareaders (all parameters)
  */
 TEST(SubscriberTests, UnsupportedPublisherMethods)
 {
@@ -510,8 +530,6 @@ TEST(SubscriberTests, UnsupportedPublisherMethods)
     fastdds::dds::TopicQos topic_qos;
     EXPECT_EQ(ReturnCode_t::RETCODE_UNSUPPORTED, subscriber->copy_from_topic_qos(reader_qos, topic_qos));
     EXPECT_EQ(ReturnCode_t::RETCODE_UNSUPPORTED, subscriber->delete_contained_entities());
-    EXPECT_EQ(ReturnCode_t::RETCODE_UNSUPPORTED, subscriber->begin_access());
-    EXPECT_EQ(ReturnCode_t::RETCODE_UNSUPPORTED, subscriber->end_access());
     EXPECT_EQ(ReturnCode_t::RETCODE_UNSUPPORTED, subscriber->get_datareaders(
                 readers,
                 sample_states,
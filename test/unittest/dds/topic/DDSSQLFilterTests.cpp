@@ -0,0 +1,308 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fastdds/rtps/common/SerializedPayload.h>
+#include <fastrtps/types/DynamicData.h>
+#include <fastrtps/types/DynamicDataFactory.h>
+#include <fastrtps/types/DynamicPubSubType.h>
+#include <fastrtps/types/DynamicTypeBuilder.h>
+#include <fastrtps/types/DynamicTypeBuilderFactory.h>
+#include <fastrtps/types/DynamicTypeBuilderPtr.h>
+#include <fastrtps/types/DynamicTypePtr.h>
+
+#include <fastdds/topic/DDSSQLFilter/DDSFilterExpression.hpp>
+#include <fastdds/topic/DDSSQLFilter/DDSFilterFactory.hpp>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastdds::dds::DDSSQLFilter;
+using namespace eprosima::fastrtps::types;
+using eprosima::fastrtps::rtps::SerializedPayload_t;
+
+class DDSSQLFilterTests : public ::testing::Test
+{
+public:
+
+    void SetUp() override
+    {
+        DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+
+        DynamicTypeBuilder_ptr enum_builder = factory->create_enum_builder();
+        enum_builder->add_empty_member(0, "RED");
+        enum_builder->add_empty_member(1, "GREEN");
+        enum_builder->add_empty_member(2, "BLUE");
+        enum_builder->set_name("Color");
+
+        DynamicTypeBuilder_ptr inner_builder = factory->create_struct_builder();
+        inner_builder->add_member(0, "x", factory->create_int16_type());
+        inner_builder->add_member(1, "y", factory->create_float32_type());
+        inner_builder->set_name("Inner");
+
+        DynamicTypeBuilder_ptr builder = factory->create_struct_builder();
+        builder->add_member(0, "bool_field", factory->create_bool_type());
+        builder->add_member(1, "char_field", factory->create_char8_type());
+        builder->add_member(2, "int_field", factory->create_int32_type());
+        builder->add_member(3, "uint_field", factory->create_uint64_type());
+        builder->add_member(4, "double_field", factory->create_float64_type());
+        builder->add_member(5, "string_field", factory->create_string_type());
+        builder->add_member(6, "enum_field", enum_builder.get());
+        builder->add_member(7, "inner", inner_builder.get());
+        builder->set_name("FilterTestType");
+
+        type_ = builder->build();
+        pubsub_type_.reset(new DynamicPubSubType(type_));
+    }
+
+    void TearDown() override
+    {
+        pubsub_type_.reset();
+        type_ = DynamicType_ptr();
+    }
+
+protected:
+
+    std::unique_ptr<DDSFilterExpression> create_filter(
+            const std::string& expression,
+            const std::vector<std::string>& parameters = {})
+    {
+        std::unique_ptr<DDSFilterExpression> filter;
+        ReturnCode_t ret = DDSFilterFactory::create_filter(type_, expression, parameters, filter);
+        EXPECT_EQ(ret == ReturnCode_t::RETCODE_OK, nullptr != filter);
+        return filter;
+    }
+
+    void serialize(
+            SerializedPayload_t& payload,
+            bool bool_value,
+            char char_value,
+            int32_t int_value,
+            uint64_t uint_value,
+            double double_value,
+            const std::string& string_value,
+            const std::string& enum_value,
+            int16_t inner_x)
+    {
+        DynamicData* data = DynamicDataFactory::get_instance()->create_data(type_);
+        data->set_bool_value(bool_value, 0);
+        data->set_char8_value(char_value, 1);
+        data->set_int32_value(int_value, 2);
+        data->set_uint64_value(uint_value, 3);
+        data->set_float64_value(double_value, 4);
+        data->set_string_value(string_value, 5);
+        data->set_enum_value(enum_value, 6);
+        DynamicData* inner = data->loan_value(7);
+        inner->set_int16_value(inner_x, 0);
+        inner->set_float32_value(1.5f, 1);
+        data->return_loaned_value(inner);
+
+        payload.reserve(pubsub_type_->getSerializedSizeProvider(data)());
+        ASSERT_TRUE(pubsub_type_->serialize(data, &payload));
+        DynamicDataFactory::get_instance()->delete_data(data);
+    }
+
+    bool evaluate(
+            const DDSFilterExpression& filter,
+            const SerializedPayload_t& payload)
+    {
+        return filter.evaluate(payload.data, payload.length);
+    }
+
+    DynamicType_ptr type_;
+    std::unique_ptr<DynamicPubSubType> pubsub_type_;
+};
+
+TEST_F(DDSSQLFilterTests, invalid_expressions)
+{
+    std::vector<std::pair<std::string, std::vector<std::string>>> invalid =
+    {
+        {"", {}},
+        {"int_field", {}},
+        {"int_field =", {}},
+        {"int_field = 1 AND", {}},
+        {"(int_field = 1", {}},
+        {"int_field = 1)", {}},
+        {"unknown_field = 1", {}},
+        {"inner.z = 1", {}},
+        {"inner = 1", {}},
+        {"int_field = 'text'", {}},
+        {"string_field > 3", {}},
+        {"int_field LIKE 'a%'", {}},
+        {"enum_field = 'YELLOW'", {}},
+        {"int_field = %0", {}},
+        {"int_field = %1", {"1"}},
+        {"int_field = %0", {"'text'"}},
+        {"int_field = 1 BETWEEN 2", {}},
+        {"int_field = 'unterminated", {}},
+    };
+
+    for (const auto& item : invalid)
+    {
+        std::unique_ptr<DDSFilterExpression> filter;
+        EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER,
+                DDSFilterFactory::create_filter(type_, item.first, item.second, filter)) << item.first;
+        EXPECT_EQ(nullptr, filter) << item.first;
+    }
+}
+
+TEST_F(DDSSQLFilterTests, comparisons)
+{
+    SerializedPayload_t payload;
+    serialize(payload, true, 'c', -7, 1000u, 2.5, "hello world", "BLUE", 3);
+
+    std::vector<std::pair<std::string, bool>> cases =
+    {
+        {"int_field = -7", true},
+        {"int_field <> -7", false},
+        {"int_field != -7", false},
+        {"int_field < 0", true},
+        {"int_field <= -7", true},
+        {"int_field > -7", false},
+        {"int_field >= -8", true},
+        {"-7 = int_field", true},
+        {"uint_field = 1000", true},
+        {"uint_field > int_field", true},
+        {"uint_field = 0x3E8", true},
+        {"double_field = 2.5", true},
+        {"double_field > 2.4e0", true},
+        {"double_field < 2", false},
+        {"bool_field = TRUE", true},
+        {"bool_field = FALSE", false},
+        {"char_field = 'c'", true},
+        {"char_field > 'd'", false},
+        {"string_field = 'hello world'", true},
+        {"string_field = `hello world'", true},
+        {"string_field < 'hello'", false},
+        {"string_field > 'hello'", true},
+        {"enum_field = 'BLUE'", true},
+        {"enum_field <> 'RED'", true},
+        {"enum_field > 'GREEN'", true},
+        {"enum_field = 2", true},
+        {"inner.x = 3", true},
+        {"inner.x > 3", false},
+    };
+
+    for (const auto& item : cases)
+    {
+        std::unique_ptr<DDSFilterExpression> filter = create_filter(item.first);
+        ASSERT_NE(nullptr, filter) << item.first;
+        EXPECT_EQ(item.second, evaluate(*filter, payload)) << item.first;
+    }
+}
+
+TEST_F(DDSSQLFilterTests, like_and_between)
+{
+    SerializedPayload_t payload;
+    serialize(payload, false, 'a', 15, 0u, -1.0, "hello world", "RED", 0);
+
+    std::vector<std::pair<std::string, bool>> cases =
+    {
+        {"string_field LIKE 'hello%'", true},
+        {"string_field LIKE '%world'", true},
+        {"string_field LIKE '%lo w%'", true},
+        {"string_field LIKE 'h_llo world'", true},
+        {"string_field LIKE 'hello'", false},
+        {"string_field LIKE '_ello'", false},
+        {"string_field LIKE '%'", true},
+        {"int_field BETWEEN 10 AND 20", true},
+        {"int_field BETWEEN 16 AND 20", false},
+        {"int_field BETWEEN 15 AND 15", true},
+        {"int_field NOT BETWEEN 10 AND 20", false},
+        {"double_field BETWEEN -2 AND 0", true},
+    };
+
+    for (const auto& item : cases)
+    {
+        std::unique_ptr<DDSFilterExpression> filter = create_filter(item.first);
+        ASSERT_NE(nullptr, filter) << item.first;
+        EXPECT_EQ(item.second, evaluate(*filter, payload)) << item.first;
+    }
+}
+
+TEST_F(DDSSQLFilterTests, logical_operators)
+{
+    SerializedPayload_t payload;
+    serialize(payload, true, 'a', 5, 10u, 0.0, "text", "GREEN", 1);
+
+    std::vector<std::pair<std::string, bool>> cases =
+    {
+        {"int_field = 5 AND uint_field = 10", true},
+        {"int_field = 5 AND uint_field = 11", false},
+        {"int_field = 6 OR uint_field = 10", true},
+        {"int_field = 6 OR uint_field = 11", false},
+        {"NOT int_field = 5", false},
+        {"NOT (int_field = 6)", true},
+        {"int_field = 6 OR int_field = 5 AND uint_field = 11", false},
+        {"(int_field = 6 OR int_field = 5) and uint_field = 10", true},
+        {"int_field = 6 or (int_field = 5 AND NOT enum_field = 'RED')", true},
+    };
+
+    for (const auto& item : cases)
+    {
+        std::unique_ptr<DDSFilterExpression> filter = create_filter(item.first);
+        ASSERT_NE(nullptr, filter) << item.first;
+        EXPECT_EQ(item.second, evaluate(*filter, payload)) << item.first;
+    }
+}
+
+TEST_F(DDSSQLFilterTests, parameters)
+{
+    SerializedPayload_t payload;
+    serialize(payload, true, 'a', 5, 10u, 0.0, "text", "GREEN", 1);
+
+    std::unique_ptr<DDSFilterExpression> filter =
+            create_filter("int_field > %0 AND string_field = %1 AND enum_field = %2", {"3", "'text'", "'GREEN'"});
+    ASSERT_NE(nullptr, filter);
+    EXPECT_TRUE(evaluate(*filter, payload));
+
+    EXPECT_TRUE(filter->set_parameters({"7", "'text'", "'GREEN'"}));
+    EXPECT_FALSE(evaluate(*filter, payload));
+
+    EXPECT_TRUE(filter->set_parameters({"-1", "'text'", "'BLUE'"}));
+    EXPECT_FALSE(evaluate(*filter, payload));
+
+    // Invalid values keep the previous parameters
+    EXPECT_FALSE(filter->set_parameters({"'a'", "'text'", "'GREEN'"}));
+    EXPECT_FALSE(filter->set_parameters({"3", "'text'", "'YELLOW'"}));
+    EXPECT_FALSE(filter->set_parameters({"3", "'text'"}));
+    EXPECT_FALSE(evaluate(*filter, payload));
+}
+
+TEST_F(DDSSQLFilterTests, unreadable_payloads_pass)
+{
+    std::unique_ptr<DDSFilterExpression> filter = create_filter("int_field = 5");
+    ASSERT_NE(nullptr, filter);
+
+    // Truncated payload
+    SerializedPayload_t payload;
+    serialize(payload, true, 'a', 6, 10u, 0.0, "text", "GREEN", 1);
+    EXPECT_FALSE(evaluate(*filter, payload));
+    EXPECT_TRUE(filter->evaluate(payload.data, 6));
+
+    // Unknown encapsulation
+    payload.data[1] = 0x10;
+    EXPECT_TRUE(evaluate(*filter, payload));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -24,6 +24,7 @@
 #include <memory>
 #include <thread>
 #include <chrono>
+#include <iomanip>
 #include <sstream>
 
 using namespace eprosima::fastdds::dds;
@@ -175,6 +176,70 @@ TEST_F(LogTests, logless_flush_call)
     GTEST_SUCCESS_("If we are here there was no deadlock.");
 }
 
+/*
+ * This test checks that arguments stored in binary form are formatted as they would have been by a std::ostream.
+ * 1. Log an entry mixing basic types, manipulators and a type formatted on the calling thread.
+ * 2. Log an entry longer than the maximum size of the arguments.
+ * 3. Log an entry longer than the maximum size of the messages.
+ * 4. Check the first message is formatted as a std::stringstream would do, the second one is complete and the third
+ *    one is truncated.
+ */
+TEST_F(LogTests, deferred_formatting)
+{
+    auto format = [](std::ostream& stream) -> std::ostream&
+            {
+                return stream << "int " << -3 << " unsigned " << 42u << " hex " << std::hex << 255 << std::dec <<
+                       " char " << 'x' << " bool " << std::boolalpha << true << " double " << 1.5 <<
+                       " string " << std::string("text");
+            };
+
+    std::stringstream expected;
+    format(expected) << " width [" << std::setw(4) << 7 << "]";
+
+    logError(DeferredFormatting, "int " << -3 << " unsigned " << 42u << " hex " << std::hex << 255 << std::dec <<
+            " char " << 'x' << " bool " << std::boolalpha << true << " double " << 1.5 <<
+            " string " << std::string("text") << " width [" << std::setw(4) << 7 << "]");
+
+    std::string long_message(2 * detail::LogRecord::max_arguments_size, 'a');
+    logError(DeferredFormatting, long_message << " end");
+
+    std::string too_long_message(2 * Log::max_message_size, 'a');
+    logError(DeferredFormatting, too_long_message);
+
+    auto consumedEntries = HELPER_WaitForEntries(3);
+    ASSERT_EQ(3u, consumedEntries.size());
+    EXPECT_EQ(expected.str(), consumedEntries[0].message);
+    EXPECT_EQ(long_message + " end", consumedEntries[1].message);
+    EXPECT_EQ(Log::max_message_size + 5u, consumedEntries[2].message.size());
+    EXPECT_EQ("(...)", consumedEntries[2].message.substr(consumedEntries[2].message.size() - 5));
+}
+
+/*
+ * This test checks that the manipulators stored in binary form keep applying once the entry is formatted on the
+ * calling thread.
+ * 1. Log an entry with std::hex followed by a type formatted on the calling thread.
+ * 2. Log an entry with std::hex followed by arguments exceeding the maximum size of the arguments.
+ * 3. Check both messages are formatted as a std::stringstream would do.
+ */
+TEST_F(LogTests, deferred_formatting_manipulators)
+{
+    std::stringstream expected_width;
+    expected_width << "hex " << std::hex << 255 << " [" << std::setw(4) << 255 << "] " << 255;
+
+    logError(DeferredFormatting, "hex " << std::hex << 255 << " [" << std::setw(4) << 255 << "] " << 255);
+
+    std::string long_message(detail::LogRecord::max_arguments_size, 'a');
+    std::stringstream expected_long;
+    expected_long << "hex " << std::hex << 255 << " " << long_message << " " << 255;
+
+    logError(DeferredFormatting, "hex " << std::hex << 255 << " " << long_message << " " << 255);
+
+    auto consumedEntries = HELPER_WaitForEntries(2);
+    ASSERT_EQ(2u, consumedEntries.size());
+    EXPECT_EQ(expected_width.str(), consumedEntries[0].message);
+    EXPECT_EQ(expected_long.str(), consumedEntries[1].message);
+}
+
 /*
     'validate_single_flush_call' tests if the Flush() operation:
  + assures all log entries make to this point are consumed
@@ -288,6 +288,55 @@ TEST(BuiltinDataSerializationTests, ignore_unsupported_type_object)
     }
 }
 
+TEST(BuiltinDataSerializationTests, content_filter_property)
+{
+    ReaderProxyData in(max_unicast_locators, max_multicast_locators);
+
+    // Topic and type name cannot be empty
+    in.topicName("TEST");
+    in.typeName("TestType");
+
+    fastdds::rtps::ContentFilterProperty filter;
+    filter.content_filtered_topic_name = "CFT_TEST";
+    filter.related_topic_name = "TEST";
+    filter.filter_class_name = "DDSSQL";
+    filter.filter_expression = "index > %0 AND message LIKE %1";
+    filter.expression_parameters.push_back("10");
+    filter.expression_parameters.push_back("'Hello*'");
+    in.content_filter(filter);
+    ASSERT_TRUE(in.has_content_filter());
+
+    {
+        // Perform serialization
+        uint32_t msg_size = in.get_serialized_size(true);
+        CDRMessage_t msg(msg_size);
+        EXPECT_TRUE(in.writeToCDRMessage(&msg, true));
+
+        // Perform deserialization
+        ReaderProxyData out(max_unicast_locators, max_multicast_locators);
+        msg.pos = 0;
+        EXPECT_TRUE(out.readFromCDRMessage(&msg, network, true));
+        EXPECT_TRUE(out.has_content_filter());
+        EXPECT_EQ(filter, out.content_filter());
+    }
+
+    {
+        // A reader without filter does not announce one
+        ReaderProxyData no_filter(max_unicast_locators, max_multicast_locators);
+        no_filter.topicName("TEST");
+        no_filter.typeName("TestType");
+
+        uint32_t msg_size = no_filter.get_serialized_size(true);
+        CDRMessage_t msg(msg_size);
+        EXPECT_TRUE(no_filter.writeToCDRMessage(&msg, true));
+
+        ReaderProxyData out(max_unicast_locators, max_multicast_locators);
+        msg.pos = 0;
+        EXPECT_TRUE(out.readFromCDRMessage(&msg, network, true));
+        EXPECT_FALSE(out.has_content_filter());
+    }
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
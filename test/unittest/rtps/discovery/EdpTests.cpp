@@ -19,14 +19,22 @@
 #include <fastdds/rtps/builtin/discovery/participant/PDP.h>
 #include <fastrtps/rtps/builtin/data/WriterProxyData.h>
 #include <fastrtps/rtps/builtin/data/ReaderProxyData.h>
+#include <fastdds/rtps/reader/StatefulReader.h>
+#include <fastdds/rtps/writer/StatefulWriter.h>
 #include <rtps/participant/RTPSParticipantImpl.h>
 #include <rtps/participant/RTPSParticipantImpl.h>
 
+#include <memory>
+#include <mutex>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::Ref;
 using ::testing::Return;
 using ::testing::ReturnRef;
 
@@ -45,6 +53,9 @@ public:
     {
     }
 
+    using EDP::pairingReader;
+    using EDP::pairingWriter;
+
     bool initEDP(
             BuiltinAttributes& /*attributes*/) override
     {
@@ -110,6 +121,32 @@ protected:
         wdata->isAlive(true);
 
         edp = new EDPMock(&pdp_, &participant_);
+
+        pdp_.mutex_ = &pdp_mutex_;
+        local_prefix_.value[0] = 1;
+        remote_prefix_.value[0] = 2;
+        local_participant_guid_ = GUID_t(local_prefix_, c_EntityId_RTPSParticipant);
+        ON_CALL(participant_, getGuid()).WillByDefault(ReturnRef(local_participant_guid_));
+        ON_CALL(participant_, getParticipantMutex()).WillByDefault(Return(&participant_mutex_));
+        ON_CALL(participant_, userWritersListBegin()).WillByDefault(Invoke([this]()
+                {
+                    return local_writers_.begin();
+                }));
+        ON_CALL(participant_, userWritersListEnd()).WillByDefault(Invoke([this]()
+                {
+                    return local_writers_.end();
+                }));
+        ON_CALL(participant_, userReadersListBegin()).WillByDefault(Invoke([this]()
+                {
+                    return local_readers_.begin();
+                }));
+        ON_CALL(participant_, userReadersListEnd()).WillByDefault(Invoke([this]()
+                {
+                    return local_readers_.end();
+                }));
+#if HAVE_SECURITY
+        ON_CALL(participant_, security_manager()).WillByDefault(ReturnRef(security_manager_));
+#endif // if HAVE_SECURITY
     }
 
     void TearDown() override
@@ -194,11 +231,95 @@ protected:
         }
     }
 
+    std::unique_ptr<::testing::NiceMock<WriterProxyData>> create_writer_data(
+            const GUID_t& guid,
+            const char* topic_name)
+    {
+        std::unique_ptr<::testing::NiceMock<WriterProxyData>> data(new ::testing::NiceMock<WriterProxyData>(1, 1));
+        data->guid(guid);
+        data->topicName(topic_name);
+        data->topicKind(TopicKind_t::NO_KEY);
+        data->typeName("TypeName");
+        data->isAlive(true);
+        return data;
+    }
+
+    std::unique_ptr<::testing::NiceMock<ReaderProxyData>> create_reader_data(
+            const GUID_t& guid,
+            const char* topic_name)
+    {
+        std::unique_ptr<::testing::NiceMock<ReaderProxyData>> data(new ::testing::NiceMock<ReaderProxyData>(1, 1));
+        data->guid(guid);
+        data->topicName(topic_name);
+        data->topicKind(TopicKind_t::NO_KEY);
+        data->typeName("TypeName");
+        data->m_qos.type_consistency.m_force_type_validation = false;
+        data->isAlive(true);
+        return data;
+    }
+
+    void add_local_writer(
+            ::testing::NiceMock<StatefulWriter>& writer,
+            const GUID_t& guid)
+    {
+        writer.set_listener(nullptr);
+        ON_CALL(static_cast<const RTPSWriter&>(writer), getGuid()).WillByDefault(ReturnRef(guid));
+        local_writers_.push_back(&writer);
+    }
+
+    void add_local_reader(
+            ::testing::NiceMock<StatefulReader>& reader,
+            const GUID_t& guid)
+    {
+        reader.setListener(nullptr);
+        reader.m_guid = guid;
+        local_readers_.push_back(&reader);
+    }
+
+    //! Expect the writer to be matched with the reader
+    void expect_writer_match(
+            ::testing::NiceMock<StatefulWriter>& writer,
+            const GUID_t& writer_guid,
+            ReaderProxyData& reader)
+    {
+#if HAVE_SECURITY
+        EXPECT_CALL(security_manager_, discovered_reader(writer_guid, _, Ref(reader), _)).WillOnce(Return(true));
+#else
+        (void)writer_guid;
+        EXPECT_CALL(writer, matched_reader_add(Ref(reader))).WillOnce(Return(true));
+#endif // if HAVE_SECURITY
+    }
+
+    //! Expect the reader to be matched with the writer
+    void expect_reader_match(
+            ::testing::NiceMock<StatefulReader>& reader,
+            const GUID_t& reader_guid,
+            WriterProxyData& writer)
+    {
+#if HAVE_SECURITY
+        EXPECT_CALL(security_manager_, discovered_writer(reader_guid, _, Ref(writer), _)).WillOnce(Return(true));
+#else
+        (void)reader_guid;
+        EXPECT_CALL(reader, matched_writer_add(Ref(writer))).WillOnce(Return(true));
+#endif // if HAVE_SECURITY
+    }
+
     ::testing::NiceMock<PDP> pdp_;
     ::testing::NiceMock<RTPSParticipantImpl> participant_;
     ::testing::NiceMock<WriterProxyData>* wdata;
     ::testing::NiceMock<ReaderProxyData>* rdata;
     EDPMock* edp;
+
+    std::recursive_mutex pdp_mutex_;
+    std::recursive_mutex participant_mutex_;
+    GuidPrefix_t local_prefix_;
+    GuidPrefix_t remote_prefix_;
+    GUID_t local_participant_guid_;
+    std::vector<RTPSWriter*> local_writers_;
+    std::vector<RTPSReader*> local_readers_;
+#if HAVE_SECURITY
+    ::testing::NiceMock<security::SecurityManager> security_manager_;
+#endif // if HAVE_SECURITY
 };
 
 
@@ -388,6 +509,153 @@ TEST_F(EdpTests, CheckPositiveAckCompatibility)
     }
 }
 
+TEST_F(EdpTests, PairingWriterChecksReadersOnItsTopic)
+{
+    GUID_t writer_guid(local_prefix_, 0x103u);
+    ::testing::NiceMock<StatefulWriter> writer;
+    add_local_writer(writer, writer_guid);
+    auto writer_data = create_writer_data(writer_guid, "Topic");
+
+    GUID_t compatible_guid(remote_prefix_, 0x104u);
+    GUID_t incompatible_guid(remote_prefix_, 0x204u);
+    auto compatible = create_reader_data(compatible_guid, "Topic");
+    auto incompatible = create_reader_data(incompatible_guid, "Topic");
+    incompatible->typeName("AnotherTypeName");
+    std::vector<ReaderProxyData*> readers_on_topic{compatible.get(), incompatible.get()};
+
+    // Only the readers on the topic of the writer are checked
+    EXPECT_CALL(pdp_, reader_proxies_on_topic(_)).Times(0);
+    EXPECT_CALL(pdp_, reader_proxies_on_topic(string_255("Topic"))).WillOnce(ReturnRef(readers_on_topic));
+
+    expect_writer_match(writer, writer_guid, *compatible);
+    EXPECT_CALL(writer, matched_reader_is_matched(incompatible_guid)).WillOnce(Return(true));
+    EXPECT_CALL(writer, matched_reader_remove(incompatible_guid)).WillOnce(Return(true));
+
+    EXPECT_TRUE(edp->pairingWriter(&writer, local_participant_guid_, *writer_data));
+}
+
+TEST_F(EdpTests, PairingReaderChecksWritersOnItsTopic)
+{
+    GUID_t reader_guid(local_prefix_, 0x104u);
+    ::testing::NiceMock<StatefulReader> reader;
+    add_local_reader(reader, reader_guid);
+    auto reader_data = create_reader_data(reader_guid, "Topic");
+
+    GUID_t compatible_guid(remote_prefix_, 0x103u);
+    GUID_t incompatible_guid(remote_prefix_, 0x203u);
+    auto compatible = create_writer_data(compatible_guid, "Topic");
+    auto incompatible = create_writer_data(incompatible_guid, "Topic");
+    incompatible->typeName("AnotherTypeName");
+    std::vector<WriterProxyData*> writers_on_topic{compatible.get(), incompatible.get()};
+
+    // Only the writers on the topic of the reader are checked
+    EXPECT_CALL(pdp_, writer_proxies_on_topic(_)).Times(0);
+    EXPECT_CALL(pdp_, writer_proxies_on_topic(string_255("Topic"))).WillOnce(ReturnRef(writers_on_topic));
+
+    expect_reader_match(reader, reader_guid, *compatible);
+    EXPECT_CALL(reader, matched_writer_is_matched(incompatible_guid)).WillOnce(Return(true));
+    EXPECT_CALL(reader, matched_writer_remove(incompatible_guid, false)).WillOnce(Return(true));
+
+    EXPECT_TRUE(edp->pairingReader(&reader, local_participant_guid_, *reader_data));
+}
+
+TEST_F(EdpTests, PairingRemoteReaderWithAnyLocalWriter)
+{
+    GUID_t writer_guid(local_prefix_, 0x103u);
+    GUID_t other_writer_guid(local_prefix_, 0x203u);
+    ::testing::NiceMock<StatefulWriter> writer;
+    ::testing::NiceMock<StatefulWriter> other_writer;
+    add_local_writer(writer, writer_guid);
+    add_local_writer(other_writer, other_writer_guid);
+    auto writer_data = create_writer_data(writer_guid, "Topic");
+    auto other_writer_data = create_writer_data(other_writer_guid, "AnotherTopic");
+    auto remote_writer_data = create_writer_data(GUID_t(remote_prefix_, 0x303u), "Topic");
+    std::vector<WriterProxyData*> writers_on_topic{remote_writer_data.get(), writer_data.get()};
+    std::vector<WriterProxyData*> writers_on_another_topic{other_writer_data.get()};
+    ON_CALL(pdp_, writer_proxies_on_topic(string_255("Topic"))).WillByDefault(ReturnRef(writers_on_topic));
+    ON_CALL(pdp_, writer_proxies_on_topic(string_255("AnotherTopic"))).WillByDefault(
+        ReturnRef(writers_on_another_topic));
+
+    GUID_t remote_participant_guid(remote_prefix_, c_EntityId_RTPSParticipant);
+    GUID_t remote_reader_guid(remote_prefix_, 0x104u);
+    auto remote_reader = create_reader_data(remote_reader_guid, "Topic");
+
+    // The remote reader is only matched with the local writer on its topic
+    expect_writer_match(writer, writer_guid, *remote_reader);
+    EXPECT_CALL(other_writer, matched_reader_add(_)).Times(0);
+    EXPECT_CALL(other_writer, matched_reader_remove(_)).Times(0);
+    EXPECT_TRUE(edp->pairing_reader_proxy_with_any_local_writer(remote_participant_guid, remote_reader.get()));
+    ::testing::Mock::VerifyAndClearExpectations(&writer);
+    ::testing::Mock::VerifyAndClearExpectations(&other_writer);
+
+    // When the remote reader is found on another topic, it is unmatched from the writer of its former topic
+    remote_reader->topicName("AnotherTopic");
+    expect_writer_match(other_writer, other_writer_guid, *remote_reader);
+    EXPECT_CALL(writer, matched_reader_is_matched(remote_reader_guid)).WillOnce(Return(true));
+    EXPECT_CALL(writer, matched_reader_remove(remote_reader_guid)).WillOnce(Return(true));
+    EXPECT_TRUE(edp->pairing_reader_proxy_with_any_local_writer(remote_participant_guid, remote_reader.get()));
+}
+
+TEST_F(EdpTests, PairingRemoteWriterWithAnyLocalReader)
+{
+    GUID_t reader_guid(local_prefix_, 0x104u);
+    GUID_t other_reader_guid(local_prefix_, 0x204u);
+    ::testing::NiceMock<StatefulReader> reader;
+    ::testing::NiceMock<StatefulReader> other_reader;
+    add_local_reader(reader, reader_guid);
+    add_local_reader(other_reader, other_reader_guid);
+    auto reader_data = create_reader_data(reader_guid, "Topic");
+    auto other_reader_data = create_reader_data(other_reader_guid, "AnotherTopic");
+    auto remote_reader_data = create_reader_data(GUID_t(remote_prefix_, 0x304u), "Topic");
+    std::vector<ReaderProxyData*> readers_on_topic{remote_reader_data.get(), reader_data.get()};
+    std::vector<ReaderProxyData*> readers_on_another_topic{other_reader_data.get()};
+    ON_CALL(pdp_, reader_proxies_on_topic(string_255("Topic"))).WillByDefault(ReturnRef(readers_on_topic));
+    ON_CALL(pdp_, reader_proxies_on_topic(string_255("AnotherTopic"))).WillByDefault(
+        ReturnRef(readers_on_another_topic));
+
+    GUID_t remote_participant_guid(remote_prefix_, c_EntityId_RTPSParticipant);
+    GUID_t remote_writer_guid(remote_prefix_, 0x103u);
+    auto remote_writer = create_writer_data(remote_writer_guid, "Topic");
+
+    // The remote writer is only matched with the local reader on its topic
+    expect_reader_match(reader, reader_guid, *remote_writer);
+    EXPECT_CALL(other_reader, matched_writer_add(_)).Times(0);
+    EXPECT_CALL(other_reader, matched_writer_remove(_, _)).Times(0);
+    EXPECT_TRUE(edp->pairing_writer_proxy_with_any_local_reader(remote_participant_guid, remote_writer.get()));
+    ::testing::Mock::VerifyAndClearExpectations(&reader);
+    ::testing::Mock::VerifyAndClearExpectations(&other_reader);
+
+    // When the remote writer is found on another topic, it is unmatched from the reader of its former topic
+    remote_writer->topicName("AnotherTopic");
+    expect_reader_match(other_reader, other_reader_guid, *remote_writer);
+    EXPECT_CALL(reader, matched_writer_is_matched(remote_writer_guid)).WillOnce(Return(true));
+    EXPECT_CALL(reader, matched_writer_remove(remote_writer_guid, false)).WillOnce(Return(true));
+    EXPECT_TRUE(edp->pairing_writer_proxy_with_any_local_reader(remote_participant_guid, remote_writer.get()));
+}
+
+TEST_F(EdpTests, UnpairRemoteParticipantEndpoints)
+{
+    GUID_t writer_guid(local_prefix_, 0x103u);
+    GUID_t reader_guid(local_prefix_, 0x204u);
+    ::testing::NiceMock<StatefulWriter> writer;
+    ::testing::NiceMock<StatefulReader> reader;
+    add_local_writer(writer, writer_guid);
+    add_local_reader(reader, reader_guid);
+
+    // The endpoints of a removed participant are not on the topic index anymore, so they are unmatched from all
+    // the local endpoints whatever their topic
+    GUID_t remote_participant_guid(remote_prefix_, c_EntityId_RTPSParticipant);
+    GUID_t remote_reader_guid(remote_prefix_, 0x104u);
+    GUID_t remote_writer_guid(remote_prefix_, 0x203u);
+    EXPECT_CALL(pdp_, reader_proxies_on_topic(_)).Times(0);
+    EXPECT_CALL(pdp_, writer_proxies_on_topic(_)).Times(0);
+    EXPECT_CALL(writer, matched_reader_remove(remote_reader_guid)).WillOnce(Return(true));
+    EXPECT_CALL(reader, matched_writer_remove(remote_writer_guid, true)).WillOnce(Return(true));
+
+    EXPECT_TRUE(edp->unpairReaderProxy(remote_participant_guid, remote_reader_guid));
+    EXPECT_TRUE(edp->unpairWriterProxy(remote_participant_guid, remote_writer_guid, true));
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
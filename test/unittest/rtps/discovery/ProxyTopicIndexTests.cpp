@@ -0,0 +1,162 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <rtps/builtin/discovery/participant/ProxyTopicIndex.hpp>
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+/**
+ * Stands for the ReaderProxyData and WriterProxyData objects kept by PDP.
+ */
+struct TestProxyData
+{
+    explicit TestProxyData(
+            const char* topic_name)
+        : topic_name_(topic_name)
+    {
+    }
+
+    const string_255& topicName() const
+    {
+        return topic_name_;
+    }
+
+    void topicName(
+            const string_255& topic_name)
+    {
+        topic_name_ = topic_name;
+    }
+
+    string_255 topic_name_;
+};
+
+using TestTopicIndex = std::unordered_map<std::string, std::vector<TestProxyData*>>;
+
+TEST(ProxyTopicIndexTests, add_and_find)
+{
+    TestTopicIndex index;
+    TestProxyData first("TopicA");
+    TestProxyData second("TopicA");
+    TestProxyData third("TopicB");
+
+    add_to_topic_index(index, &first);
+    add_to_topic_index(index, &second);
+    add_to_topic_index(index, &third);
+
+    EXPECT_EQ((std::vector<TestProxyData*>{&first, &second}), find_in_topic_index(index, "TopicA"));
+    EXPECT_EQ((std::vector<TestProxyData*>{&third}), find_in_topic_index(index, "TopicB"));
+    EXPECT_TRUE(find_in_topic_index(index, "TopicC").empty());
+    EXPECT_EQ(2u, index.size());
+}
+
+TEST(ProxyTopicIndexTests, remove_keeps_collections)
+{
+    TestTopicIndex index;
+    TestProxyData first("TopicA");
+    TestProxyData second("TopicA");
+    TestProxyData not_indexed("TopicA");
+
+    add_to_topic_index(index, &first);
+    add_to_topic_index(index, &second);
+    const std::vector<TestProxyData*>& proxies = find_in_topic_index(index, "TopicA");
+
+    // Removing a proxy which is not on the index does nothing
+    remove_from_topic_index(index, &not_indexed);
+    EXPECT_EQ(2u, proxies.size());
+
+    // References taken while matching remain valid when the topic runs out of proxies
+    remove_from_topic_index(index, &first);
+    EXPECT_EQ((std::vector<TestProxyData*>{&second}), proxies);
+    remove_from_topic_index(index, &second);
+    EXPECT_TRUE(proxies.empty());
+    EXPECT_EQ(&proxies, &find_in_topic_index(index, "TopicA"));
+
+    add_to_topic_index(index, &first);
+    EXPECT_EQ((std::vector<TestProxyData*>{&first}), proxies);
+}
+
+TEST(ProxyTopicIndexTests, endpoint_topic_change)
+{
+    TestTopicIndex index;
+    TestProxyData endpoint("TopicA");
+    TestProxyData other("TopicA");
+
+    add_to_topic_index(index, &endpoint);
+    add_to_topic_index(index, &other);
+
+    // An update changing the topic moves the proxy to the collection of the new topic
+    EXPECT_TRUE(update_in_topic_index(index, &endpoint,
+            [](TestProxyData* data)
+            {
+                data->topicName("TopicB");
+                return true;
+            }));
+    EXPECT_EQ((std::vector<TestProxyData*>{&other}), find_in_topic_index(index, "TopicA"));
+    EXPECT_EQ((std::vector<TestProxyData*>{&endpoint}), find_in_topic_index(index, "TopicB"));
+
+    // An update keeping the topic leaves the proxy on it just once
+    EXPECT_TRUE(update_in_topic_index(index, &endpoint,
+            [](TestProxyData*)
+            {
+                return true;
+            }));
+    EXPECT_EQ((std::vector<TestProxyData*>{&endpoint}), find_in_topic_index(index, "TopicB"));
+
+    // A failed update still leaves the proxy on the topic it now has, as it is still kept by its participant
+    EXPECT_FALSE(update_in_topic_index(index, &endpoint,
+            [](TestProxyData* data)
+            {
+                data->topicName("TopicC");
+                return false;
+            }));
+    EXPECT_TRUE(find_in_topic_index(index, "TopicB").empty());
+    EXPECT_EQ((std::vector<TestProxyData*>{&endpoint}), find_in_topic_index(index, "TopicC"));
+}
+
+TEST(ProxyTopicIndexTests, participant_removal)
+{
+    TestTopicIndex index;
+    TestProxyData removed_on_a("TopicA");
+    TestProxyData removed_on_b("TopicB");
+    TestProxyData kept_on_a("TopicA");
+
+    std::map<uint32_t, TestProxyData*> removed_participant;
+    removed_participant[1] = &removed_on_a;
+    removed_participant[2] = &removed_on_b;
+
+    add_to_topic_index(index, &removed_on_a);
+    add_to_topic_index(index, &kept_on_a);
+    add_to_topic_index(index, &removed_on_b);
+
+    // The proxies of the removed participant are not found on their topics anymore
+    remove_all_from_topic_index(index, removed_participant);
+    EXPECT_EQ((std::vector<TestProxyData*>{&kept_on_a}), find_in_topic_index(index, "TopicA"));
+    EXPECT_TRUE(find_in_topic_index(index, "TopicB").empty());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -141,6 +141,41 @@ TEST_F(ThroughputControllerTests, throughput_controller_resets_completely_after_
    std::this_thread::sleep_for(std::chrono::milliseconds(periodMillisecs + 50));
 }
 
+TEST_F(ThroughputControllerTests, throughput_controller_refills_gradually)
+{
+    // Given
+    sController(testChangesForUse);
+    ASSERT_EQ(5u, testChangesForUse.size());
+
+    // When half the period has elapsed
+    std::this_thread::sleep_for(std::chrono::milliseconds(periodMillisecs / 2));
+
+    // Then some credit should have been restored, but not all of it
+    sController(otherChangesForUse);
+    EXPECT_LT(0u, otherChangesForUse.size());
+    EXPECT_GT(5u, otherChangesForUse.size());
+    std::this_thread::sleep_for(std::chrono::milliseconds(periodMillisecs + 50));
+}
+
+TEST_F(ThroughputControllerTests, throughput_controller_lets_big_changes_through_when_full)
+{
+    // Given a change bigger than the controller size
+    CacheChange_t big_change(2 * controllerSize);
+    big_change.sequenceNumber = {0, 1};
+    big_change.serializedPayload.length = 2 * controllerSize;
+    RTPSWriterCollector<ReaderLocator*> bigChangesForUse;
+    bigChangesForUse.add_change(&big_change, nullptr, FragmentNumberSet_t());
+
+    // When the controller is full, it should be let through
+    sController(bigChangesForUse);
+    ASSERT_EQ(1u, bigChangesForUse.size());
+
+    // And nothing else until the debt is paid
+    sController(testChangesForUse);
+    EXPECT_EQ(0u, testChangesForUse.size());
+    std::this_thread::sleep_for(std::chrono::milliseconds(periodMillisecs + 50));
+}
+
 int main(int argc, char **argv)
 {
     testing::InitGoogleTest(&argc, argv);
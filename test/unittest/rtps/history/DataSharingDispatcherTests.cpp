@@ -0,0 +1,181 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <rtps/DataSharing/DataSharingDispatcher.hpp>
+#include <rtps/DataSharing/DataSharingNotification.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace ::testing;
+using namespace std;
+
+/**
+ * Gives access to both sides of a notification segment.
+ */
+class TestNotification : public DataSharingNotification
+{
+public:
+
+    bool create(
+            const GUID_t& reader_guid)
+    {
+        return create_and_init_notification(reader_guid);
+    }
+
+    bool open(
+            const GUID_t& reader_guid)
+    {
+        return open_and_init_notification(reader_guid);
+    }
+
+    bool has_dispatcher() const
+    {
+        return static_cast<bool>(dispatcher_);
+    }
+
+    bool has_new_data() const
+    {
+        return notification_->new_data.load();
+    }
+};
+
+/**
+ * Records the thread polling it.
+ */
+class TestListener : public DataSharingDispatcher::Listener
+{
+public:
+
+    bool poll() override
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        thread_ = std::this_thread::get_id();
+        cv_.notify_all();
+        return false;
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        thread_ = std::thread::id();
+    }
+
+    std::thread::id wait_poll()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait_for(lock, std::chrono::seconds(1), [this]()
+                {
+                    return std::thread::id() != thread_;
+                });
+        return thread_;
+    }
+
+private:
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::thread::id thread_;
+};
+
+static GuidPrefix_t test_prefix(
+        uint8_t value)
+{
+    GuidPrefix_t prefix;
+    prefix.value[0] = 0xD5;
+    prefix.value[11] = value;
+    return prefix;
+}
+
+TEST(DataSharingDispatcherTests, dispatcher_assignment)
+{
+    GuidPrefix_t prefix = test_prefix(1);
+    DataSharingDispatcher dispatcher(prefix, 2);
+
+    const size_t num_readers = 3;
+    TestNotification readers[num_readers];
+    TestNotification writers[num_readers];
+    TestListener listeners[num_readers];
+
+    for (size_t i = 0; i < num_readers; ++i)
+    {
+        GUID_t guid(prefix, static_cast<uint32_t>(i + 1));
+        ASSERT_TRUE(readers[i].create(guid));
+        ASSERT_TRUE(dispatcher.add_listener(&listeners[i], readers[i]));
+
+        // Writers find the dispatcher of the reader on its segment
+        ASSERT_TRUE(writers[i].open(guid));
+        EXPECT_TRUE(writers[i].has_dispatcher());
+    }
+
+    // The first two readers get a thread of their own, and the third goes to the first one
+    std::thread::id threads[num_readers];
+    for (size_t i = 0; i < num_readers; ++i)
+    {
+        listeners[i].clear();
+        writers[i].notify();
+        threads[i] = listeners[i].wait_poll();
+        ASSERT_NE(std::thread::id(), threads[i]);
+    }
+    EXPECT_NE(threads[0], threads[1]);
+    EXPECT_EQ(threads[0], threads[2]);
+
+    for (size_t i = 0; i < num_readers; ++i)
+    {
+        dispatcher.remove_listener(&listeners[i]);
+        readers[i].destroy();
+    }
+}
+
+TEST(DataSharingDispatcherTests, fallback_without_dispatcher)
+{
+    GuidPrefix_t prefix = test_prefix(2);
+    GUID_t guid(prefix, 1u);
+
+    // A reader not served by a dispatcher is notified directly
+    TestNotification reader;
+    ASSERT_TRUE(reader.create(guid));
+    TestNotification writer;
+    ASSERT_TRUE(writer.open(guid));
+    EXPECT_FALSE(writer.has_dispatcher());
+
+    EXPECT_FALSE(reader.has_new_data());
+    writer.notify();
+    EXPECT_TRUE(reader.has_new_data());
+    reader.destroy();
+
+    // Same when the dispatcher has no threads
+    DataSharingDispatcher dispatcher(prefix, 0);
+    TestListener listener;
+    TestNotification other_reader;
+    ASSERT_TRUE(other_reader.create(guid));
+    EXPECT_FALSE(dispatcher.add_listener(&listener, other_reader));
+    TestNotification other_writer;
+    ASSERT_TRUE(other_writer.open(guid));
+    EXPECT_FALSE(other_writer.has_dispatcher());
+    other_reader.destroy();
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
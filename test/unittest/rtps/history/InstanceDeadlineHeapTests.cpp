@@ -0,0 +1,136 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/common/InstanceDeadlineHeap.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+
+constexpr size_t num_instances = 50;
+
+class InstanceDeadlineHeapTests : public ::testing::Test
+{
+public:
+
+    void SetUp() override
+    {
+        instances.resize(num_instances);
+        for (size_t i = 0; i < num_instances; ++i)
+        {
+            instances[i].handle.value[0] = static_cast<uint8_t>(i);
+            set_deadline(i, (i * 37) % num_instances);
+        }
+    }
+
+    void set_deadline(
+            size_t instance,
+            size_t ms)
+    {
+        instances[instance].next_deadline_us = base + std::chrono::milliseconds(ms);
+    }
+
+    // Check the top of the heap is the instance with the earliest deadline among the ones on the heap
+    void check_top(
+            const std::vector<bool>& on_heap)
+    {
+        KeyedChanges* expected = nullptr;
+        for (size_t i = 0; i < num_instances; ++i)
+        {
+            if (on_heap[i] && (nullptr == expected || instances[i].next_deadline_us < expected->next_deadline_us))
+            {
+                expected = &instances[i];
+            }
+        }
+
+        ASSERT_NE(nullptr, uut.top());
+        EXPECT_EQ(expected->next_deadline_us, uut.top()->next_deadline_us);
+    }
+
+    std::chrono::steady_clock::time_point base = std::chrono::steady_clock::now();
+    std::vector<KeyedChanges> instances;
+    InstanceDeadlineHeap uut;
+};
+
+TEST_F(InstanceDeadlineHeapTests, update_and_pop)
+{
+    EXPECT_TRUE(uut.empty());
+    EXPECT_EQ(nullptr, uut.top());
+
+    std::vector<bool> on_heap(num_instances, false);
+    for (size_t i = 0; i < num_instances; ++i)
+    {
+        uut.update(instances[i]);
+        on_heap[i] = true;
+        check_top(on_heap);
+    }
+    EXPECT_EQ(num_instances, uut.size());
+
+    // Postpone the deadlines of some instances, like when a sample is received
+    for (size_t i = 0; i < num_instances; i += 3)
+    {
+        set_deadline(i, num_instances + i);
+        uut.update(instances[i]);
+        check_top(on_heap);
+    }
+
+    // Instances should come out ordered by deadline
+    std::chrono::steady_clock::time_point last = base;
+    while (!uut.empty())
+    {
+        KeyedChanges* top = uut.top();
+        EXPECT_FALSE(top->next_deadline_us < last);
+        last = top->next_deadline_us;
+        uut.remove(*top);
+        EXPECT_TRUE(KeyedChanges::not_in_deadline_heap == top->deadline_heap_index);
+    }
+}
+
+TEST_F(InstanceDeadlineHeapTests, remove)
+{
+    std::vector<bool> on_heap(num_instances, true);
+    for (size_t i = 0; i < num_instances; ++i)
+    {
+        uut.update(instances[i]);
+    }
+
+    // Removing instances not on the heap has no effect
+    KeyedChanges other;
+    uut.remove(other);
+    EXPECT_EQ(num_instances, uut.size());
+
+    for (size_t i = 0; i < num_instances; i += 2)
+    {
+        uut.remove(instances[i]);
+        on_heap[i] = false;
+        check_top(on_heap);
+    }
+    EXPECT_EQ(num_instances / 2, uut.size());
+
+    // Instances can be added again
+    uut.update(instances[0]);
+    on_heap[0] = true;
+    check_top(on_heap);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -19,7 +19,10 @@
     FRIEND_TEST(WriterProxyTests, MissingChangesUpdate); \
     FRIEND_TEST(WriterProxyTests, LostChangesUpdate); \
     FRIEND_TEST(WriterProxyTests, ReceivedChangeSet); \
-    FRIEND_TEST(WriterProxyTests, IrrelevantChangeSet);
+    FRIEND_TEST(WriterProxyTests, IrrelevantChangeSet); \
+    FRIEND_TEST(WriterProxyTests, CoherentSet); \
+    FRIEND_TEST(WriterProxyTests, ReceivedChangeSetOnLongGaps); \
+    FRIEND_TEST(WriterProxyTests, ReceivedChangeSetFarAhead);
 
 #include <rtps/reader/WriterProxy.h>
 #include <rtps/participant/RTPSParticipantImpl.h>
@@ -694,6 +697,196 @@ TEST(WriterProxyTests, IrrelevantChangeSet)
     ASSERT_EQ(wproxy.unknown_missing_changes_up_to(SequenceNumber_t(0, 9)), 0u);
 }
 
+TEST(WriterProxyTests, CoherentSet)
+{
+    WriterProxyData wattr(4u, 1u);
+    StatefulReader readerMock;
+    WriterProxy wproxy(&readerMock, RemoteLocatorsAllocationAttributes(), ResourceLimitedContainerConfig());
+    EXPECT_CALL(*wproxy.initial_acknack_, update_interval(readerMock.getTimes().initialAcknackDelay)).Times(1u);
+    EXPECT_CALL(*wproxy.heartbeat_response_, update_interval(readerMock.getTimes().heartbeatResponseDelay)).Times(1u);
+    EXPECT_CALL(*wproxy.initial_acknack_, restart_timer()).Times(1u);
+    wproxy.start(wattr, SequenceNumber_t());
+
+    auto receive = [&wproxy](
+        uint32_t seq,
+        uint32_t set_first,
+        bool set_end)
+            {
+                CacheChange_t change;
+                change.sequenceNumber = SequenceNumber_t(0, seq);
+                if (0 != set_first)
+                {
+                    change.write_params.coherent_set(SequenceNumber_t(0, set_first));
+                }
+                change.write_params.coherent_set_end(set_end);
+                wproxy.coherent_set_update(change);
+                wproxy.received_change_set(change.sequenceNumber);
+            };
+
+    // 1. Changes outside coherent sets are visible as soon as they are received
+    receive(1, 0, false);
+    ASSERT_EQ(wproxy.visible_changes_max(), SequenceNumber_t(0, 1));
+    ASSERT_EQ(wproxy.next_cache_change_to_be_notified(), SequenceNumber_t(0, 1));
+    ASSERT_EQ(wproxy.next_cache_change_to_be_notified(), SequenceNumber_t::unknown());
+
+    // 2. Coherent set [2, 4] received out of order is held until complete
+    receive(2, 2, false);
+    ASSERT_EQ(wproxy.available_changes_max(), SequenceNumber_t(0, 2));
+    ASSERT_EQ(wproxy.visible_changes_max(), SequenceNumber_t(0, 1));
+    ASSERT_EQ(wproxy.next_cache_change_to_be_notified(), SequenceNumber_t::unknown());
+    receive(4, 2, true);
+    ASSERT_EQ(wproxy.visible_changes_max(), SequenceNumber_t(0, 1));
+    receive(3, 2, false);
+    ASSERT_EQ(wproxy.available_changes_max(), SequenceNumber_t(0, 4));
+    ASSERT_EQ(wproxy.visible_changes_max(), SequenceNumber_t(0, 4));
+    ASSERT_EQ(wproxy.next_cache_change_to_be_notified(), SequenceNumber_t(0, 2));
+    ASSERT_EQ(wproxy.next_cache_change_to_be_notified(), SequenceNumber_t(0, 3));
+    ASSERT_EQ(wproxy.next_cache_change_to_be_notified(), SequenceNumber_t(0, 4));
+    ASSERT_EQ(wproxy.next_cache_change_to_be_notified(), SequenceNumber_t::unknown());
+
+    // 3. Coherent set [5, 6] without end mark is closed by a change outside the set
+    receive(5, 5, false);
+    receive(6, 5, false);
+    ASSERT_EQ(wproxy.visible_changes_max(), SequenceNumber_t(0, 4));
+    receive(7, 0, false);
+    ASSERT_EQ(wproxy.visible_changes_max(), SequenceNumber_t(0, 7));
+
+    // 4. Coherent set [8, 9] without end mark is closed by the beginning of coherent set [10, 10]
+    receive(8, 8, false);
+    receive(9, 8, false);
+    ASSERT_EQ(wproxy.visible_changes_max(), SequenceNumber_t(0, 7));
+    receive(10, 10, true);
+    ASSERT_EQ(wproxy.visible_changes_max(), SequenceNumber_t(0, 10));
+    while (wproxy.next_cache_change_to_be_notified() != SequenceNumber_t::unknown())
+    {
+    }
+
+    // 5. Coherent set [11, 13] whose last change is lost is visible once the writer moves past it
+    receive(11, 11, false);
+    receive(12, 11, false);
+    ASSERT_EQ(wproxy.visible_changes_max(), SequenceNumber_t(0, 10));
+    ASSERT_EQ(wproxy.next_cache_change_to_be_notified(), SequenceNumber_t::unknown());
+    // Change 13 is removed from the writer history before being repaired
+    wproxy.lost_changes_update(SequenceNumber_t(0, 14));
+    ASSERT_EQ(wproxy.visible_changes_max(), SequenceNumber_t(0, 10));
+    receive(14, 0, false);
+    ASSERT_EQ(wproxy.visible_changes_max(), SequenceNumber_t(0, 14));
+    ASSERT_EQ(wproxy.next_cache_change_to_be_notified(), SequenceNumber_t(0, 11));
+    ASSERT_EQ(wproxy.next_cache_change_to_be_notified(), SequenceNumber_t(0, 12));
+    ASSERT_EQ(wproxy.next_cache_change_to_be_notified(), SequenceNumber_t(0, 13));
+    ASSERT_EQ(wproxy.next_cache_change_to_be_notified(), SequenceNumber_t(0, 14));
+    ASSERT_EQ(wproxy.next_cache_change_to_be_notified(), SequenceNumber_t::unknown());
+}
+
+TEST(WriterProxyTests, ReceivedChangeSetOnLongGaps)
+{
+    WriterProxyData wattr(4u, 1u);
+    StatefulReader readerMock;
+    WriterProxy wproxy(&readerMock,
+                       RemoteLocatorsAllocationAttributes(),
+                       ResourceLimitedContainerConfig());
+
+    EXPECT_CALL(*wproxy.initial_acknack_, update_interval(readerMock.getTimes().initialAcknackDelay)).Times(1u);
+    EXPECT_CALL(*wproxy.heartbeat_response_, update_interval(readerMock.getTimes().heartbeatResponseDelay)).Times(1u);
+    EXPECT_CALL(*wproxy.initial_acknack_, restart_timer()).Times(1u);
+    wproxy.start(wattr, SequenceNumber_t());
+
+    // 1. Writer proxy receives all odd sequence numbers from 301 to 999, and then 201
+    for (uint32_t i = 301; i < 1000; i += 2)
+    {
+        ASSERT_TRUE(wproxy.received_change_set(SequenceNumber_t(0, i)));
+    }
+    ASSERT_TRUE(wproxy.received_change_set(SequenceNumber_t(0, 201)));
+    ASSERT_FALSE(wproxy.received_change_set(SequenceNumber_t(0, 201)));
+    ASSERT_TRUE(wproxy.change_was_received(SequenceNumber_t(0, 201)));
+    ASSERT_FALSE(wproxy.change_was_received(SequenceNumber_t(0, 202)));
+    ASSERT_TRUE(wproxy.change_was_received(SequenceNumber_t(0, 999)));
+
+    // Changes 1 to 200, 202 to 300, and the even ones up to 998 are missing
+    ASSERT_EQ(wproxy.unknown_missing_changes_up_to(SequenceNumber_t(0, 1000)), 200u + 99u + 349u);
+    ASSERT_EQ(wproxy.unknown_missing_changes_up_to(SequenceNumber_t(0, 2000)), 200u + 99u + 349u);
+    ASSERT_EQ(wproxy.unknown_missing_changes_up_to(SequenceNumber_t(0, 301)), 299u);
+
+    SequenceNumberSet_t t1(SequenceNumber_t(0, 1));
+    t1.add_range(SequenceNumber_t(0, 1), SequenceNumber_t(0, 201));
+    t1.add_range(SequenceNumber_t(0, 202), SequenceNumber_t(0, 257));
+    ASSERT_THAT(t1, wproxy.missing_changes());
+
+    // 2. Writer proxy is informed that changes up to 299 are lost
+    wproxy.lost_changes_update(SequenceNumber_t(0, 300));
+    ASSERT_EQ(wproxy.available_changes_max(), SequenceNumber_t(0, 299));
+
+    SequenceNumberSet_t t2(SequenceNumber_t(0, 300));
+    for (uint32_t i = 300; i < 556; i += 2)
+    {
+        t2.add(SequenceNumber_t(0, i));
+    }
+    ASSERT_THAT(t2, wproxy.missing_changes());
+
+    // 3. Writer proxy receives all even sequence numbers
+    for (uint32_t i = 300; i < 1000; i += 2)
+    {
+        ASSERT_TRUE(wproxy.received_change_set(SequenceNumber_t(0, i)));
+    }
+    ASSERT_EQ(wproxy.available_changes_max(), SequenceNumber_t(0, 999));
+    ASSERT_EQ(wproxy.are_there_missing_changes(), false);
+    ASSERT_TRUE(wproxy.changes_received_.empty());
+}
+
+TEST(WriterProxyTests, ReceivedChangeSetFarAhead)
+{
+    WriterProxyData wattr(4u, 1u);
+    StatefulReader readerMock;
+    WriterProxy wproxy(&readerMock,
+                       RemoteLocatorsAllocationAttributes(),
+                       ResourceLimitedContainerConfig());
+
+    EXPECT_CALL(*wproxy.initial_acknack_, update_interval(readerMock.getTimes().initialAcknackDelay)).Times(1u);
+    EXPECT_CALL(*wproxy.heartbeat_response_, update_interval(readerMock.getTimes().heartbeatResponseDelay)).Times(1u);
+    EXPECT_CALL(*wproxy.initial_acknack_, restart_timer()).Times(1u);
+    wproxy.start(wattr, SequenceNumber_t());
+
+    // 1. Writer proxy receives a change far ahead, and then some close ones
+    SequenceNumber_t far_ahead(0x7FFFFFFE, 0xFFFFFFF0);
+    ASSERT_TRUE(wproxy.received_change_set(far_ahead));
+    ASSERT_FALSE(wproxy.received_change_set(far_ahead));
+    ASSERT_TRUE(wproxy.change_was_received(far_ahead));
+    ASSERT_TRUE(wproxy.changes_received_.empty());
+
+    ASSERT_TRUE(wproxy.received_change_set(SequenceNumber_t(0, 5)));
+    ASSERT_TRUE(wproxy.received_change_set(SequenceNumber_t(0, 2000)));
+    ASSERT_LE(wproxy.changes_received_.size(), wproxy.max_received_words_);
+    ASSERT_EQ(2u, wproxy.changes_received_beyond_.size());
+
+    ASSERT_EQ(wproxy.unknown_missing_changes_up_to(SequenceNumber_t(0, 3000)), 3000u - 1u - 2u);
+    SequenceNumberSet_t t1(SequenceNumber_t(0, 1));
+    t1.add_range(SequenceNumber_t(0, 1), SequenceNumber_t(0, 5));
+    t1.add_range(SequenceNumber_t(0, 6), SequenceNumber_t(0, 257));
+    ASSERT_THAT(t1, wproxy.missing_changes());
+
+    // 2. Moving the low mark brings the changes which now fit into the bitmap
+    wproxy.lost_changes_update(SequenceNumber_t(0, 1990));
+    ASSERT_EQ(wproxy.available_changes_max(), SequenceNumber_t(0, 1989));
+    ASSERT_EQ(1u, wproxy.changes_received_beyond_.size());
+    ASSERT_TRUE(wproxy.change_was_received(SequenceNumber_t(0, 2000)));
+    ASSERT_EQ(wproxy.unknown_missing_changes_up_to(SequenceNumber_t(0, 2001)), 10u);
+
+    // 3. Writer proxy receives the changes up to the one received before, and the low mark jumps over it
+    for (uint32_t i = 1990; i < 2000; ++i)
+    {
+        ASSERT_TRUE(wproxy.received_change_set(SequenceNumber_t(0, i)));
+    }
+    ASSERT_EQ(wproxy.available_changes_max(), SequenceNumber_t(0, 2000));
+    ASSERT_TRUE(wproxy.change_was_received(far_ahead));
+
+    // 4. Writer proxy is informed that changes up to the far ahead one are lost
+    wproxy.lost_changes_update(far_ahead);
+    ASSERT_EQ(wproxy.available_changes_max(), far_ahead);
+    ASSERT_EQ(wproxy.are_there_missing_changes(), false);
+    ASSERT_TRUE(wproxy.changes_received_.empty());
+    ASSERT_TRUE(wproxy.changes_received_beyond_.empty());
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
@@ -0,0 +1,103 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rtps/resources/ResourceEventPool.hpp>
+
+#include <fastdds/rtps/resources/TimedEvent.h>
+
+#include <gtest/gtest.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using namespace eprosima::fastrtps::rtps;
+
+TEST(ResourceEventPoolTests, classes_without_threads_use_general_thread)
+{
+    EventThreadAttributes att;
+    att.reliability_threads = 1;
+    ResourceEventPool pool(att);
+
+    EXPECT_EQ(&pool.general(), &pool.get(EventThreadClass::DISCOVERY));
+    EXPECT_EQ(&pool.general(), &pool.get(EventThreadClass::USER_CALLBACKS));
+    EXPECT_NE(&pool.general(), &pool.get(EventThreadClass::RELIABILITY));
+    EXPECT_EQ(&pool.get(EventThreadClass::RELIABILITY), &pool.get(EventThreadClass::RELIABILITY));
+}
+
+TEST(ResourceEventPoolTests, events_spread_among_class_threads)
+{
+    EventThreadAttributes att;
+    att.user_callback_threads = 2;
+    ResourceEventPool pool(att);
+
+    ResourceEvent* first = &pool.get(EventThreadClass::USER_CALLBACKS);
+    ResourceEvent* second = &pool.get(EventThreadClass::USER_CALLBACKS);
+    EXPECT_NE(first, second);
+    EXPECT_NE(&pool.general(), first);
+    EXPECT_NE(&pool.general(), second);
+    EXPECT_EQ(first, &pool.get(EventThreadClass::USER_CALLBACKS));
+    EXPECT_EQ(second, &pool.get(EventThreadClass::USER_CALLBACKS));
+}
+
+TEST(ResourceEventPoolTests, events_run_on_dedicated_thread)
+{
+    EventThreadAttributes att;
+    att.discovery_threads = 1;
+    ResourceEventPool pool(att);
+    pool.init_threads();
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::thread::id general_thread;
+    std::thread::id discovery_thread;
+
+    auto callback = [&](std::thread::id& thread_id) -> bool
+            {
+                std::lock_guard<std::mutex> guard(mutex);
+                thread_id = std::this_thread::get_id();
+                cv.notify_all();
+                return false;
+            };
+
+    TimedEvent general_event(pool.general(), [&]()
+            {
+                return callback(general_thread);
+            }, 1);
+    TimedEvent discovery_event(pool.get(EventThreadClass::DISCOVERY), [&]()
+            {
+                return callback(discovery_thread);
+            }, 1);
+    general_event.restart_timer();
+    discovery_event.restart_timer();
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_TRUE(cv.wait_for(lock, std::chrono::seconds(5), [&]()
+                {
+                    return std::thread::id() != general_thread && std::thread::id() != discovery_thread;
+                }));
+    }
+
+    EXPECT_NE(general_thread, discovery_thread);
+    EXPECT_NE(std::this_thread::get_id(), discovery_thread);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
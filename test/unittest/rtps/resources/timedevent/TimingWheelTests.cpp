@@ -0,0 +1,157 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rtps/resources/TimingWheel.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+
+using Clock = TimingWheel::clock;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+
+static const Clock::time_point start = Clock::time_point() + std::chrono::hours(1);
+
+TEST(TimingWheelTests, expires_on_due_tick)
+{
+    TimingWheel wheel(start, milliseconds(1));
+    std::vector<TimingWheelNode> nodes(3);
+    std::vector<TimingWheelNode*> expired;
+
+    wheel.insert(&nodes[0], start + microseconds(2500));
+    wheel.insert(&nodes[1], start + milliseconds(3));
+    wheel.insert(&nodes[2], start + milliseconds(70));
+    EXPECT_EQ(3u, wheel.size());
+    EXPECT_EQ(start + milliseconds(3), wheel.next_expiry());
+
+    // Never expired before the due time
+    wheel.advance(start + microseconds(2999), expired);
+    EXPECT_TRUE(expired.empty());
+
+    // Nodes on the same tick are expired together
+    wheel.advance(start + milliseconds(3), expired);
+    ASSERT_EQ(2u, expired.size());
+    EXPECT_FALSE(TimingWheel::contains(&nodes[0]));
+    EXPECT_FALSE(TimingWheel::contains(&nodes[1]));
+    EXPECT_TRUE(TimingWheel::contains(&nodes[2]));
+
+    // Node on a higher level
+    expired.clear();
+    wheel.advance(start + milliseconds(69), expired);
+    EXPECT_TRUE(expired.empty());
+    wheel.advance(start + milliseconds(71), expired);
+    ASSERT_EQ(1u, expired.size());
+    EXPECT_EQ(&nodes[2], expired[0]);
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_EQ(Clock::time_point::max(), wheel.next_expiry());
+}
+
+TEST(TimingWheelTests, remove_and_move)
+{
+    TimingWheel wheel(start, milliseconds(1));
+    std::vector<TimingWheelNode> nodes(3);
+    std::vector<TimingWheelNode*> expired;
+
+    wheel.insert(&nodes[0], start + milliseconds(10));
+    wheel.insert(&nodes[1], start + milliseconds(10));
+    wheel.insert(&nodes[2], start + milliseconds(20));
+
+    wheel.remove(&nodes[0]);
+    wheel.insert(&nodes[2], start + milliseconds(5));
+    EXPECT_EQ(2u, wheel.size());
+    EXPECT_EQ(start + milliseconds(5), wheel.next_expiry());
+
+    wheel.advance(start + milliseconds(30), expired);
+    ASSERT_EQ(2u, expired.size());
+    EXPECT_EQ(&nodes[2], expired[0]);
+    EXPECT_EQ(&nodes[1], expired[1]);
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimingWheelTests, already_due)
+{
+    TimingWheel wheel(start, milliseconds(1));
+    TimingWheelNode node;
+    std::vector<TimingWheelNode*> expired;
+
+    wheel.advance(start + milliseconds(100), expired);
+    wheel.insert(&node, start + milliseconds(50));
+    EXPECT_EQ(start + milliseconds(100), wheel.next_expiry());
+    wheel.advance(start + milliseconds(100), expired);
+    ASSERT_EQ(1u, expired.size());
+    EXPECT_EQ(&node, expired[0]);
+}
+
+TEST(TimingWheelTests, random_schedule)
+{
+    TimingWheel wheel(start, milliseconds(1));
+    std::vector<TimingWheelNode> nodes(500);
+    std::vector<Clock::time_point> due_times(nodes.size());
+    std::vector<TimingWheelNode*> expired;
+    std::mt19937 generator(1234);
+
+    Clock::time_point now = start;
+    size_t total_expired = 0;
+    for (uint32_t step = 0; step < 20000; ++step)
+    {
+        // Schedule or cancel a random node, with due times reaching the overflow list
+        size_t index = generator() % nodes.size();
+        if (TimingWheel::contains(&nodes[index]) && 0 == generator() % 4)
+        {
+            wheel.remove(&nodes[index]);
+        }
+        else
+        {
+            uint32_t range_ms = (0 == generator() % 8) ? 20000000u : 5000u;
+            due_times[index] = now + microseconds(generator() % (range_ms * 1000u));
+            wheel.insert(&nodes[index], due_times[index]);
+        }
+
+        // Advance up to the next expiration at most
+        Clock::time_point next = std::min(wheel.next_expiry(), now + milliseconds(generator() % 300));
+        now = std::max(now, next);
+
+        expired.clear();
+        wheel.advance(now, expired);
+        for (TimingWheelNode* node : expired)
+        {
+            Clock::time_point due_time = due_times[static_cast<size_t>(node - nodes.data())];
+            EXPECT_LE(due_time, now);
+            EXPECT_GT(due_time + milliseconds(1), now) << "at step " << step;
+        }
+        total_expired += expired.size();
+
+        size_t on_wheel = static_cast<size_t>(std::count_if(nodes.begin(), nodes.end(),
+                [](const TimingWheelNode& node)
+                {
+                    return TimingWheel::contains(&node);
+                }));
+        ASSERT_EQ(on_wheel, wheel.size());
+    }
+
+    EXPECT_LT(0u, total_expired);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
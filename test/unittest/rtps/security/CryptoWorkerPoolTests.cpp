@@ -0,0 +1,134 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rtps/security/CryptoWorkerPool.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps::security;
+
+TEST(CryptoWorkerPoolTests, runs_every_job_once)
+{
+    CryptoWorkerPool pool(3);
+    ASSERT_EQ(3u, pool.num_threads());
+
+    for (size_t num_jobs = 0; num_jobs < 40; ++num_jobs)
+    {
+        std::vector<std::atomic<uint32_t>> runs(num_jobs);
+        for (std::atomic<uint32_t>& count : runs)
+        {
+            count.store(0);
+        }
+
+        pool.run(num_jobs, [&runs](size_t index)
+                {
+                    ++runs[index];
+                });
+
+        for (const std::atomic<uint32_t>& count : runs)
+        {
+            EXPECT_EQ(1u, count.load());
+        }
+    }
+}
+
+TEST(CryptoWorkerPoolTests, jobs_run_on_several_threads)
+{
+    CryptoWorkerPool pool(2);
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+    std::atomic<uint32_t> started(0);
+
+    // Each job waits for the others to start, so the three threads must take part
+    pool.run(3, [&](size_t)
+            {
+                {
+                    std::lock_guard<std::mutex> guard(mutex);
+                    threads.insert(std::this_thread::get_id());
+                }
+                ++started;
+                while (started.load() < 3)
+                {
+                    std::this_thread::yield();
+                }
+            });
+
+    EXPECT_EQ(3u, threads.size());
+    EXPECT_EQ(1u, threads.count(std::this_thread::get_id()));
+}
+
+TEST(CryptoWorkerPoolTests, concurrent_callers)
+{
+    CryptoWorkerPool pool(2);
+    std::atomic<uint32_t> errors(0);
+    std::vector<std::thread> callers;
+
+    for (uint32_t caller = 0; caller < 4; ++caller)
+    {
+        callers.emplace_back([&pool, &errors]()
+                {
+                    for (size_t iteration = 0; iteration < 1000; ++iteration)
+                    {
+                        size_t num_jobs = 1 + iteration % 9;
+                        std::vector<size_t> results(num_jobs, 0);
+                        pool.run(num_jobs, [&results](size_t index)
+                        {
+                            results[index] = index + 1;
+                        });
+
+                        for (size_t i = 0; i < num_jobs; ++i)
+                        {
+                            if (results[i] != i + 1)
+                            {
+                                ++errors;
+                            }
+                        }
+                    }
+                });
+    }
+
+    for (std::thread& caller : callers)
+    {
+        caller.join();
+    }
+
+    EXPECT_EQ(0u, errors.load());
+}
+
+TEST(CryptoWorkerPoolTests, no_threads)
+{
+    CryptoWorkerPool pool(0);
+    std::vector<size_t> order;
+
+    pool.run(5, [&order](size_t index)
+            {
+                order.push_back(index);
+            });
+
+    EXPECT_EQ((std::vector<size_t>{0, 1, 2, 3, 4}), order);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -133,6 +133,215 @@ TEST(ReaderProxyTests, are_there_gaps)
     ASSERT_FALSE(rproxy.are_there_gaps());
 }
 
+/*
+ * Check the status of the changes is kept when the collection spans several words of the status bitmaps.
+ */
+TEST(ReaderProxyTests, requested_changes_set)
+{
+    StatefulWriter writerMock;
+    WriterTimes wTimes;
+    RemoteLocatorsAllocationAttributes alloc;
+    ReaderProxy rproxy(wTimes, alloc, &writerMock);
+
+    // Changes 1 to 100, except multiples of 10
+    for (uint32_t i = 1; i <= 100; ++i)
+    {
+        if (0 != i % 10)
+        {
+            ChangeForReader_t change(SequenceNumber_t(0, i));
+            change.setStatus(UNACKNOWLEDGED);
+            rproxy.add_change(change, false);
+        }
+    }
+    ASSERT_TRUE(rproxy.are_there_gaps());
+    ASSERT_TRUE(rproxy.has_unacknowledged());
+    ASSERT_EQ(SequenceNumber_t(0, 1), rproxy.first_relevant_sequence_number());
+
+    // Request changes 30 to 69
+    SequenceNumberSet_t requested(SequenceNumber_t(0, 30));
+    requested.add_range(SequenceNumber_t(0, 30), SequenceNumber_t(0, 70));
+    ASSERT_TRUE(rproxy.requested_changes_set(requested));
+    ASSERT_FALSE(rproxy.requested_changes_set(requested));
+
+    // Holes are not converted
+    ASSERT_EQ(36u, rproxy.perform_acknack_response());
+    ASSERT_EQ(0u, rproxy.perform_acknack_response());
+
+    std::vector<SequenceNumber_t> unsent;
+    std::vector<SequenceNumber_t> holes;
+    rproxy.for_each_unsent_change(SequenceNumber_t(0, 101), [&](const SequenceNumber_t& seq,
+            const ChangeForReader_t* change)
+            {
+                if (nullptr != change)
+                {
+                    ASSERT_EQ(seq, change->getSequenceNumber());
+                    ASSERT_EQ(UNSENT, change->getStatus());
+                    unsent.push_back(seq);
+                }
+                else
+                {
+                    holes.push_back(seq);
+                }
+            });
+    ASSERT_EQ(36u, unsent.size());
+    ASSERT_EQ(SequenceNumber_t(0, 31), unsent.front());
+    ASSERT_EQ(SequenceNumber_t(0, 69), unsent.back());
+    ASSERT_EQ(10u, holes.size());
+    ASSERT_EQ(SequenceNumber_t(0, 10), holes.front());
+    ASSERT_EQ(SequenceNumber_t(0, 100), holes.back());
+
+    // Acknowledge up to 49, with 50 being a hole
+    rproxy.acked_changes_set(SequenceNumber_t(0, 50));
+    ASSERT_TRUE(rproxy.change_is_acked(SequenceNumber_t(0, 45)));
+    ASSERT_FALSE(rproxy.change_is_acked(SequenceNumber_t(0, 51)));
+    ASSERT_EQ(SequenceNumber_t(0, 51), rproxy.first_relevant_sequence_number());
+
+    bool is_irrelevant = true;
+    ASSERT_TRUE(rproxy.change_is_unsent(SequenceNumber_t(0, 55), is_irrelevant));
+    ASSERT_FALSE(is_irrelevant);
+    ASSERT_FALSE(rproxy.change_is_unsent(SequenceNumber_t(0, 75), is_irrelevant));
+
+    // Acknowledge everything
+    rproxy.acked_changes_set(SequenceNumber_t(0, 101));
+    ASSERT_FALSE(rproxy.has_changes());
+    ASSERT_FALSE(rproxy.has_unacknowledged());
+    ASSERT_FALSE(rproxy.are_there_gaps());
+}
+
+/*
+ * Check the window of a writer with a bounded history reuses its positions, and grows for the changes not fitting on it.
+ */
+TEST(ReaderProxyTests, bounded_window)
+{
+    StatefulWriter writerMock;
+    writerMock.history()->m_att.initialReservedCaches = 33;
+    writerMock.history()->m_att.maximumReservedCaches = 33;
+    WriterTimes wTimes;
+    RemoteLocatorsAllocationAttributes alloc;
+    ReaderProxy rproxy(wTimes, alloc, &writerMock);
+
+    auto add_changes = [&rproxy](
+        uint32_t first,
+        uint32_t last)
+            {
+                for (uint32_t i = first; i <= last; ++i)
+                {
+                    ChangeForReader_t change(SequenceNumber_t(0, i));
+                    change.setStatus(UNACKNOWLEDGED);
+                    rproxy.add_change(change, false);
+                }
+            };
+
+    // The window holds 64 positions, starting at sequence number 0
+    add_changes(1, 63);
+    ASSERT_FALSE(rproxy.change_is_acked(SequenceNumber_t(0, 1)));
+    ASSERT_FALSE(rproxy.change_is_acked(SequenceNumber_t(0, 63)));
+    // Change 64 does not fit, so the ring grows to keep it
+    add_changes(64, 64);
+    ASSERT_FALSE(rproxy.change_is_acked(SequenceNumber_t(0, 64)));
+    ASSERT_EQ(SequenceNumber_t(0, 1), rproxy.first_relevant_sequence_number());
+
+    // Acknowledging the first word moves the window, and the positions left behind are reused
+    rproxy.acked_changes_set(SequenceNumber_t(0, 41));
+    ASSERT_EQ(SequenceNumber_t(0, 41), rproxy.first_relevant_sequence_number());
+    add_changes(65, 96);
+    ASSERT_TRUE(rproxy.change_is_acked(SequenceNumber_t(0, 40)));
+    ASSERT_FALSE(rproxy.change_is_acked(SequenceNumber_t(0, 41)));
+    ASSERT_FALSE(rproxy.change_is_acked(SequenceNumber_t(0, 64)));
+    ASSERT_FALSE(rproxy.change_is_acked(SequenceNumber_t(0, 96)));
+    ASSERT_TRUE(rproxy.change_is_acked(SequenceNumber_t(0, 97)));
+
+    SequenceNumberSet_t requested(SequenceNumber_t(0, 60));
+    requested.add_range(SequenceNumber_t(0, 60), SequenceNumber_t(0, 70));
+    ASSERT_TRUE(rproxy.requested_changes_set(requested));
+    ASSERT_EQ(10u, rproxy.perform_acknack_response());
+
+    rproxy.acked_changes_set(SequenceNumber_t(0, 97));
+    ASSERT_FALSE(rproxy.has_changes());
+    ASSERT_FALSE(rproxy.are_there_gaps());
+}
+
+/*
+ * Check an old change kept unacknowledged while the newer ones are removed from the history, as happens with
+ * keyed KEEP_LAST writers, does not make the newer changes be lost.
+ */
+TEST(ReaderProxyTests, bounded_window_old_change)
+{
+    StatefulWriter writerMock;
+    writerMock.history()->m_att.initialReservedCaches = 33;
+    writerMock.history()->m_att.maximumReservedCaches = 33;
+    WriterTimes wTimes;
+    RemoteLocatorsAllocationAttributes alloc;
+    ReaderProxy rproxy(wTimes, alloc, &writerMock);
+
+    ChangeForReader_t old_change(SequenceNumber_t(0, 1));
+    old_change.setStatus(UNACKNOWLEDGED);
+    rproxy.add_change(old_change, false);
+
+    // The history never holds more than 33 changes
+    for (uint32_t i = 2; i <= 1000; ++i)
+    {
+        ChangeForReader_t change(SequenceNumber_t(0, i));
+        change.setStatus(UNACKNOWLEDGED);
+        rproxy.add_change(change, false);
+        if (33u < i)
+        {
+            rproxy.change_has_been_removed(SequenceNumber_t(0, i - 32));
+        }
+    }
+
+    ASSERT_FALSE(rproxy.change_is_acked(SequenceNumber_t(0, 1)));
+    ASSERT_TRUE(rproxy.change_is_acked(SequenceNumber_t(0, 968)));
+    for (uint32_t i = 969; i <= 1000; ++i)
+    {
+        ASSERT_FALSE(rproxy.change_is_acked(SequenceNumber_t(0, i)));
+    }
+    ASSERT_TRUE(rproxy.are_there_gaps());
+
+    // Once the old change is removed, the window starts on the first of the newer ones
+    rproxy.change_has_been_removed(SequenceNumber_t(0, 1));
+    ASSERT_EQ(SequenceNumber_t(0, 969), rproxy.first_relevant_sequence_number());
+    for (uint32_t i = 1001; i <= 1100; ++i)
+    {
+        ChangeForReader_t change(SequenceNumber_t(0, i));
+        change.setStatus(UNACKNOWLEDGED);
+        rproxy.add_change(change, false);
+        ASSERT_FALSE(rproxy.change_is_acked(SequenceNumber_t(0, i)));
+    }
+
+    rproxy.acked_changes_set(SequenceNumber_t(0, 1101));
+    ASSERT_FALSE(rproxy.has_changes());
+}
+
+/*
+ * Check the window of a writer with an unbounded history grows keeping its contents.
+ */
+TEST(ReaderProxyTests, unbounded_window)
+{
+    StatefulWriter writerMock;
+    writerMock.history()->m_att.initialReservedCaches = 10;
+    writerMock.history()->m_att.maximumReservedCaches = 0;
+    WriterTimes wTimes;
+    RemoteLocatorsAllocationAttributes alloc;
+    ReaderProxy rproxy(wTimes, alloc, &writerMock);
+
+    for (uint32_t i = 1; i <= 1000; ++i)
+    {
+        ChangeForReader_t change(SequenceNumber_t(0, i));
+        change.setStatus(0 == i % 2 ? UNACKNOWLEDGED : UNSENT);
+        rproxy.add_change(change, false);
+    }
+
+    for (uint32_t i = 1; i <= 1000; ++i)
+    {
+        bool is_irrelevant = true;
+        ASSERT_EQ(0 != i % 2, rproxy.change_is_unsent(SequenceNumber_t(0, i), is_irrelevant));
+        ASSERT_FALSE(rproxy.change_is_acked(SequenceNumber_t(0, i)));
+    }
+    ASSERT_EQ(SequenceNumber_t(0, 1), rproxy.first_relevant_sequence_number());
+    ASSERT_FALSE(rproxy.are_there_gaps());
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
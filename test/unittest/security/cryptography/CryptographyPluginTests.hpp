@@ -24,6 +24,7 @@
 #include <openssl/rand.h>
 #include <cstdlib>
 #include <cstring>
+#include <thread>
 
 class CryptographyPluginTest : public ::testing::Test
 {
@@ -1831,4 +1832,171 @@ TEST_F(CryptographyPluginTest, transform_preprocess_secure_submessage)
     delete i_handle;
 }
 
+TEST_F(CryptographyPluginTest, transform_context_reuse_and_rekey)
+{
+    using namespace eprosima::fastrtps::rtps::security;
+
+    PKIIdentityHandle* i_handle = new PKIIdentityHandle();
+    AccessPermissionsHandle* perm_handle = new AccessPermissionsHandle();
+    ParticipantSecurityAttributes part_sec_attr;
+    EndpointSecurityAttributes sec_attrs;
+    SharedSecretHandle* shared_secret = new SharedSecretHandle();
+    SecurityException exception;
+
+    // Renew the session key every two messages
+    eprosima::fastrtps::rtps::PropertySeq prop_handle;
+    eprosima::fastrtps::rtps::Property prop;
+    prop.name("dds.sec.crypto.maxblockspersession");
+    prop.value("2");
+    prop_handle.push_back(prop);
+
+    sec_attrs.is_payload_protected = true;
+    sec_attrs.plugin_endpoint_attributes = PLUGIN_ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_PAYLOAD_ENCRYPTED;
+
+    std::vector<uint8_t> dummy_data(32);
+    SharedSecret::BinaryData binary_data;
+    RAND_bytes(dummy_data.data(), 32);
+    binary_data.name("Challenge1");
+    binary_data.value(dummy_data);
+    (*shared_secret)->data_.push_back(binary_data);
+    RAND_bytes(dummy_data.data(), 32);
+    binary_data.name("Challenge2");
+    binary_data.value(dummy_data);
+    (*shared_secret)->data_.push_back(binary_data);
+    RAND_bytes(dummy_data.data(), 32);
+    binary_data.name("SharedSecret");
+    binary_data.value(dummy_data);
+    (*shared_secret)->data_.push_back(binary_data);
+
+    struct Endpoints
+    {
+        ParticipantCryptoHandle* participant_A;
+        ParticipantCryptoHandle* participant_B;
+        ParticipantCryptoHandle* ParticipantA_remote;
+        ParticipantCryptoHandle* ParticipantB_remote;
+        DatawriterCryptoHandle* writer;
+        DatareaderCryptoHandle* reader;
+        DatareaderCryptoHandle* remote_reader;
+        DatawriterCryptoHandle* remote_writer;
+    };
+
+    auto create_endpoints = [&](Endpoints& e)
+            {
+                e.participant_A = CryptoPlugin->keyfactory()->register_local_participant(*i_handle, *perm_handle,
+                                prop_handle, part_sec_attr, exception);
+                e.participant_B = CryptoPlugin->keyfactory()->register_local_participant(*i_handle, *perm_handle,
+                                prop_handle, part_sec_attr, exception);
+                e.reader = CryptoPlugin->keyfactory()->register_local_datareader(*e.participant_A, prop_handle,
+                                sec_attrs, exception);
+                e.writer = CryptoPlugin->keyfactory()->register_local_datawriter(*e.participant_B, prop_handle,
+                                sec_attrs, exception);
+                e.ParticipantA_remote = CryptoPlugin->keyfactory()->register_matched_remote_participant(
+                    *e.participant_A, *i_handle, *perm_handle, *shared_secret, exception);
+                e.ParticipantB_remote = CryptoPlugin->keyfactory()->register_matched_remote_participant(
+                    *e.participant_B, *i_handle, *perm_handle, *shared_secret, exception);
+                e.remote_reader = CryptoPlugin->keyfactory()->register_matched_remote_datareader(*e.writer,
+                                *e.ParticipantB_remote, *shared_secret, false, exception);
+                e.remote_writer = CryptoPlugin->keyfactory()->register_matched_remote_datawriter(*e.reader,
+                                *e.ParticipantA_remote, *shared_secret, exception);
+
+                DatawriterCryptoTokenSeq Writer_CryptoTokens, Reader_CryptoTokens;
+                CryptoPlugin->keyexchange()->create_local_datawriter_crypto_tokens(Writer_CryptoTokens, *e.writer,
+                        *e.remote_reader, exception);
+                CryptoPlugin->keyexchange()->create_local_datareader_crypto_tokens(Reader_CryptoTokens, *e.reader,
+                        *e.remote_writer, exception);
+                CryptoPlugin->keyexchange()->set_remote_datareader_crypto_tokens(*e.writer, *e.remote_reader,
+                        Reader_CryptoTokens, exception);
+                CryptoPlugin->keyexchange()->set_remote_datawriter_crypto_tokens(*e.reader, *e.remote_writer,
+                        Writer_CryptoTokens, exception);
+            };
+
+    auto delete_endpoints = [&](Endpoints& e)
+            {
+                EXPECT_TRUE(CryptoPlugin->keyfactory()->unregister_datawriter(e.writer, exception));
+                EXPECT_TRUE(CryptoPlugin->keyfactory()->unregister_datawriter(e.remote_writer, exception));
+                EXPECT_TRUE(CryptoPlugin->keyfactory()->unregister_datareader(e.reader, exception));
+                EXPECT_TRUE(CryptoPlugin->keyfactory()->unregister_datareader(e.remote_reader, exception));
+                EXPECT_TRUE(CryptoPlugin->keyfactory()->unregister_participant(e.participant_A, exception));
+                EXPECT_TRUE(CryptoPlugin->keyfactory()->unregister_participant(e.ParticipantA_remote, exception));
+                EXPECT_TRUE(CryptoPlugin->keyfactory()->unregister_participant(e.participant_B, exception));
+                EXPECT_TRUE(CryptoPlugin->keyfactory()->unregister_participant(e.ParticipantB_remote, exception));
+            };
+
+    char message[] = "My goose is cooked"; //Length 18
+    eprosima::fastrtps::rtps::SerializedPayload_t plain_payload(18);
+    memcpy(plain_payload.data, message, 18);
+    plain_payload.length = 18;
+    std::vector<uint8_t> inline_qos;
+
+    auto encode = [&](Endpoints& e, eprosima::fastrtps::rtps::SerializedPayload_t& encoded_payload)
+            {
+                encoded_payload.pos = 0;
+                encoded_payload.length = 0;
+                return CryptoPlugin->cryptotransform()->encode_serialized_payload(encoded_payload, inline_qos,
+                               plain_payload, *e.writer, exception);
+            };
+
+    auto decode = [&](Endpoints& e, eprosima::fastrtps::rtps::SerializedPayload_t& encoded_payload)
+            {
+                eprosima::fastrtps::rtps::SerializedPayload_t decoded_payload(18 + 32);
+                encoded_payload.pos = 0;
+                return CryptoPlugin->cryptotransform()->decode_serialized_payload(decoded_payload, encoded_payload,
+                               inline_qos, *e.reader, *e.remote_writer, exception) &&
+                       18 == decoded_payload.length && 0 == memcmp(plain_payload.data, decoded_payload.data, 18);
+            };
+
+    Endpoints first;
+    create_endpoints(first);
+
+    // Several messages per session and several sessions, so cached contexts and session keys are both reused
+    // and replaced
+    std::vector<eprosima::fastrtps::rtps::SerializedPayload_t> encoded_payloads(7);
+    for (eprosima::fastrtps::rtps::SerializedPayload_t& encoded_payload : encoded_payloads)
+    {
+        encoded_payload.reserve(100);
+        ASSERT_TRUE(encode(first, encoded_payload));
+        ASSERT_TRUE(decode(first, encoded_payload));
+    }
+
+    // Messages of older sessions are still decoded, on this thread and on a thread with empty caches
+    for (eprosima::fastrtps::rtps::SerializedPayload_t& encoded_payload : encoded_payloads)
+    {
+        EXPECT_TRUE(decode(first, encoded_payload));
+    }
+    bool other_thread_ok = true;
+    std::thread other_thread([&]()
+            {
+                for (eprosima::fastrtps::rtps::SerializedPayload_t& encoded_payload : encoded_payloads)
+                {
+                    other_thread_ok &= decode(first, encoded_payload);
+                }
+            });
+    other_thread.join();
+    EXPECT_TRUE(other_thread_ok);
+
+    // New keys after unregistering work on the threads that cached the old ones
+    delete_endpoints(first);
+    Endpoints second;
+    create_endpoints(second);
+
+    eprosima::fastrtps::rtps::SerializedPayload_t encoded_payload(100);
+    for (size_t i = 0; i < encoded_payloads.size(); ++i)
+    {
+        ASSERT_TRUE(encode(second, encoded_payload));
+        ASSERT_TRUE(decode(second, encoded_payload));
+    }
+
+    // Messages protected with the unregistered keys are not accepted
+    for (eprosima::fastrtps::rtps::SerializedPayload_t& old_payload : encoded_payloads)
+    {
+        EXPECT_FALSE(decode(second, old_payload));
+    }
+
+    delete_endpoints(second);
+
+    delete shared_secret;
+    delete perm_handle;
+    delete i_handle;
+}
+
 #endif // ifndef _UNITTEST_SECURITY_CRYPTOGRAPHY_CRYPTOGRAPHYPLUGINTESTS_HPP_
@@ -86,6 +86,12 @@ protected:
         data_[16].physical_data({});
         data_to_check_[16] = &data_[16].physical_data();
 
+        data_[17].writer_reader_latency_summary({});
+        data_to_check_[17] = &data_[17].writer_reader_latency_summary();
+
+        data_[18].locator2locator_latency_summary({});
+        data_to_check_[18] = &data_[18].locator2locator_latency_summary();
+
         for (size_t i = 0; i < kinds_.size(); i++)
         {
             data_[i]._d(kinds_[i]);
@@ -153,10 +159,10 @@ protected:
         }
     }
 
-    std::array<testing::StrictMock<DataWriter>, 17> writers_;
-    std::array<void*, 17> data_to_check_;
-    std::array<Data, 17> data_;
-    std::array<EventKind, 17> kinds_ =
+    std::array<testing::StrictMock<DataWriter>, 19> writers_;
+    std::array<void*, 19> data_to_check_;
+    std::array<Data, 19> data_;
+    std::array<EventKind, 19> kinds_ =
     {
         EventKind::HISTORY2HISTORY_LATENCY,
         EventKind::NETWORK_LATENCY,
@@ -174,7 +180,9 @@ protected:
         EventKind::EDP_PACKETS,
         EventKind::DISCOVERED_ENTITY,
         EventKind::SAMPLE_DATAS,
-        EventKind::PHYSICAL_DATA
+        EventKind::PHYSICAL_DATA,
+        EventKind::HISTORY2HISTORY_LATENCY_SUMMARY,
+        EventKind::NETWORK_LATENCY_SUMMARY
     };
 
     DomainParticipantStatisticsListener listener_;
@@ -269,6 +269,8 @@ TEST_F(StatisticsDomainParticipantTests, EnableDisableStatisticsDataWriterTest)
     eprosima::fastdds::dds::TypeSupport discovery_type(new DiscoveryTimePubSubType);
     eprosima::fastdds::dds::TypeSupport sample_identity_count_type(new SampleIdentityCountPubSubType);
     eprosima::fastdds::dds::TypeSupport physical_data_type(new PhysicalDataPubSubType);
+    eprosima::fastdds::dds::TypeSupport history_latency_summary_type(new WriterReaderLatencySummaryPubSubType);
+    eprosima::fastdds::dds::TypeSupport network_latency_summary_type(new Locator2LocatorLatencySummaryPubSubType);
     eprosima::fastdds::dds::TypeSupport null_type(nullptr);
 
     // 4. Check that the types are not registered yet
@@ -280,6 +282,8 @@ TEST_F(StatisticsDomainParticipantTests, EnableDisableStatisticsDataWriterTest)
     EXPECT_EQ(null_type, statistics_participant->find_type(discovery_type.get_type_name()));
     EXPECT_EQ(null_type, statistics_participant->find_type(sample_identity_count_type.get_type_name()));
     EXPECT_EQ(null_type, statistics_participant->find_type(physical_data_type.get_type_name()));
+    EXPECT_EQ(null_type, statistics_participant->find_type(history_latency_summary_type.get_type_name()));
+    EXPECT_EQ(null_type, statistics_participant->find_type(network_latency_summary_type.get_type_name()));
 
     // 5. Check that the topics do not exist
     EXPECT_EQ(nullptr, statistics_participant->lookup_topicdescription(HISTORY_LATENCY_TOPIC));
@@ -299,6 +303,8 @@ TEST_F(StatisticsDomainParticipantTests, EnableDisableStatisticsDataWriterTest)
     EXPECT_EQ(nullptr, statistics_participant->lookup_topicdescription(DISCOVERY_TOPIC));
     EXPECT_EQ(nullptr, statistics_participant->lookup_topicdescription(SAMPLE_DATAS_TOPIC));
     EXPECT_EQ(nullptr, statistics_participant->lookup_topicdescription(PHYSICAL_DATA_TOPIC));
+    EXPECT_EQ(nullptr, statistics_participant->lookup_topicdescription(HISTORY_LATENCY_SUMMARY_TOPIC));
+    EXPECT_EQ(nullptr, statistics_participant->lookup_topicdescription(NETWORK_LATENCY_SUMMARY_TOPIC));
 
     // 6. Enable each statistics DataWriter checking that topics are created and types are registered.
     EXPECT_EQ(ReturnCode_t::RETCODE_OK, statistics_participant->enable_statistics_datawriter(HISTORY_LATENCY_TOPIC,
@@ -387,6 +393,18 @@ TEST_F(StatisticsDomainParticipantTests, EnableDisableStatisticsDataWriterTest)
     EXPECT_NE(nullptr, statistics_participant->lookup_topicdescription(PHYSICAL_DATA_TOPIC));
     EXPECT_TRUE(physical_data_type == statistics_participant->find_type(physical_data_type.get_type_name()));
 
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, statistics_participant->enable_statistics_datawriter(
+                HISTORY_LATENCY_SUMMARY_TOPIC, STATISTICS_DATAWRITER_QOS));
+    EXPECT_NE(nullptr, statistics_participant->lookup_topicdescription(HISTORY_LATENCY_SUMMARY_TOPIC));
+    EXPECT_TRUE(history_latency_summary_type == statistics_participant->find_type(
+                history_latency_summary_type.get_type_name()));
+
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, statistics_participant->enable_statistics_datawriter(
+                NETWORK_LATENCY_SUMMARY_TOPIC, STATISTICS_DATAWRITER_QOS));
+    EXPECT_NE(nullptr, statistics_participant->lookup_topicdescription(NETWORK_LATENCY_SUMMARY_TOPIC));
+    EXPECT_TRUE(network_latency_summary_type == statistics_participant->find_type(
+                network_latency_summary_type.get_type_name()));
+
     // 7. Enable an already enabled statistics DataWriter
     EXPECT_EQ(ReturnCode_t::RETCODE_OK, statistics_participant->enable_statistics_datawriter(SAMPLE_DATAS_TOPIC,
             STATISTICS_DATAWRITER_QOS));
@@ -494,6 +512,16 @@ TEST_F(StatisticsDomainParticipantTests, EnableDisableStatisticsDataWriterTest)
     EXPECT_EQ(ReturnCode_t::RETCODE_OK, statistics_participant->disable_statistics_datawriter(PHYSICAL_DATA_TOPIC));
     EXPECT_EQ(nullptr, statistics_participant->lookup_topicdescription(PHYSICAL_DATA_TOPIC));
     EXPECT_EQ(null_type, statistics_participant->find_type(physical_data_type.get_type_name()));
+
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, statistics_participant->disable_statistics_datawriter(
+                HISTORY_LATENCY_SUMMARY_TOPIC));
+    EXPECT_EQ(nullptr, statistics_participant->lookup_topicdescription(HISTORY_LATENCY_SUMMARY_TOPIC));
+    EXPECT_EQ(null_type, statistics_participant->find_type(history_latency_summary_type.get_type_name()));
+
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, statistics_participant->disable_statistics_datawriter(
+                NETWORK_LATENCY_SUMMARY_TOPIC));
+    EXPECT_EQ(nullptr, statistics_participant->lookup_topicdescription(NETWORK_LATENCY_SUMMARY_TOPIC));
+    EXPECT_EQ(null_type, statistics_participant->find_type(network_latency_summary_type.get_type_name()));
 #endif // FASTDDS_STATISTICS
 
     EXPECT_EQ(ReturnCode_t::RETCODE_OK, eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->
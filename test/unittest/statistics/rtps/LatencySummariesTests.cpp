@@ -0,0 +1,292 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <statistics/rtps/LatencyHistogram.hpp>
+#include <statistics/rtps/LatencySummaries.hpp>
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastdds::statistics;
+
+static detail::GUID_s make_guid(
+        uint8_t id)
+{
+    detail::GUID_s guid;
+    guid.guidPrefix().value()[0] = id;
+    guid.entityId().value()[3] = id;
+    return guid;
+}
+
+static detail::Locator_s make_locator(
+        uint32_t port)
+{
+    detail::Locator_s locator;
+    locator.kind(1);
+    locator.port(port);
+    return locator;
+}
+
+static Data history_latency(
+        uint8_t writer,
+        uint8_t reader,
+        float latency)
+{
+    WriterReaderData notification;
+    notification.writer_guid(make_guid(writer));
+    notification.reader_guid(make_guid(reader));
+    notification.data(latency);
+
+    Data data;
+    data.writer_reader_data(notification);
+    return data;
+}
+
+static Data network_latency(
+        uint32_t src_port,
+        uint32_t dst_port,
+        float latency)
+{
+    Locator2LocatorData notification;
+    notification.src_locator(make_locator(src_port));
+    notification.dst_locator(make_locator(dst_port));
+    notification.data(latency);
+
+    Data data;
+    data.locator2locator_data(notification);
+    return data;
+}
+
+// Every value falls on a bucket whose highest value is close to it
+TEST(LatencyHistogramTests, bucket_layout)
+{
+    size_t previous_index = 0;
+    for (uint64_t value = 0; value < (1ull << 36); value += 1 + value / 7)
+    {
+        size_t index = LatencyHistogram::bucket_index(value);
+        ASSERT_LT(index, static_cast<size_t>(LatencyHistogram::num_buckets));
+        EXPECT_LE(previous_index, index);
+        previous_index = index;
+
+        uint64_t highest = LatencyHistogram::highest_value(index);
+        EXPECT_LE(value, highest);
+        EXPECT_LE(static_cast<double>(highest - value), static_cast<double>(value) / LatencyHistogram::sub_buckets);
+    }
+
+    // Small values are exact
+    for (uint64_t value = 0; value < 2 * LatencyHistogram::sub_buckets; ++value)
+    {
+        EXPECT_EQ(value, LatencyHistogram::highest_value(LatencyHistogram::bucket_index(value)));
+    }
+}
+
+TEST(LatencyHistogramTests, percentiles)
+{
+    LatencyHistogram histogram;
+    detail::LatencyPercentiles_s percentiles;
+
+    EXPECT_FALSE(histogram.take(percentiles));
+
+    for (uint64_t value = 1; value <= 1000; ++value)
+    {
+        histogram.record(value * 1000);
+    }
+
+    ASSERT_TRUE(histogram.take(percentiles));
+    EXPECT_EQ(1000u, percentiles.count());
+    EXPECT_NEAR(500000.0f, percentiles.p50(), 500000.0f / LatencyHistogram::sub_buckets);
+    EXPECT_NEAR(990000.0f, percentiles.p99(), 990000.0f / LatencyHistogram::sub_buckets);
+    EXPECT_NEAR(999000.0f, percentiles.p999(), 999000.0f / LatencyHistogram::sub_buckets);
+    EXPECT_EQ(1000000.0f, percentiles.maximum());
+
+    // The histogram is empty after taking the percentiles
+    EXPECT_FALSE(histogram.take(percentiles));
+
+    // A single value is every percentile
+    histogram.record(12345);
+    ASSERT_TRUE(histogram.take(percentiles));
+    EXPECT_EQ(1u, percentiles.count());
+    EXPECT_EQ(12345.0f, percentiles.p50());
+    EXPECT_EQ(12345.0f, percentiles.p99());
+    EXPECT_EQ(12345.0f, percentiles.p999());
+    EXPECT_EQ(12345.0f, percentiles.maximum());
+
+    // Values out of range keep an exact maximum
+    histogram.record(1ull << 40);
+    ASSERT_TRUE(histogram.take(percentiles));
+    EXPECT_EQ(static_cast<float>(1ull << 40), percentiles.maximum());
+    EXPECT_LE(percentiles.p50(), percentiles.maximum());
+}
+
+TEST(LatencyHistogramTests, concurrent_record)
+{
+    constexpr uint32_t num_threads = 4;
+    constexpr uint32_t num_values = 10000;
+
+    LatencyHistogram histogram;
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < num_threads; ++i)
+    {
+        threads.emplace_back([&histogram, i]()
+                {
+                    for (uint32_t value = 0; value < num_values; ++value)
+                    {
+                        histogram.record(value * (i + 1));
+                    }
+                });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    detail::LatencyPercentiles_s percentiles;
+    ASSERT_TRUE(histogram.take(percentiles));
+    EXPECT_EQ(num_threads * num_values, percentiles.count());
+    EXPECT_EQ(static_cast<float>((num_values - 1) * num_threads), percentiles.maximum());
+}
+
+TEST(LatencySummariesTests, summaries_per_pair)
+{
+    LatencySummaries summaries;
+
+    for (uint32_t i = 1; i <= 100; ++i)
+    {
+        summaries.on_statistics_data(history_latency(1, 2, 1000.0f * i));
+        summaries.on_statistics_data(network_latency(7400, 7410, 10.0f * i));
+    }
+    summaries.on_statistics_data(history_latency(1, 3, 5000.0f));
+    // Latencies between unsynchronized clocks are counted as zero
+    summaries.on_statistics_data(history_latency(1, 3, -5000.0f));
+
+    // Other events are ignored
+    Data discovery;
+    discovery.discovery_time(DiscoveryTime());
+    summaries.on_statistics_data(discovery);
+
+    uint32_t history_summaries = 0;
+    uint32_t network_summaries = 0;
+    summaries.take([&](const Data& data)
+            {
+                if (EventKind::HISTORY2HISTORY_LATENCY_SUMMARY == data._d())
+                {
+                    const WriterReaderLatencySummary& summary = data.writer_reader_latency_summary();
+                    EXPECT_EQ(1, summary.writer_guid().guidPrefix().value()[0]);
+                    if (2 == summary.reader_guid().guidPrefix().value()[0])
+                    {
+                        EXPECT_EQ(100u, summary.data().count());
+                        EXPECT_EQ(100000.0f, summary.data().maximum());
+                    }
+                    else
+                    {
+                        EXPECT_EQ(3, summary.reader_guid().guidPrefix().value()[0]);
+                        EXPECT_EQ(2u, summary.data().count());
+                        EXPECT_EQ(0.0f, summary.data().p50());
+                        EXPECT_EQ(5000.0f, summary.data().maximum());
+                    }
+                    ++history_summaries;
+                }
+                else
+                {
+                    ASSERT_EQ(EventKind::NETWORK_LATENCY_SUMMARY, data._d());
+                    const Locator2LocatorLatencySummary& summary = data.locator2locator_latency_summary();
+                    EXPECT_EQ(7400u, summary.src_locator().port());
+                    EXPECT_EQ(7410u, summary.dst_locator().port());
+                    EXPECT_EQ(100u, summary.data().count());
+                    EXPECT_EQ(1000.0f, summary.data().maximum());
+                    ++network_summaries;
+                }
+            });
+    EXPECT_EQ(2u, history_summaries);
+    EXPECT_EQ(1u, network_summaries);
+
+    // Pairs without new latencies are not reported
+    summaries.on_statistics_data(history_latency(1, 2, 1000.0f));
+    uint32_t num_summaries = 0;
+    summaries.take([&num_summaries](const Data& data)
+            {
+                EXPECT_EQ(EventKind::HISTORY2HISTORY_LATENCY_SUMMARY, data._d());
+                EXPECT_EQ(1u, data.writer_reader_latency_summary().data().count());
+                ++num_summaries;
+            });
+    EXPECT_EQ(1u, num_summaries);
+}
+
+TEST(LatencySummariesTests, max_pairs)
+{
+    LatencySummaries summaries;
+
+    for (uint32_t port = 0; port < LatencySummaries::max_pairs + 10; ++port)
+    {
+        summaries.on_statistics_data(network_latency(port, 7410, 1000.0f));
+    }
+
+    uint32_t num_summaries = 0;
+    summaries.take([&num_summaries](const Data&)
+            {
+                ++num_summaries;
+            });
+    EXPECT_EQ(LatencySummaries::max_pairs, num_summaries);
+}
+
+TEST(LatencySummariesTests, released_pairs)
+{
+    LatencySummaries summaries;
+
+    // Pairs without latencies on a period are released, so a different set of pairs may be used on each one
+    const uint32_t pairs_per_period = LatencySummaries::max_pairs / 2 + 1;
+    for (uint32_t period = 0; period < 4; ++period)
+    {
+        for (uint32_t port = 0; port < pairs_per_period; ++port)
+        {
+            summaries.on_statistics_data(network_latency(period * pairs_per_period + port, 7410, 1000.0f));
+        }
+        summaries.on_statistics_data(history_latency(1, 2, 1000.0f * (period + 1)));
+
+        uint32_t network_summaries = 0;
+        uint32_t history_summaries = 0;
+        summaries.take([&](const Data& data)
+                {
+                    if (EventKind::NETWORK_LATENCY_SUMMARY == data._d())
+                    {
+                        const Locator2LocatorLatencySummary& summary = data.locator2locator_latency_summary();
+                        EXPECT_LE(period * pairs_per_period, summary.src_locator().port());
+                        EXPECT_GT((period + 1) * pairs_per_period, summary.src_locator().port());
+                        EXPECT_EQ(1u, summary.data().count());
+                        ++network_summaries;
+                    }
+                    else
+                    {
+                        // The pair with latencies on every period is kept
+                        ASSERT_EQ(EventKind::HISTORY2HISTORY_LATENCY_SUMMARY, data._d());
+                        EXPECT_EQ(1u, data.writer_reader_latency_summary().data().count());
+                        EXPECT_EQ(1000.0f * (period + 1), data.writer_reader_latency_summary().data().maximum());
+                        ++history_summaries;
+                    }
+                });
+        EXPECT_EQ(pairs_per_period, network_summaries);
+        EXPECT_EQ(1u, history_summaries);
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
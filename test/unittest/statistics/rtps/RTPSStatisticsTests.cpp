@@ -111,6 +111,12 @@ struct MockListener : IListener
             case SUBSCRIPTION_THROUGHPUT:
                 on_subscriber_throughput(data.entity_data());
                 break;
+            case HISTORY2HISTORY_LATENCY_SUMMARY:
+                on_history_latency_summary(data.writer_reader_latency_summary());
+                break;
+            case NETWORK_LATENCY_SUMMARY:
+                on_network_latency_summary(data.locator2locator_latency_summary());
+                break;
             default:
                 on_unexpected_kind(kind);
                 break;
@@ -133,6 +139,9 @@ struct MockListener : IListener
     MOCK_METHOD1(on_sample_datas, void(const eprosima::fastdds::statistics::SampleIdentityCount&));
     MOCK_METHOD1(on_publisher_throughput, void(const eprosima::fastdds::statistics::EntityData&));
     MOCK_METHOD1(on_subscriber_throughput, void(const eprosima::fastdds::statistics::EntityData&));
+    MOCK_METHOD1(on_history_latency_summary, void(const eprosima::fastdds::statistics::WriterReaderLatencySummary&));
+    MOCK_METHOD1(on_network_latency_summary,
+            void(const eprosima::fastdds::statistics::Locator2LocatorLatencySummary&));
     MOCK_METHOD1(on_unexpected_kind, void(eprosima::fastdds::statistics::EventKind));
 };
 
@@ -859,6 +868,86 @@ TEST_F(RTPSStatisticsTests, statistics_rpts_listener_gap_callback)
     EXPECT_TRUE(participant_->remove_statistics_listener(participant_writer_listener, EventKind::GAP_COUNT));
 }
 
+/*
+ * This test checks the latency summaries:
+ * - HISTORY2HISTORY_LATENCY_SUMMARY callbacks are periodically performed
+ * - NETWORK_LATENCY_SUMMARY callbacks are periodically performed
+ * - Listeners only requesting the summaries are not notified of every latency event
+ */
+TEST_F(RTPSStatisticsTests, statistics_rpts_latency_summaries)
+{
+    using namespace ::testing;
+    using namespace fastrtps;
+    using namespace fastrtps::rtps;
+    using namespace std;
+
+    // create the testing endpoints
+    uint16_t length = 255;
+    create_endpoints(length, RELIABLE);
+
+    auto summaries_listener = make_shared<MockListener>();
+    ASSERT_TRUE(participant_->add_statistics_listener(summaries_listener,
+            EventKind::HISTORY2HISTORY_LATENCY_SUMMARY | EventKind::NETWORK_LATENCY_SUMMARY));
+
+    // check the percentiles are consistent
+    auto consistent = [](const eprosima::fastdds::statistics::detail::LatencyPercentiles_s& data)
+            {
+                return 0 < data.count() && data.p50() <= data.p99() && data.p99() <= data.p999() &&
+                       data.p999() <= data.maximum();
+            };
+
+    atomic_int history_summaries(0);
+    atomic_int network_summaries(0);
+    ON_CALL(*summaries_listener, on_history_latency_summary)
+            .WillByDefault([&](const eprosima::fastdds::statistics::WriterReaderLatencySummary& data)
+            {
+                EXPECT_TRUE(consistent(data.data()));
+                ++history_summaries;
+            });
+    ON_CALL(*summaries_listener, on_network_latency_summary)
+            .WillByDefault([&](const eprosima::fastdds::statistics::Locator2LocatorLatencySummary& data)
+            {
+                EXPECT_TRUE(consistent(data.data()));
+                ++network_summaries;
+            });
+    EXPECT_CALL(*summaries_listener, on_history_latency_summary)
+            .Times(AtLeast(1));
+    EXPECT_CALL(*summaries_listener, on_network_latency_summary)
+            .Times(AtLeast(1));
+    EXPECT_CALL(*summaries_listener, on_history_latency)
+            .Times(0);
+    EXPECT_CALL(*summaries_listener, on_network_latency)
+            .Times(0);
+
+    // match writer and reader on a dummy topic
+    match_endpoints(false, "string", "statisticsSmallTopic");
+
+    // exchange data
+    write_small_sample(length);
+
+    // wait for reception
+    EXPECT_TRUE(reader_->wait_for_unread_cache(Duration_t(5, 0)));
+
+    // receive the sample
+    CacheChange_t* reader_change = nullptr;
+    ASSERT_TRUE(reader_->nextUntakenCache(&reader_change, nullptr));
+    reader_->releaseCache(reader_change);
+
+    // wait for the summaries to be published
+    int loop = 0;
+    while (history_summaries < 1 || network_summaries < 1)
+    {
+        this_thread::sleep_for(chrono::milliseconds(100));
+        if ( ++loop > 30 )
+        {
+            break;
+        }
+    }
+
+    EXPECT_TRUE(participant_->remove_statistics_listener(summaries_listener,
+            EventKind::HISTORY2HISTORY_LATENCY_SUMMARY | EventKind::NETWORK_LATENCY_SUMMARY));
+}
+
 /*
  * This test checks the participant discovery callbacks
  */
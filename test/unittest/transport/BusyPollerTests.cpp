@@ -0,0 +1,156 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rtps/resources/BusyPoller.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace eprosima::fastrtps::rtps;
+
+class CountingSource : public BusyPoller::Source
+{
+public:
+
+    bool poll() override
+    {
+        ++polls;
+        if (pending_data.load() > 0)
+        {
+            --pending_data;
+            ++processed_data;
+            return true;
+        }
+        return false;
+    }
+
+    bool wait_processed(
+            uint32_t expected)
+    {
+        auto end = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (processed_data.load() < expected)
+        {
+            if (std::chrono::steady_clock::now() > end)
+            {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+
+    std::atomic<uint32_t> polls{0};
+    std::atomic<uint32_t> pending_data{0};
+    std::atomic<uint32_t> processed_data{0};
+};
+
+TEST(BusyPollerTests, sources_polled_until_removed)
+{
+    BusyPollAttributes att;
+    att.enabled = true;
+    att.spin_rounds = 100;
+    BusyPoller poller(att);
+
+    CountingSource first;
+    CountingSource second;
+    poller.add_source(&first);
+    poller.add_source(&second);
+
+    first.pending_data = 3;
+    second.pending_data = 2;
+    EXPECT_TRUE(first.wait_processed(3));
+    EXPECT_TRUE(second.wait_processed(2));
+
+    // Once removed, the source is not polled anymore
+    poller.remove_source(&first);
+    uint32_t polls = first.polls.load();
+    second.pending_data = 1;
+    EXPECT_TRUE(second.wait_processed(3));
+    EXPECT_EQ(polls, first.polls.load());
+
+    poller.remove_source(&second);
+}
+
+TEST(BusyPollerTests, sources_polled_while_backing_off)
+{
+    BusyPollAttributes att;
+    att.enabled = true;
+    att.spin_rounds = 10;
+    att.max_backoff_us = 1000;
+    BusyPoller poller(att);
+
+    CountingSource source;
+    poller.add_source(&source);
+
+    // Let the poller reach the longest sleep
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    source.pending_data = 1;
+    EXPECT_TRUE(source.wait_processed(1));
+
+    poller.remove_source(&source);
+}
+
+TEST(BusyPollerTests, source_removed_from_its_poll)
+{
+    class SelfRemovingSource : public BusyPoller::Source
+    {
+    public:
+
+        explicit SelfRemovingSource(
+                BusyPoller& poller)
+            : poller_(poller)
+        {
+        }
+
+        bool poll() override
+        {
+            ++polls;
+            poller_.remove_source(this);
+            return true;
+        }
+
+        std::atomic<uint32_t> polls{0};
+
+    private:
+
+        BusyPoller& poller_;
+    };
+
+    BusyPollAttributes att;
+    att.enabled = true;
+    BusyPoller poller(att);
+
+    SelfRemovingSource self_removing(poller);
+    CountingSource other;
+    poller.add_source(&self_removing);
+    poller.add_source(&other);
+
+    other.pending_data = 1;
+    EXPECT_TRUE(other.wait_processed(1));
+    EXPECT_EQ(1u, self_removing.polls.load());
+
+    poller.remove_source(&other);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
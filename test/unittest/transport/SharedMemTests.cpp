@@ -21,6 +21,7 @@
 #include "../../../src/cpp/rtps/transport/shared_mem/SharedMemManager.hpp"
 #include "../../../src/cpp/rtps/transport/shared_mem/SharedMemGlobal.hpp"
 #include "../../../src/cpp/rtps/transport/shared_mem/MultiProducerConsumerRingBuffer.hpp"
+#include "../../../src/cpp/rtps/transport/shared_mem/test_SharedMemChannelResource.hpp"
 
 #include <string>
 #include <fstream>
@@ -1344,6 +1345,274 @@ TEST_F(SHMTransportTests, port_listener_dead_recover)
     thread_listener1.join();
 }
 
+TEST_F(SHMTransportTests, futex_notification)
+{
+    const std::string domain_name("SHMTests");
+
+    auto shared_mem_manager = SharedMemManager::create(domain_name);
+    SharedMemGlobal* shared_mem_global = shared_mem_manager->global_segment();
+    auto segment = shared_mem_manager->create_segment(1024, 16);
+
+    SharedMemGlobal::PortNotificationSettings notification;
+    notification.use_futex = true;
+    notification.max_spin_us = 20;
+
+    shared_mem_manager->remove_port(0);
+    auto read_port = shared_mem_manager->open_port(0, 16, 1000, SharedMemGlobal::Port::OpenMode::ReadExclusive,
+                    notification);
+    auto listener = read_port->create_listener();
+
+    // The notification mechanism is the one chosen by the creator of the port
+    auto global_port = shared_mem_global->open_port(0, 16, 1000, SharedMemGlobal::Port::OpenMode::Write);
+    ASSERT_EQ(SharedMemFutex::is_supported(), global_port->is_futex_notified());
+
+    // Processes looking for the node of ports without futex do not find it
+    {
+        SharedMemSegment port_segment(boost::interprocess::open_only,
+                (shared_mem_global->domain_name() + "_port0").c_str());
+        auto find_node = [&port_segment](
+            bool is_futex_notified)
+                {
+                    return port_segment.get().find<SharedMemGlobal::PortNode>(
+                        SharedMemGlobal::port_node_name(is_futex_notified).c_str()).first;
+                };
+        ASSERT_EQ(SharedMemFutex::is_supported(), nullptr == find_node(false));
+        ASSERT_EQ(SharedMemFutex::is_supported(), nullptr != find_node(true));
+    }
+
+    auto write_port = shared_mem_manager->open_port(0, 16, 1000, SharedMemGlobal::Port::OpenMode::Write);
+
+    const uint8_t num_buffers = 32;
+    std::atomic<uint8_t> received_count(0);
+    std::thread thread_listener([&]
+            {
+                for (uint8_t i = 1; i <= num_buffers; i++)
+                {
+                    auto buf = listener->pop();
+                    ASSERT_TRUE(buf != nullptr);
+                    ASSERT_EQ(i, *static_cast<uint8_t*>(buf->data()));
+                    received_count = i;
+                }
+
+                // Blocked until the listener is closed
+                ASSERT_TRUE(listener->pop() == nullptr);
+            });
+
+    for (uint8_t i = 1; i <= num_buffers; i++)
+    {
+        auto buf = segment->alloc_buffer(1, std::chrono::steady_clock::now() + std::chrono::milliseconds(100));
+        ASSERT_TRUE(buf != nullptr);
+        *static_cast<uint8_t*>(buf->data()) = i;
+        ASSERT_TRUE(write_port->try_push(buf));
+
+        // Half of the buffers arrive when the listener has stopped spinning and is blocked
+        if (i % 2 == 0)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    }
+
+    while (received_count.load() < num_buffers)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    listener->close();
+    thread_listener.join();
+}
+
+TEST_F(SHMTransportTests, listener_try_pop)
+{
+    const std::string domain_name("SHMTests");
+
+    auto shared_mem_manager = SharedMemManager::create(domain_name);
+    auto segment = shared_mem_manager->create_segment(1024, 16);
+
+    shared_mem_manager->remove_port(0);
+    auto read_port = shared_mem_manager->open_port(0, 16, 1000, SharedMemGlobal::Port::OpenMode::ReadExclusive);
+    auto listener = read_port->create_listener();
+    auto write_port = shared_mem_manager->open_port(0, 16, 1000, SharedMemGlobal::Port::OpenMode::Write);
+
+    // Empty port does not block
+    ASSERT_TRUE(listener->try_pop() == nullptr);
+
+    for (uint8_t i = 1; i <= 3; i++)
+    {
+        auto buf = segment->alloc_buffer(1, std::chrono::steady_clock::now() + std::chrono::milliseconds(100));
+        ASSERT_TRUE(buf != nullptr);
+        *static_cast<uint8_t*>(buf->data()) = i;
+        ASSERT_TRUE(write_port->try_push(buf));
+    }
+
+    for (uint8_t i = 1; i <= 3; i++)
+    {
+        auto buf = listener->try_pop();
+        ASSERT_TRUE(buf != nullptr);
+        ASSERT_EQ(i, *static_cast<uint8_t*>(buf->data()));
+        buf.reset();
+        listener->stop_processing_buffer();
+    }
+
+    ASSERT_TRUE(listener->try_pop() == nullptr);
+
+    listener->close();
+    ASSERT_TRUE(listener->try_pop() == nullptr);
+}
+
+TEST_F(SHMTransportTests, busy_polled_channel_uses_receive_override)
+{
+    class CountingReceiver : public TransportReceiverInterface
+    {
+    public:
+
+        void OnDataReceived(
+                const octet*,
+                const uint32_t,
+                const Locator&,
+                const Locator&) override
+        {
+            sem.post();
+        }
+
+        Semaphore sem;
+    };
+
+    const std::string domain_name("SHMTests");
+
+    auto shared_mem_manager = SharedMemManager::create(domain_name);
+    auto segment = shared_mem_manager->create_segment(1024, 16);
+
+    shared_mem_manager->remove_port(0);
+    auto read_port = shared_mem_manager->open_port(0, 16, 1000, SharedMemGlobal::Port::OpenMode::ReadExclusive);
+    auto write_port = shared_mem_manager->open_port(0, 16, 1000, SharedMemGlobal::Port::OpenMode::Write);
+
+    BusyPollAttributes att;
+    att.enabled = true;
+    BusyPoller poller(att);
+
+    Locator_t locator;
+    locator.kind = LOCATOR_KIND_SHM;
+    CountingReceiver receiver;
+    uint32_t big_buffer_count = 0;
+    test_SharedMemChannelResource channel(read_port->create_listener(), locator, &receiver, 8, &big_buffer_count,
+            &poller);
+
+    // The buffers popped by the poller go through the Receive override of the channel
+    for (uint32_t size : {16u, 1u, 8u})
+    {
+        auto buf = segment->alloc_buffer(size, std::chrono::steady_clock::now() + std::chrono::milliseconds(100));
+        ASSERT_TRUE(buf != nullptr);
+        ASSERT_TRUE(write_port->try_push(buf));
+        receiver.sem.wait();
+    }
+    EXPECT_EQ(2u, big_buffer_count);
+
+    channel.disable();
+    channel.release();
+    channel.clear();
+}
+
+TEST_F(SHMTransportTests, send_loaned_buffer)
+{
+    descriptor.zero_copy_min_size(64);
+    SharedMemTransport transportUnderTest(descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    // Small messages are copied
+    ASSERT_TRUE(transportUnderTest.loan_buffer(32) == nullptr);
+
+    // Listen on the port the transport sends to, in the domain of the transport
+    auto shared_mem_manager = SharedMemManager::create("fastrtps");
+    shared_mem_manager->remove_port(g_default_port);
+    auto read_port = shared_mem_manager->open_port(g_default_port, 16, 1000,
+                    SharedMemGlobal::Port::OpenMode::ReadExclusive);
+    auto listener = read_port->create_listener();
+
+    Locator_t unicastLocator;
+    unicastLocator.kind = LOCATOR_KIND_SHM;
+    unicastLocator.port = g_default_port;
+
+    Locator_t outputChannelLocator;
+    outputChannelLocator.kind = LOCATOR_KIND_SHM;
+    outputChannelLocator.port = g_default_port + 1;
+
+    eprosima::fastrtps::rtps::SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, outputChannelLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    octet* message = transportUnderTest.loan_buffer(256);
+    ASSERT_TRUE(message != nullptr);
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        message[i] = static_cast<octet>(i);
+    }
+
+    LocatorList locator_list;
+    locator_list.push_back(unicastLocator);
+    Locators locators_begin(locator_list.begin());
+    Locators locators_end(locator_list.end());
+    EXPECT_TRUE(send_resource_list.at(0)->send(message, 100, &locators_begin, &locators_end,
+            (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+
+    // The listener references the loaned buffer, so it sees changes made after sending
+    message[0] = 0xFF;
+    transportUnderTest.return_loan(message);
+
+    auto buf = listener->try_pop();
+    ASSERT_TRUE(buf != nullptr);
+    ASSERT_EQ(100u, buf->size());
+    const octet* received = static_cast<const octet*>(buf->data());
+    EXPECT_EQ(0xFF, received[0]);
+    for (uint32_t i = 1; i < 100; ++i)
+    {
+        EXPECT_EQ(static_cast<octet>(i), received[i]);
+    }
+    buf.reset();
+    listener->stop_processing_buffer();
+
+    listener->close();
+}
+
+TEST_F(SHMTransportTests, segment_memory_policy)
+{
+    const std::string domain_name("SHMTests");
+
+    auto shared_mem_manager = SharedMemManager::create(domain_name);
+
+    // Unsupported options only log warnings, so the segment is always usable
+    SharedMemSegment::MemoryPolicy memory_policy;
+    memory_policy.huge_pages = true;
+    memory_policy.numa_node = 0;
+    memory_policy.prefault = true;
+    auto segment = shared_mem_manager->create_segment(64 * 1024, 16, memory_policy);
+
+    shared_mem_manager->remove_port(0);
+    auto read_port = shared_mem_manager->open_port(0, 16, 1000, SharedMemGlobal::Port::OpenMode::ReadExclusive);
+    auto listener = read_port->create_listener();
+    auto write_port = shared_mem_manager->open_port(0, 16, 1000, SharedMemGlobal::Port::OpenMode::Write);
+
+    for (uint8_t i = 1; i <= 8; i++)
+    {
+        auto buf = segment->alloc_buffer(4096, std::chrono::steady_clock::now() + std::chrono::milliseconds(100));
+        ASSERT_TRUE(buf != nullptr);
+        memset(buf->data(), i, 4096);
+        ASSERT_TRUE(write_port->try_push(buf));
+    }
+
+    for (uint8_t i = 1; i <= 8; i++)
+    {
+        auto buf = listener->try_pop();
+        ASSERT_TRUE(buf != nullptr);
+        ASSERT_EQ(4096u, buf->size());
+        ASSERT_EQ(i, static_cast<uint8_t*>(buf->data())[4095]);
+        buf.reset();
+        listener->stop_processing_buffer();
+    }
+
+    listener->close();
+}
+
 TEST_F(SHMTransportTests, empty_cv_mutex_deadlocked_try_push)
 {
     const std::string domain_name("SHMTests");
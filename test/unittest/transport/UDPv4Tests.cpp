@@ -14,6 +14,7 @@
 
 #include <thread>
 #include <memory>
+#include <vector>
 
 #include <asio.hpp>
 #include <gtest/gtest.h>
@@ -438,6 +439,122 @@ TEST_F(UDPv4Tests, send_and_receive_between_allowed_sockets_using_localhost)
     sem.wait();
 }
 
+TEST_F(UDPv4Tests, send_and_receive_in_batches_with_several_sockets_per_port)
+{
+    descriptor.interfaceWhiteList.emplace_back("127.0.0.1");
+    descriptor.receive_batch_size = 8;
+    descriptor.receive_threads_per_port = 2;
+    UDPv4Transport transportUnderTest(descriptor);
+    transportUnderTest.init();
+
+    Locator_t unicastLocator;
+    unicastLocator.port = g_default_port;
+    unicastLocator.kind = LOCATOR_KIND_UDPv4;
+    IPLocator::setIPv4(unicastLocator, "127.0.0.1");
+
+    LocatorList_t locator_list;
+    locator_list.push_back(unicastLocator);
+
+    Locator_t outputChannelLocator;
+    outputChannelLocator.port = g_default_port + 1;
+    outputChannelLocator.kind = LOCATOR_KIND_UDPv4;
+    IPLocator::setIPv4(outputChannelLocator, "127.0.0.1");
+
+    MockReceiverResource receiver(transportUnderTest, unicastLocator);
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+    ASSERT_TRUE(transportUnderTest.IsInputChannelOpen(unicastLocator));
+
+    // The port is still exclusive to this transport, even if its sockets share it
+    UDPv4Transport otherTransport(descriptor);
+    otherTransport.init();
+    MockReceiverResource otherReceiver(otherTransport, unicastLocator);
+    ASSERT_FALSE(otherTransport.IsInputChannelOpen(unicastLocator));
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, outputChannelLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+    const int num_messages = 20;
+
+    Semaphore sem;
+    std::function<void()> recCallback = [&]()
+            {
+                EXPECT_EQ(memcmp(message, msg_recv->data, 5), 0);
+                sem.post();
+            };
+
+    msg_recv->setCallback(recCallback);
+
+    auto sendThreadFunction = [&]()
+            {
+                for (int i = 0; i < num_messages; ++i)
+                {
+                    Locators locators_begin(locator_list.begin());
+                    Locators locators_end(locator_list.end());
+
+                    EXPECT_TRUE(send_resource_list.at(0)->send(message, 5, &locators_begin, &locators_end,
+                            (std::chrono::steady_clock::now() + std::chrono::microseconds(100))));
+                }
+            };
+
+    senderThread.reset(new std::thread(sendThreadFunction));
+    senderThread->join();
+    for (int i = 0; i < num_messages; ++i)
+    {
+        sem.wait();
+    }
+}
+
+TEST_F(UDPv4Tests, send_to_several_locators_at_once)
+{
+    descriptor.interfaceWhiteList.emplace_back("127.0.0.1");
+    UDPv4Transport transportUnderTest(descriptor);
+    transportUnderTest.init();
+
+    const uint16_t num_locators = 3;
+    LocatorList_t locator_list;
+    std::vector<std::unique_ptr<MockReceiverResource>> receivers;
+    Semaphore sem;
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+
+    for (uint16_t i = 0; i < num_locators; ++i)
+    {
+        Locator_t unicastLocator;
+        unicastLocator.port = g_default_port + 2 + i;
+        unicastLocator.kind = LOCATOR_KIND_UDPv4;
+        IPLocator::setIPv4(unicastLocator, "127.0.0.1");
+        locator_list.push_back(unicastLocator);
+
+        receivers.emplace_back(new MockReceiverResource(transportUnderTest, unicastLocator));
+        MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receivers.back()->CreateMessageReceiver());
+        ASSERT_TRUE(transportUnderTest.IsInputChannelOpen(unicastLocator));
+        msg_recv->setCallback([&message, &sem, msg_recv]()
+                {
+                    EXPECT_EQ(memcmp(message, msg_recv->data, 5), 0);
+                    sem.post();
+                });
+    }
+
+    Locator_t outputChannelLocator;
+    outputChannelLocator.port = g_default_port + 1;
+    outputChannelLocator.kind = LOCATOR_KIND_UDPv4;
+    IPLocator::setIPv4(outputChannelLocator, "127.0.0.1");
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, outputChannelLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    Locators locators_begin(locator_list.begin());
+    Locators locators_end(locator_list.end());
+    EXPECT_TRUE(send_resource_list.at(0)->send(message, 5, &locators_begin, &locators_end,
+            (std::chrono::steady_clock::now() + std::chrono::microseconds(100))));
+
+    for (uint16_t i = 0; i < num_locators; ++i)
+    {
+        sem.wait();
+    }
+}
+
 TEST_F(UDPv4Tests, send_and_receive_between_allowed_sockets_using_unicast)
 {
     std::vector<IPFinder::info_IP> interfaces;
@@ -0,0 +1,137 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <utils/collections/ConcurrentFlatMap.hpp>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+
+// Hash sending every key to a few buckets, so probe sequences overlap and wrap around the table
+struct CollidingHash
+{
+    size_t operator ()(
+            uint32_t key) const
+    {
+        return (key % 4) + 29;
+    }
+
+};
+
+TEST(ConcurrentFlatMapTests, find_or_insert)
+{
+    ConcurrentFlatMap<uint32_t, uint32_t> uut(4);
+    EXPECT_EQ(0u, uut.size());
+    EXPECT_EQ(4u, uut.max_size());
+    EXPECT_EQ(nullptr, uut.find(1u));
+
+    uint32_t* value = uut.find_or_insert(1u);
+    ASSERT_NE(nullptr, value);
+    EXPECT_EQ(0u, *value);
+    *value = 10u;
+
+    EXPECT_EQ(value, uut.find_or_insert(1u));
+    EXPECT_EQ(value, uut.find(1u));
+    EXPECT_EQ(1u, uut.size());
+
+    // Table full
+    ASSERT_NE(nullptr, uut.find_or_insert(2u));
+    ASSERT_NE(nullptr, uut.find_or_insert(3u));
+    ASSERT_NE(nullptr, uut.find_or_insert(4u));
+    EXPECT_EQ(nullptr, uut.find_or_insert(5u));
+    EXPECT_EQ(4u, uut.size());
+
+    // Existing keys are still found
+    EXPECT_EQ(value, uut.find_or_insert(1u));
+    EXPECT_EQ(10u, *uut.find(1u));
+
+    uint32_t sum = 0;
+    uut.for_each([&sum](const uint32_t& key, uint32_t&)
+            {
+                sum += key;
+            });
+    EXPECT_EQ(10u, sum);
+}
+
+TEST(ConcurrentFlatMapTests, colliding_keys)
+{
+    ConcurrentFlatMap<uint32_t, uint32_t, CollidingHash> uut(16);
+
+    for (uint32_t key = 0; key < 16; ++key)
+    {
+        uint32_t* value = uut.find_or_insert(key);
+        ASSERT_NE(nullptr, value);
+        *value = key * 10;
+    }
+
+    for (uint32_t key = 0; key < 16; ++key)
+    {
+        ASSERT_NE(nullptr, uut.find(key));
+        EXPECT_EQ(key * 10, *uut.find(key));
+    }
+    EXPECT_EQ(nullptr, uut.find(16u));
+    EXPECT_EQ(nullptr, uut.find_or_insert(16u));
+}
+
+TEST(ConcurrentFlatMapTests, concurrent_counters)
+{
+    constexpr uint32_t num_threads = 4;
+    constexpr uint32_t num_keys = 64;
+    constexpr uint32_t num_rounds = 1000;
+
+    ConcurrentFlatMap<uint32_t, std::atomic<uint64_t>, CollidingHash> uut(num_keys);
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < num_threads; ++i)
+    {
+        threads.emplace_back([&uut]()
+                {
+                    for (uint32_t round = 0; round < num_rounds; ++round)
+                    {
+                        for (uint32_t key = 0; key < num_keys; ++key)
+                        {
+                            std::atomic<uint64_t>* value = uut.find_or_insert(key);
+                            ASSERT_NE(nullptr, value);
+                            value->fetch_add(1, std::memory_order_relaxed);
+                        }
+                    }
+                });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Every key was added once, and no increment was lost
+    EXPECT_EQ(num_keys, uut.size());
+    uint32_t keys = 0;
+    uut.for_each([&keys](const uint32_t&, std::atomic<uint64_t>& value)
+            {
+                ++keys;
+                EXPECT_EQ(num_threads * num_rounds, value.load());
+            });
+    EXPECT_EQ(num_keys, keys);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
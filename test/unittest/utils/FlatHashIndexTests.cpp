@@ -0,0 +1,140 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/utils/collections/FlatHashIndex.hpp>
+#include <fastdds/rtps/common/InstanceHandle.h>
+#include <gtest/gtest.h>
+
+using namespace eprosima::fastrtps;
+using eprosima::fastrtps::rtps::InstanceHandle_t;
+
+// Hash sending every key to a few buckets, so probe sequences overlap and wrap around the table
+struct CollidingHash
+{
+    size_t operator ()(
+            uint32_t key) const
+    {
+        return (key % 4) + 13;
+    }
+
+};
+
+TEST(FlatHashIndexTests, insert_find_erase)
+{
+    FlatHashIndex<uint32_t, uint32_t> uut;
+    EXPECT_TRUE(uut.empty());
+    EXPECT_EQ(nullptr, uut.find(1u));
+    EXPECT_FALSE(uut.erase(1u));
+
+    EXPECT_TRUE(uut.insert(1u, 10u));
+    EXPECT_TRUE(uut.insert(2u, 20u));
+    EXPECT_FALSE(uut.insert(1u, 30u));
+    EXPECT_EQ(2u, uut.size());
+
+    ASSERT_NE(nullptr, uut.find(1u));
+    EXPECT_EQ(10u, *uut.find(1u));
+    ASSERT_NE(nullptr, uut.find(2u));
+    EXPECT_EQ(20u, *uut.find(2u));
+
+    *uut.find(2u) = 40u;
+    EXPECT_EQ(40u, *uut.find(2u));
+
+    EXPECT_TRUE(uut.erase(1u));
+    EXPECT_FALSE(uut.erase(1u));
+    EXPECT_EQ(nullptr, uut.find(1u));
+    EXPECT_EQ(1u, uut.size());
+
+    uut.clear();
+    EXPECT_TRUE(uut.empty());
+    EXPECT_EQ(nullptr, uut.find(2u));
+}
+
+TEST(FlatHashIndexTests, grow)
+{
+    FlatHashIndex<uint32_t, uint32_t> uut(1u);
+    for (uint32_t i = 0; i < 1000u; ++i)
+    {
+        ASSERT_TRUE(uut.insert(i, i * 2u));
+    }
+    EXPECT_EQ(1000u, uut.size());
+
+    for (uint32_t i = 0; i < 1000u; ++i)
+    {
+        ASSERT_NE(nullptr, uut.find(i));
+        EXPECT_EQ(i * 2u, *uut.find(i));
+    }
+    EXPECT_EQ(nullptr, uut.find(1000u));
+}
+
+TEST(FlatHashIndexTests, erase_with_collisions)
+{
+    // Remove keys in different orders from overlapping probe sequences, checking all the remaining keys are found
+    for (uint32_t first_removed = 0; first_removed < 12u; ++first_removed)
+    {
+        FlatHashIndex<uint32_t, uint32_t, CollidingHash> uut;
+        for (uint32_t i = 0; i < 12u; ++i)
+        {
+            ASSERT_TRUE(uut.insert(i, i));
+        }
+
+        for (uint32_t n = 0; n < 12u; ++n)
+        {
+            uint32_t removed = (first_removed + n * 5u) % 12u;
+            ASSERT_TRUE(uut.erase(removed));
+            ASSERT_EQ(nullptr, uut.find(removed));
+
+            for (uint32_t m = n + 1; m < 12u; ++m)
+            {
+                uint32_t remaining = (first_removed + m * 5u) % 12u;
+                ASSERT_NE(nullptr, uut.find(remaining));
+                EXPECT_EQ(remaining, *uut.find(remaining));
+            }
+        }
+
+        EXPECT_TRUE(uut.empty());
+    }
+}
+
+TEST(FlatHashIndexTests, instance_handle_keys)
+{
+    FlatHashIndex<InstanceHandle_t, int> uut;
+
+    // Short keys are zero padded, so they only differ on the first bytes
+    for (int i = 0; i < 256; ++i)
+    {
+        InstanceHandle_t handle;
+        handle.value[0] = static_cast<uint8_t>(i);
+        ASSERT_TRUE(uut.insert(handle, i));
+    }
+
+    for (int i = 0; i < 256; ++i)
+    {
+        InstanceHandle_t handle;
+        handle.value[0] = static_cast<uint8_t>(i);
+        ASSERT_NE(nullptr, uut.find(handle));
+        EXPECT_EQ(i, *uut.find(handle));
+    }
+
+    InstanceHandle_t other;
+    other.value[15] = 1;
+    EXPECT_EQ(nullptr, uut.find(other));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,167 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <utils/PartitionMatcher.hpp>
+
+#include <fastrtps/utils/StringMatching.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+using eprosima::fastdds::dds::PartitionQosPolicy;
+
+static const std::vector<std::string> expressions =
+{
+    "",
+    "*",
+    "**",
+    "?",
+    "foo",
+    "foo/bar/baz",
+    "foo*",
+    "fo*o",
+    "*baz",
+    "foo/*/baz",
+    "foo/bar/ba?",
+    "*ba?*",
+    "foo\\bar\\baz",
+    "*bar",
+    "a*b*c",
+    "*a*a*a",
+    "aaa",
+    "abc",
+    "aXbYc",
+    "[fb]oo",
+    "b[!a]r",
+    "FOO/BAR/QUX",
+    "a\\*",
+    "a*",
+    "a\\b",
+    "ab"
+};
+
+static PartitionQosPolicy partitions(
+        const std::vector<const char*>& names)
+{
+    PartitionQosPolicy qos;
+    for (const char* name : names)
+    {
+        qos.push_back(name);
+    }
+    return qos;
+}
+
+TEST(PartitionMatcherTests, kinds)
+{
+#if !defined(_WIN32)
+    EXPECT_EQ(PartitionMatcher::Kind::LITERAL, PartitionMatcher("foo").kind());
+    EXPECT_EQ(PartitionMatcher::Kind::PREFIX, PartitionMatcher("foo*").kind());
+    EXPECT_EQ(PartitionMatcher::Kind::PREFIX, PartitionMatcher("*").kind());
+    EXPECT_EQ(PartitionMatcher::Kind::WILDCARD, PartitionMatcher("*foo").kind());
+    EXPECT_EQ(PartitionMatcher::Kind::WILDCARD, PartitionMatcher("f?o").kind());
+    EXPECT_EQ(PartitionMatcher::Kind::GLOB, PartitionMatcher("[fb]oo").kind());
+    EXPECT_EQ(PartitionMatcher::Kind::GLOB, PartitionMatcher("a\\*").kind());
+    EXPECT_EQ(PartitionMatcher::Kind::GLOB, PartitionMatcher("a\\b").kind());
+#endif // if !defined(_WIN32)
+}
+
+TEST(PartitionMatcherTests, backslashes)
+{
+#if !defined(_WIN32)
+    // Expressions with backslashes follow the escaping rules of StringMatching, which takes them literally
+    EXPECT_TRUE(PartitionMatcher("a\\*").matches_name("a\\b"));
+    EXPECT_FALSE(PartitionMatcher("a\\*").matches_name("a*"));
+    EXPECT_TRUE(PartitionMatcher("a\\b").matches_name("a\\b"));
+    EXPECT_FALSE(PartitionMatcher("a\\b").matches_name("ab"));
+#endif // if !defined(_WIN32)
+}
+
+TEST(PartitionMatcherTests, same_results_as_string_matching)
+{
+    for (const std::string& lhs : expressions)
+    {
+        PartitionMatcher lhs_matcher(lhs.c_str());
+        for (const std::string& rhs : expressions)
+        {
+            PartitionMatcher rhs_matcher(rhs.c_str());
+            EXPECT_EQ(StringMatching::matchPattern(lhs.c_str(), rhs.c_str()), lhs_matcher.matches_name(rhs.c_str()))
+                << "pattern '" << lhs << "' name '" << rhs << "'";
+            EXPECT_EQ(StringMatching::matchString(lhs.c_str(), rhs.c_str()), lhs_matcher.matches(rhs_matcher))
+                << "'" << lhs << "' and '" << rhs << "'";
+        }
+    }
+}
+
+TEST(PartitionMatcherTests, partition_sets)
+{
+    PartitionMatcherCache cache;
+    PartitionQosPolicy none;
+
+    EXPECT_TRUE(cache.match(none, none));
+    EXPECT_FALSE(cache.match(none, partitions({"foo"})));
+    EXPECT_FALSE(cache.match(partitions({"foo*"}), none));
+    EXPECT_TRUE(cache.match(partitions({"foo"}), partitions({"bar", "foo"})));
+    EXPECT_TRUE(cache.match(partitions({"foo", "b*"}), partitions({"bar"})));
+    EXPECT_FALSE(cache.match(partitions({"foo", "b*"}), partitions({"qux", "a*"})));
+    EXPECT_TRUE(cache.match(partitions({"*x", "b?r"}), partitions({"a*", "bar"})));
+
+    // Results of wildcard pairs are reused
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        EXPECT_TRUE(cache.match(partitions({"*a*", "*b*"}), partitions({"*c*", "b?"})));
+        EXPECT_FALSE(cache.match(partitions({"*a*", "*b*"}), partitions({"c?", "?d"})));
+    }
+    EXPECT_EQ(13u, cache.compiled_expressions());
+}
+
+TEST(PartitionMatcherTests, memoized_pairs_limit)
+{
+    PartitionMatcherCache cache(2);
+    PartitionQosPolicy writer = partitions({"*a", "*b", "*c"});
+
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        EXPECT_FALSE(cache.match(writer, partitions({"?x", "?y"})));
+        EXPECT_TRUE(cache.match(writer, partitions({"?x", "?c"})));
+    }
+}
+
+TEST(PartitionMatcherTests, compiled_expressions_limit)
+{
+    PartitionMatcherCache cache(4096, 4);
+    PartitionQosPolicy reader = partitions({"*1", "*2"});
+
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        std::string name = "name" + std::to_string(i);
+        PartitionQosPolicy writer = partitions({name.c_str()});
+        EXPECT_EQ(1 == i % 10 || 2 == i % 10, cache.match(writer, reader)) << name;
+        EXPECT_GE(4u, cache.compiled_expressions());
+    }
+
+    // Results are still right after the memoized pairs have been discarded
+    EXPECT_TRUE(cache.match(partitions({"name1"}), reader));
+    EXPECT_FALSE(cache.match(partitions({"name3"}), reader));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
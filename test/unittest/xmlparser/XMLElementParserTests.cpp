@@ -1611,6 +1611,36 @@ TEST_F(XMLParserTests, getXMLPublishModeQosSynchronousKind)
     EXPECT_EQ(publishMode.kind, PublishModeQosPolicyKind::SYNCHRONOUS_PUBLISH_MODE);
 }
 
+/*
+ * This test checks the positive case of configuration via XML of the publish mode priority.
+ * 1. Check that the XML return code is correct for the publish mode setting.
+ * 2. Check that the publish mode kind is set to ASYNCHRONOUS_PUBLISH_MODE.
+ * 3. Check that the publish mode priority is set to the configured value.
+ */
+TEST_F(XMLParserTests, getXMLPublishModeQosPriority)
+{
+    uint8_t ident = 1;
+    PublishModeQosPolicy publishMode;
+    tinyxml2::XMLDocument xml_doc;
+    tinyxml2::XMLElement* titleElement;
+
+    // XML snippet
+    const char* xml =
+            "\
+            <publishMode>\
+                <kind>ASYNCHRONOUS</kind>\
+                <priority>-5</priority>\
+            </publishMode>\
+            ";
+
+    // Load the xml
+    ASSERT_EQ(tinyxml2::XMLError::XML_SUCCESS, xml_doc.Parse(xml));
+    titleElement = xml_doc.RootElement();
+    EXPECT_EQ(XMLP_ret::XML_OK, XMLParserTest::getXMLPublishModeQos_wrapper(titleElement, publishMode, ident));
+    EXPECT_EQ(publishMode.kind, PublishModeQosPolicyKind::ASYNCHRONOUS_PUBLISH_MODE);
+    EXPECT_EQ(publishMode.priority, -5);
+}
+
 /*
  * This test checks the positive case of configuration via XML of the history memory policy.
  * 1. Check that the XML return code is correct for the history memory policy setting.
@@ -3287,6 +3317,7 @@ TEST_F(XMLParserTests, getXMLEnum_positive)
  * 7. Correct parsing of a valid <data_sharing> set to AUTO with shared memory directory.
  * 8. Correct parsing of a valid <data_sharing> set to ON with shared memory directory.
  * 9. Correct parsing of a valid <data_sharing> set to OFF with shared memory directory.
+ * 10. Correct parsing of a valid <data_sharing> with memory placement options.
  */
 TEST_F(XMLParserTests, getXMLDataSharingQos)
 {
@@ -3427,6 +3458,26 @@ TEST_F(XMLParserTests, getXMLDataSharingQos)
         EXPECT_EQ(datasharing_policy.max_domains(), 0u);
         EXPECT_EQ(datasharing_policy.domain_ids().size(), 0u);
     }
+
+    {
+        const char* xml =
+                "\
+                <data_sharing>\
+                    <kind>AUTOMATIC</kind>\
+                    <huge_pages>true</huge_pages>\
+                    <numa_node>1</numa_node>\
+                    <prefault>true</prefault>\
+                </data_sharing>\
+                ";
+
+        ASSERT_EQ(tinyxml2::XMLError::XML_SUCCESS, xml_doc.Parse(xml));
+        titleElement = xml_doc.RootElement();
+        EXPECT_EQ(XMLP_ret::XML_OK, XMLParserTest::propertiesPolicy_wrapper(titleElement, datasharing_policy, ident));
+        EXPECT_EQ(datasharing_policy.kind(), DataSharingKind::AUTO);
+        EXPECT_TRUE(datasharing_policy.huge_pages());
+        EXPECT_EQ(datasharing_policy.numa_node(), 1);
+        EXPECT_TRUE(datasharing_policy.prefault());
+    }
 }
 
 /*
@@ -559,6 +559,8 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                     <receiveBufferSize>8192</receiveBufferSize>\
                     <TTL>250</TTL>\
                     <non_blocking_send>false</non_blocking_send>\
+                    <receive_batch_size>32</receive_batch_size>\
+                    <receive_threads_per_port>4</receive_threads_per_port>\
                     <maxMessageSize>16384</maxMessageSize>\
                     <maxInitialPeersRange>100</maxInitialPeersRange>\
                     <interfaceWhiteList>\
@@ -586,7 +588,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                     <rtps_dump_file>rtsp_messages.log</rtps_dump_file>\
                 </transport_descriptor>\
                 ";
-        char xml[2000];
+        char xml[2500];
 
         // UDPv4
         sprintf(xml, xml_p, "4");
@@ -600,6 +602,8 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pUDPv4Desc->receiveBufferSize, 8192u);
         EXPECT_EQ(pUDPv4Desc->TTL, 250u);
         EXPECT_EQ(pUDPv4Desc->non_blocking_send, false);
+        EXPECT_EQ(pUDPv4Desc->receive_batch_size, 32u);
+        EXPECT_EQ(pUDPv4Desc->receive_threads_per_port, 4u);
         EXPECT_EQ(pUDPv4Desc->max_message_size(), 16384u);
         EXPECT_EQ(pUDPv4Desc->max_initial_peers_range(), 100u);
         EXPECT_EQ(pUDPv4Desc->interfaceWhiteList[0], "192.168.1.41");
@@ -620,6 +624,8 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pUDPv6Desc->receiveBufferSize, 8192u);
         EXPECT_EQ(pUDPv6Desc->TTL, 250u);
         EXPECT_EQ(pUDPv6Desc->non_blocking_send, false);
+        EXPECT_EQ(pUDPv6Desc->receive_batch_size, 32u);
+        EXPECT_EQ(pUDPv6Desc->receive_threads_per_port, 4u);
         EXPECT_EQ(pUDPv6Desc->max_message_size(), 16384u);
         EXPECT_EQ(pUDPv6Desc->max_initial_peers_range(), 100u);
         EXPECT_EQ(pUDPv6Desc->interfaceWhiteList[0], "192.168.1.41");
@@ -734,6 +740,11 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                     <port_queue_capacity>512</port_queue_capacity>\
                     <healthy_check_timeout_ms>1000</healthy_check_timeout_ms>\
                     <rtps_dump_file>rtsp_messages.log</rtps_dump_file>\
+                    <futex_notification>true</futex_notification>\
+                    <notification_spin_us>20</notification_spin_us>\
+                    <zero_copy_min_size>65536</zero_copy_min_size>\
+                    <huge_pages>true</huge_pages>\
+                    <numa_node>0</numa_node>\
                     <maxMessageSize>16384</maxMessageSize>\
                     <maxInitialPeersRange>100</maxInitialPeersRange>\
                 </transport_descriptor>\
@@ -749,6 +760,11 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pSHMDesc->port_queue_capacity(), 512u);
         EXPECT_EQ(pSHMDesc->healthy_check_timeout_ms(), 1000u);
         EXPECT_EQ(pSHMDesc->rtps_dump_file(), "rtsp_messages.log");
+        EXPECT_TRUE(pSHMDesc->futex_notification());
+        EXPECT_EQ(pSHMDesc->notification_spin_us(), 20u);
+        EXPECT_EQ(pSHMDesc->zero_copy_min_size(), 65536u);
+        EXPECT_TRUE(pSHMDesc->huge_pages());
+        EXPECT_EQ(pSHMDesc->numa_node(), 0);
         EXPECT_EQ(pSHMDesc->max_message_size(), 16384u);
         EXPECT_EQ(pSHMDesc->max_initial_peers_range(), 100u);
 
@@ -814,6 +830,11 @@ TEST_F(XMLParserTests, parseXMLTransportData_NegativeClauses)
         "port_queue_capacity",
         "healthy_check_timeout_ms",
         "rtps_dump_file",
+        "futex_notification",
+        "notification_spin_us",
+        "zero_copy_min_size",
+        "huge_pages",
+        "numa_node",
         "bad_element"
     };
 